@@ -3,19 +3,40 @@
 
 #include <Arduino.h>
 #include "Blitter.h"
+#include "AssetSrc.h"
 
-// A flexible animation of N frames. Each frame is a 4-bpp sprite with its own palette.
+// A flexible animation of N frames. Each frame is a 4-bpp sprite with its own palette,
+// or one palette for the whole animation when its frames were built to share it.
+// A delta frame (tools/ca_assetc -delta) shares its keyframe's data and lists
+// the row spans where it differs; the renderer swaps them in per scanline.
+// A streamed frame (src set) keeps its rows in an asset pack instead, read
+// through the CA_Asset row cache; it has no data and no delta
 struct CA_Frame4 {
-  const uint8_t* data;       // PROGMEM 4-bpp
+  const uint8_t* data;       // PROGMEM 4-bpp (a delta frame: its keyframe's)
   const uint16_t* pal565;    // PROGMEM palette[16]
   uint16_t w, h;             // in VIRTUAL pixels <<--- important when scaling!
+  const uint8_t* delta;      // PROGMEM rows that differ from data, or nullptr
+#if CA_ASSET_STREAM
+  CA_AssetSrc* src;          // rows come from here at `off`, or nullptr
+  uint32_t off;
+#endif
 };
 
+// Brace initializers naming every CA_Frame4 member: a frame in flash (delta
+// nullptr for a keyframe) and a frame streamed from src at off
+#if CA_ASSET_STREAM
+  #define CA_FRAME4(data, pal, w, h, delta)   { data, pal, w, h, delta, nullptr, 0 }
+  #define CA_FRAME4_SRC(pal, w, h, src, off)  { nullptr, pal, w, h, nullptr, src, off }
+#else
+  #define CA_FRAME4(data, pal, w, h, delta)   { data, pal, w, h, delta }
+#endif
+
 struct CA_Anim4 {
   const CA_Frame4* frames;   // array of frames
   uint8_t count;             // number of frames
   uint16_t frameMs;          // per-frame duration
   uint8_t loop : 1;          // loop animation
+  const uint16_t* pal565;    // PROGMEM palette[16] every frame uses, or nullptr
 };
 
 // Advance and get current frame index
@@ -27,6 +48,57 @@ inline uint8_t frameAt(const CA_Anim4& a, uint32_t startMs, uint32_t nowMs){
   if (!a.loop && idx >= a.count) return a.count-1;
   return (uint8_t)(idx % a.count);
 }
+
+// ---- Streamed frames ----
+#if CA_ASSET_STREAM
+// Row `row` of a streamed frame, in RAM until the next CA_Asset read
+inline const uint8_t* streamRow(const CA_Frame4& f, int16_t row){
+  return CA_Asset::row(f.src, f.off, (uint16_t)((f.w + 1) >> 1), (uint16_t)row, f.h);
+}
+#endif
+
+// ---- Delta frames ----
+// Row `row` of f: the keyframe's bytes at the returned pointer, except bytes
+// [b0, b1), which come from span (b0 == b1: the keyframe's row as is)
+inline const uint8_t* deltaRow(const CA_Frame4& f, int16_t row,
+                               uint8_t& b0, uint8_t& b1, const uint8_t*& span){
+  b0 = b1 = 0;
+  const uint8_t* key = f.data + (uint16_t)row * (uint16_t)((f.w + 1) >> 1);
+  if (!f.delta) return key;
+  const uint8_t y0 = pgm_read_byte(f.delta), n = pgm_read_byte(f.delta + 1);
+  const uint8_t r = (uint8_t)(row - y0);
+  if (row < y0 || r >= n) return key;
+  const uint8_t* e = f.delta + 4 + (uint16_t)r * 4;
+  b0 = pgm_read_byte(e); b1 = pgm_read_byte(e + 1);
+  span = f.delta + 4 + (uint16_t)n * 4 + (uint16_t)(pgm_read_byte(e + 2) | (pgm_read_byte(e + 3) << 8));
+  return key;
+}
+
+// Pixels where f differs from its keyframe, [x0, x1) × [y0, y1); false if
+// none (a keyframe, or a frame equal to it)
+inline bool deltaBounds(const CA_Frame4& f, int16_t& x0, int16_t& y0, int16_t& x1, int16_t& y1){
+  if (!f.delta) return false;
+  const uint8_t n = pgm_read_byte(f.delta + 1);
+  if (!n) return false;
+  y0 = pgm_read_byte(f.delta);          y1 = (int16_t)(y0 + n);
+  x0 = pgm_read_byte(f.delta + 2);      x1 = pgm_read_byte(f.delta + 3);
+  return true;
+}
+
+// Palette index at (x, y), delta applied
+inline uint8_t pixelAt(const CA_Frame4& f, uint16_t x, uint16_t y){
+#if CA_ASSET_STREAM
+  if (f.src) {
+    const uint8_t b = streamRow(f, (int16_t)y)[x >> 1];
+    return (x & 1) ? (uint8_t)(b & 0x0F) : (uint8_t)(b >> 4);
+  }
+#endif
+  uint8_t b0, b1; const uint8_t* span = nullptr;
+  const uint8_t* row = deltaRow(f, (int16_t)y, b0, b1, span);
+  const uint8_t bx = (uint8_t)(x >> 1);
+  const uint8_t b = (bx >= b0 && bx < b1) ? pgm_read_byte(span + (bx - b0)) : pgm_read_byte(row + bx);
+  return (x & 1) ? (uint8_t)(b & 0x0F) : (uint8_t)(b >> 4);
+}
 } // namespace
 
 #endif
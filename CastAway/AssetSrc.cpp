@@ -0,0 +1,129 @@
+#include "AssetSrc.h"
+
+#if CA_ASSET_STREAM
+#include <string.h>
+
+CA_PackSrc CA_Asset::pack;
+
+// ---- sources ----
+#if CA_ASSET_SD
+bool CA_SdAssetSrc::open(const char* path){
+  static bool begun = false;
+  if (!begun) begun = SD.begin(CA_ASSET_SD_CS);
+  if (!begun) return false;
+  if (f) f.close();
+  f = SD.open(path, FILE_READ);
+  return (bool)f;
+}
+
+bool CA_SdAssetSrc::read(uint32_t off, uint8_t* dst, uint16_t n){
+  if (!f) return false;
+  if (f.position() != off && !f.seek(off)) return false;
+  return f.read(dst, n) == (int)n;
+}
+#else
+bool CA_FileAssetSrc::open(const char* path){
+  if (f) fclose(f);
+  f = fopen(path, "rb"); pos = 0;
+  return f != nullptr;
+}
+
+bool CA_FileAssetSrc::read(uint32_t off, uint8_t* dst, uint16_t n){
+  if (!f) return false;
+  if (pos != off && fseek(f, (long)off, SEEK_SET) != 0) { pos = 0xFFFFFFFFu; return false; }
+  const size_t got = fread(dst, 1, n, f);
+  pos = off + (uint32_t)got;
+  return got == n;
+}
+#endif
+
+// ---- row cache ----
+// A slot holds rows [r0, r0 + n) of the asset at (src, off)
+namespace {
+  struct Slot {
+    CA_AssetSrc* src;
+    uint32_t off;
+    uint16_t r0;
+    uint8_t  n, used;
+    uint8_t  px[CA_ASSET_SLOT];
+  };
+  Slot s_slots[CA_ASSET_SLOTS];
+  Slot s_pins[CA_ASSET_PINS ? CA_ASSET_PINS : 1];   // whole small assets, never replaced
+  uint8_t s_use = 0;
+  CA_Asset::Stats s_stats;
+
+  Slot* find(Slot* set, uint8_t setN, CA_AssetSrc* src, uint32_t off, uint16_t r0){
+    for (uint8_t i=0;i<setN;++i){
+      Slot& s = set[i];
+      if (s.n && s.src == src && s.off == off && s.r0 == r0) return &s;
+    }
+    return nullptr;
+  }
+
+  Slot* lru(){
+    Slot* e = s_slots;
+    for (uint8_t i=1;i<CA_ASSET_SLOTS;++i)
+      if ((uint8_t)(s_use - s_slots[i].used) > (uint8_t)(s_use - e->used)) e = &s_slots[i];
+    return e;
+  }
+
+  Slot* freePin(){
+    for (uint8_t i=0;i<CA_ASSET_PINS;++i) if (!s_pins[i].n) return &s_pins[i];
+    return nullptr;
+  }
+
+  // Read block r0 of the asset into slot e
+  Slot* load(Slot* e, CA_AssetSrc* src, uint32_t off, uint16_t len, uint16_t r0, uint16_t nRows, uint8_t per){
+    const uint8_t n = (uint8_t)((nRows - r0) < per ? (nRows - r0) : per);
+    const uint16_t bytes = (uint16_t)(n * len);
+    if (!src->read(off + (uint32_t)r0 * len, e->px, bytes)) memset(e->px, 0, bytes);
+    e->src = src; e->off = off; e->r0 = r0; e->n = n; e->used = ++s_use;
+    ++s_stats.reads; s_stats.bytes += bytes;
+    return e;
+  }
+}
+
+const uint8_t* CA_Asset::row(CA_AssetSrc* src, uint32_t off, uint16_t len, uint16_t r, uint16_t nRows){
+  const uint8_t per = (uint8_t)(CA_ASSET_SLOT / len);
+  const uint16_t r0 = (uint16_t)(r - r % per);
+  const bool whole = nRows <= per;
+  Slot* s = whole ? find(s_pins, CA_ASSET_PINS, src, off, 0) : nullptr;
+  if (s) { ++s_stats.hits; return s->px + (uint16_t)(r * len); }
+  s = find(s_slots, CA_ASSET_SLOTS, src, off, r0);
+  if (s) {
+    ++s_stats.hits;
+  } else {
+    ++s_stats.misses;
+    s = whole ? freePin() : nullptr;
+    s = load(s ? s : lru(), src, off, len, r0, nRows, per);
+  }
+  s->used = ++s_use;
+  return s->px + (uint16_t)(r - r0) * len;
+}
+
+uint16_t CA_Asset::fetchRows(uint16_t len){ return (uint16_t)(CA_ASSET_SLOTS * (CA_ASSET_SLOT / len)); }
+
+uint16_t CA_Asset::fetch(CA_AssetSrc* src, uint32_t off, uint16_t len, uint16_t r, uint16_t n, uint16_t nRows){
+  const uint8_t per = (uint8_t)(CA_ASSET_SLOT / len);
+  if (r >= nRows) return 0;
+  if (n > nRows - r) n = (uint16_t)(nRows - r);
+  const uint16_t cap = (uint16_t)(fetchRows(len) - r % per);
+  if (n > cap) n = cap;
+  // Touch each block as it is fetched: the least recently used slot is then
+  // never one this call already filled
+  for (uint16_t r0 = (uint16_t)(r - r % per); r0 < r + n; r0 = (uint16_t)(r0 + per)){
+    Slot* s = find(s_slots, CA_ASSET_SLOTS, src, off, r0);
+    if (!s) s = load(lru(), src, off, len, r0, nRows, per);
+    s->used = ++s_use;
+  }
+  return n;
+}
+
+void CA_Asset::invalidate(){
+  for (uint8_t i=0;i<CA_ASSET_SLOTS;++i) s_slots[i].n = 0;
+  for (uint8_t i=0;i<CA_ASSET_PINS;++i) s_pins[i].n = 0;
+}
+
+const CA_Asset::Stats& CA_Asset::stats(){ return s_stats; }
+
+#endif // CA_ASSET_STREAM
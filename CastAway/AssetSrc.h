@@ -0,0 +1,125 @@
+#ifndef CA_ASSET_SRC_H
+#define CA_ASSET_SRC_H
+
+#include <Arduino.h>
+
+// 1 = the background and the fish frames come from the asset pack file
+// (assets/PACK_BG.h, assets/PACK_FISH.h) instead of flash. The background
+// tile map or RLE bitmap, when chosen, still wins
+#ifndef CA_ASSET_PACK
+#define CA_ASSET_PACK 0
+#endif
+
+// Streamed assets (CA_AssetSrc, CA_Frame4::src, CA_StreamBg): built in on host
+// builds; on AVR only with the pack, as they need an SD slot and
+// CA_ASSET_SLOTS × CA_ASSET_SLOT bytes of SRAM
+#ifndef CA_ASSET_STREAM
+  #if defined(__AVR__)
+    #define CA_ASSET_STREAM CA_ASSET_PACK
+  #else
+    #define CA_ASSET_STREAM 1
+  #endif
+#endif
+#ifndef CA_ASSET_PACK_PATH
+#define CA_ASSET_PACK_PATH "CASTAWAY.PAK"
+#endif
+
+// Where the pack is read from: the shield's microSD slot on AVR (SD library),
+// a file in the working directory elsewhere
+#ifndef CA_ASSET_SD
+  #if defined(__AVR__)
+    #define CA_ASSET_SD 1
+  #else
+    #define CA_ASSET_SD 0
+  #endif
+#endif
+// SD chip select. MCUFRIEND Uno shields wire the slot to pins 10-13, which on
+// a Mega are not the hardware SPI pins (50-52): jumper them across
+#ifndef CA_ASSET_SD_CS
+#define CA_ASSET_SD_CS 10
+#endif
+
+#if CA_ASSET_STREAM
+
+// Row cache: CA_ASSET_SLOTS blocks of CA_ASSET_SLOT bytes, least recently used
+// one replaced. A block holds as many whole rows of one asset as fit (one BG
+// row, a whole fish), read in one go. The renderer fetches a box's BG rows
+// before it opens the box's window (CA_Asset::fetch), not line by line
+#ifndef CA_ASSET_SLOTS
+#define CA_ASSET_SLOTS 4
+#endif
+#ifndef CA_ASSET_SLOT
+#define CA_ASSET_SLOT 160
+#endif
+// Assets that fit one block whole (the fish frames) are pinned in
+// CA_ASSET_PINS blocks of their own once read, so BG rows never evict them.
+// More of them than that share the row cache
+#ifndef CA_ASSET_PINS
+#define CA_ASSET_PINS 2
+#endif
+
+#if CA_ASSET_SD
+#include <SD.h>
+#else
+#include <stdio.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// CA_AssetSrc
+// Random-access bytes of a packed asset file (tools/ca_assetc -pack). Reads
+// are block sized and mostly sequential; sources skip the seek when they can
+// -----------------------------------------------------------------------------
+class CA_AssetSrc {
+public:
+  // n bytes at off into dst; false (dst untouched) if the source cannot
+  virtual bool read(uint32_t off, uint8_t* dst, uint16_t n) = 0;
+};
+
+#if CA_ASSET_SD
+// A file on the SD card. open() starts the card on first use
+class CA_SdAssetSrc : public CA_AssetSrc {
+public:
+  bool open(const char* path);
+  bool read(uint32_t off, uint8_t* dst, uint16_t n) override;
+private:
+  File f;
+};
+typedef CA_SdAssetSrc CA_PackSrc;
+#else
+// A local file standing in for the card
+class CA_FileAssetSrc : public CA_AssetSrc {
+public:
+  bool open(const char* path);
+  bool read(uint32_t off, uint8_t* dst, uint16_t n) override;
+private:
+  FILE*    f   = nullptr;
+  uint32_t pos = 0;
+};
+typedef CA_FileAssetSrc CA_PackSrc;
+#endif
+
+namespace CA_Asset {
+  // The pack CA_ASSET_PACK reads; CA_Draw::init() opens it
+  extern CA_PackSrc pack;
+
+  // Row r (0..nRows-1) of an asset stored in src as nRows rows of len bytes
+  // (len <= CA_ASSET_SLOT) from off. Valid until the next call. Rows the
+  // source cannot read come back as zeros (palette index 0)
+  const uint8_t* row(CA_AssetSrc* src, uint32_t off, uint16_t len, uint16_t r, uint16_t nRows);
+
+  // Rows [r, r + n) of the same asset into the row cache ahead of the row()
+  // calls for them, skipping the blocks already there. Returns how many rows
+  // from r it holds now: no more than fetchRows(len)
+  uint16_t fetch(CA_AssetSrc* src, uint32_t off, uint16_t len, uint16_t r, uint16_t n, uint16_t nRows);
+  uint16_t fetchRows(uint16_t len);   // rows of len bytes the row cache holds at once
+
+  // Forget every cached block (the pack was rewritten or reopened)
+  void invalidate();
+
+  // misses: row() calls that had to read; reads: blocks read, fetched or not
+  struct Stats { uint32_t hits, misses, reads, bytes; };
+  const Stats& stats();
+}
+
+#endif // CA_ASSET_STREAM
+#endif
@@ -4,12 +4,16 @@
 namespace { // just global
   // Single scanline buffer used by all compositors
   // s_back is the current line the renderer composes into
-  static uint16_t s_lineA[320];
+  static uint16_t s_lineA[CA_LINE_MAX];
   static uint16_t* s_back = s_lineA;
   
   // Read helpers from PROGMEM. Using inline keeps call overhead low on AVR
   inline uint8_t  rd8(const uint8_t* p){ return pgm_read_byte(p); }
   inline uint16_t rd16(const uint16_t* p){ return pgm_read_word(p); }
+
+  // Row kernels read flash rows, or rows already in RAM (decoded RLE rows,
+  // streamed assets)
+  template<bool RAM> inline uint8_t bgRd(const uint8_t* p){ return RAM ? *p : pgm_read_byte(p); }
 }
 
 // Raw LCD bus path removed.
@@ -270,19 +274,60 @@ void CA_Blit::composeHBarLine(int16_t y, int16_t x0, int16_t wRegion,
   #endif
 }
 
-// Compose a 320px-wide background scanline from a 160x120 indexed image split into 4 quads
-// Each source pixel is replicated horizontally by 2 to achieve 2x scale
-void CA_Blit::composeBGLine_160to320_quads_P(const uint8_t* q0, const uint8_t* q1,
-                                             const uint8_t* q2, const uint8_t* q3,
-                                             uint16_t w160, uint16_t h120,
-                                             uint16_t cw, uint16_t ch,
-                                             const uint16_t* pal565,
-                                             int16_t y, int16_t x0, int16_t w){
-  if (w <= 0) return;
+// ---- line segments ----
+void CA_Blit::lineInit(CA_LineDDA& s, int16_t xa, int16_t ya, int16_t xb, int16_t yb){
+  if (yb < ya) { int16_t t = xa; xa = xb; xb = t; t = ya; ya = yb; yb = t; }
+  s.xa = xa; s.ya = ya; s.xb = xb; s.yb = yb;
+  s.step = (yb > ya) ? (((int32_t)(xb - xa) * 65536) / (int32_t)(yb - ya)) : 0;
+  s.cx = (int32_t)xa * 65536 + 0x8000;
+  s.cy = ya;
+}
 
-  int16_t srcY = y >> 1;
-  if (srcY < 0) srcY = 0; else if (srcY >= (int16_t)h120) srcY = (int16_t)h120 - 1;
+bool CA_Blit::lineSpan(CA_LineDDA& s, int16_t y, int16_t& L, int16_t& R){
+  if (y < s.ya || y > s.yb) return false;
+  const int16_t lo = (s.xa < s.xb) ? s.xa : s.xb;
+  const int16_t hi = (s.xa < s.xb) ? s.xb : s.xa;
+  if (s.ya == s.yb) { L = lo; R = hi; return true; }
+
+  // DDA: one add per row walking down, a multiply to jump
+  if (y == s.cy + 1)  s.cx += s.step;
+  else if (y != s.cy) s.cx = (int32_t)s.xa * 65536 + 0x8000 + (int32_t)(y - s.ya) * s.step;
+  s.cy = y;
+
+  const int32_t half = ((s.step < 0) ? -s.step : s.step) >> 1;
+  if (half <= 0x8000) {
+    L = R = (int16_t)(s.cx >> 16);               // steep: one pixel per row
+  } else {
+    // The row holds x(y - 1/2) .. x(y + 1/2); the shared end pixel goes to
+    // the row below
+    L = (int16_t)((s.cx - half) >> 16);
+    R = (int16_t)((s.cx + half) >> 16);
+    if (s.step > 0) --R; else ++L;
+  }
+  if (L < lo) L = lo;
+  if (R > hi) R = hi;
+  return true;
+}
+
+void CA_Blit::composeSegmentLine(int16_t y, int16_t x0, int16_t wRegion,
+                                 CA_LineDDA& s, uint16_t color565){
+  int16_t L, R;
+  if (!lineSpan(s, y, L, R)) return;
+  if (L < x0) L = x0;
+  if (R >= x0 + wRegion) R = (int16_t)(x0 + wRegion - 1);
+  for (int16_t x = L; x <= R; ++x) s_back[x - x0] = color565;
+}
 
+// Compose background row srcY of a 160x120 indexed image split into 4 quads,
+// x in [x0, x0+w) of its 2× span (0..2*w160), into s_back[0..w)
+// Each source pixel is replicated horizontally by 2 to achieve 2x scale.
+// RAM: the quads are rows already decoded into RAM (row-RLE BG)
+template<bool RAM>
+static void bgRow2x(const uint8_t* q0, const uint8_t* q1,
+                    const uint8_t* q2, const uint8_t* q3,
+                    uint16_t w160, uint16_t cw, uint16_t ch,
+                    const uint16_t* pal565,
+                    int16_t srcY, int16_t x0, int16_t w){
   // Branchless quadrant selection for row base
   const uint8_t* baseQ[4] = { q0, q1, q2, q3 };
   const uint16_t leftW  = cw;
@@ -308,7 +353,7 @@ void CA_Blit::composeBGLine_160to320_quads_P(const uint8_t* q0, const uint8_t* q
     // If starting on an odd screen x, emit the second half of the current source pixel
     int16_t sxi = (int16_t)(srcX0 + (segL >> 1));
     if (x & 1) {
-      const uint16_t c = pal[ rd8(row + sxi) ];
+      const uint16_t c = pal[ bgRd<RAM>(row + sxi) ];
       *dst++ = c;
       ++x;
       ++sxi; // consumed the second half -> advance to next source pixel
@@ -320,14 +365,14 @@ void CA_Blit::composeBGLine_160to320_quads_P(const uint8_t* q0, const uint8_t* q
     // Aggressive 8-pixel unroll for maximum throughput
     while (pairs >= 8) {
       #if defined(__AVR__) && CA_AVR_BG_FAST
-      const uint16_t c0 = pal[ rd8(row + sxi    ) ];
-      const uint16_t c1 = pal[ rd8(row + sxi + 1) ];
-      const uint16_t c2 = pal[ rd8(row + sxi + 2) ];
-      const uint16_t c3 = pal[ rd8(row + sxi + 3) ];
-      const uint16_t c4 = pal[ rd8(row + sxi + 4) ];
-      const uint16_t c5 = pal[ rd8(row + sxi + 5) ];
-      const uint16_t c6 = pal[ rd8(row + sxi + 6) ];
-      const uint16_t c7 = pal[ rd8(row + sxi + 7) ];
+      const uint16_t c0 = pal[ bgRd<RAM>(row + sxi    ) ];
+      const uint16_t c1 = pal[ bgRd<RAM>(row + sxi + 1) ];
+      const uint16_t c2 = pal[ bgRd<RAM>(row + sxi + 2) ];
+      const uint16_t c3 = pal[ bgRd<RAM>(row + sxi + 3) ];
+      const uint16_t c4 = pal[ bgRd<RAM>(row + sxi + 4) ];
+      const uint16_t c5 = pal[ bgRd<RAM>(row + sxi + 5) ];
+      const uint16_t c6 = pal[ bgRd<RAM>(row + sxi + 6) ];
+      const uint16_t c7 = pal[ bgRd<RAM>(row + sxi + 7) ];
       // Ultra-fast 16-store sequence
       asm volatile(
         "st Z+, %A1\n\t" "st Z+, %B1\n\t" "st Z+, %A1\n\t" "st Z+, %B1\n\t"
@@ -345,17 +390,17 @@ void CA_Blit::composeBGLine_160to320_quads_P(const uint8_t* q0, const uint8_t* q
       sxi += 8; x += 16; pairs -= 8;
       #else
       for(int i = 0; i < 8; i++) {
-        const uint16_t c = pal[ rd8(row + sxi + i) ];
+        const uint16_t c = pal[ bgRd<RAM>(row + sxi + i) ];
         dst[i*2] = c; dst[i*2+1] = c;
       }
       dst += 16; sxi += 8; x += 16; pairs -= 8;
       #endif
     }
     while (pairs >= 4) {
-      const uint16_t c0 = pal[ rd8(row + sxi    ) ];
-      const uint16_t c1 = pal[ rd8(row + sxi + 1) ];
-      const uint16_t c2 = pal[ rd8(row + sxi + 2) ];
-      const uint16_t c3 = pal[ rd8(row + sxi + 3) ];
+      const uint16_t c0 = pal[ bgRd<RAM>(row + sxi    ) ];
+      const uint16_t c1 = pal[ bgRd<RAM>(row + sxi + 1) ];
+      const uint16_t c2 = pal[ bgRd<RAM>(row + sxi + 2) ];
+      const uint16_t c3 = pal[ bgRd<RAM>(row + sxi + 3) ];
       // Fast duplicate stores
       #if defined(__AVR__) && CA_AVR_BG_FAST
       asm volatile(
@@ -380,8 +425,8 @@ void CA_Blit::composeBGLine_160to320_quads_P(const uint8_t* q0, const uint8_t* q
     }
 #endif
     while (pairs >= 2) {
-      const uint16_t c0 = pal[ rd8(row + sxi    ) ];
-      const uint16_t c1 = pal[ rd8(row + sxi + 1) ];
+      const uint16_t c0 = pal[ bgRd<RAM>(row + sxi    ) ];
+      const uint16_t c1 = pal[ bgRd<RAM>(row + sxi + 1) ];
       #if defined(__AVR__) && CA_AVR_BG_FAST
       asm volatile(
         "st  Z+, %A1\n\t"  "st  Z+, %B1\n\t"
@@ -399,7 +444,7 @@ void CA_Blit::composeBGLine_160to320_quads_P(const uint8_t* q0, const uint8_t* q
       sxi += 2; x += 4; pairs -= 2;
     }
     if (pairs == 1) {
-      const uint16_t c = pal[ rd8(row + sxi++) ];
+      const uint16_t c = pal[ bgRd<RAM>(row + sxi++) ];
       #if defined(__AVR__) && CA_AVR_BG_FAST
       asm volatile(
         "st  Z+, %A1\n\t"  "st  Z+, %B1\n\t"
@@ -417,7 +462,7 @@ void CA_Blit::composeBGLine_160to320_quads_P(const uint8_t* q0, const uint8_t* q
 
     // Trailing single
     if (x < segR) {
-      *dst = pal[ rd8(row + sxi) ];
+      *dst = pal[ bgRd<RAM>(row + sxi) ];
     }
   };
 
@@ -438,6 +483,252 @@ void CA_Blit::composeBGLine_160to320_quads_P(const uint8_t* q0, const uint8_t* q
   }
 }
 
+// Same at 3× across (160 -> 480 px): each source pixel three times
+template<bool RAM>
+static void bgRow3x(const uint8_t* q0, const uint8_t* q1,
+                    const uint8_t* q2, const uint8_t* q3,
+                    uint16_t w160, uint16_t cw, uint16_t ch,
+                    const uint16_t* pal565,
+                    int16_t srcY, int16_t x0, int16_t w){
+  const uint8_t* baseQ[4] = { q0, q1, q2, q3 };
+  const uint8_t topMask = (uint8_t)(srcY >= (int16_t)ch);
+  const uint8_t baseIdx = (uint8_t)(topMask << 1);
+  const int16_t ly = (int16_t)(srcY - (topMask ? (int16_t)ch : 0));
+  const uint8_t* rowL = baseQ[baseIdx + 0] + (uint32_t)ly * cw;
+  const uint8_t* rowR = baseQ[baseIdx + 1] + (uint32_t)ly * (uint16_t)(w160 - cw);
+
+  const int16_t splitX = (int16_t)(cw * 3);
+  const int16_t xEnd   = (int16_t)(x0 + w);
+
+  auto drawSegment = [&](int16_t segL, int16_t segR, const uint8_t* row, int16_t srcX0){
+    uint16_t* dst = s_back + (segL - x0);
+    const uint16_t* pal = pal565;
+    const int16_t q = (int16_t)(segL / 3);           // once per segment
+    int16_t sxi = (int16_t)(srcX0 + q);
+    int16_t n = (int16_t)(segR - segL);
+
+    // Finish a source pixel that started left of segL
+    uint8_t ph = (uint8_t)(segL - q * 3);
+    if (ph) {
+      const uint16_t c = pal[ bgRd<RAM>(row + sxi++) ];
+      for (; ph < 3 && n; ++ph, --n) *dst++ = c;
+    }
+
+    // Four source pixels (12 px) per iteration
+    while (n >= 12) {
+      const uint16_t c0 = pal[ bgRd<RAM>(row + sxi    ) ];
+      const uint16_t c1 = pal[ bgRd<RAM>(row + sxi + 1) ];
+      const uint16_t c2 = pal[ bgRd<RAM>(row + sxi + 2) ];
+      const uint16_t c3 = pal[ bgRd<RAM>(row + sxi + 3) ];
+      #if defined(__AVR__) && CA_AVR_BG_FAST
+      asm volatile(
+        "st Z+, %A1\n\t" "st Z+, %B1\n\t" "st Z+, %A1\n\t" "st Z+, %B1\n\t" "st Z+, %A1\n\t" "st Z+, %B1\n\t"
+        "st Z+, %A2\n\t" "st Z+, %B2\n\t" "st Z+, %A2\n\t" "st Z+, %B2\n\t" "st Z+, %A2\n\t" "st Z+, %B2\n\t"
+        "st Z+, %A3\n\t" "st Z+, %B3\n\t" "st Z+, %A3\n\t" "st Z+, %B3\n\t" "st Z+, %A3\n\t" "st Z+, %B3\n\t"
+        "st Z+, %A4\n\t" "st Z+, %B4\n\t" "st Z+, %A4\n\t" "st Z+, %B4\n\t" "st Z+, %A4\n\t" "st Z+, %B4\n\t"
+        : "+z" (dst)
+        : "r" (c0), "r" (c1), "r" (c2), "r" (c3)
+        : "memory"
+      );
+      #else
+      dst[0] = c0; dst[1]  = c0; dst[2]  = c0; dst[3]  = c1; dst[4]  = c1; dst[5]  = c1;
+      dst[6] = c2; dst[7]  = c2; dst[8]  = c2; dst[9]  = c3; dst[10] = c3; dst[11] = c3;
+      dst += 12;
+      #endif
+      sxi += 4; n -= 12;
+    }
+    while (n >= 3) {
+      const uint16_t c = pal[ bgRd<RAM>(row + sxi++) ];
+      dst[0] = c; dst[1] = c; dst[2] = c;
+      dst += 3; n -= 3;
+    }
+    // Trailing part of a pixel
+    if (n) {
+      const uint16_t c = pal[ bgRd<RAM>(row + sxi) ];
+      dst[0] = c;
+      if (n > 1) dst[1] = c;
+    }
+  };
+
+  int16_t L0 = x0, R0 = xEnd;
+  if (L0 < 0) L0 = 0;
+  if (R0 > splitX) R0 = splitX;
+  if (R0 > L0) drawSegment(L0, R0, rowL, 0);
+
+  int16_t L1 = x0; if (L1 < splitX) L1 = splitX;
+  int16_t R1 = xEnd; const int16_t screenMax = (int16_t)(w160 * 3);
+  if (R1 > screenMax) R1 = screenMax;
+  if (R1 > L1) drawSegment(L1, R1, rowR, (int16_t)-cw);
+}
+
+static void fillLine(uint16_t* dst, int16_t n, uint16_t c){
+  while (n-- > 0) *dst++ = c;
+}
+
+// Compose a 320px-wide background scanline from a 160x120 indexed image split into 4 quads
+void CA_Blit::composeBGLine_160to320_quads_P(const uint8_t* q0, const uint8_t* q1,
+                                             const uint8_t* q2, const uint8_t* q3,
+                                             uint16_t w160, uint16_t h120,
+                                             uint16_t cw, uint16_t ch,
+                                             const uint16_t* pal565,
+                                             int16_t y, int16_t x0, int16_t w){
+  if (w <= 0) return;
+
+  int16_t srcY = y >> 1;
+  if (srcY < 0) srcY = 0; else if (srcY >= (int16_t)h120) srcY = (int16_t)h120 - 1;
+  bgRow2x<false>(q0, q1, q2, q3, w160, cw, ch, pal565, srcY, x0, w);
+}
+
+// Letterbox and band shift shared by the BG composers: fills the border,
+// then calls row(srcY, lx, n) for each run of the BG, lx in local screen x
+template<typename RowFn>
+static void bgLine(const CA_BgMap& m, int16_t y, int16_t x0, int16_t w, int16_t dx, RowFn row){
+  if (w <= 0) return;
+  const int16_t srcY = m.srcRow(y);
+  const int16_t x1 = (int16_t)(x0 + w);
+  const int16_t b0 = x0 > m.x0 ? x0 : m.x0;
+  const int16_t b1 = x1 < (int16_t)(m.x0 + m.w) ? x1 : (int16_t)(m.x0 + m.w);
+  if (srcY < 0 || b1 <= b0) { fillLine(s_back, w, m.border); return; }
+  if (b0 > x0) fillLine(s_back, (int16_t)(b0 - x0), m.border);
+  if (b1 < x1) fillLine(s_back + (b1 - x0), (int16_t)(x1 - b1), m.border);
+
+  // The row kernels write from s_back[0]. A shifted row is at most two runs:
+  // from lx to the right edge of the BG, then from its left edge
+  uint16_t* const line = s_back;
+  int16_t at = (int16_t)(b0 - x0), n = (int16_t)(b1 - b0);
+  int16_t lx = (int16_t)(b0 - m.x0 + dx);
+  if (dx) { lx %= m.w; if (lx < 0) lx = (int16_t)(lx + m.w); }
+  while (n > 0) {
+    const int16_t run = (int16_t)(m.w - lx) < n ? (int16_t)(m.w - lx) : n;
+    s_back = line + at;
+    row(srcY, lx, run);
+    at = (int16_t)(at + run); n = (int16_t)(n - run); lx = 0;
+  }
+  s_back = line;
+}
+
+// Any panel: scale through the map, letterbox outside it
+void CA_Blit::composeBGLine_quads_P(const CA_BgMap& m,
+                                    const uint8_t* q0, const uint8_t* q1,
+                                    const uint8_t* q2, const uint8_t* q3,
+                                    uint16_t w160, uint16_t h120,
+                                    uint16_t cw, uint16_t ch,
+                                    const uint16_t* pal565,
+                                    int16_t y, int16_t x0, int16_t w, int16_t dx){
+  bgLine(m, y, x0, w, dx, [&](int16_t srcY, int16_t lx, int16_t n){
+    if (srcY >= (int16_t)h120) srcY = (int16_t)h120 - 1;
+    if (m.sx == 3) bgRow3x<false>(q0, q1, q2, q3, w160, cw, ch, pal565, srcY, lx, n);
+    else           bgRow2x<false>(q0, q1, q2, q3, w160, cw, ch, pal565, srcY, lx, n);
+  });
+}
+
+// Decoded row-RLE rows, least recently used one replaced. `at` is where
+// decoding resumes in the row's data, `n` the pixels decoded so far
+namespace {
+  struct RleRow {
+    const CA_RleBg* bg;
+    int16_t  r;
+    uint16_t at;
+    uint8_t  n, used;
+    uint8_t  px[CA_RleBg::MAX_W];
+  };
+  RleRow  s_rleRows[CA_BG_ROW_CACHE];
+  uint8_t s_rleUse = 0;
+}
+
+const uint8_t* CA_Blit::rleBgRow(const CA_RleBg& b, int16_t r, int16_t x1){
+  RleRow* e = s_rleRows;
+  for (uint8_t i=0;i<CA_BG_ROW_CACHE;++i){
+    RleRow& c = s_rleRows[i];
+    if (c.bg == &b && c.r == r) { e = &c; break; }
+    if ((uint8_t)(s_rleUse - c.used) > (uint8_t)(s_rleUse - e->used)) e = &c;
+  }
+  if (e->bg != &b || e->r != r) {
+    e->bg = &b; e->r = r; e->n = 0;
+    e->at = pgm_read_word(b.row + r);
+  }
+  e->used = ++s_rleUse;
+  if (x1 > (int16_t)b.w) x1 = (int16_t)b.w;
+
+  // Whole runs until x1 is covered; a repeat becomes a fill
+  while ((int16_t)e->n < x1) {
+    const uint8_t c = rd8(b.data + e->at++);
+    uint8_t* dst = e->px + e->n;
+    if (c & 0x80) {
+      const uint8_t k = (uint8_t)((c & 0x7F) + 3);
+      memset(dst, rd8(b.data + e->at++), k);
+      e->n = (uint8_t)(e->n + k);
+    } else {
+      const uint8_t k = (uint8_t)(c + 1);
+      memcpy_P(dst, b.data + e->at, k);
+      e->at = (uint16_t)(e->at + k);
+      e->n = (uint8_t)(e->n + k);
+    }
+  }
+  return e->px;
+}
+
+// A decoded row is one quadrant as wide as the picture
+void CA_Blit::composeBGLine_rle_P(const CA_BgMap& m, const CA_RleBg& b,
+                                  const uint16_t* pal565,
+                                  int16_t y, int16_t x0, int16_t w, int16_t dx){
+  bgLine(m, y, x0, w, dx, [&](int16_t srcY, int16_t lx, int16_t n){
+    if (srcY >= (int16_t)b.h) srcY = (int16_t)b.h - 1;
+    const uint8_t* row = rleBgRow(b, srcY, (int16_t)((lx + n - 1) / m.sx + 1));
+    if (m.sx == 3) bgRow3x<true>(row, row, row, row, b.w, b.w, 1, pal565, 0, lx, n);
+    else           bgRow2x<true>(row, row, row, row, b.w, b.w, 1, pal565, 0, lx, n);
+  });
+}
+
+#if CA_ASSET_STREAM
+// A streamed row is read whole, once per block of rows (CA_Asset)
+void CA_Blit::composeBGLine_stream(const CA_BgMap& m, const CA_StreamBg& b,
+                                   const uint16_t* pal565,
+                                   int16_t y, int16_t x0, int16_t w, int16_t dx){
+  bgLine(m, y, x0, w, dx, [&](int16_t srcY, int16_t lx, int16_t n){
+    if (srcY >= (int16_t)b.h) srcY = (int16_t)b.h - 1;
+    const uint8_t* row = CA_Asset::row(b.src, b.off, b.w, (uint16_t)srcY, b.h);
+    if (m.sx == 3) bgRow3x<true>(row, row, row, row, b.w, b.w, 1, pal565, 0, lx, n);
+    else           bgRow2x<true>(row, row, row, row, b.w, b.w, 1, pal565, 0, lx, n);
+  });
+}
+#endif
+
+// One run of a tile-map row: n screen pixels from local x lx, each source
+// pixel replicated sx times. Tiles are fetched once per 8 source pixels
+static void tileRow(const CA_TileBg& t, uint8_t sx, int16_t ox, const uint16_t* pal565,
+                    int16_t wy, int16_t lx, int16_t n){
+  const int16_t worldW = (int16_t)((int16_t)t.mapW << 3);
+  const uint16_t* mrow = t.map + (uint16_t)(wy >> 3) * t.mapW;
+  const uint8_t tRow = (uint8_t)((wy & 7) << 3);
+  int16_t sxi = (int16_t)(lx / sx);
+  uint8_t ph = (uint8_t)(lx - sxi * sx);            // copies of the first pixel already left of lx
+  int16_t wx = (int16_t)((sxi + ox) % worldW); if (wx < 0) wx = (int16_t)(wx + worldW);
+  uint16_t* dst = s_back;
+  while (n > 0) {
+    const uint16_t e = pgm_read_word(mrow + (wx >> 3));
+    const uint8_t* src = t.tiles + ((uint32_t)(e & 0x7FFF) << 6) + tRow;
+    const uint8_t flip = (e & CA_TileBg::HFLIP) ? 7 : 0;
+    for (uint8_t k = (uint8_t)(wx & 7); k < 8 && n > 0; ++k){
+      const uint16_t c = pal565[pgm_read_byte(src + (k ^ flip))];
+      int16_t r = (int16_t)(sx - ph); if (r > n) r = n;
+      n = (int16_t)(n - r); ph = 0;
+      while (r--) *dst++ = c;
+    }
+    wx = (int16_t)((wx | 7) + 1); if (wx >= worldW) wx = 0;
+  }
+}
+
+void CA_Blit::composeBGLine_tiles_P(const CA_BgMap& m, const CA_TileBg& t,
+                                    const uint16_t* pal565,
+                                    int16_t y, int16_t x0, int16_t w, int16_t dx){
+  bgLine(m, y, x0, w, dx, [&](int16_t srcY, int16_t lx, int16_t n){
+    const int16_t worldH = (int16_t)((int16_t)t.mapH << 3);
+    int16_t wy = (int16_t)((srcY + m.oy) % worldH); if (wy < 0) wy = (int16_t)(wy + worldH);
+    tileRow(t, m.sx, m.ox, pal565, wy, lx, n);
+  });
+}
+
 void CA_Blit::pushLinePhysicalNoAddr(const CA_BlitConfig& cfg, int16_t w, bool first){
   if (w <= 0) return;
   cfg.tft->pushColors(s_back, w, first);
@@ -455,21 +746,14 @@ void CA_Blit::pokeLinePixel(int16_t dx, uint16_t color565) {
   s_back[dx] = color565;
 }
 
-#if CA_AVR_FAST_BLIT
-// AVR-optimized inner loops for 4bpp sprite composition
-// These routines reduce branches and exploit packed nibbles for speed
-// They avoid modulo operations and keep register pressure predictable
-void CA_Blit::composeOver4bpp_AVR_P(const uint8_t* data, uint16_t w, uint16_t h,
-                                    int16_t vx, int16_t vy, const uint16_t* pal565,
-                                    bool hFlip, int16_t y, int16_t x0, int16_t wRegion){
-  const int16_t row = (int16_t)(y - vy); if ((uint16_t)row >= h) return;
-  const uint16_t bpr = (w + 1) >> 1;
-  const uint8_t* src = data + (uint32_t)row * bpr;
+// One row of a 4bpp sprite keyed by palette index, from flash or from RAM
+// (streamed frames). Unrolled per direction with CA_AVR_AGGR
+template<bool RAM>
+static void keyIdxRow(const uint8_t* src, uint16_t w, int16_t vx, uint16_t* paletteRam,
+                      bool hFlip, uint8_t keyIndex, int16_t x0, int16_t wRegion){
   const int16_t dxBaseN = (int16_t)(vx - x0);
   const int16_t dxBaseF = (int16_t)((vx + (int16_t)w - 1) - x0);
 #if CA_AVR_AGGR
-  // Non-flipped fast path increments the destination x monotonically
-  // This keeps the compiler from inserting extra address math in the loop
   if (!hFlip) {
     int16_t lo = (int16_t)-dxBaseN;
     int16_t hi = (int16_t)((wRegion - 1) - dxBaseN);
@@ -479,25 +763,26 @@ void CA_Blit::composeOver4bpp_AVR_P(const uint8_t* data, uint16_t w, uint16_t h,
     int16_t sx = lo;
     int16_t dx = (int16_t)(dxBaseN + lo);
     int16_t j  = (int16_t)(sx >> 1);
-    // If starting on odd sx, do lower nibble first
     if (sx & 1) {
-      const uint8_t b = rd8(src + j);
+      const uint8_t b = bgRd<RAM>(src + j);
       const uint8_t ni = (uint8_t)(b & 0x0F);
-      if (ni) s_back[dx] = rd16(pal565 + ni);
+      if (ni != keyIndex) s_back[dx] = paletteRam[ni];
       ++sx; ++dx; ++j;
     }
-    const int16_t jEnd = (int16_t)(hi >> 1);
+    // Whole bytes up to hi; an even hi ends on a high nibble
+    const int16_t jEnd = (int16_t)((hi - 1) >> 1);
     for (; j <= jEnd; ++j) {
-      const uint8_t b = rd8(src + j);
-      uint8_t ni = (uint8_t)(b >> 4); if (ni) s_back[dx] = rd16(pal565 + ni);
-      ++dx;
-      ni = (uint8_t)(b & 0x0F);       if (ni) s_back[dx] = rd16(pal565 + ni);
-      ++dx;
+      const uint8_t b = bgRd<RAM>(src + j);
+      uint8_t ni;
+      ni = (uint8_t)(b >> 4); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; ++dx;
+      ni = (uint8_t)(b & 0x0F); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; ++dx;
+    }
+    if (!(hi & 1)) {
+      const uint8_t ni = (uint8_t)(bgRd<RAM>(src + j) >> 4);
+      if (ni != keyIndex) s_back[dx] = paletteRam[ni];
     }
     return;
   }
-  // Flipped fast path decrements the destination x monotonically
-  // This mirrors the sprite horizontally with minimal conditional logic
   else {
     int16_t lo = (int16_t)(dxBaseF - (int16_t)(wRegion - 1));
     int16_t hi = dxBaseF;
@@ -507,30 +792,34 @@ void CA_Blit::composeOver4bpp_AVR_P(const uint8_t* data, uint16_t w, uint16_t h,
     int16_t sx = lo;
     int16_t dx = (int16_t)(dxBaseF - lo);
     int16_t j  = (int16_t)(sx >> 1);
-    // If starting on odd sx, do low nibble first (then move to next byte)
     if (sx & 1) {
-      const uint8_t b = rd8(src + j);
+      const uint8_t b = bgRd<RAM>(src + j);
       const uint8_t ni = (uint8_t)(b & 0x0F);
-      if (ni) s_back[dx] = rd16(pal565 + ni);
+      if (ni != keyIndex) s_back[dx] = paletteRam[ni];
       ++sx; --dx; ++j;
     }
-    const int16_t jEnd = (int16_t)(hi >> 1);
+    const int16_t jEnd = (int16_t)((hi - 1) >> 1);
     int16_t bytes = (int16_t)(jEnd - j + 1);
     while (bytes >= 2) {
-      const uint8_t b0 = rd8(src + j);
-      const uint8_t b1 = rd8(src + j + 1);
+      const uint8_t b0 = bgRd<RAM>(src + j);
+      const uint8_t b1 = bgRd<RAM>(src + j + 1);
       uint8_t ni;
-      ni = (uint8_t)(b0 >> 4); if (ni) s_back[dx] = rd16(pal565 + ni); --dx;
-      ni = (uint8_t)(b0 & 0x0F); if (ni) s_back[dx] = rd16(pal565 + ni); --dx;
-      ni = (uint8_t)(b1 >> 4); if (ni) s_back[dx] = rd16(pal565 + ni); --dx;
-      ni = (uint8_t)(b1 & 0x0F); if (ni) s_back[dx] = rd16(pal565 + ni); --dx;
+      ni = (uint8_t)(b0 >> 4); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; --dx;
+      ni = (uint8_t)(b0 & 0x0F); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; --dx;
+      ni = (uint8_t)(b1 >> 4); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; --dx;
+      ni = (uint8_t)(b1 & 0x0F); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; --dx;
       j += 2; bytes -= 2;
     }
     if (bytes == 1) {
-      const uint8_t b = rd8(src + j);
+      const uint8_t b = bgRd<RAM>(src + j);
       uint8_t ni;
-      ni = (uint8_t)(b >> 4); if (ni) s_back[dx] = rd16(pal565 + ni); --dx;
-      ni = (uint8_t)(b & 0x0F); if (ni) s_back[dx] = rd16(pal565 + ni); --dx;
+      ni = (uint8_t)(b >> 4); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; --dx;
+      ni = (uint8_t)(b & 0x0F); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; --dx;
+      ++j;
+    }
+    if (!(hi & 1)) {
+      const uint8_t ni = (uint8_t)(bgRd<RAM>(src + j) >> 4);
+      if (ni != keyIndex) s_back[dx] = paletteRam[ni];
     }
     return;
   }
@@ -554,30 +843,41 @@ void CA_Blit::composeOver4bpp_AVR_P(const uint8_t* data, uint16_t w, uint16_t h,
   int16_t j = (int16_t)(sxStart >> 1);
   const int16_t jEnd = (int16_t)(sxEnd >> 1);
   for (; j <= jEnd; ++j) {
-  const uint8_t b = rd8(src + j);
+    const uint8_t b = bgRd<RAM>(src + j);
     const int16_t sx0 = (int16_t)(j << 1);
     const int16_t sx1 = (int16_t)(sx0 + 1);
     if (sx0 >= sxStart) {
       const int16_t dx = hFlip ? (int16_t)(dxBaseF - sx0) : (int16_t)(dxBaseN + sx0);
-      if ((uint16_t)dx < (uint16_t)wRegion) { const uint8_t ni = (uint8_t)(b >> 4); if (ni) s_back[dx] = rd16(pal565 + ni); }
+      if ((uint16_t)dx < (uint16_t)wRegion) { const uint8_t ni = (uint8_t)(b >> 4); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; }
     }
     if (sx1 <= sxEnd) {
       const int16_t dx = hFlip ? (int16_t)(dxBaseF - sx1) : (int16_t)(dxBaseN + sx1);
-      if ((uint16_t)dx < (uint16_t)wRegion) { const uint8_t ni = (uint8_t)(b & 0x0F); if (ni) s_back[dx] = rd16(pal565 + ni); }
+      if ((uint16_t)dx < (uint16_t)wRegion) { const uint8_t ni = (uint8_t)(b & 0x0F); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; }
     }
   }
 }
 
-void CA_Blit::composeOver4bppKey_AVR_P(const uint8_t* data, uint16_t w, uint16_t h,
-                                       int16_t vx, int16_t vy, uint16_t* paletteRam,
-                                       bool hFlip, uint16_t key565,
-                                       int16_t y, int16_t x0, int16_t wRegion){
+void CA_Blit::composeOver4bppKeyIdxRow(const uint8_t* row, uint16_t w, int16_t vx,
+                                       uint16_t* paletteRam, bool hFlip, uint8_t keyIndex,
+                                       int16_t x0, int16_t wRegion){
+  keyIdxRow<true>(row, w, vx, paletteRam, hFlip, keyIndex, x0, wRegion);
+}
+
+#if CA_AVR_FAST_BLIT
+// AVR-optimized inner loops for 4bpp sprite composition
+// These routines reduce branches and exploit packed nibbles for speed
+// They avoid modulo operations and keep register pressure predictable
+void CA_Blit::composeOver4bpp_AVR_P(const uint8_t* data, uint16_t w, uint16_t h,
+                                    int16_t vx, int16_t vy, const uint16_t* pal565,
+                                    bool hFlip, int16_t y, int16_t x0, int16_t wRegion){
   const int16_t row = (int16_t)(y - vy); if ((uint16_t)row >= h) return;
   const uint16_t bpr = (w + 1) >> 1;
   const uint8_t* src = data + (uint32_t)row * bpr;
   const int16_t dxBaseN = (int16_t)(vx - x0);
   const int16_t dxBaseF = (int16_t)((vx + (int16_t)w - 1) - x0);
 #if CA_AVR_AGGR
+  // Non-flipped fast path increments the destination x monotonically
+  // This keeps the compiler from inserting extra address math in the loop
   if (!hFlip) {
     int16_t lo = (int16_t)-dxBaseN;
     int16_t hi = (int16_t)((wRegion - 1) - dxBaseN);
@@ -587,22 +887,30 @@ void CA_Blit::composeOver4bppKey_AVR_P(const uint8_t* data, uint16_t w, uint16_t
     int16_t sx = lo;
     int16_t dx = (int16_t)(dxBaseN + lo);
     int16_t j  = (int16_t)(sx >> 1);
+    // If starting on odd sx, do lower nibble first
     if (sx & 1) {
       const uint8_t b = rd8(src + j);
       const uint8_t ni = (uint8_t)(b & 0x0F);
-      const uint16_t c = paletteRam[ni];
-      if (c != key565) s_back[dx] = c;
+      if (ni) s_back[dx] = rd16(pal565 + ni);
       ++sx; ++dx; ++j;
     }
-    const int16_t jEnd = (int16_t)(hi >> 1);
+    // Whole bytes up to hi; an even hi ends on a high nibble
+    const int16_t jEnd = (int16_t)((hi - 1) >> 1);
     for (; j <= jEnd; ++j) {
       const uint8_t b = rd8(src + j);
-      uint8_t ni; uint16_t c;
-      ni = (uint8_t)(b >> 4); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; ++dx;
-      ni = (uint8_t)(b & 0x0F); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; ++dx;
+      uint8_t ni = (uint8_t)(b >> 4); if (ni) s_back[dx] = rd16(pal565 + ni);
+      ++dx;
+      ni = (uint8_t)(b & 0x0F);       if (ni) s_back[dx] = rd16(pal565 + ni);
+      ++dx;
+    }
+    if (!(hi & 1)) {
+      const uint8_t ni = (uint8_t)(rd8(src + j) >> 4);
+      if (ni) s_back[dx] = rd16(pal565 + ni);
     }
     return;
   }
+  // Flipped fast path decrements the destination x monotonically
+  // This mirrors the sprite horizontally with minimal conditional logic
   else {
     int16_t lo = (int16_t)(dxBaseF - (int16_t)(wRegion - 1));
     int16_t hi = dxBaseF;
@@ -612,30 +920,35 @@ void CA_Blit::composeOver4bppKey_AVR_P(const uint8_t* data, uint16_t w, uint16_t
     int16_t sx = lo;
     int16_t dx = (int16_t)(dxBaseF - lo);
     int16_t j  = (int16_t)(sx >> 1);
+    // If starting on odd sx, do low nibble first (then move to next byte)
     if (sx & 1) {
       const uint8_t b = rd8(src + j);
       const uint8_t ni = (uint8_t)(b & 0x0F);
-      const uint16_t c = paletteRam[ni];
-      if (c != key565) s_back[dx] = c;
+      if (ni) s_back[dx] = rd16(pal565 + ni);
       ++sx; --dx; ++j;
     }
-    const int16_t jEnd = (int16_t)(hi >> 1);
+    const int16_t jEnd = (int16_t)((hi - 1) >> 1);
     int16_t bytes = (int16_t)(jEnd - j + 1);
     while (bytes >= 2) {
       const uint8_t b0 = rd8(src + j);
       const uint8_t b1 = rd8(src + j + 1);
-      uint8_t ni; uint16_t c;
-      ni = (uint8_t)(b0 >> 4); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; --dx;
-      ni = (uint8_t)(b0 & 0x0F); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; --dx;
-      ni = (uint8_t)(b1 >> 4); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; --dx;
-      ni = (uint8_t)(b1 & 0x0F); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; --dx;
+      uint8_t ni;
+      ni = (uint8_t)(b0 >> 4); if (ni) s_back[dx] = rd16(pal565 + ni); --dx;
+      ni = (uint8_t)(b0 & 0x0F); if (ni) s_back[dx] = rd16(pal565 + ni); --dx;
+      ni = (uint8_t)(b1 >> 4); if (ni) s_back[dx] = rd16(pal565 + ni); --dx;
+      ni = (uint8_t)(b1 & 0x0F); if (ni) s_back[dx] = rd16(pal565 + ni); --dx;
       j += 2; bytes -= 2;
     }
     if (bytes == 1) {
       const uint8_t b = rd8(src + j);
-      uint8_t ni; uint16_t c;
-      ni = (uint8_t)(b >> 4); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; --dx;
-      ni = (uint8_t)(b & 0x0F); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; --dx;
+      uint8_t ni;
+      ni = (uint8_t)(b >> 4); if (ni) s_back[dx] = rd16(pal565 + ni); --dx;
+      ni = (uint8_t)(b & 0x0F); if (ni) s_back[dx] = rd16(pal565 + ni); --dx;
+      ++j;
+    }
+    if (!(hi & 1)) {
+      const uint8_t ni = (uint8_t)(rd8(src + j) >> 4);
+      if (ni) s_back[dx] = rd16(pal565 + ni);
     }
     return;
   }
@@ -664,19 +977,19 @@ void CA_Blit::composeOver4bppKey_AVR_P(const uint8_t* data, uint16_t w, uint16_t
     const int16_t sx1 = (int16_t)(sx0 + 1);
     if (sx0 >= sxStart) {
       const int16_t dx = hFlip ? (int16_t)(dxBaseF - sx0) : (int16_t)(dxBaseN + sx0);
-      if ((uint16_t)dx < (uint16_t)wRegion) { const uint8_t ni = (uint8_t)(b >> 4); const uint16_t c = paletteRam[ni]; if (c != key565) s_back[dx] = c; }
+      if ((uint16_t)dx < (uint16_t)wRegion) { const uint8_t ni = (uint8_t)(b >> 4); if (ni) s_back[dx] = rd16(pal565 + ni); }
     }
     if (sx1 <= sxEnd) {
       const int16_t dx = hFlip ? (int16_t)(dxBaseF - sx1) : (int16_t)(dxBaseN + sx1);
-      if ((uint16_t)dx < (uint16_t)wRegion) { const uint8_t ni = (uint8_t)(b & 0x0F); const uint16_t c = paletteRam[ni]; if (c != key565) s_back[dx] = c; }
+      if ((uint16_t)dx < (uint16_t)wRegion) { const uint8_t ni = (uint8_t)(b & 0x0F); if (ni) s_back[dx] = rd16(pal565 + ni); }
     }
   }
 }
 
-void CA_Blit::composeOver4bppKeyIdx_AVR_P(const uint8_t* data, uint16_t w, uint16_t h,
-                                          int16_t vx, int16_t vy, uint16_t* paletteRam,
-                                          bool hFlip, uint8_t keyIndex,
-                                          int16_t y, int16_t x0, int16_t wRegion){
+void CA_Blit::composeOver4bppKey_AVR_P(const uint8_t* data, uint16_t w, uint16_t h,
+                                       int16_t vx, int16_t vy, uint16_t* paletteRam,
+                                       bool hFlip, uint16_t key565,
+                                       int16_t y, int16_t x0, int16_t wRegion){
   const int16_t row = (int16_t)(y - vy); if ((uint16_t)row >= h) return;
   const uint16_t bpr = (w + 1) >> 1;
   const uint8_t* src = data + (uint32_t)row * bpr;
@@ -695,15 +1008,22 @@ void CA_Blit::composeOver4bppKeyIdx_AVR_P(const uint8_t* data, uint16_t w, uint1
     if (sx & 1) {
       const uint8_t b = rd8(src + j);
       const uint8_t ni = (uint8_t)(b & 0x0F);
-      if (ni != keyIndex) s_back[dx] = paletteRam[ni];
+      const uint16_t c = paletteRam[ni];
+      if (c != key565) s_back[dx] = c;
       ++sx; ++dx; ++j;
     }
-    const int16_t jEnd = (int16_t)(hi >> 1);
+    // Whole bytes up to hi; an even hi ends on a high nibble
+    const int16_t jEnd = (int16_t)((hi - 1) >> 1);
     for (; j <= jEnd; ++j) {
       const uint8_t b = rd8(src + j);
-      uint8_t ni;
-      ni = (uint8_t)(b >> 4); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; ++dx;
-      ni = (uint8_t)(b & 0x0F); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; ++dx;
+      uint8_t ni; uint16_t c;
+      ni = (uint8_t)(b >> 4); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; ++dx;
+      ni = (uint8_t)(b & 0x0F); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; ++dx;
+    }
+    if (!(hi & 1)) {
+      const uint8_t ni = (uint8_t)(rd8(src + j) >> 4);
+      const uint16_t c = paletteRam[ni];
+      if (c != key565) s_back[dx] = c;
     }
     return;
   }
@@ -719,26 +1039,33 @@ void CA_Blit::composeOver4bppKeyIdx_AVR_P(const uint8_t* data, uint16_t w, uint1
     if (sx & 1) {
       const uint8_t b = rd8(src + j);
       const uint8_t ni = (uint8_t)(b & 0x0F);
-      if (ni != keyIndex) s_back[dx] = paletteRam[ni];
+      const uint16_t c = paletteRam[ni];
+      if (c != key565) s_back[dx] = c;
       ++sx; --dx; ++j;
     }
-    const int16_t jEnd = (int16_t)(hi >> 1);
+    const int16_t jEnd = (int16_t)((hi - 1) >> 1);
     int16_t bytes = (int16_t)(jEnd - j + 1);
     while (bytes >= 2) {
       const uint8_t b0 = rd8(src + j);
       const uint8_t b1 = rd8(src + j + 1);
-      uint8_t ni;
-      ni = (uint8_t)(b0 >> 4); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; --dx;
-      ni = (uint8_t)(b0 & 0x0F); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; --dx;
-      ni = (uint8_t)(b1 >> 4); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; --dx;
-      ni = (uint8_t)(b1 & 0x0F); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; --dx;
+      uint8_t ni; uint16_t c;
+      ni = (uint8_t)(b0 >> 4); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; --dx;
+      ni = (uint8_t)(b0 & 0x0F); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; --dx;
+      ni = (uint8_t)(b1 >> 4); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; --dx;
+      ni = (uint8_t)(b1 & 0x0F); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; --dx;
       j += 2; bytes -= 2;
     }
     if (bytes == 1) {
       const uint8_t b = rd8(src + j);
-      uint8_t ni;
-      ni = (uint8_t)(b >> 4); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; --dx;
-      ni = (uint8_t)(b & 0x0F); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; --dx;
+      uint8_t ni; uint16_t c;
+      ni = (uint8_t)(b >> 4); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; --dx;
+      ni = (uint8_t)(b & 0x0F); c = paletteRam[ni]; if (c != key565) s_back[dx] = c; --dx;
+      ++j;
+    }
+    if (!(hi & 1)) {
+      const uint8_t ni = (uint8_t)(rd8(src + j) >> 4);
+      const uint16_t c = paletteRam[ni];
+      if (c != key565) s_back[dx] = c;
     }
     return;
   }
@@ -767,12 +1094,21 @@ void CA_Blit::composeOver4bppKeyIdx_AVR_P(const uint8_t* data, uint16_t w, uint1
     const int16_t sx1 = (int16_t)(sx0 + 1);
     if (sx0 >= sxStart) {
       const int16_t dx = hFlip ? (int16_t)(dxBaseF - sx0) : (int16_t)(dxBaseN + sx0);
-      if ((uint16_t)dx < (uint16_t)wRegion) { const uint8_t ni = (uint8_t)(b >> 4); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; }
+      if ((uint16_t)dx < (uint16_t)wRegion) { const uint8_t ni = (uint8_t)(b >> 4); const uint16_t c = paletteRam[ni]; if (c != key565) s_back[dx] = c; }
     }
     if (sx1 <= sxEnd) {
       const int16_t dx = hFlip ? (int16_t)(dxBaseF - sx1) : (int16_t)(dxBaseN + sx1);
-      if ((uint16_t)dx < (uint16_t)wRegion) { const uint8_t ni = (uint8_t)(b & 0x0F); if (ni != keyIndex) s_back[dx] = paletteRam[ni]; }
+      if ((uint16_t)dx < (uint16_t)wRegion) { const uint8_t ni = (uint8_t)(b & 0x0F); const uint16_t c = paletteRam[ni]; if (c != key565) s_back[dx] = c; }
     }
   }
 }
+
+void CA_Blit::composeOver4bppKeyIdx_AVR_P(const uint8_t* data, uint16_t w, uint16_t h,
+                                          int16_t vx, int16_t vy, uint16_t* paletteRam,
+                                          bool hFlip, uint8_t keyIndex,
+                                          int16_t y, int16_t x0, int16_t wRegion){
+  const int16_t row = (int16_t)(y - vy); if ((uint16_t)row >= h) return;
+  const uint16_t bpr = (w + 1) >> 1;
+  keyIdxRow<false>(data + (uint32_t)row * bpr, w, vx, paletteRam, hFlip, keyIndex, x0, wRegion);
+}
 #endif
\ No newline at end of file
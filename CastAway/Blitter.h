@@ -4,19 +4,134 @@
 #include <Arduino.h>
 #include <MCUFRIEND_kbv.h>
 #include <avr/pgmspace.h>
+#include "AssetSrc.h"
+
+// Widest scanline the line buffers hold (pixels). 480 covers the 480×320
+// ILI9486 panels; builds for 320×240 panels only can set 320 and save 640 B
+#ifndef CA_LINE_MAX
+#define CA_LINE_MAX 480
+#endif
+
+// How the 160×120 background meets a panel larger than 320×240:
+// 1 = fill it (480×320: 3× across, 8/3× down), 0 = 2× centred, letterboxed
+#ifndef CA_BG_FILL
+#define CA_BG_FILL 1
+#endif
+
+// Decoded rows a row-RLE background keeps in RAM (CA_RleBg; SRAM: 164 B each).
+// Two cover the screen rows of a 2× source row and the runs of a band shift
+#ifndef CA_BG_ROW_CACHE
+#define CA_BG_ROW_CACHE 2
+#endif
+
+// -----------------------------------------------------------------------------
+// CA_BgMap
+// Where the background lands on screen; CA_Draw::init() picks it from the
+// panel size. Columns are replicated sx times (a compiled kernel per factor,
+// 2 and 3); rows step by syStep/256 source rows per screen row, exact for 2×
+// (128) and 320 rows (96). Outside [x0, x0+w) × [y0, y0+h) is `border`.
+// A tile-map BG shows the 160×120 window of its world at (ox, oy)
+// -----------------------------------------------------------------------------
+struct CA_BgMap {
+  uint8_t  sx     = 2;
+  uint16_t syStep = 128;
+  int16_t  x0 = 0, y0 = 0;
+  int16_t  w = 320, h = 240;
+  uint16_t border = 0x0000;
+  int16_t  ox = 0, oy = 0;   // world origin, source pixels (tile maps only)
+
+  // Source row shown on screen row y, -1 in the letterbox
+  int16_t srcRow(int16_t y) const {
+    const int16_t ly = (int16_t)(y - y0);
+    if ((uint16_t)ly >= (uint16_t)h) return -1;
+    return (int16_t)(((uint16_t)ly * syStep) >> 8);
+  }
+  // First screen row showing source row r (r = source height: end of the BG)
+  int16_t screenRow(int16_t r) const {
+    return (int16_t)(y0 + (int16_t)((((uint32_t)r << 8) + syStep - 1) / syStep));
+  }
+  int16_t screenX(int16_t sx0) const { return (int16_t)(x0 + sx0 * sx); }
+};
+
+// -----------------------------------------------------------------------------
+// CA_TileBg
+// Tile-map background: deduplicated 8×8 8bpp tiles (64 B each, row-major) and
+// a row-major map of tile numbers, mapW × mapH tiles; HFLIP in an entry shows
+// the tile mirrored. The world may be larger than the 160×120 window the BG
+// map shows; it wraps at its edges. Pixels index the same 256-entry BG
+// palette as the bitmap. All PROGMEM
+// -----------------------------------------------------------------------------
+struct CA_TileBg {
+  static const uint16_t HFLIP = 0x8000;
+  const uint8_t*  tiles;
+  const uint16_t* map;
+  uint8_t mapW, mapH;
+};
+
+// -----------------------------------------------------------------------------
+// CA_RleBg
+// Row-compressed 8bpp background, w × h (w <= MAX_W): rows of control bytes,
+// c < 0x80 followed by c+1 palette indices, c >= 0x80 by one index repeated
+// (c & 0x7F)+3 times. Row r is data[row[r] .. row[r+1]), so any row decodes
+// on its own. Built by tools/ca_assetc.cpp -bg. All PROGMEM
+// -----------------------------------------------------------------------------
+struct CA_RleBg {
+  static const uint8_t MAX_W = 160;
+  const uint8_t*  data;
+  const uint16_t* row;
+  uint8_t w, h;
+};
+
+#if CA_ASSET_STREAM
+// -----------------------------------------------------------------------------
+// CA_StreamBg
+// 8bpp background streamed from an asset pack: w × h row-major indices at off
+// in src (tools/ca_assetc -bg -pack), read a row at a time through the
+// CA_Asset row cache. Only the rows a line shows are ever in RAM
+// -----------------------------------------------------------------------------
+struct CA_StreamBg {
+  CA_AssetSrc* src;
+  uint32_t off;
+  uint8_t w, h;
+};
+#endif
+
+// -----------------------------------------------------------------------------
+// CA_LineDDA
+// A 1px line segment walked one scanline at a time (CA_Blit::lineSpan).
+// Endpoints are stored top first; `step` is the x advance per row (16.16) and
+// `cx` the rounded x of row `cy`, so the next row down costs one add and any
+// other row one multiply. Set up with CA_Blit::lineInit()
+// -----------------------------------------------------------------------------
+struct CA_LineDDA {
+  int16_t xa, ya, xb, yb;   // ya <= yb
+  int32_t step;             // (xb - xa) / (yb - ya), 16.16
+  int32_t cx;               // x of row cy + 0.5, 16.16
+  int16_t cy;
+};
 
 // -----------------------------------------------------------------------------
 // CA_BlitConfig
 // Lightweight bundle of LCD/viewport info shared by all blitters.
 //  - tft     : target display (already begun + rotated)
-//  - scale   : global sprite scale (usually 1). Background uses its own 2× path.
-//  - screenW/H: physical screen size in pixels after rotation.
+//  - scale   : global sprite scale (usually 1). Background uses its own path.
+//  - screenW/H: physical screen size in pixels after rotation (W capped at
+//               CA_LINE_MAX)
+//  - bg      : background placement and scale for this panel
+//  - tiles   : background source when set, else rle, else stream when set,
+//              else the BG8 quadrant bitmap
 // -----------------------------------------------------------------------------
 struct CA_BlitConfig {
   MCUFRIEND_kbv* tft = nullptr;
   uint8_t  scale  = 1;
   int16_t  screenW = 320;
   int16_t  screenH = 240;
+  CA_BgMap bg;
+  const CA_TileBg* tiles = nullptr;
+  const CA_RleBg*  rle   = nullptr;
+#if CA_ASSET_STREAM
+  const CA_StreamBg* stream = nullptr;
+#endif
 };
 
 // -----------------------------------------------------------------------------
@@ -74,6 +189,12 @@ namespace CA_Blit {
                                bool hFlip, uint8_t keyIndex,
                                int16_t y, int16_t x0, int16_t wRegion);
 
+  // One row of a 4bpp sprite already in RAM (a streamed frame's), w pixels
+  // wide at vx, keyed like composeOver4bppKeyIdx_P
+  void composeOver4bppKeyIdxRow(const uint8_t* row, uint16_t w, int16_t vx,
+                                uint16_t* paletteRam, bool hFlip, uint8_t keyIndex,
+                                int16_t x0, int16_t wRegion);
+
   // Fill a solid rectangle on the current scanline into s_back[]
   // Only affects the portion intersecting y and [x0, x0+wRegion]
   void composeSolidRectLine(int16_t y, int16_t x0, int16_t wRegion,
@@ -92,6 +213,18 @@ namespace CA_Blit {
                        int16_t bx, int16_t by, int16_t bw, int16_t bh,
                        int16_t fillW, uint16_t color565);
 
+  // Line segments: lineInit() prepares the stepper, lineSpan() gives the
+  // pixels [L, R] the line covers on row y (false off its rows) and moves the
+  // cursor there. Rows of a shallow line abut without overlap; steep lines
+  // take one pixel per row
+  void lineInit(CA_LineDDA& s, int16_t xa, int16_t ya, int16_t xb, int16_t yb);
+  bool lineSpan(CA_LineDDA& s, int16_t y, int16_t& L, int16_t& R);
+
+  // Draw the line's span on this scanline into s_back[]
+  // Only affects the portion intersecting [x0, x0+wRegion)
+  void composeSegmentLine(int16_t y, int16_t x0, int16_t wRegion,
+                          CA_LineDDA& s, uint16_t color565);
+
   // ---------------------------------------------------------------------------
   // Background line composer: 160×120 → 320×240 (2× scale)
   // Reconstructs the background scanline y (screen space) using pre-split
@@ -109,7 +242,46 @@ namespace CA_Blit {
                                       const uint16_t* pal565,
                                       int16_t y, int16_t x0, int16_t w);
 
-  // Enable AVR-optimized inner loop for BG replicate (2x) when available
+  // Background line composer for any panel: scales by `m` (2× or 3× across)
+  // and fills the letterbox around it. Per pixel the 2× map runs the same
+  // kernel as the 160to320 path above. Arguments as above, y/x0/w in screen
+  // space. dx shifts the row left by dx screen pixels, wrapping around the
+  // BG width (parallax bands); the letterbox does not move
+  void composeBGLine_quads_P(const CA_BgMap& m,
+                             const uint8_t* q0, const uint8_t* q1,
+                             const uint8_t* q2, const uint8_t* q3,
+                             uint16_t w160, uint16_t h120,
+                             uint16_t cw, uint16_t ch,
+                             const uint16_t* pal565,
+                             int16_t y, int16_t x0, int16_t w, int16_t dx = 0);
+
+  // Same for a tile-map BG: the window at (m.ox, m.oy) of the world, scaled
+  // and shifted like the bitmap. One map read per 8 source pixels
+  void composeBGLine_tiles_P(const CA_BgMap& m, const CA_TileBg& t,
+                             const uint16_t* pal565,
+                             int16_t y, int16_t x0, int16_t w, int16_t dx = 0);
+
+  // Same for a row-RLE BG. Rows are decoded into a small RAM cache
+  // (CA_BG_ROW_CACHE), left to right only as far as a line needs, and the
+  // row kernels then read RAM instead of flash
+  void composeBGLine_rle_P(const CA_BgMap& m, const CA_RleBg& b,
+                           const uint16_t* pal565,
+                           int16_t y, int16_t x0, int16_t w, int16_t dx = 0);
+
+  // Source row r of a row-RLE BG in RAM, decoded at least up to pixel x1
+  // (exclusive). It stays valid while fewer than CA_BG_ROW_CACHE other rows
+  // are decoded
+  const uint8_t* rleBgRow(const CA_RleBg& b, int16_t r, int16_t x1);
+
+#if CA_ASSET_STREAM
+  // Same for a BG streamed from an asset pack: each source row is fetched
+  // through the CA_Asset row cache, then drawn by the RAM row kernels
+  void composeBGLine_stream(const CA_BgMap& m, const CA_StreamBg& b,
+                            const uint16_t* pal565,
+                            int16_t y, int16_t x0, int16_t w, int16_t dx = 0);
+#endif
+
+  // Enable AVR-optimized inner loop for BG replicate (2x/3x) when available
 #ifndef CA_AVR_BG_FAST
 #define CA_AVR_BG_FAST 1
 #endif
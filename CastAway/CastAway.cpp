@@ -38,6 +38,26 @@ void fastFormatFishCount(char* buf, uint16_t count) {
 // Background optimization: disable fish rendering for testing
 static bool s_disableFishRendering = false;
 
+// Parallax bands (BG source rows): the top of the sky drifts, the lake surface
+// below the shore sways. Rows below the reflections stay put (fish swim there)
+namespace {
+  const CA_Parallax::Band PARALLAX_BANDS[] PROGMEM = {
+    {  0, 6, 0, 400 },
+    { 82, 8, 2, 180 },
+  };
+}
+
+// Time of day: palette tints (128 = stock color), each faded into and held.
+// The loop runs about three and a half minutes
+namespace {
+  const CA_TimeOfDay::Phase TOD_PHASES[] PROGMEM = {
+    { { 128, 128, 128 }, 12000, 60000 },   // day
+    { { 150, 104,  88 }, 12000, 25000 },   // dusk
+    { {  56,  68, 112 }, 12000, 45000 },   // night
+    { { 136, 112, 120 }, 12000, 10000 },   // dawn
+  };
+}
+
 void CastAwayGame::begin(MCUFRIEND_kbv* tft){
   active = true;
   randomSeed(analogRead(A0));
@@ -47,18 +67,34 @@ void CastAwayGame::begin(MCUFRIEND_kbv* tft){
 
   CA_Draw::drawBackground(blitCfg);
   renderer.setBgPalette(CA_Draw::getBgPaletteRAM());
+  water.begin(blitCfg, CA_Draw::getBgPaletteRAM());
+  renderer.setWaterFx(&water);
+  renderer.setPixelBudget(RENDER_PX_BUDGET);
+  renderer.setInterlaceArea(RENDER_IL_AREA);
+  waterCycle.begin(CA_Draw::getBgPaletteRAM(), BG8_cyc_idx, BG8_CYC_N,
+                   BG8_cyc_span, BG8_CYC_SPANS);
+  parallax.begin(renderer, PARALLAX_BANDS, sizeof(PARALLAX_BANDS) / sizeof(PARALLAX_BANDS[0]));
+  timeOfDay.begin(blitCfg, CA_Draw::getBgPaletteRAM(), BG8_pal565, &waterCycle,
+                  TOD_PHASES, sizeof(TOD_PHASES) / sizeof(TOD_PHASES[0]), millis());
 
   gs.vw = blitCfg.screenW; gs.vh = blitCfg.screenH;
 
-  gs.boatX = gs.vw/2 - (BOAT_W/2) + 16;
-  gs.boatY = gs.vh/2 + 41;
+  // Boat and lake sit on the same spot of the picture whatever the panel's
+  // BG map (2× on 320×240: boat at 161, water from row 172)
+  const CA_BgMap& bg = blitCfg.bg;
+  gs.boatX = (int16_t)(bg.x0 + bg.w/2 - (BOAT_W/2) + 16);
+  gs.boatY = (int16_t)(bg.y0 + bg.h/2 + (41 * bg.h) / 240);
   gs.manX  = gs.boatX + BOAT_W/2 - MAN1_W/2 - 8;
   gs.manY  = gs.boatY - MAN1_H + 2;
   gs.rodAx = gs.boatX - 32;
   gs.rodAy = gs.boatY - 13;
 
-  // cache the boat's single frame palette
-  boatPalCached = CA_Draw::ensurePaletteRAM(BOAT_pal565);
+  // Sprite descriptors: every frame's RAM palette and key, resolved once
+  boatDesc    = renderer.registerFrames(AnimTables::BOAT_FR, 1);
+  manDesc     = renderer.registerAnim(MAN_IDLE);
+  rodIdleDesc = renderer.registerAnim(AnimTables::ROD_IDLE);
+  rodPullDesc = renderer.registerAnim(AnimTables::ROD_PULL);
+  fishDesc    = renderer.registerAnim(FISH_SWIM);
 
   manAnim      = MAN_IDLE;
   manAnimStart = millis();
@@ -66,14 +102,18 @@ void CastAwayGame::begin(MCUFRIEND_kbv* tft){
   rodAnim      = &AnimTables::ROD_IDLE;
   rodAnimStart = millis();
 
-  const int16_t seaY0  = (gs.vh * 72) / 100;  // Revert to original calculation
+  const int16_t seaY0  = (int16_t)(bg.y0 + ((int32_t)bg.h * 72) / 100);
   fishParams.y0 = seaY0;
   fishParams.vw = gs.vw;
-  fishParams.vh = gs.vh - seaY0; if (fishParams.vh < 0) fishParams.vh = 0;
+  fishParams.vh = (int16_t)(bg.y0 + bg.h - seaY0); if (fishParams.vh < 0) fishParams.vh = 0;
   // Use configurable starting fish count, clamped to capacity
   fishParams.count = (startFishCount > FMAX) ? FMAX : startFishCount;
   // Initialize fish array with the chosen count
   CA_FishOps::init(fish, fishParams, rnd());
+  particles.begin(blitCfg, CA_Draw::getBgPaletteRAM(), seaY0);
+  renderer.setParticles(&particles);
+  fxState = 0xFF;
+  nextBubbleMs = millis();
 
   gs.tension     = 30;
   gs.caughtCount = initCaughtCount; // honor pre-begin setCaughtCount()
@@ -85,25 +125,26 @@ void CastAwayGame::begin(MCUFRIEND_kbv* tft){
   
   // Reset endgame state
   endgameTriggered = false;
+  endgameModal = false;
   endgameStartMs = 0;
 
   fpsWindowStart = millis();
   fpsFrames = 0; fpsValue = 0;
   strcpy(fpsBuf, "0fps");
 
+  quality.begin(CA_TARGET_FPS, millis());
+  shimmerFull = water.getDensity();
+  manStepCounter = fishStepCounter = 0;
+  manIdxCached = 0;
+  applyQuality();
+
   // Initial HUD
   renderer.beginFrame();
 
 
   // 1) Queue BOAT as a FOREGROUND sprite now, so markForegroundDirty can see it
-  {
-    const CA_Frame4 boatF = { BOAT_data, BOAT_pal565, BOAT_W, BOAT_H };
-    const int16_t boatX = gs.boatX;
-    const int16_t boatY = gs.boatY - BOAT_H + 6;
-    const uint16_t boatKey = CA_Draw::frameKey565(boatF, boatPalCached);
-    renderer.addSpriteFG(boatF, boatX, boatY, /*hFlip=*/false,
-                         boatPalCached, boatKey, /*z within FG*/ 0);
-  }
+  renderer.addSpriteId(CA_Render::LAYER_FG, boatDesc, gs.boatX, (int16_t)(gs.boatY - BOAT_H + 6),
+                       /*hFlip=*/false, /*z within FG*/ 0);
 
   // HUD widgets
   const uint16_t COL_BG=0x224B, COL_WHITE=0xFFFF;
@@ -137,6 +178,127 @@ void CastAwayGame::begin(MCUFRIEND_kbv* tft){
   prevTension = gs.tension;
   strncpy(prevMsg, gs.msg.l0, sizeof(prevMsg)-1); prevMsg[sizeof(prevMsg)-1]=0;
 }
+// ---- Endgame modal ("Lake emptied!") ----
+namespace {
+  const int16_t MODAL_BTN_Y = 120, MODAL_BTN_W = 70, MODAL_BTN_H = 20;
+  inline bool hitButton(int16_t sx, int16_t sy, int16_t bx) {
+    return sx >= bx && sx < bx + MODAL_BTN_W && sy >= MODAL_BTN_Y && sy < MODAL_BTN_Y + MODAL_BTN_H;
+  }
+}
+
+// Queued every frame while it is up, so any repaint underneath keeps it whole
+void CastAwayGame::queueEndgameModal(){
+  const uint16_t COL_BLACK=0x0000, COL_WHITE=0xFFFF;
+  renderer.addSolid  (MODAL_X, MODAL_Y, MODAL_W, MODAL_H, COL_BLACK, +2000);
+  renderer.addOutline(MODAL_X, MODAL_Y, MODAL_W, MODAL_H, COL_WHITE, +2001);
+  renderer.addText("Lake emptied! Maybe do", 60, 88,  COL_WHITE, +2002);
+  renderer.addText("something productive?",  60, 102, COL_WHITE, +2002);
+  renderer.addOutline(MODAL_EXIT_X, MODAL_BTN_Y, MODAL_BTN_W, MODAL_BTN_H, COL_WHITE, +2001);
+  renderer.addText("Exit", 75, 126, COL_WHITE, +2002);
+  renderer.addOutline(MODAL_RESTART_X, MODAL_BTN_Y, MODAL_BTN_W, MODAL_BTN_H, COL_WHITE, +2001);
+  renderer.addText("Restart", 198, 126, COL_WHITE, +2002);
+}
+
+// The rod frames draw the line down to the water; a polyline carries it on
+// to the lure, slack while idle and taut while reeling. The renderer dirties
+// only the thin boxes along it, so it is free while nothing moves
+void CastAwayGame::queueFishingLine(uint8_t rodId, int16_t rodX, int16_t rodY){
+  const CA_Render::SpriteDesc& d = renderer.spriteDesc(rodId);
+  const CA_Frame4& rodF = *d.f;
+  if (d.f != lineRodF) {
+    // Lowest row with a drawn pixel, leftmost pixel in it (the line, not the rod)
+    lineRodF = d.f;
+    const uint8_t key = d.keyIdx;
+    bool found = false;
+    for (int16_t y = (int16_t)(rodF.h - 1); y >= 0 && !found; --y){
+      for (uint16_t x = 0; x < rodF.w; ++x){
+        const uint8_t idx = CA_Anim::pixelAt(rodF, x, (uint16_t)y);
+        if (idx == key) continue;
+        lineEndX = (int8_t)x; lineEndY = (int8_t)y; lineIdx = idx; found = true;
+        break;
+      }
+    }
+  }
+  const int16_t ax = (int16_t)(rodX + lineEndX), ay = (int16_t)(rodY + lineEndY + 1);
+  const int16_t lx = (int16_t)(gs.rodAx - 8),    ly = (int16_t)(gs.rodAy + 55);
+  const int16_t sag = (gs.state == GS_REEL) ? 0 : 3;
+  const int16_t pts[6] = { ax, ay, (int16_t)((ax + lx) / 2 - sag), (int16_t)((ay + ly) / 2), lx, ly };
+  renderer.addPolyline(pts, 3, d.palRam[lineIdx], +200);
+}
+
+// Frames a → b of a sprite at (x, y). Deltas of one keyframe differ from each
+// other only inside their two delta rects; other pairs repaint the sprite
+void CastAwayGame::markPoseChange(const CA_Frame4& a, const CA_Frame4& b, int16_t x, int16_t y){
+  int16_t x0 = 0, y0 = 0, x1 = (int16_t)max(a.w, b.w), y1 = (int16_t)max(a.h, b.h);
+  if (a.data == b.data && a.w == b.w && a.h == b.h) {
+    int16_t ax0, ay0, ax1, ay1, bx0, by0, bx1, by1;
+    const bool da = CA_Anim::deltaBounds(a, ax0, ay0, ax1, ay1);
+    const bool db = CA_Anim::deltaBounds(b, bx0, by0, bx1, by1);
+    if (!da && !db) return;                    // same pixels
+    if (!da) { ax0 = bx0; ay0 = by0; ax1 = bx1; ay1 = by1; }
+    if (!db) { bx0 = ax0; by0 = ay0; bx1 = ax1; by1 = ay1; }
+    x0 = min(ax0, bx0); y0 = min(ay0, by0); x1 = max(ax1, bx1); y1 = max(ay1, by1);
+  } else {
+    --x0; --y0; ++x1; ++y1;                    // as the MR box: a pixel of pad
+  }
+  renderer.addDirtyWorldRect((int16_t)(x + x0), (int16_t)(y + y0), (int16_t)(x1 - x0), (int16_t)(y1 - y0), CA_Render::PRIO_HIGH);
+}
+
+// New round after the modal: only what changed is repainted. The modal's
+// rect brings back whatever it covered; HUD, fish and the man/rod mark their
+// own rects as their state resets. The rest of the screen never changed
+void CastAwayGame::restartGame(uint32_t now){
+  endgameModal = false;
+  renderer.addDirtyRect(MODAL_X, MODAL_Y, MODAL_W, MODAL_H);
+
+  endgameTriggered = false;
+  endgameStartMs = 0;
+  gs.tension = 30; gs.tensionVel = 0; gs.activeBiter = -1; gs.state = GS_DRIFT;
+  gs.caughtCount = 0; // Reset score
+  gs.holding = false; gs.stylusWasDown = false;
+  CA_Logic::clearMessages(gs);
+
+  // Reset fish (they flew off screen; new ones dirty their rects when drawn)
+  CA_FishOps::init(fish, fishParams, rnd());
+
+  // Reset animations
+  manAnimStart = now;
+  rodAnimStart = now;
+
+  // Reset FPS tracking
+  fpsWindowStart = now;
+  fpsFrames = 0;
+
+  // Force HUD refresh
+  forceCaughtHudRefresh = true;
+}
+
+// Push the governor's knobs for the current level to the effects and renderer
+void CastAwayGame::applyQuality(){
+  water.setDensity((uint8_t)(((uint16_t)shimmerFull * quality.shimmerPct() + 99) / 100));
+  waterCycle.setStepMs(quality.cycleStepMs());
+  parallax.setEnabled(quality.parallax());
+  particles.setCellBudget(quality.particleCells());
+  renderer.setFrameSkip(quality.frameSkip());
+}
+
+#if CA_RENDER_LOG
+void CastAwayGame::registerFrames(CA_FrameRegistry& r){
+  using namespace AnimTables;
+  r.add(BOAT_FR, 1);
+  r.add(MAN_FRAMES, 6);
+  r.add(ROD_IDLE_FR, 3);
+  r.add(ROD_PULL_FR, reel_frame_count);
+  r.add(FISH_FRAMES, 2);
+}
+#endif
+
+// Hardware scroll band (see CA_Render::setScrollBand)
+void CastAwayGame::setScrollBand(int16_t a0, int16_t len, int8_t pxPerTick){
+  renderer.setScrollBand(a0, len, blitCfg.screenW > blitCfg.screenH);
+  scrollSpeed = len ? pxPerTick : 0;
+}
+
 // Set caught (score)
 void CastAwayGame::setCaughtCount(uint16_t n, bool showHudMessage){
   if (!active) {
@@ -164,6 +326,9 @@ void CastAwayGame::tick(){
 
   const uint32_t now = millis();
 
+  // Quality governor: one frame-time sample per rendered frame
+  if (quality.sample(now, !renderer.frameSkipped())) applyQuality();
+
   // Exit button rect
   const int BXW=40, BXH=16, BXX=blitCfg.screenW-(BXW+6), BXY=blitCfg.screenH-(BXH+6);
 
@@ -200,64 +365,85 @@ void CastAwayGame::tick(){
     (void)lureX; (void)lureY; // currently only used by fish update call below
   }
 
-  // FISH first
-  gs.activeBiter = CA_FishOps::updateAndDraw(
-      fish, fishParams, blitCfg, fishAnim,
-      /*lureX*/ gs.rodAx - 8, /*lureY*/ gs.rodAy + 55,
-      gs.state, gs.activeBiter, now);
+  // FISH first (the governor may thin the AI cadence; fish hold still between steps)
+  const bool fishStep = (++fishStepCounter >= quality.fishEvery());
+  if (fishStep) {
+    fishStepCounter = 0;
+    gs.activeBiter = CA_FishOps::updateAndDraw(
+        fish, fishParams, blitCfg, fishAnim,
+        /*lureX*/ gs.rodAx - 8, /*lureY*/ gs.rodAy + 55,
+        gs.state, gs.activeBiter, now);
+  }
 
-  // FSM
-  CA_Logic::step(gs, blitCfg);
+  // FSM (paused while the endgame modal waits for a choice)
+  if (!endgameModal) CA_Logic::step(gs, blitCfg);
+
+  // Particles: ripples on a bite, a splash on a catch, bubbles from the lure
+  // while it waits
+  {
+    const int16_t lureX = (int16_t)(gs.rodAx - 8), lureY = (int16_t)(gs.rodAy + 55);
+    if (gs.state != fxState) {
+      if (gs.state == GS_BITE)  particles.emit(CA_Particles::RIPPLE, lureX, fishParams.y0, 6);
+      if (gs.state == GS_CATCH) particles.emit(CA_Particles::SPLASH, lureX, fishParams.y0, 16);
+      fxState = gs.state;
+    }
+    if ((gs.state == GS_IDLE || gs.state == GS_DRIFT) && (int32_t)(now - nextBubbleMs) >= 0) {
+      particles.emit(CA_Particles::BUBBLE, lureX, lureY, 1);
+      nextBubbleMs = now + 1200 + (rnd() & 1023);
+    }
+  }
 
 
   // RENDERING
   renderer.beginFrame();
 
+  // Water shimmer: moves a few squares and dirties only the cells they touch
+  water.update(renderer, now);
+  // Water palette cycle: repaints only the spans that use the cycled blues
+  waterCycle.update(renderer, now);
+  if (scrollSpeed) renderer.scrollBy(scrollSpeed);
+  // Parallax: repaints only the bands whose offset moved; holds while scrolling
+  parallax.update(renderer, now);
+  // Time of day: a few palette entries per frame, repaints paced by the renderer
+  timeOfDay.update(renderer, now);
+  // Particles: steps within the cell budget, dirties the cells they touched
+  particles.update(renderer, now);
+
   // Fish (conditionally disabled for testing). Fish AI handles endgame flying.
   if (!s_disableFishRendering && fishParams.count) {
     for (uint8_t i=0;i<fishParams.count;++i){
-      const uint8_t frameNow  = fish[i].curFrame;
+      const uint8_t frameNow  = fish.frame(i);
       const CA_Frame4& frNow  = fishAnim.frames[frameNow];
-      uint16_t* pal = CA_Draw::ensurePaletteRAM(frNow.pal565);
-      const uint16_t key565 = CA_Draw::frameKey565(frNow, pal);
+      int16_t dx, dy;
+      CA_FishOps::drawPos(fish, i, fishParams, fishAnim, dx, dy);
 
       // Ensure the fish's current on-screen rect is marked dirty so the
       // background is composed under its new position (prevents vanish/ghosts
       // when movement skips out of the previous dirty area).
-      // Add a tiny 1px pad for safety.
-      {
+      // Add a tiny 1px pad for safety. Nothing moved without an AI step
+      if (fishStep) {
         // Pad more generously to account for flips and union rounding merges
-        int16_t cx = (int16_t)(fish[i].drawX - 2);
-        int16_t cy = (int16_t)(fish[i].drawY - 2);
+        int16_t cx = (int16_t)(dx - 2);
+        int16_t cy = (int16_t)(dy - 2);
         int16_t cw = (int16_t)(frNow.w + 4);
         int16_t ch = (int16_t)(frNow.h + 4);
-        renderer.addDirtyWorldRect(cx, cy, cw, ch);
+        renderer.addDirtyWorldRect(cx, cy, cw, ch, fishPrio(i));
       }
 
-      renderer.addSprite(
-        frNow, fish[i].drawX, fish[i].drawY, (fish[i].flip != 0),
-        pal, key565, -10
-      );
+      renderer.addSpriteId(CA_Render::LAYER_WORLD, (uint8_t)(fishDesc + frameNow),
+                           dx, dy, fish.flip(i), -10);
     }
   }
 
   // ---- WORLD: man, boat, rod ---- 
-  // Reduce man animation frequency to minimize BG recomposition
-  static uint8_t s_manUpdateCounter = 0;
-  static uint8_t s_cachedManIdx = 0;
-  
-  if (++s_manUpdateCounter >= 3) {  // Update man animation every 3rd frame
-    s_manUpdateCounter = 0;
-    s_cachedManIdx = CA_Anim::frameAt(manAnim, manAnimStart, now);
+  // Man pose is re-picked at the governor's ambient rate
+  if (++manStepCounter >= quality.manEvery()) {
+    manStepCounter = 0;
+    manIdxCached = CA_Anim::frameAt(manAnim, manAnimStart, now);
   }
-  
-  const uint8_t manIdx = s_cachedManIdx;
-  const CA_Frame4& manF = manAnim.frames[manIdx];
 
-  // Boat: static foreground sprite (do NOT union into world dirty)
-  const CA_Frame4 boatF = { BOAT_data, BOAT_pal565, BOAT_W, BOAT_H };
-  const int16_t boatX = gs.boatX;
-  const int16_t boatY = gs.boatY - BOAT_H + 6;
+  const uint8_t manIdx = manIdxCached;
+  const CA_Frame4& manF = manAnim.frames[manIdx];
 
   // choose rod anim: ONLY pull during REEL (idle otherwise)
   const CA_Anim4* desiredRod = (gs.state == GS_REEL) ? &AnimTables::ROD_PULL : &AnimTables::ROD_IDLE;
@@ -277,12 +463,14 @@ void CastAwayGame::tick(){
   // Base rod frame from the current set (or tension bend)
   uint8_t rodAnimIdx = CA_Anim::frameAt(*rodAnim, rodAnimStart, fakeNow);
   const CA_Frame4* rodPtr = &rodAnim->frames[rodAnimIdx];
+  uint8_t rodId = (uint8_t)((rodAnim == &AnimTables::ROD_PULL ? rodPullDesc : rodIdleDesc) + rodAnimIdx);
   if (gs.state == GS_REEL) {
     int ridx = (int)((long)gs.tension * reel_frame_count / 1001);   // 0..4 by tension
     if (gs.tensionVel >  10) ++ridx;                     // pulling up = more bend
     if (gs.tensionVel < -10) --ridx;                     // dropping = relax
     if (ridx < 0) ridx = 0; else if (ridx > reel_frame_count - 1) ridx = reel_frame_count - 1;
     rodPtr = &AnimTables::ROD_PULL_FR[ridx];
+    rodId  = (uint8_t)(rodPullDesc + ridx);
   }
   const CA_Frame4& rodF = *rodPtr;
 
@@ -301,15 +489,19 @@ void CastAwayGame::tick(){
   // pad a pixel to catch outlines etc.
   mr_x0 -= 1; mr_y0 -= 1; mr_x1 += 1; mr_y1 += 1;
 
-  // Only mark dirty if pose changed or during REEL
+  // Only mark dirty if pose changed or during REEL. Otherwise man and rod hold
+  // still, and a pose change repaints only where the two frames differ
   bool mrChanged = (manIdx != lastManIdx) || (rodPtr != lastRodPtr) || (gs.state == GS_REEL);
-  if (mrChanged) {
+  if (mrChanged && gs.state != GS_REEL && lastManIdx != 0xFF && lastRodPtr) {
+    if (manIdx != lastManIdx) markPoseChange(manAnim.frames[lastManIdx], manF, gs.manX, gs.manY);
+    if (rodPtr != lastRodPtr) markPoseChange(*lastRodPtr, rodF, gs.rodAx, (int16_t)(gs.rodAy - rodF.h + 24));
+  } else if (mrChanged) {
     // re-draw previous MR box to clean trails
     if (prevMR_x1 > prevMR_x0 && prevMR_y1 > prevMR_y0) {
-      renderer.addDirtyWorldRect(prevMR_x0, prevMR_y0, (int16_t)(prevMR_x1 - prevMR_x0), (int16_t)(prevMR_y1 - prevMR_y0));
+      renderer.addDirtyWorldRect(prevMR_x0, prevMR_y0, (int16_t)(prevMR_x1 - prevMR_x0), (int16_t)(prevMR_y1 - prevMR_y0), CA_Render::PRIO_HIGH);
     }
-    // draw current MR box
-    renderer.addDirtyWorldRect(mr_x0, mr_y0, (int16_t)(mr_x1 - mr_x0), (int16_t)(mr_y1 - mr_y0));
+    // draw current MR box (the player: rod bend is the reel feedback)
+    renderer.addDirtyWorldRect(mr_x0, mr_y0, (int16_t)(mr_x1 - mr_x0), (int16_t)(mr_y1 - mr_y0), CA_Render::PRIO_HIGH);
   }
 
   // stash for next frame
@@ -317,33 +509,23 @@ void CastAwayGame::tick(){
   lastManIdx = manIdx; lastRodPtr = rodPtr;
 
   // === Enqueue sprites (boat drawn as static foreground with highest Z) ===
-  uint16_t* manPal  = CA_Draw::ensurePaletteRAM(manF.pal565);
-  uint16_t* boatPal = boatPalCached;
-  uint16_t* rodPal  = CA_Draw::ensurePaletteRAM(rodF.pal565);
-
-  // Man (no prev-pose path)
-  renderer.addSprite(
-    manF, gs.manX, gs.manY, /*hFlip*/ false,
-    manPal, CA_Draw::frameKey565(manF, manPal), /*z*/ -5
-  );
-
-  // Rod (no prev-pose path)
+  // Man and rod (no prev-pose path)
+  renderer.addSpriteId(CA_Render::LAYER_WORLD, (uint8_t)(manDesc + manIdx), gs.manX, gs.manY, /*hFlip*/ false, /*z*/ -5);
   {
     const int16_t rodX = gs.rodAx;
     const int16_t rodY = (int16_t)(gs.rodAy - rodF.h + 24);
-    renderer.addSprite(
-      rodF, rodX, rodY, /*hFlip*/ false,
-      rodPal, CA_Draw::frameKey565(rodF, rodPal), /*z*/ +5
-    );
+    renderer.addSpriteId(CA_Render::LAYER_WORLD, rodId, rodX, rodY, /*hFlip*/ false, /*z*/ +5);
+    queueFishingLine(rodId, rodX, rodY);
   }
 
-  // add the boat to the foreground layer (z = 0 in FG layer)
-  renderer.addSpriteFG(boatF, boatX, boatY, false, boatPal, CA_Draw::frameKey565(boatF, boatPal), 0);
+  // Boat: static foreground sprite (do NOT union into world dirty), z = 0 in FG
+  renderer.addSpriteId(CA_Render::LAYER_FG, boatDesc, gs.boatX, (int16_t)(gs.boatY - BOAT_H + 6), false, 0);
 
   // carry-over fish dirty
-  for (uint8_t i=0;i<fishParams.count;++i){
-    if (fish[i].prevRectW && fish[i].prevRectH)
-      renderer.addDirtyWorldRect(fish[i].prevRectX, fish[i].prevRectY, fish[i].prevRectW, fish[i].prevRectH);
+  for (uint8_t i=0;i<fishParams.count && fishStep;++i){
+    int16_t px, py, pw, ph;
+    if (CA_FishOps::prevRect(fish, i, fishParams, blitCfg, px, py, pw, ph))
+      renderer.addDirtyWorldRect(px, py, pw, ph, fishPrio(i));
   }
 
   // ---- HUD Colors ----
@@ -378,7 +560,7 @@ void CastAwayGame::tick(){
   if (bw != lastBarW || barCol != lastBarCol || gs.state == GS_REEL || firstTime) {
     // Mark both UI and world dirty around the new slimmer frame
     renderer.addDirtyRect(tbX-2, tbY-2, tbW+4, tbH+4);
-    renderer.addDirtyWorldRect(tbX-2, tbY-2, tbW+4, tbH+4);
+    renderer.addDirtyWorldRect(tbX-2, tbY-2, tbW+4, tbH+4, CA_Render::PRIO_UI);
     lastBarW = bw; lastBarCol = barCol;
     firstTime = false;
     s_barNeedsClear = true;  // ensure interior gets cleared on this update
@@ -475,89 +657,27 @@ void CastAwayGame::tick(){
     endgameTriggered = true;
     endgameStartMs = now;
     // Set all fish to flying mode
-    CA_FishOps::setFlyingMode(fish, fishParams, now);
+    CA_FishOps::setFlyingMode(fish, fishParams);
   }
 
   if (endgameTriggered) {
     // Check if all fish have flown off screen
     bool allGone = true;
     for (uint8_t i=0;i<fishParams.count;++i){
-      if (fish[i].y > -50) { // Still visible or close to visible
+      if (fish.y[i] > -50) { // Still visible or close to visible
         allGone = false;
         break;
       }
     }
 
-    if (allGone) {
-      renderer.renderFrame();
-      // Modal choice
-      // Draw a bordered box with two buttons: Exit and Restart, wait for touch
-      MCUFRIEND_kbv* tft = blitCfg.tft;
-      tft->fillRect(40, 80, 240, 80, 0x0000);
-      tft->drawRect(40, 80, 240, 80, 0xFFFF);
-      tft->setTextColor(0xFFFF); tft->setTextSize(1);
-      tft->setCursor(60, 88); tft->print(F("Lake emptied! Maybe do"));
-      tft->setCursor(60, 102); tft->print(F("something productive?"));
-
-      tft->drawRect(60, 120, 70, 20, 0xFFFF); tft->setCursor(75, 126); tft->print(F("Exit"));
-      tft->drawRect(190, 120, 70, 20, 0xFFFF); tft->setCursor(198, 126); tft->print(F("Restart"));
-
-      // Wait for choice (blocking until valid tap)
-      int16_t sx=0, sy=0; bool chosen=false; bool exitChosen=false;
-      while (!chosen) {
-        if (CA_Draw::getTouchScreen(sx, sy)) {
-          if (sx>=60 && sx<130 && sy>=120 && sy<140) { exitChosen=true; chosen=true; }
-          else if (sx>=190 && sx<260 && sy>=120 && sy<140) { exitChosen=false; chosen=true; }
-        }
-      }
-
-      if (exitChosen) {
-        active = false; CA_Draw::restoreUI(); return;
-      } else {
-        // Full restart - reset all game state
-        endgameTriggered = false;
-        endgameStartMs = 0;
-        gs.tension = 30; gs.tensionVel = 0; gs.activeBiter = -1; gs.state = GS_DRIFT;
-        gs.caughtCount = 0; // Reset score
-        gs.holding = false; gs.stylusWasDown = false;
-        CA_Logic::clearMessages(gs);
-        
-        // Reset fish
-        CA_FishOps::init(fish, fishParams, rnd());
-        
-        // Reset animations
-        manAnimStart = now;
-        rodAnimStart = now;
-        
-        // Reset FPS tracking  
-        fpsWindowStart = now;
-        fpsFrames = 0;
-        
-        // Redraw BG and ensure boat FG is re-enqueued
-        CA_Draw::drawBackground(blitCfg);
-        
-        // Re-add boat to foreground layer (same as in begin())
-        {
-          const CA_Frame4 boatF = { BOAT_data, BOAT_pal565, BOAT_W, BOAT_H };
-          const int16_t boatX = gs.boatX;
-          const int16_t boatY = gs.boatY - BOAT_H + 6;
-          const uint16_t boatKey = CA_Draw::frameKey565(boatF, boatPalCached);
-          renderer.addSpriteFG(boatF, boatX, boatY, /*hFlip=*/false,
-                               boatPalCached, boatKey, /*z within FG*/ 0);
-        }
-        
-        renderer.markForegroundDirty();
-        
-        // Also explicitly dirty the entire boat area to ensure full redraw
-        const int16_t boatX = gs.boatX;
-        const int16_t boatY = gs.boatY - BOAT_H + 6;
-        renderer.addDirtyRect(boatX-2, boatY-2, BOAT_W+4, BOAT_H+4);
-        
-        // Force HUD refresh
-        forceCaughtHudRefresh = true;
-      }
+    // Modal choice: Exit or Restart. It is plain UI on top of the scene, so
+    // the loop keeps running; taps are handled with the Exit button below
+    if (allGone && !endgameModal) {
+      endgameModal = true;
+      renderer.addDirtyRect(MODAL_X, MODAL_Y, MODAL_W, MODAL_H);
     }
   }
+  if (endgameModal) queueEndgameModal();
 
   // Normal fish rendering continues even during endgame (fish AI handles flying)
   
@@ -585,11 +705,13 @@ void CastAwayGame::tick(){
     bool justTapped = (!prevDown && down);
     prevDown = down;
     if (justTapped) {
-      if (sx >= BXX && sx < BXX+BXW && sy >= BXY && sy < BXY+BXH) {
+      const bool modalExit = endgameModal && hitButton(sx, sy, MODAL_EXIT_X);
+      if (modalExit || (sx >= BXX && sx < BXX+BXW && sy >= BXY && sy < BXY+BXH)) {
         active = false;                 // deactivate game
         CA_Draw::restoreUI();           // hand back to sketch loop
         return;
       }
+      if (endgameModal && hitButton(sx, sy, MODAL_RESTART_X)) restartGame(now);
     }
   }
 }
@@ -9,26 +9,37 @@
 #include "FishAI.h"      // fish structs and update
 #include "GameLogic.h"   // game state + FSM
 #include "Render.h"      // scanline renderer (world + foreground + UI)
+#include "WaterFx.h"     // surface shimmer with its own dirty cells
+#include "Particles.h"   // splashes, ripples and bubbles (own dirty cells)
+#include "PalCycle.h"    // water palette cycling (repaints its span map only)
+#include "Parallax.h"    // drifting / swaying BG bands (repaints moved bands only)
+#include "TimeOfDay.h"   // day / dusk / night palette tints (paced repaints)
+#include "Quality.h"     // adaptive quality governor (frame time -> effect levels)
+#include "RenderLog.h"   // optional render command log (host replay)
 
 // Assets (4bpp frames + palettes in PROGMEM)
 #include "assets/BOAT.h"
-#include "assets/MAN1.h"
-#include "assets/MAN2.h"
-#include "assets/MAN3.h"
-#include "assets/MAN4.h"
-#include "assets/MAN5.h"
-#include "assets/MAN6.h"
-
-#include "assets/FISHINGROD1.h"
-#include "assets/FISHINGROD2.h"
-#include "assets/FISHINGROD3.h"
-#include "assets/FISHINGROD4.h"
-#include "assets/FISHINGROD5.h"
-#include "assets/FISHINGROD6.h"
-#include "assets/FISHINGROD7.h"
+#include "assets/ANGLER.h"     // MAN1..6 + FISHINGROD1..7: one shared palette, keyframes + deltas (tools/ca_assetc)
 
+#if CA_ASSET_PACK
+#include "assets/PACK_FISH.h"  // FISH1/FISH2 rows in the asset pack, palettes in flash
+#else
 #include "assets/FISH1.h"
 #include "assets/FISH2.h"
+#endif
+
+#include "assets/BG_CYCLE.h"   // palette-cycle ring + span map for the background
+
+// Static FG cache for the boat, in pixels (2 B + 1 bit of SRAM each, 0 = off).
+// The whole boat is BOAT_W×BOAT_H; a smaller budget caches its top rows only.
+// Off by default on AVR, where 2.8 KB is a third of the Mega's SRAM
+#ifndef CA_FG_CACHE_PX
+  #if defined(__AVR__)
+    #define CA_FG_CACHE_PX 0
+  #else
+    #define CA_FG_CACHE_PX (BOAT_W * BOAT_H)
+  #endif
+#endif
 
 // -----------------------------------------------------------------------------
 // CastAwayGame
@@ -55,12 +66,63 @@ public:
   void setFishCount(uint8_t n, bool reinit = true);
   uint8_t getFishCount() const { return fishParams.count; }
 
+  // Ambient hardware scroll: move a band of the screen by pxPerTick every tick
+  // using the controller's scrolling area (0 stops it where it is; len 0 turns
+  // the band off). In landscape the band is a run of full-height columns
+  // [a0, a0+len) scrolling sideways, in portrait a run of rows. Call after begin()
+  void setScrollBand(int16_t a0, int16_t len, int8_t pxPerTick);
+
+  // Renderer telemetry (dropped primitives, dirty-box overflows, peak usage)
+  const CA_Render::Stats& getRenderStats() const { return renderer.getStats(); }
+
+#if CA_RENDER_LOG
+  // Record the renderer's command lists into `log` (nullptr stops)
+  void setRenderLog(CA_RenderLog* log) { renderer.setRenderLog(log); }
+  // Frame ids for render logs. The recorder and the replay tool both fill
+  // their registry here: assets are per translation unit, so the pointers
+  // the game draws with only exist in CastAway.cpp
+  static void registerFrames(CA_FrameRegistry& r);
+#endif
+
 private:
+  static const uint8_t FMAX = CA_FISH_MAX; // fish capacity (FishAI.h: 64 on a Mega)
+
+  // Pixels per frame for WORLD/AMBIENT dirty boxes (~1/4 screen). HUD, the
+  // player and the biting fish are always drawn; larger repaints spread over
+  // the next frames so touch keeps being polled
+  static const uint32_t RENDER_PX_BUDGET = 20000;
+  // Dirty boxes above this area (~1/4 screen) are pushed as two interlaced fields
+  static const uint32_t RENDER_IL_AREA = 19200;
+
+  // Render queues sized for a full lake: every fish plus the man and the rod
+  struct RenderCaps : CA_RenderCaps {
+    static constexpr uint8_t SPR = FMAX + 2;
+    static constexpr uint16_t FGC = CA_FG_CACHE_PX;
+    static constexpr uint8_t DESC = 16;   // boat 1, man 6, rod 3 + 4, fish 2
+    static constexpr uint8_t TXT = 9;     // message 2, fps, caught, endgame modal 4, Exit
+  };
+
   // ---- lifetime / plumbing ----
   bool           active = false;      // when false, loop() can exit to a splash etc.
   CA_BlitConfig blitCfg;             // TFT pointer + screenW/H + scale (copied into renderer)
   CA_GameState  gs;                  // positions, input flags, scores, FSM bits (see GameLogic.h)
-  CA_Render      renderer;           // scanline renderer with world/foreground/UI layers
+  CA_RenderT<RenderCaps> renderer;   // scanline renderer with world/foreground/UI layers
+  CA_WaterFx    water;               // surface shimmer (composed by the renderer)
+  CA_Particles  particles;           // splashes, ripples, bubbles (composed by the renderer)
+  uint8_t       fxState = 0xFF;      // FSM state the particle emitters last saw
+  uint32_t      nextBubbleMs = 0;    // next bubble from the lure
+  CA_PalCycle   waterCycle;          // rotates the water blues in the BG palette
+  CA_Parallax   parallax;            // sky drift and lake sway (renderer BG bands)
+  CA_TimeOfDay  timeOfDay;           // tints every palette through the day
+  int8_t        scrollSpeed = 0;     // hardware scroll band step per tick (0 = still)
+
+  // ---- quality governor ----
+  CA_Quality    quality;             // steps effect levels against CA_TARGET_FPS
+  uint8_t       shimmerFull = 0;     // shimmer density picked at begin() (level 0)
+  uint8_t       manStepCounter = 0;  // frames since the man pose was re-picked
+  uint8_t       fishStepCounter = 0; // frames since the last fish AI step
+  uint8_t       manIdxCached = 0;
+  void applyQuality();               // push the current level's knobs to the effects
 
   // HUD refresh flags
   bool forceCaughtHudRefresh = false;
@@ -72,19 +134,30 @@ private:
   bool       manFlip = false;         // currently unused; placeholder for turning avatar
 
   // ---- fish ----
-  static const uint8_t FMAX = 20;     // Supports up to 20 fish (tuned for Mega2560 SRAM)
-  CA_Fish       fish[FMAX];          // individual fish runtime state
+  CA_FishesT<FMAX> fish;            // per-fish runtime state, one array per field
   CA_FishParams fishParams;          // bounds, waterline, etc.
   CA_Anim4      fishAnim;             // shared swim anim set (2 frames)
 
   // ---- mini endgame (empty lake) ----
   bool endgameTriggered = false;      // once true, animate fish fly-away and prompt
   uint32_t endgameStartMs = 0;        // when the sequence began
+  bool endgameModal = false;          // "Lake emptied!" choice is on screen
+  static const int16_t MODAL_X = 40, MODAL_Y = 80, MODAL_W = 240, MODAL_H = 80;
+  static const int16_t MODAL_EXIT_X = 60, MODAL_RESTART_X = 190;
+  void queueEndgameModal();           // modal as UI primitives (every frame while up)
+  void restartGame(uint32_t now);     // reset the round; repaints changed regions only
 
   // ---- rod ----
   const CA_Anim4* rodAnim = nullptr;  // either ROD_IDLE or ROD_PULL (or bend-by-tension override)
   uint32_t         rodAnimStart = 0;  // epoch for rodAnim timing
 
+  // ---- fishing line (under water, from where the rod art ends to the lure) ----
+  const CA_Frame4* lineRodF = nullptr; // rod frame the line end below was found in
+  int8_t           lineEndX = 0, lineEndY = 0; // lowest drawn pixel of that frame
+  uint8_t          lineIdx  = 0;       // its palette index: the line color
+  void queueFishingLine(uint8_t rodId, int16_t rodX, int16_t rodY);
+  void markPoseChange(const CA_Frame4& a, const CA_Frame4& b, int16_t x, int16_t y);
+
   // ---- HUD change tracking (to keep UI dirty as small as possible) ----
   int16_t  prevTension = -1;          // last tension (0..1000); -1 forces first paint
   char     prevMsg[22];               // last status line (fits 5x7 text width)
@@ -102,8 +175,14 @@ private:
   uint8_t  fpsValue       = 0;
   char     fpsBuf[8]      = "0fps";
 
-  // ---- palette caches ----
-  uint16_t* boatPalCached = nullptr;  // boat has a single frame → cache its 16 colors once
+  // ---- sprite descriptors (first renderer id of each set, from begin()) ----
+  uint8_t boatDesc = 0, manDesc = 0;  // frame i of a set is its first id + i
+  uint8_t rodIdleDesc = 0, rodPullDesc = 0, fishDesc = 0;
+
+  // Dirty priority of fish i: the one on the hook is what the player watches
+  uint8_t fishPrio(uint8_t i) const {
+    return ((int8_t)i == gs.activeBiter) ? (uint8_t)CA_Render::PRIO_HIGH : (uint8_t)CA_Render::PRIO_WORLD;
+  }
 
   // ---- tiny PRNG for quick effects ----
   uint32_t rng = 0xC0DEAAAAu;         // xorshift-ish; good enough for jitter and spawning
@@ -113,46 +192,59 @@ private:
 // -----------------------------------------------------------------------------
 // AnimTables
 // Static, compile-time animation definitions that stitch together PROGMEM frames
-// Each CNC_Anim4 is { frames[], frameCount, msPerFrame, loop }. Frames themselves
-// carry the PROGMEM data pointers and dimensions. These are read-only tables
+// Each CNC_Anim4 is { frames[], frameCount, msPerFrame, loop, pal565 }. Frames
+// themselves carry the PROGMEM data pointers and dimensions; man and rod frames
+// are mostly deltas of a keyframe (NAME_delta). These are read-only tables
 // -----------------------------------------------------------------------------
 namespace AnimTables {
 
   // Man idle: 6-frame loop, ~2.2 fps (450 ms per frame)
   static const CA_Frame4 MAN_FRAMES[6] = {
-    { MAN1_data, MAN1_pal565, MAN1_W, MAN1_H },
-    { MAN2_data, MAN2_pal565, MAN2_W, MAN2_H },
-    { MAN3_data, MAN3_pal565, MAN3_W, MAN3_H },
-    { MAN4_data, MAN4_pal565, MAN4_W, MAN4_H },
-    { MAN5_data, MAN5_pal565, MAN5_W, MAN5_H },
-    { MAN6_data, MAN6_pal565, MAN6_W, MAN6_H },
+    CA_FRAME4(MAN1_data, MAN1_pal565, MAN1_W, MAN1_H, MAN1_delta),
+    CA_FRAME4(MAN2_data, MAN2_pal565, MAN2_W, MAN2_H, MAN2_delta),
+    CA_FRAME4(MAN3_data, MAN3_pal565, MAN3_W, MAN3_H, MAN3_delta),
+    CA_FRAME4(MAN4_data, MAN4_pal565, MAN4_W, MAN4_H, MAN4_delta),
+    CA_FRAME4(MAN5_data, MAN5_pal565, MAN5_W, MAN5_H, MAN5_delta),
+    CA_FRAME4(MAN6_data, MAN6_pal565, MAN6_W, MAN6_H, MAN6_delta),
   };
-  static const CA_Anim4 MAN_IDLE = { MAN_FRAMES, 6, 750, 1 };
+  static const CA_Anim4 MAN_IDLE = { MAN_FRAMES, 6, 750, 1, ANGLER_pal565 };
 
   // Rod idle: subtle sway, 3 frames @ 250 ms
   static const CA_Frame4 ROD_IDLE_FR[3] = {
-    { FISHINGROD1_data, FISHINGROD1_pal565, FISHINGROD1_W, FISHINGROD1_H },
-    { FISHINGROD2_data, FISHINGROD2_pal565, FISHINGROD2_W, FISHINGROD2_H },
-    { FISHINGROD3_data, FISHINGROD3_pal565, FISHINGROD3_W, FISHINGROD3_H },
+    CA_FRAME4(FISHINGROD1_data, FISHINGROD1_pal565, FISHINGROD1_W, FISHINGROD1_H, FISHINGROD1_delta),
+    CA_FRAME4(FISHINGROD2_data, FISHINGROD2_pal565, FISHINGROD2_W, FISHINGROD2_H, FISHINGROD2_delta),
+    CA_FRAME4(FISHINGROD3_data, FISHINGROD3_pal565, FISHINGROD3_W, FISHINGROD3_H, FISHINGROD3_delta),
   };
-  static const CA_Anim4 ROD_IDLE = { ROD_IDLE_FR, 3, 250, 1 };
+  static const CA_Anim4 ROD_IDLE = { ROD_IDLE_FR, 3, 250, 1, ANGLER_pal565 };
 
   // Rod pull: bend frames selected by tension (not strictly time based)
   static const int reel_frame_count = 4;  // must match ROD_PULL_FR length
   static const CA_Frame4 ROD_PULL_FR[reel_frame_count] = {
-    { FISHINGROD4_data, FISHINGROD4_pal565, FISHINGROD4_W, FISHINGROD4_H },
-    { FISHINGROD5_data, FISHINGROD5_pal565, FISHINGROD5_W, FISHINGROD5_H },
-    { FISHINGROD6_data, FISHINGROD6_pal565, FISHINGROD6_W, FISHINGROD6_H },
-    { FISHINGROD7_data, FISHINGROD7_pal565, FISHINGROD7_W, FISHINGROD7_H },
+    CA_FRAME4(FISHINGROD4_data, FISHINGROD4_pal565, FISHINGROD4_W, FISHINGROD4_H, FISHINGROD4_delta),
+    CA_FRAME4(FISHINGROD5_data, FISHINGROD5_pal565, FISHINGROD5_W, FISHINGROD5_H, FISHINGROD5_delta),
+    CA_FRAME4(FISHINGROD6_data, FISHINGROD6_pal565, FISHINGROD6_W, FISHINGROD6_H, FISHINGROD6_delta),
+    CA_FRAME4(FISHINGROD7_data, FISHINGROD7_pal565, FISHINGROD7_W, FISHINGROD7_H, FISHINGROD7_delta),
   };
-  static const CA_Anim4 ROD_PULL = { ROD_PULL_FR, reel_frame_count, 350, 1 };
+  static const CA_Anim4 ROD_PULL = { ROD_PULL_FR, reel_frame_count, 350, 1, ANGLER_pal565 };
 
   // Fish swim: 2-frame loop, flip-flop @ 120 ms per frame
+#if CA_ASSET_PACK
+  static const CA_Frame4 FISH_FRAMES[2] = {
+    CA_FRAME4_SRC(FISH1_pal565, FISH1_W, FISH1_H, &CA_Asset::pack, FISH1_pack),
+    CA_FRAME4_SRC(FISH2_pal565, FISH2_W, FISH2_H, &CA_Asset::pack, FISH2_pack),
+  };
+#else
   static const CA_Frame4 FISH_FRAMES[2] = {
-    { FISH1_data, FISH1_pal565, FISH1_W, FISH1_H },
-    { FISH2_data, FISH2_pal565, FISH2_W, FISH2_H },
+    CA_FRAME4(FISH1_data, FISH1_pal565, FISH1_W, FISH1_H, nullptr),
+    CA_FRAME4(FISH2_data, FISH2_pal565, FISH2_W, FISH2_H, nullptr),
+  };
+#endif
+  static const CA_Anim4 FISH_SWIM = { FISH_FRAMES, 2, 120, 1, nullptr };   // 20 colors: one palette each
+
+  // Boat: single static frame
+  static const CA_Frame4 BOAT_FR[1] = {
+    CA_FRAME4(BOAT_data, BOAT_pal565, BOAT_W, BOAT_H, nullptr),
   };
-  static const CA_Anim4 FISH_SWIM = { FISH_FRAMES, 2, 120, 1 };
 }
 
 #endif
@@ -3,9 +3,26 @@
 #include <SPI.h>
 #include <string.h>
 
+#if CA_BG_TILES
+#include "assets/BG_TILES.h"
+#elif CA_BG_RLE
+#include "assets/BG_RLE.h"
+#elif CA_ASSET_PACK
+#include "assets/PACK_BG.h"
+#endif
+// The quadrant bitmap, unless another source was picked
+#define CA_BG_QUADS (!CA_BG_TILES && !CA_BG_RLE && !CA_ASSET_PACK)
+
 namespace { // global
   // Single pointer to the sketch-owned TFT
   MCUFRIEND_kbv* s_tft = nullptr;
+#if CA_BG_TILES
+  const CA_TileBg s_tileBg = { BG8_tiles, BG8_map, BG8_MAP_W, BG8_MAP_H };
+#elif CA_BG_RLE
+  const CA_RleBg s_rleBg = { BG8_rle, BG8_rle_row, BG8_W, BG8_H };
+#elif CA_ASSET_PACK
+  const CA_StreamBg s_streamBg = { &CA_Asset::pack, BG8_pack, BG8_W, BG8_H };
+#endif
 }
 
 namespace CA_Draw {
@@ -16,11 +33,110 @@ void init(CA_BlitConfig& cfg, MCUFRIEND_kbv* tft_in, uint8_t scale){
   cfg.scale   = scale;
   cfg.screenW = tft_in->width();
   cfg.screenH = tft_in->height();
+  if (cfg.screenW > CA_LINE_MAX) cfg.screenW = CA_LINE_MAX;
+
+  // Background map: 2× on 320×240; larger panels are filled (3× across
+  // where it fits, rows stretched to the height) or get 2× centred
+  CA_BgMap& m = cfg.bg;
+  m = CA_BgMap();
+  if (CA_BG_FILL && cfg.screenH > (int16_t)(BG8_H * 2)) {
+    if (cfg.screenW >= (int16_t)(BG8_W * 3)) m.sx = 3;
+    m.h = cfg.screenH;
+    m.syStep = (uint16_t)(((uint32_t)BG8_H << 8) / (uint16_t)m.h);
+  } else {
+    m.h = (int16_t)(BG8_H * 2);
+  }
+  m.w  = (int16_t)(BG8_W * m.sx);
+  m.x0 = (int16_t)((cfg.screenW - m.w) / 2);
+  m.y0 = (int16_t)((cfg.screenH - m.h) / 2);
+  cfg.tiles = nullptr;
+  cfg.rle   = nullptr;
+#if CA_ASSET_STREAM
+  cfg.stream = nullptr;
+#endif
+#if CA_ASSET_PACK
+  // BG rows and fish frames are read from the pack from here on
+  CA_Asset::pack.open(CA_ASSET_PACK_PATH);
+  CA_Asset::invalidate();
+#endif
+#if CA_BG_TILES
+  cfg.tiles = &s_tileBg;
+#elif CA_BG_RLE
+  cfg.rle   = &s_rleBg;
+#elif CA_ASSET_PACK
+  cfg.stream = &s_streamBg;
+#endif
   s_tft->fillScreen(0x0000);
 }
 
+void composeBgLine(const CA_BlitConfig& cfg, const uint16_t* pal, int16_t y, int16_t x0, int16_t w, int16_t dx){
+  if (cfg.tiles) { CA_Blit::composeBGLine_tiles_P(cfg.bg, *cfg.tiles, pal, y, x0, w, dx); return; }
+  if (cfg.rle)   { CA_Blit::composeBGLine_rle_P(cfg.bg, *cfg.rle, pal, y, x0, w, dx); return; }
+#if CA_ASSET_STREAM
+  if (cfg.stream) { CA_Blit::composeBGLine_stream(cfg.bg, *cfg.stream, pal, y, x0, w, dx); return; }
+#endif
+#if CA_BG_QUADS
+  CA_Blit::composeBGLine_quads_P(cfg.bg,
+    BG8_q0, BG8_q1, BG8_q2, BG8_q3,
+    BG8_W, BG8_H, BG8_cw, BG8_ch,
+    pal, y, x0, w, dx
+  );
+#endif
+}
+
+int16_t fetchBgLines(const CA_BlitConfig& cfg, int16_t y0, int16_t y1){
+#if CA_ASSET_STREAM
+  if (cfg.stream && !cfg.tiles && !cfg.rle) {
+    const CA_StreamBg& b = *cfg.stream;
+    const int16_t cap = (int16_t)CA_Asset::fetchRows(b.w);
+    int16_t r0 = -1, r1 = -1, y = y0;   // source rows [r0, r1] of [y0, y)
+    for (; y < y1; ++y){
+      int16_t r = cfg.bg.srcRow(y);
+      if (r < 0) continue;              // letterbox: no BG read
+      if (r >= (int16_t)b.h) r = (int16_t)(b.h - 1);
+      if (r0 < 0) r0 = r;
+      if (r - r0 >= cap) break;
+      r1 = r;
+    }
+    if (r0 >= 0) CA_Asset::fetch(b.src, b.off, b.w, (uint16_t)r0, (uint16_t)(r1 - r0 + 1), b.h);
+    return y;
+  }
+#endif
+  (void)cfg; (void)y0;
+  return y1;
+}
+
+void readBgRow(const CA_BlitConfig& cfg, int16_t row, uint8_t* idx){
+  if (cfg.tiles) {
+    const CA_TileBg& t = *cfg.tiles;
+    const int16_t worldW = (int16_t)((int16_t)t.mapW << 3), worldH = (int16_t)((int16_t)t.mapH << 3);
+    const int16_t wy = (int16_t)(((row + cfg.bg.oy) % worldH + worldH) % worldH);
+    for (int16_t x=0;x<(int16_t)BG8_W;++x){
+      const int16_t wx = (int16_t)(((x + cfg.bg.ox) % worldW + worldW) % worldW);
+      const uint16_t e = pgm_read_word(t.map + (uint16_t)(wy >> 3) * t.mapW + (wx >> 3));
+      const uint8_t k = (uint8_t)((e & CA_TileBg::HFLIP) ? 7 - (wx & 7) : (wx & 7));
+      idx[x] = pgm_read_byte(t.tiles + ((uint32_t)(e & 0x7FFF) << 6) + ((wy & 7) << 3) + k);
+    }
+    return;
+  }
+  if (cfg.rle) { memcpy(idx, CA_Blit::rleBgRow(*cfg.rle, row, BG8_W), BG8_W); return; }
+#if CA_ASSET_STREAM
+  if (cfg.stream) {
+    const CA_StreamBg& b = *cfg.stream;
+    memcpy(idx, CA_Asset::row(b.src, b.off, b.w, (uint16_t)row, b.h), BG8_W);
+    return;
+  }
+#endif
+#if CA_BG_QUADS
+  const bool bottom = row >= (int16_t)BG8_ch;
+  const uint16_t ly = (uint16_t)(bottom ? row - BG8_ch : row);
+  memcpy_P(idx,          (bottom ? BG8_q2 : BG8_q0) + ly * BG8_cw, BG8_cw);
+  memcpy_P(idx + BG8_cw, (bottom ? BG8_q3 : BG8_q1) + ly * (BG8_W - BG8_cw), BG8_W - BG8_cw);
+#endif
+}
+
 void drawBackground(const CA_BlitConfig& cfg){
-  // Paint the entire screen using the same 2× BG scanline composer used by the renderer
+  // Paint the entire screen using the same BG scanline composer used by the renderer
   MCUFRIEND_kbv* t = cfg.tft;
   uint16_t* pal = getBgPaletteRAM();     // 256-entry palette in RAM (fast)
 
@@ -32,12 +148,7 @@ void drawBackground(const CA_BlitConfig& cfg){
   bool first = true;
 
   for (int16_t y = 0; y < H; ++y){
-    CA_Blit::composeBGLine_160to320_quads_P(
-      BG8_q0, BG8_q1, BG8_q2, BG8_q3,
-      BG8_W, BG8_H, BG8_cw, BG8_ch,
-      pal,
-      y, /*x0=*/0, /*w=*/W
-    );
+    composeBgLine(cfg, pal, y, /*x0=*/0, /*w=*/W);
     CA_Blit::pushLinePhysicalNoAddr(cfg, W, first);
     first = false;
   }
@@ -45,7 +156,7 @@ void drawBackground(const CA_BlitConfig& cfg){
 }
 
 void restoreRect(const CA_BlitConfig& cfg, int16_t vx, int16_t vy, int16_t vw, int16_t vh){
-  // Restore a screen-space rect using the 2× BG scanline composer (no 1:1 blit)
+  // Restore a screen-space rect using the BG scanline composer (no 1:1 blit)
   if (vw <= 0 || vh <= 0) return;
 
   int16_t x0 = vx; if (x0 < 0) x0 = 0;
@@ -64,12 +175,7 @@ void restoreRect(const CA_BlitConfig& cfg, int16_t vx, int16_t vy, int16_t vw, i
   bool first = true;
 
   for (int16_t y = y0; y < y1; ++y){
-    CA_Blit::composeBGLine_160to320_quads_P(
-      BG8_q0, BG8_q1, BG8_q2, BG8_q3,
-      BG8_W, BG8_H, BG8_cw, BG8_ch,
-      pal,
-      y, /*x0=*/x0, /*w=*/W
-    );
+    composeBgLine(cfg, pal, y, /*x0=*/x0, /*w=*/W);
     CA_Blit::pushLinePhysicalNoAddr(cfg, W, first);
     first = false;
   }
@@ -79,15 +185,28 @@ void restoreRect(const CA_BlitConfig& cfg, int16_t vx, int16_t vy, int16_t vw, i
 
 // ---- palette caches ----
 struct PalEntry { const uint16_t* src; uint16_t ram[16]; };
-static PalEntry s_pals[16]; // palette cache
-static uint8_t s_palN=0;
+static PalEntry s_pals[CA_PAL_SLOTS]; // palette cache
+static uint8_t s_palN=0, s_palOverflows=0;
+
+uint8_t paletteSlots(){ return s_palN; }
+uint8_t paletteOverflows(){ return s_palOverflows; }
+
+uint16_t* paletteSlot(uint8_t i, const uint16_t** src){
+  if (i >= s_palN) return nullptr;
+  if (src) *src = s_pals[i].src;
+  return s_pals[i].ram;
+}
 
 uint16_t* ensurePaletteRAM(const uint16_t* palProgmem){
   for (uint8_t i=0;i<s_palN;++i) if (s_pals[i].src == palProgmem) return s_pals[i].ram;
-  uint8_t slot = (s_palN < (uint8_t)(sizeof(s_pals)/sizeof(s_pals[0]))) ? s_palN++ : (uint8_t)(sizeof(s_pals)/sizeof(s_pals[0]) - 1);
-  s_pals[slot].src = palProgmem;
-  memcpy_P(s_pals[slot].ram, palProgmem, sizeof(s_pals[slot].ram));
-  return s_pals[slot].ram;
+  if (s_palN >= CA_PAL_SLOTS) {
+    if (s_palOverflows < 0xFF) ++s_palOverflows;
+    return s_pals[CA_PAL_SLOTS - 1].ram;
+  }
+  PalEntry& e = s_pals[s_palN++];
+  e.src = palProgmem;
+  memcpy_P(e.ram, palProgmem, sizeof(e.ram));
+  return e.ram;
 }
 
 static uint16_t s_bgPal[256]; static bool s_bgLoaded=false;
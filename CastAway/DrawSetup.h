@@ -7,6 +7,27 @@
 #include "Anim.h"             // CA_Frame4 (4bpp frames)
 #include "assets/BACKGROUND.h"// BG8_* data (160×120 8bpp tiles/quads)
 
+// Background source: 0 = the quadrant bitmap above, 1 = the tile map in
+// assets/BG_TILES.h (same picture, plus its mirror image as a scrollable
+// world; see CA_Render::setBgOrigin). Only the chosen one is linked
+#ifndef CA_BG_TILES
+#define CA_BG_TILES 0
+#endif
+
+// 1 = the bitmap from assets/BG_RLE.h instead: the same picture as
+// row-compressed runs, decoded through a small row cache (CA_RleBg).
+// Ignored with CA_BG_TILES. With neither, CA_ASSET_PACK (AssetSrc.h) streams
+// the bitmap from the asset pack on SD
+#ifndef CA_BG_RLE
+#define CA_BG_RLE 0
+#endif
+
+// RAM copies of 16-entry sprite palettes (34 B each). The game uses 4:
+// ANGLER, BOAT, FISH1, FISH2
+#ifndef CA_PAL_SLOTS
+#define CA_PAL_SLOTS 4
+#endif
+
 // -----------------------------------------------------------------------------
 // CA_Draw
 // Lightweight helpers for wiring the TFT, painting the scaled background, and
@@ -20,15 +41,31 @@ namespace CA_Draw {
   void restoreUI();
 
   // Bind a TFT instance to a blit config. Stores the TFT pointer, queries width/
-  // height, sets scaling factor (typically 1 for sprites; BG is composed at 2×)
+  // height, sets scaling factor (typically 1 for sprites) and picks the BG map
+  // for the panel (cfg.bg: 2× on 320×240, see CA_BG_FILL for larger ones)
   // Also clears the screen to black.
   void init(CA_BlitConfig& cfg, MCUFRIEND_kbv* tft_in, uint8_t scale=1);
 
-  // Full-screen background paint at 2× using the scanline BG composer
+  // Full-screen background paint through cfg.bg using the scanline BG composer
   // Uses getBgPaletteRAM() for fast 256-color lookups
   void drawBackground(const CA_BlitConfig& cfg);
 
-  // Restore a rectangular region of the background at 2× scale. (vx,vy,vw,vh) are
+  // Compose BG scanline y, [x0, x0+w), from cfg's source (cfg.tiles, .rle,
+  // .stream or the bitmap) into the line buffer; dx as in CA_Blit::composeBGLine_quads_P.
+  // Every BG read goes through here, so the bitmap has one copy in flash
+  void composeBgLine(const CA_BlitConfig& cfg, const uint16_t* pal,
+                     int16_t y, int16_t x0, int16_t w, int16_t dx = 0);
+
+  // Read the BG source rows of scanlines [y0, y1) ahead of composeBgLine(),
+  // as many as the asset row cache holds. Returns the scanline after the last
+  // one covered; y1 when the BG is not streamed (nothing to read)
+  int16_t fetchBgLines(const CA_BlitConfig& cfg, int16_t y0, int16_t y1);
+
+  // Palette indices of source row `row` (0..BG8_H-1) of the BG window, BG8_W
+  // entries into idx. For effects that need to know where indices are used
+  void readBgRow(const CA_BlitConfig& cfg, int16_t row, uint8_t* idx);
+
+  // Restore a rectangular region of the background (cfg.bg). (vx,vy,vw,vh) are
   // in screen pixels. This is used to erase trails (e.g., previous fish rects)
   // without redrawing the entire screen
   void restoreRect(const CA_BlitConfig& cfg, int16_t vx, int16_t vy, int16_t vw, int16_t vh);
@@ -36,8 +73,16 @@ namespace CA_Draw {
   // ---------------- Palette management ----------------
   // Copy a 16-entry RGB565 palette from PROGMEM to RAM and return the RAM pointer
   // The copy is cached; repeated calls with the same source pointer return the
-  // same RAM block. Keep this small to avoid SRAM pressure
+  // same RAM block. Once CA_PAL_SLOTS are taken, a new palette gets the last
+  // slot as it is (wrong colors, but the frames already using it keep theirs)
+  // and is counted in paletteOverflows()
   uint16_t* ensurePaletteRAM(const uint16_t* palProgmem); // 16 entries copied to RAM
+  uint8_t   paletteOverflows();
+
+  // Cached palettes, for effects that rewrite the RAM copies (time of day):
+  // slot count, and slot i's RAM palette with its PROGMEM source
+  uint8_t   paletteSlots();
+  uint16_t* paletteSlot(uint8_t i, const uint16_t** src);
 
   // Return the 256-entry background palette in RAM. Lazily populated from
   // BG8_pal565 on first call. Kept in a single static buffer
@@ -47,7 +92,12 @@ namespace CA_Draw {
   // Utility to derive a per-frame transparent key using the top-left pixel of
   // a 4bpp sprite frame. The first source byte holds the first two pixels:
   // high nibble = pixel (x=0), low nibble = pixel (x=1). We use the high nibble.
-  inline uint8_t  topLeftKeyIndex(const CA_Frame4& f) { return pgm_read_byte(f.data) >> 4; }
+  inline uint8_t  topLeftKeyIndex(const CA_Frame4& f) {
+#if CA_ASSET_STREAM
+    if (f.src) return CA_Anim::streamRow(f, 0)[0] >> 4;
+#endif
+    return pgm_read_byte(f.data) >> 4;
+  }
 
   // Convert that palette index into an RGB565 color using the provided 16-entry
   // RAM palette. Pass this as key565 when enqueuing sprites to the renderer.
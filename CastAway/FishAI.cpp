@@ -37,44 +37,39 @@ static const uint8_t  MAX_SP       = 3;
 
 static inline int16_t fastAbs16(int16_t v){ return lutAbs16(v); }
 
-void CA_FishOps::init(CA_Fish* fish, const CA_FishParams& p, uint32_t seed){
+void CA_FishOps::init(CA_Fishes& f, const CA_FishParams& p, uint32_t seed){
   uint32_t r = seed ? seed : 0xACE1u;
-  for (uint8_t i=0;i<p.count;i++){
+  const uint8_t n = (p.count > f.cap) ? f.cap : p.count;
+  for (uint8_t i=0;i<n;i++){
     int16_t rx = (p.vw > 16) ? (int16_t)(8 + (rand16(r) % (p.vw - 16))) : (int16_t)(p.vw/2);
     int16_t ry = (p.vh > 12) ? (int16_t)(6 + (rand16(r) % (p.vh - 12))) : (int16_t)(p.vh/2);
 
-    fish[i].x = rx; fish[i].y = ry;
-
-    fish[i].prevRectX = fish[i].prevRectY = 0;
-    fish[i].prevRectW = fish[i].prevRectH = 0;
+    f.x[i] = rx; f.y[i] = ry;
+    f.px[i] = f.py[i] = CA_Fishes::NO_PREV;
 
     // Direction + base speed with some variety
-    fish[i].vx  = (rand16(r)&1)? 1 : -1;
-    fish[i].sp  = (uint8_t)(MIN_SP + (rand16(r) % (MAX_SP - MIN_SP + 1)));
+    f.vx[i] = (rand16(r)&1)? 1 : -1;
+    f.sp[i] = (uint8_t)(MIN_SP + (rand16(r) % (MAX_SP - MIN_SP + 1)));
 
     // Desync flips and frame clocks right from start
-    fish[i].nextFlipAt = millis() + 1200 + (rand16(r) % 2200);
+    f.flipAt[i] = (uint16_t)(millis() + 1200 + (rand16(r) % 2200));
 
-    // We'll reuse 'mood' as a stable per-fish random salt in [80..199]
-    fish[i].mood = (uint8_t)(80 + (rand16(r) % 120));
-    fish[i].ai   = F_SWIM;
-    fish[i].cd   = 0;
+    // Stable per-fish random salt in [80..199]
+    f.salt[i] = (uint8_t)(80 + (rand16(r) % 120));
+    f.st[i]   = F_SWIM;
+    f.cd[i]   = 0;
 
     // Phase offset desyncs wander and lets us derive per-fish randomness
-    fish[i].phase     = rand16(r);
-    fish[i].animStart = millis() - (uint32_t)(rand16(r) % 1000);  // spread initial anim offsets
-
-    fish[i].drawX = fish[i].drawY = 0;
-    fish[i].curFrame = 0;
-    fish[i].flip = 0;
+    f.phase[i]  = rand16(r);
+    f.animAt[i] = (uint16_t)(millis() - (uint32_t)(rand16(r) % 1000));  // spread initial anim offsets
   }
 }
 
-void CA_FishOps::setFlyingMode(CA_Fish* f, const CA_FishParams& p, uint32_t startTime){
+void CA_FishOps::setFlyingMode(CA_Fishes& f, const CA_FishParams& p){
   for (uint8_t i=0; i<p.count; ++i){
-    f[i].ai = F_FLY;
-    f[i].vx = 0; // Stop horizontal movement
-    f[i].sp = 2; // Set consistent upward speed (2 pixels per frame)
+    f.st[i] = (uint8_t)((f.st[i] & ~CA_Fishes::ST_MODE) | F_FLY);
+    f.vx[i] = 0; // Stop horizontal movement
+    f.sp[i] = 2; // Set consistent upward speed (2 pixels per frame)
   }
 }
 
@@ -82,45 +77,81 @@ void CA_FishOps::restoreUnderRect(const CA_BlitConfig& cfg, int16_t vx, int16_t
   CA_Draw::restoreRect(cfg, vx, vy, w, h);
 }
 
-int8_t CA_FishOps::updateAndDraw(CA_Fish* f, const CA_FishParams& p,
+void CA_FishOps::drawPos(const CA_Fishes& f, uint8_t i, const CA_FishParams& p,
+                         const CA_Anim4& anim, int16_t& dx, int16_t& dy){
+  const CA_Frame4& fr = anim.frames[f.frame(i)];
+  dx = f.x[i] - (int16_t)fr.w/2;
+  dy = (p.y0 + f.y[i]) - (int16_t)fr.h/2;
+}
+
+bool CA_FishOps::prevRect(const CA_Fishes& f, uint8_t i, const CA_FishParams& p, const CA_BlitConfig& cfg,
+                          int16_t& rx, int16_t& ry, int16_t& rw, int16_t& rh){
+  if (f.px[i] == CA_Fishes::NO_PREV) return false;
+  const int16_t oldCX = f.px[i];
+  const int16_t oldCY = p.y0 + f.py[i];
+
+  const int8_t PADX = 2, PADY = 1;
+  int16_t x = oldCX - (int16_t)(f.maxW >> 1) - PADX;
+  int16_t y = oldCY - (int16_t)(f.maxH >> 1) - PADY;
+  int16_t w = (int16_t)f.maxW + (PADX << 1);
+  int16_t h = (int16_t)f.maxH + (PADY << 1);
+
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > cfg.screenW) w = cfg.screenW - x;
+  if (y + h > cfg.screenH) h = cfg.screenH - y;
+  if (w <= 0 || h <= 0) return false;
+  rx = x; ry = y; rw = w; rh = h;
+  return true;
+}
+
+int8_t CA_FishOps::updateAndDraw(CA_Fishes& f, const CA_FishParams& p,
                               const CA_BlitConfig& cfg,
                               const CA_Anim4& anim,
                               int16_t lureAbsX, int16_t lureAbsY,
                               uint8_t gameState, int8_t activeBiter,
                               uint32_t now)
 {
+  (void)cfg;
   // ---- sprite max bounds (for tail-safe erase box) ----
   // Cache frame dimensions to avoid rescanning every tick
-  static uint16_t s_cachedMaxW = 0, s_cachedMaxH = 0;
-  static const void* s_lastFramePtr = nullptr;
-  
-  if (anim.frames != s_lastFramePtr) {
-    // Frames changed, rescan dimensions
-    s_cachedMaxW = 0; s_cachedMaxH = 0;
+  if (anim.frames != f.maxOf) {
+    f.maxW = 0; f.maxH = 0;
     for (uint8_t k=0; k<anim.count; ++k) {
-      if (anim.frames[k].w > s_cachedMaxW) s_cachedMaxW = anim.frames[k].w;
-      if (anim.frames[k].h > s_cachedMaxH) s_cachedMaxH = anim.frames[k].h;
+      if (anim.frames[k].w > f.maxW) f.maxW = anim.frames[k].w;
+      if (anim.frames[k].h > f.maxH) f.maxH = anim.frames[k].h;
     }
-    s_lastFramePtr = anim.frames;
+    f.maxOf = anim.frames;
   }
-  
-  uint16_t maxFw = s_cachedMaxW, maxFh = s_cachedMaxH;
+
+  // Whole animation loops, in animAt units scaled by the slowest speed (see
+  // CA_Fishes); 0 = never rebase, clamp instead
+  const uint32_t loopMs = (uint32_t)anim.frameMs * anim.count * 100u;
+  const uint16_t rebase = (anim.loop && loopMs && loopMs <= 0xF000u) ? (uint16_t)loopMs : 0;
+  const uint16_t now16  = (uint16_t)now;
 
   // Pre-computed flags
   const bool lureInWater   = (lureAbsY >= (p.y0 + 1));
   const bool seekingOK     = (gameState==GS_IDLE || gameState==GS_DRIFT);
   const bool hasActiveBiter= (activeBiter >= 0);
   const bool isReeling     = (gameState == GS_REEL);
+  const uint8_t N = (p.count > f.cap) ? f.cap : p.count;
+
+  // Where each fish starts from is where it was drawn: prevRect() repaints it
+  for (uint8_t i=0;i<N;i++){
+    const bool drawn = (f.st[i] & CA_Fishes::ST_DRAWN) != 0;
+    f.px[i] = drawn ? f.x[i] : CA_Fishes::NO_PREV;
+    f.py[i] = f.y[i];
+  }
 
   // If a new biter appeared, make others flee once
   if (hasActiveBiter && activeBiter != s_prevActiveBiter){
-    for (uint8_t i=0;i<p.count;i++) if (i != (uint8_t)activeBiter){
-      CA_Fish &fi = f[i];
-      fi.ai = F_FLEE;
-      fi.cd = 90 + (now & 63);
-      fi.vx = (fi.x < lureAbsX) ? -1 : +1;
-      if (fi.sp < MAX_SP) fi.sp++;
-      fi.nextFlipAt = now + 2000 + ((now + i*37) & 511);
+    for (uint8_t i=0;i<N;i++) if (i != (uint8_t)activeBiter){
+      f.st[i] = (uint8_t)((f.st[i] & ~CA_Fishes::ST_MODE) | F_FLEE);
+      f.cd[i] = (uint8_t)(90 + (now & 63));
+      f.vx[i] = (f.x[i] < lureAbsX) ? -1 : +1;
+      if (f.sp[i] < MAX_SP) f.sp[i]++;
+      f.flipAt[i] = (uint16_t)(now + 2000 + ((now + i*37) & 511));
     }
   }
   s_prevActiveBiter = activeBiter;
@@ -129,31 +160,31 @@ int8_t CA_FishOps::updateAndDraw(CA_Fish* f, const CA_FishParams& p,
   // Spatial buckets along X for separation (O(N) build, small local scans)
   // Skip separation entirely during active bite/reel to save cycles
   // =====================================================================
-  const uint8_t N = p.count;
+  int16_t* const X = f.x;
+  int16_t* const Y = f.y;
   if (N > 1 && !hasActiveBiter && SEPARATE_R) {
     if (N == 2) {
       // Special case: direct pairwise check for exactly 2 fish (much faster)
-      int16_t dx = f[1].x - f[0].x;
-      int16_t dy = f[1].y - f[0].y;
+      int16_t dx = X[1] - X[0];
+      int16_t dy = Y[1] - Y[0];
       if (fastAbs16(dx) + fastAbs16(dy) <= SEPARATE_R) {
         // Simple push apart
-        f[0].x -= SEPARATE_PUSH_X; 
-        f[0].y += (f[0].y <= f[1].y ? -SEPARATE_PUSH_Y : +SEPARATE_PUSH_Y);
-        f[1].x += SEPARATE_PUSH_X; 
-        f[1].y += (f[0].y <= f[1].y ? +SEPARATE_PUSH_Y : -SEPARATE_PUSH_Y);
+        X[0] -= SEPARATE_PUSH_X;
+        Y[0] += (Y[0] <= Y[1] ? -SEPARATE_PUSH_Y : +SEPARATE_PUSH_Y);
+        X[1] += SEPARATE_PUSH_X;
+        Y[1] += (Y[0] <= Y[1] ? +SEPARATE_PUSH_Y : -SEPARATE_PUSH_Y);
       }
     } else {
-      // Original optimized bucket system for 3+ fish
-      // Original optimized bucket system for 3+ fish
+      // Bucket system for 3+ fish, chained through f.link
       static uint8_t head[24];         // max 24 cells (fits 320px with CELL_W=16)
-      static uint8_t nextIdx[32];      // next pointer per fish (N<=32)
+      uint8_t* const nextIdx = f.link;
       const uint8_t CELL_W = 16;
       uint8_t nCells = (uint8_t)((p.vw + CELL_W - 1) / CELL_W);
       if (nCells > (uint8_t)(sizeof(head))) nCells = (uint8_t)sizeof(head);
 
       for (uint8_t c=0; c<nCells; ++c) head[c] = 0xFF;
       for (uint8_t i=0;i<N;i++){
-        int16_t x = f[i].x; if (x < 0) x = 0; if (x >= p.vw) x = p.vw - 1;
+        int16_t x = X[i]; if (x < 0) x = 0; if (x >= p.vw) x = p.vw - 1;
         uint8_t ci = (uint8_t)(x / CELL_W); if (ci >= nCells) ci = nCells - 1;
         nextIdx[i] = head[ci];
         head[ci] = i;
@@ -164,21 +195,21 @@ int8_t CA_FishOps::updateAndDraw(CA_Fish* f, const CA_FishParams& p,
         for (uint8_t i=head[c]; i!=0xFF; i=nextIdx[i]){
           // scan neighbors within same cell
           for (uint8_t j=nextIdx[i]; j!=0xFF; j=nextIdx[j]){
-            int16_t dx = f[j].x - f[i].x; if (dx < 0) dx = -dx; if (dx > SEPARATE_R) continue;
-            int16_t dy = f[j].y - f[i].y; if (dy < 0) dy = -dy;
+            int16_t dx = X[j] - X[i]; if (dx < 0) dx = -dx; if (dx > SEPARATE_R) continue;
+            int16_t dy = Y[j] - Y[i]; if (dy < 0) dy = -dy;
             if (dx + dy <= SEPARATE_R){
-              f[i].x -= SEPARATE_PUSH_X; f[i].y += (f[i].y <= f[j].y ? -SEPARATE_PUSH_Y : +SEPARATE_PUSH_Y);
-              f[j].x += SEPARATE_PUSH_X; f[j].y += (f[i].y <= f[j].y ? +SEPARATE_PUSH_Y : -SEPARATE_PUSH_Y);
+              X[i] -= SEPARATE_PUSH_X; Y[i] += (Y[i] <= Y[j] ? -SEPARATE_PUSH_Y : +SEPARATE_PUSH_Y);
+              X[j] += SEPARATE_PUSH_X; Y[j] += (Y[i] <= Y[j] ? +SEPARATE_PUSH_Y : -SEPARATE_PUSH_Y);
             }
           }
           // scan next cell (c+1)
           if (c + 1 < nCells){
             for (uint8_t j=head[c+1]; j!=0xFF; j=nextIdx[j]){
-              int16_t dx = f[j].x - f[i].x; if (dx < 0) dx = -dx; if (dx > SEPARATE_R) continue;
-              int16_t dy = f[j].y - f[i].y; if (dy < 0) dy = -dy;
+              int16_t dx = X[j] - X[i]; if (dx < 0) dx = -dx; if (dx > SEPARATE_R) continue;
+              int16_t dy = Y[j] - Y[i]; if (dy < 0) dy = -dy;
               if (dx + dy <= SEPARATE_R){
-                f[i].x -= SEPARATE_PUSH_X; f[i].y += (f[i].y <= f[j].y ? -SEPARATE_PUSH_Y : +SEPARATE_PUSH_Y);
-                f[j].x += SEPARATE_PUSH_X; f[j].y += (f[i].y <= f[j].y ? +SEPARATE_PUSH_Y : -SEPARATE_PUSH_Y);
+                X[i] -= SEPARATE_PUSH_X; Y[i] += (Y[i] <= Y[j] ? -SEPARATE_PUSH_Y : +SEPARATE_PUSH_Y);
+                X[j] += SEPARATE_PUSH_X; Y[j] += (Y[i] <= Y[j] ? +SEPARATE_PUSH_Y : -SEPARATE_PUSH_Y);
               }
             }
           }
@@ -196,79 +227,90 @@ int8_t CA_FishOps::updateAndDraw(CA_Fish* f, const CA_FishParams& p,
   const bool needClosest = (lureInWater && seekingOK && !hasActiveBiter);
   if (needClosest){
     for (uint8_t i=0;i<N;i++){
-      if (f[i].ai == F_FLY) continue; // Skip flying fish
-      int16_t dx = lureAbsX - f[i].x;
-      int16_t dy = (lureAbsY - p.y0) - f[i].y;
+      if (f.mode(i) == F_FLY) continue; // Skip flying fish
+      int16_t dx = lureAbsX - X[i];
+      int16_t dy = (lureAbsY - p.y0) - Y[i];
       int16_t dd = fastAbs16(dx) + fastAbs16(dy);
       if (dd < bestDist){ secondDist = bestDist; secondIdx = bestIdx; bestDist = dd; bestIdx = (int8_t)i; }
       else if (dd < secondDist){ secondDist = dd; secondIdx = (int8_t)i; }
     }
-  }  // ---- per-fish update ----
-  for (uint8_t i=0;i<p.count;i++){
-    CA_Fish &fi = f[i];
+  }
+
+  // ---- per-fish update: load the fields, step, store them back ----
+  for (uint8_t i=0;i<N;i++){
+    int16_t  x = X[i], y = Y[i];
+    int8_t   vx = f.vx[i];
+    uint8_t  sp = f.sp[i];
+    uint8_t  ai = f.st[i] & CA_Fishes::ST_MODE;
+    uint8_t  cd = f.cd[i];
+    uint16_t phase  = f.phase[i];
+    uint16_t flipAt = f.flipAt[i];
+    const uint8_t salt = f.salt[i];
     const bool isActiveBiter = (hasActiveBiter && activeBiter == (int8_t)i);
 
-    const uint8_t saltA = (uint8_t)((fi.mood * 29u + (fi.phase >> 3) + i*17u) & 0xFF);
-    const uint8_t saltB = (uint8_t)((fi.mood * 53u + (fi.phase >> 5) + i*31u) & 0xFF);
+    // An overdue flip stays due, however long the fish waits for it
+    if ((int16_t)(now16 - flipAt) > 0) flipAt = now16;
+
+    const uint8_t saltA = (uint8_t)((salt * 29u + (phase >> 3) + i*17u) & 0xFF);
+    const uint8_t saltB = (uint8_t)((salt * 53u + (phase >> 5) + i*31u) & 0xFF);
 
     // Cadences (bitmasks, no modulo)
-    if (((fi.phase + saltA) & WANDER_MASK) == 0){
+    if (((phase + saltA) & WANDER_MASK) == 0){
       int8_t turnBias = ((saltB & 3) == 0) ? -1 : ((saltB & 3) == 1) ? +1 : 0;
-      int8_t vx = (int8_t)(fi.vx + turnBias);
-      if (vx < -1) vx = -1; else if (vx > +1) vx = +1;
-      fi.vx = (vx == 0) ? ((saltB & 1) ? +1 : -1) : vx;
+      int8_t v = (int8_t)(vx + turnBias);
+      if (v < -1) v = -1; else if (v > +1) v = +1;
+      vx = (v == 0) ? ((saltB & 1) ? +1 : -1) : v;
     }
-    if (((fi.phase + saltB) & SPEED_MASK) == 0){
+    if (((phase + saltB) & SPEED_MASK) == 0){
       uint8_t wiggle = (uint8_t)(1 + ((saltA >> 5) & 1)); // 1 or 2
-      int sp = (int)fi.sp + ((saltA & 1) ? +wiggle : -wiggle);
-      if (sp < MIN_SP) sp = MIN_SP; else if (sp > MAX_SP) sp = MAX_SP;
-      fi.sp = (uint8_t)sp;
+      int s = (int)sp + ((saltA & 1) ? +wiggle : -wiggle);
+      if (s < MIN_SP) s = MIN_SP; else if (s > MAX_SP) s = MAX_SP;
+      sp = (uint8_t)s;
     }
 
     // ---- AI / movement base ----
-    if (fi.ai == F_FLY){
+    if (ai == F_FLY){
       // Endgame: fly upward at consistent speed from current position
-      // Simply move upward like normal swimming, but only in Y direction
-      fi.y -= fi.sp; // Move upward at normal fish speed
       // Keep horizontal position stable (no drift)
-      
-    } else if (fi.ai == F_FLEE){
-      fi.x += fi.vx * (fi.sp + 1);
-      if ((uint8_t)((now + i) & 3) != 0) fi.y += ((now >> 5) & 1) ? +1 : -1;
-      if (fi.cd > 0) { fi.cd--; } else { fi.ai = F_SWIM; }
+      y -= sp;
+
+    } else if (ai == F_FLEE){
+      x += vx * (sp + 1);
+      if ((uint8_t)((now + i) & 3) != 0) y += ((now >> 5) & 1) ? +1 : -1;
+      if (cd > 0) { cd--; } else { ai = F_SWIM; }
     } else {
       // baseline drift
-      fi.x += fi.vx * fi.sp;
-      fi.phase += (uint16_t)(3 + fi.sp);
+      x += vx * sp;
+      phase += (uint16_t)(3 + sp);
 
       // slight vertical meander
-      if (((fi.phase + saltA) & 31) == 0) fi.y += ((fi.phase >> 5) & 1) ? +1 : -1;
+      if (((phase + saltA) & 31) == 0) y += ((phase >> 5) & 1) ? +1 : -1;
 
-      if (lureInWater && seekingOK && fi.ai != F_BITE && fi.ai != F_FLY) {
-        int16_t ad = fastAbs16(lureAbsX - fi.x) + fastAbs16((lureAbsY - p.y0) - fi.y);
+      if (lureInWater && seekingOK && ai != F_BITE) {
+        int16_t ad = fastAbs16(lureAbsX - x) + fastAbs16((lureAbsY - p.y0) - y);
         if (ad < ATTRACT_R) {
-          if (fi.cd == 0) fi.cd = 40 + ((now + i*11) & 15);
-          fi.ai = F_ATTRACT;
+          if (cd == 0) cd = (uint8_t)(40 + ((now + i*11) & 15));
+          ai = F_ATTRACT;
         }
       }
 
-      if ((hasActiveBiter || isReeling) && !isActiveBiter && fi.ai != F_FLY) {
-        int16_t dx = lureAbsX - fi.x; int16_t dy = (lureAbsY - p.y0) - fi.y;
+      if ((hasActiveBiter || isReeling) && !isActiveBiter) {
+        int16_t dx = lureAbsX - x; int16_t dy = (lureAbsY - p.y0) - y;
         int16_t ad = fastAbs16(dx) + fastAbs16(dy);
-        if (ad < AVOID_R && fi.ai != F_FLEE) {
-          fi.ai = F_FLEE;
-          fi.cd = 70 + ((now + i*17) & 31);
-          fi.vx = (fi.x < lureAbsX) ? -1 : +1;
-          if (fi.sp < MAX_SP) fi.sp++;
+        if (ad < AVOID_R && ai != F_FLEE) {
+          ai = F_FLEE;
+          cd = (uint8_t)(70 + ((now + i*17) & 31));
+          vx = (x < lureAbsX) ? -1 : +1;
+          if (sp < MAX_SP) sp++;
         }
       }
 
-      if (fi.ai == F_ATTRACT) {
-        if (((now + i + (saltA>>2)) & 1) == 0) fi.x += (lureAbsX > fi.x) ? +1 : -1;
-        if (((now + (i<<1) + (saltB>>3)) & 3) == 0) fi.y += ((lureAbsY - p.y0) > fi.y) ? +1 : -1;
+      if (ai == F_ATTRACT) {
+        if (((now + i + (saltA>>2)) & 1) == 0) x += (lureAbsX > x) ? +1 : -1;
+        if (((now + (i<<1) + (saltB>>3)) & 3) == 0) y += ((lureAbsY - p.y0) > y) ? +1 : -1;
 
-        int16_t dx = lureAbsX - fi.x;
-        int16_t dy = (lureAbsY - p.y0) - fi.y;
+        int16_t dx = lureAbsX - x;
+        int16_t dy = (lureAbsY - p.y0) - y;
         int16_t dd = fastAbs16(dx) + fastAbs16(dy);        // O(1) “someoneCloser” via global best/second-best
         bool someoneCloser = false;
         if (needClosest){
@@ -279,127 +321,90 @@ int8_t CA_FishOps::updateAndDraw(CA_Fish* f, const CA_FishParams& p,
           }
         }
         if (someoneCloser && (now & 1)) {
-          if (fi.cd > 0) fi.cd--;
+          if (cd > 0) cd--;
         }
 
         // Bite check: prefer Manhattan (cheap)
         if (dd <= 10 && activeBiter == -1) {  // ~radius 5
-          fi.ai = F_BITE; fi.cd = 140; activeBiter = (int8_t)i;
+          ai = F_BITE; cd = 140; activeBiter = (int8_t)i;
         } else {
           uint8_t biteGate = (uint8_t)(((now + (i<<1) + saltB) & 3) == 0);
           if (dd <= BITE_R && activeBiter == -1 && biteGate) {
-            fi.ai = F_BITE; fi.cd = 140; activeBiter = (int8_t)i;
-          } else if (fi.cd > 0) {
-            fi.cd--;
+            ai = F_BITE; cd = 140; activeBiter = (int8_t)i;
+          } else if (cd > 0) {
+            cd--;
           }
         }
       }
-      else if (fi.ai == F_BITE) {
+      else if (ai == F_BITE) {
         if (!((gameState == GS_BITE || isReeling) && isActiveBiter)) {
-          if (fi.cd > 0) { fi.cd--; }
-          else { fi.ai = F_SWIM; if (isActiveBiter) activeBiter = -1; }
+          if (cd > 0) { cd--; }
+          else { ai = F_SWIM; if (isActiveBiter) activeBiter = -1; }
         }
       }
 
       // Make flips less likely by narrowing cadence and lengthening intervals
-      if (fi.ai != F_BITE && now >= fi.nextFlipAt){
-        if ( ((fi.phase + saltA + i*13) & 15) == 0 ) {
-          fi.vx = -fi.vx;
+      if (ai != F_BITE && (int16_t)(now16 - flipAt) >= 0){
+        if ( ((phase + saltA + i*13) & 15) == 0 ) {
+          vx = -vx;
           uint16_t jitter = (uint16_t)(1100 + ((saltB * 13u) & 2047));
-          fi.nextFlipAt = now + 1700 + jitter; // longer between flips
+          flipAt = (uint16_t)(now16 + 1700 + jitter); // longer between flips
         } else {
-          fi.nextFlipAt = now + 220 + (saltB & 0x7F); // longer debounce
+          flipAt = (uint16_t)(now16 + 220 + (saltB & 0x7F)); // longer debounce
         }
       }
     }
 
     if (isReeling && isActiveBiter) {
-      fi.nextFlipAt = now + 1500;
-      if (((now + i) & 1) == 0) fi.x += (fi.vx > 0 ? +1 : -1);
-      if (((now + (i<<1)) & 3) == 0) fi.y += ((now >> 4) & 1) ? +1 : -1;
+      flipAt = (uint16_t)(now16 + 1500);
+      if (((now + i) & 1) == 0) x += (vx > 0 ? +1 : -1);
+      if (((now + (i<<1)) & 3) == 0) y += ((now >> 4) & 1) ? +1 : -1;
     }
 
-    // ---- capture OLD rect before recomputing frame/coords ----
-    int16_t  oldX = fi.drawX;
-    int16_t  oldY = fi.drawY;
-    uint16_t oldW = anim.frames[fi.curFrame].w;
-    uint16_t oldH = anim.frames[fi.curFrame].h;
-
-    // Stash previous pose for renderer
-    fi.prevFrame = fi.curFrame;
-    fi.prevFlip  = fi.flip;
-
     // ---- per-fish animation speed & jitter ----
-    uint8_t  speedPct = (uint8_t)(80 + (fi.mood % 61));
-    uint32_t span     = now - fi.animStart;
-    uint32_t jitter   = (uint32_t)((fi.phase & 15));
-    uint32_t animNow  = fi.animStart + (span * speedPct) / 100 + jitter;
+    uint16_t animAt = f.animAt[i];
+    uint16_t span   = (uint16_t)(now16 - animAt);
+    if (rebase) {
+      if (span >= rebase) { const uint16_t k = (uint16_t)(span - span % rebase); animAt += k; span -= k; }
+    } else if (span > 0xF000u) {
+      animAt = (uint16_t)(now16 - 0xF000u); span = 0xF000u;
+    }
+    const uint8_t  speedPct = (uint8_t)(80 + (salt % 61));
+    const uint32_t t        = ((uint32_t)span * speedPct) / 100 + (phase & 15);
 
     // ---- current frame ----
-    const uint8_t frameIdx = CA_Anim::frameAt(anim, fi.animStart, animNow);
-    const CA_Frame4& fr   = anim.frames[frameIdx];
-    const bool hFlip       = (fi.vx < 0);
+    const uint8_t frameIdx = CA_Anim::frameAt(anim, 0, t);
+    const CA_Frame4& fr    = anim.frames[frameIdx];
+    const bool hFlip       = (vx < 0);
 
     // ---- bounds clamp ----
     // Skip bounds clamping for flying fish during endgame
-    if (fi.ai != F_FLY) {
+    if (ai != F_FLY) {
       int16_t halfFrW = (int16_t)fr.w / 2;
       int16_t halfFrH = (int16_t)fr.h / 2;
 
-      bool hitLeft  = (fi.x < halfFrW + 2);
-      bool hitRight = (fi.x > p.vw - halfFrW - 2);
+      bool hitLeft  = (x < halfFrW + 2);
+      bool hitRight = (x > p.vw - halfFrW - 2);
 
-      if (hitLeft)       { fi.x = halfFrW + 2; fi.vx = +1; fi.nextFlipAt = now + 400 + (saltA & 511); }
-      else if (hitRight) { fi.x = p.vw - halfFrW - 2; fi.vx = -1; fi.nextFlipAt = now + 400 + (saltA & 511); }
+      if (hitLeft)       { x = halfFrW + 2; vx = +1; flipAt = (uint16_t)(now16 + 400 + (saltA & 511)); }
+      else if (hitRight) { x = p.vw - halfFrW - 2; vx = -1; flipAt = (uint16_t)(now16 + 400 + (saltA & 511)); }
 
-      if (fi.y < halfFrH + 2)             { fi.y = halfFrH + 2; }
-      else if (fi.y > p.vh - halfFrH - 2) { fi.y = p.vh - halfFrH - 2; }
+      if (y < halfFrH + 2)             { y = halfFrH + 2; }
+      else if (y > p.vh - halfFrH - 2) { y = p.vh - halfFrH - 2; }
 
       if (hitLeft || hitRight) {
-        fi.y += ((saltB & 1) ? +2 : -2);
-        if (fi.y < halfFrH + 2) fi.y = halfFrH + 2;
-        if (fi.y > p.vh - halfFrH - 2) fi.y = p.vh - halfFrH - 2;
+        y += ((saltB & 1) ? +2 : -2);
+        if (y < halfFrH + 2) y = halfFrH + 2;
+        if (y > p.vh - halfFrH - 2) y = p.vh - halfFrH - 2;
       }
     }
 
-    // ---- new draw coords ----
-    const int16_t newX = fi.x - (int16_t)fr.w/2;
-    const int16_t newY = (p.y0 + fi.y) - (int16_t)fr.h/2;
-
-    // ---- tail-proof prev rect ----
-    {
-      const bool hadPrev = (fi.drawX | fi.drawY);
-      if (hadPrev){
-        const int16_t oldCX = oldX + (int16_t)(oldW >> 1);
-        const int16_t oldCY = oldY + (int16_t)(oldH >> 1);
-
-        const int8_t PADX = 2, PADY = 1;
-        int16_t px = oldCX - (int16_t)(maxFw >> 1) - PADX;
-        int16_t py = oldCY - (int16_t)(maxFh >> 1) - PADY;
-        int16_t pw = (int16_t)maxFw + (PADX << 1);
-        int16_t ph = (int16_t)maxFh + (PADY << 1);
-
-        if (px < 0) { pw += px; px = 0; }
-        if (py < 0) { ph += py; py = 0; }
-        if (px + pw > cfg.screenW) pw = cfg.screenW - px;
-        if (py + ph > cfg.screenH) ph = cfg.screenH - py;
-
-        if (pw > 0 && ph > 0){
-          fi.prevRectX = px; fi.prevRectY = py;
-          fi.prevRectW = pw; fi.prevRectH = ph;
-        } else {
-          fi.prevRectW = fi.prevRectH = 0;
-        }
-      } else {
-        fi.prevRectW = fi.prevRectH = 0;
-      }
-    }
-
-    fi.curFrame = frameIdx;
-    fi.flip     = hFlip ? 1 : 0;
-    fi.drawX    = newX;
-    fi.drawY    = newY;
+    X[i] = x; Y[i] = y;
+    f.vx[i] = vx; f.sp[i] = sp; f.cd[i] = cd;
+    f.phase[i] = phase; f.flipAt[i] = flipAt; f.animAt[i] = animAt;
+    f.st[i] = (uint8_t)(ai | (hFlip ? CA_Fishes::ST_FLIP : 0) | CA_Fishes::ST_DRAWN
+                        | (frameIdx << CA_Fishes::ST_FRAME));
   }
 
   return activeBiter;
-}
\ No newline at end of file
+}
@@ -6,46 +6,74 @@
 // Forward-declare animation type to avoid pulling heavy headers here
 struct CA_Anim4;
 
+// Fish slots (SRAM: 20 B each). At most 127, the range of a biter index
+#ifndef CA_FISH_MAX
+  #if defined(__AVR__)
+    #define CA_FISH_MAX 64
+  #else
+    #define CA_FISH_MAX 127
+  #endif
+#endif
+
+// -----------------------------------------------------------------------------
+// CA_Fishes
+// Runtime state of every fish, kept as parallel arrays, one per field, so the
+// AI passes (separation, nearest-to-lure, the per-fish step) stream through
+// only what they read. Positioning is kept in a logical water coordinate
+// system (see CA_FishParams); the draw position and the box to repaint are
+// derived from it (CA_FishOps::drawPos / prevRect) instead of being stored.
+//
+// Timers are the low 16 bits of millis(): flipAt is compared as a signed
+// difference and pulled up to now once overdue, animAt is moved forward by
+// whole animation loops, so neither ever wraps into the future. Fish loops
+// (count × frameMs) up to 614 ms keep their speed; longer ones hold their
+// last frame after ~61 s
+// -----------------------------------------------------------------------------
+struct CA_Fishes {
+  // st: mode (F_*) | ST_FLIP | ST_DRAWN | frame (0..7) << ST_FRAME
+  enum : uint8_t { ST_MODE = 0x07, ST_FLIP = 0x08, ST_DRAWN = 0x10, ST_FRAME = 5 };
+  // px/py of a fish not drawn before its last step
+  static const int16_t NO_PREV = -32768;
+
+  int16_t  *x, *y;               // logical position inside underwater region
+  int16_t  *px, *py;             // position the last step started from (where it was drawn)
+  int8_t   *vx;                  // signed horizontal velocity (pixels per step)
+  uint8_t  *sp;                  // speed tier (MIN_SP..MAX_SP)
+  uint8_t  *st;                  // packed mode / flip / drawn / frame
+  uint8_t  *salt;                // stable per-fish random salt in [80..199]
+  uint8_t  *cd;                  // cooldown in steps
+  uint16_t *phase;               // phase accumulator (wander / speed / meander cadences)
+  uint16_t *flipAt;              // millis() when we next consider flipping direction
+  uint16_t *animAt;              // epoch for the swim animation
+  uint8_t  *link;                // separation scratch: next fish in the same cell
+  uint8_t  cap;
+  uint16_t maxW, maxH;           // largest frame of maxOf (tail-safe repaint box)
+  const void* maxOf;
+
+  uint8_t mode (uint8_t i) const { return st[i] & ST_MODE; }
+  bool    flip (uint8_t i) const { return (st[i] & ST_FLIP) != 0; }
+  uint8_t frame(uint8_t i) const { return (uint8_t)(st[i] >> ST_FRAME); }
+};
+
 // -----------------------------------------------------------------------------
-// CA_Fish
-// Runtime state for a single fish. Positioning is kept in a logical water
-// coordinate system, but we also cache the computed on-screen draw info each
-// tick (drawX/Y, curFrame, flip) so the renderer doesn’t recompute it
+// CA_FishesT<N>
+// The fish store you instantiate: owns the arrays for N fish and hands them to
+// CA_Fishes, like CA_RenderT does for the render queues
 // -----------------------------------------------------------------------------
-struct CA_Fish {
-  // --- simulation space (water region, not full screen) ---
-  int16_t x, y;                  // logical position inside underwater region (see CA_FishParams)
-
-  // --- dirty tracking (previous frame’s drawn rect in physical/screen space) ---
-  int16_t prevRectX, prevRectY;  // top-left of the last frame’s fish bounding box (screen space)
-  int16_t prevRectW, prevRectH;  // width/height of that box (used to restore background / mark dirty)
-
-  // --- movement ---
-  int8_t  vx;                    // signed horizontal velocity in logical units (pixels per step)
-  uint8_t sp;                    // speed tier / animation pace hint (0..255)
-  uint32_t nextFlipAt;           // millis() time when we next consider flipping direction
-
-  // --- simple AI state ---
-  uint8_t mood;                  // coarse brain state (see enum below)
-  uint8_t ai;                    // substate / controller ID (implementation-specific)
-  uint16_t cd;                   // cooldown / timer (ticks or ms bucket depending on logic)
-
-  // --- animation timers ---
-  uint16_t phase;                // phase accumulator (swim wiggle, lure approach curve, etc.)
-  uint32_t animStart;            // epoch for current sprite animation selection
-
-  // --- cached per-tick render info (physical/screen space) ---
-  // The AI computes these once per tick; the renderer just consumes them.
-  int16_t drawX, drawY;          // top-left in screen pixels for this frame
-  uint8_t curFrame;              // index into the provided CA_Anim4 frame array
-  uint8_t flip;                  // 0 = normal, 1 = horizontal flip
-
-  // NEW: previous pose info for masked/stencil blit
-  uint8_t prevFrame;
-  uint8_t prevFlip;
-  
-  // Endgame flying animation
-  int16_t endgameStartX, endgameStartY; // Original position when endgame starts
+template<uint8_t N>
+struct CA_FishesT : CA_Fishes {
+  CA_FishesT() {
+    x = xBuf; y = yBuf; px = pxBuf; py = pyBuf; vx = vxBuf; sp = spBuf;
+    st = stBuf; salt = saltBuf; cd = cdBuf;
+    phase = phaseBuf; flipAt = flipBuf; animAt = animBuf; link = linkBuf;
+    cap = N; maxW = maxH = 0; maxOf = nullptr;
+  }
+
+private:
+  int16_t  xBuf[N], yBuf[N], pxBuf[N], pyBuf[N];
+  int8_t   vxBuf[N];
+  uint8_t  spBuf[N], stBuf[N], saltBuf[N], cdBuf[N], linkBuf[N];
+  uint16_t phaseBuf[N], flipBuf[N], animBuf[N];
 };
 
 // -----------------------------------------------------------------------------
@@ -54,7 +82,7 @@ struct CA_Fish {
 // All values here are in physical/screen pixels (not logical).
 // -----------------------------------------------------------------------------
 struct CA_FishParams {
-  uint8_t count;                 // number of fish in play (<= array size held by caller)
+  uint8_t count;                 // number of fish in play (<= capacity of the store)
   int16_t vw, vh;                // underwater region width/height in screen pixels
   int16_t y0;                    // absolute screen Y at which water starts (top of underwater area)
 };
@@ -74,16 +102,15 @@ enum : uint8_t { F_SWIM=0, F_ATTRACT=1, F_BITE=2, F_FLEE=3, F_FLY=4 };
 // -----------------------------------------------------------------------------
 namespace CA_FishOps {
 
-// Initialize an array of fish with positions/velocities seeded from `seed`
+// Initialize the first p.count fish with positions/velocities seeded from `seed`
 // `p` defines the underwater region in screen coordinates (vw, vh, y0)
-void init(CA_Fish* f, const CA_FishParams& p, uint32_t seed);
+void init(CA_Fishes& f, const CA_FishParams& p, uint32_t seed);
 
-// Advance AI and build per-fish draw info; also enqueue dirty for background
-// restoration using each fish's previous rect. Returns the new active biter:
+// Advance AI and pick each fish's frame and flip. Returns the new active biter:
 //  - >=0 : index of the fish currently biting
 //  -  -1 : no active biter
 // Parameters:
-//   f             : array of fish with size >= p.count
+//   f             : fish store with capacity >= p.count
 //   p             : underwater region and fish count
 //   cfg           : blit config (screen size / TFT ptr)
 //   spriteAnim    : animation set used for fish (frames are 4bpp paletted)
@@ -91,15 +118,25 @@ void init(CA_Fish* f, const CA_FishParams& p, uint32_t seed);
 //   gameState     : current high-level game state (reads only)
 //   activeBiter   : previous active biter index or -1
 //   now           : millis() timestamp for time-based transitions
-int8_t updateAndDraw(CA_Fish* f, const CA_FishParams& p,
+int8_t updateAndDraw(CA_Fishes& f, const CA_FishParams& p,
                      const CA_BlitConfig& cfg,
                      const CA_Anim4& spriteAnim,
                      int16_t lureAbsX, int16_t lureAbsY,
                      uint8_t gameState, int8_t activeBiter,
                      uint32_t now);
 
+// Top-left in screen pixels of fish i's current frame
+void drawPos(const CA_Fishes& f, uint8_t i, const CA_FishParams& p,
+             const CA_Anim4& spriteAnim, int16_t& dx, int16_t& dy);
+
+// Screen box (clipped) to repaint where fish i was drawn before the last step:
+// the largest frame plus a 2×1 px pad around its old centre, so tails and
+// flips never leave trails. False when it was not drawn or the box is empty
+bool prevRect(const CA_Fishes& f, uint8_t i, const CA_FishParams& p, const CA_BlitConfig& cfg,
+              int16_t& rx, int16_t& ry, int16_t& rw, int16_t& rh);
+
 // Set all fish to flying mode for endgame sequence
-void setFlyingMode(CA_Fish* f, const CA_FishParams& p, uint32_t startTime);
+void setFlyingMode(CA_Fishes& f, const CA_FishParams& p);
 
 // Restore a rectangular region of the underwater background at 2× scaling
 // This is typically called for previous fish rects to erase trails
@@ -0,0 +1,37 @@
+#include "PalCycle.h"
+#include "Render.h"
+
+void CA_PalCycle::begin(uint16_t* bgPal, const uint8_t* ringIdx, uint8_t n,
+                        const uint8_t (*spans)[3], uint16_t spanN){
+  if (n > MAX_RING) n = MAX_RING;
+  pal = bgPal; ring = ringIdx; ringN = n;
+  spanMap = spans; spanMapN = spanN;
+  for (uint8_t i=0;i<ringN;++i) base[i] = pal[pgm_read_byte(&ring[i])];
+  phase = 0;
+  started = false;
+}
+
+void CA_PalCycle::update(CA_Render& r, uint32_t now){
+  if (!pal || ringN < 2 || !stepMs) return;
+  const uint16_t now16 = (uint16_t)now;
+  if (!started) { due = (uint16_t)(now16 + stepMs); started = true; return; }
+  if ((int16_t)(now16 - due) < 0) return;
+  due = (uint16_t)(now16 + stepMs);
+
+  if (++phase >= ringN) phase = 0;
+  uint8_t k = phase;
+  for (uint8_t i=0;i<ringN;++i){
+    pal[pgm_read_byte(&ring[i])] = base[k];
+    if (++k >= ringN) k = 0;
+  }
+  r.addDirtyBgSpans_P(spanMap, spanMapN);
+}
+
+bool CA_PalCycle::setBase(uint8_t k, uint16_t c){
+  if (k >= ringN || base[k] == c) return false;
+  base[k] = c;
+  // Entry i shows base[(i + phase) % n]
+  int16_t i = (int16_t)k - (int16_t)phase; if (i < 0) i = (int16_t)(i + ringN);
+  pal[pgm_read_byte(&ring[i])] = c;
+  return true;
+}
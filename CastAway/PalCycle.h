@@ -0,0 +1,55 @@
+#ifndef CA_PAL_CYCLE_H
+#define CA_PAL_CYCLE_H
+
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+
+class CA_Render;
+
+// -----------------------------------------------------------------------------
+// CA_PalCycle
+// Palette animation for the background: a ring of BG palette indices (the
+// water blues) rotates its colors every step, in the RAM palette the renderer
+// and drawBackground() read from.
+//
+// Only the pixels using those indices change, so a step queues the offline span
+// map (assets/BG_CYCLE.h) with the renderer instead of a full repaint. The map
+// covers ~2% of the screen for the stock background.
+// -----------------------------------------------------------------------------
+class CA_PalCycle {
+public:
+  static const uint8_t MAX_RING = 8;   // indices in the ring (SRAM: 2 B each)
+
+  // Bind the ring (PROGMEM index list) and its span map to the RAM palette.
+  // The current colors of the ring become the cycle colors
+  void begin(uint16_t* bgPal, const uint8_t* ringIdx, uint8_t n,
+             const uint8_t (*spans)[3], uint16_t spanN);
+
+  // Time between steps; 0 pauses the cycle where it is
+  void setStepMs(uint16_t ms) { stepMs = ms; }
+  uint16_t getStepMs() const { return stepMs; }
+
+  // Advance when a step is due: rewrite the ring entries and queue the spans
+  void update(CA_Render& r, uint32_t now);
+
+  // Ring members, for effects that recolor the palette (time of day): the
+  // ring owns its entries, so those give the new color of member k here.
+  // It lands in whichever entry shows member k now. False if it had it
+  uint8_t ringSize() const { return ringN; }
+  uint8_t ringIndex(uint8_t k) const { return pgm_read_byte(&ring[k]); }
+  bool setBase(uint8_t k, uint16_t c);
+
+private:
+  uint16_t* pal = nullptr;
+  const uint8_t* ring = nullptr;        // PROGMEM
+  const uint8_t (*spanMap)[3] = nullptr; // PROGMEM
+  uint16_t spanMapN = 0;
+  uint16_t base[MAX_RING];              // ring colors at begin()
+  uint8_t  ringN = 0;
+  uint8_t  phase = 0;
+  uint16_t stepMs = 220;
+  uint16_t due = 0;                     // low 16 bits of millis() of the next step
+  bool     started = false;
+};
+
+#endif
@@ -0,0 +1,45 @@
+#include "Parallax.h"
+#include "Render.h"
+
+void CA_Parallax::begin(CA_Render& r, const Band* bands, uint8_t n){
+  if (n > MAX_BANDS) n = MAX_BANDS;
+  if (n > CA_Render::MAX_BG_BANDS) n = CA_Render::MAX_BG_BANDS;
+  for (uint8_t i=0;i<CA_Render::MAX_BG_BANDS;++i){
+    if (i < n) {
+      r.setBgBandOffset(i, 0);
+      r.setBgBand(i, pgm_read_byte(&bands[i].row0), pgm_read_byte(&bands[i].rows));
+    } else {
+      r.setBgBand(i, 0, 0);
+    }
+  }
+  band = bands; bandN = n;
+  memset(phase, 0, sizeof(phase));
+  started = false;
+}
+
+void CA_Parallax::update(CA_Render& r, uint32_t now){
+  if (!band || !enabled) { started = false; return; }
+  // A band step repaints full-width rows; on top of the scroll repairs it would
+  // push the frame past its budget and starve the boxes being carried
+  if (r.scrollPending()) { started = false; return; }
+  const uint16_t now16 = (uint16_t)now;
+  for (uint8_t i=0;i<bandN;++i){
+    const uint16_t stepMs = pgm_read_word(&band[i].stepMs);
+    if (!started) { due[i] = (uint16_t)(now16 + stepMs); continue; }
+    if ((int16_t)(now16 - due[i]) < 0) continue;
+    due[i] = (uint16_t)(now16 + stepMs);
+
+    const int16_t amp = (int16_t)pgm_read_byte(&band[i].amp);
+    int16_t dx;
+    if (!amp) {
+      dx = (int16_t)(r.bgBandOffset(i) + 1);   // the renderer wraps it to the BG width
+    } else {
+      // Triangle 0, 1 .. amp .. 0 .. -amp .. -1
+      if (++phase[i] >= (int16_t)(amp << 2)) phase[i] = 0;
+      const int16_t p = phase[i];
+      dx = p <= amp ? p : (p <= 3 * amp ? (int16_t)(2 * amp - p) : (int16_t)(p - 4 * amp));
+    }
+    r.setBgBandOffset(i, dx);
+  }
+  started = true;
+}
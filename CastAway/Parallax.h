@@ -0,0 +1,47 @@
+#ifndef CA_PARALLAX_H
+#define CA_PARALLAX_H
+
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+
+class CA_Render;
+
+// -----------------------------------------------------------------------------
+// CA_Parallax
+// Horizontal motion for bands of the background (CA_Render::setBgBand): a
+// band either drifts, one screen pixel per step around the BG width, or sways
+// back and forth by up to amp pixels. Only the band that moved is repainted,
+// so a sky strip or the lake surface comes alive for a few thousand pixels a
+// step.
+// -----------------------------------------------------------------------------
+class CA_Parallax {
+public:
+  static const uint8_t MAX_BANDS = 4;   // one per renderer BG band
+
+  // One band, in BG source rows (160×120 units). PROGMEM
+  struct Band {
+    uint8_t  row0, rows;
+    uint8_t  amp;        // 0: drift left; else sway ±amp screen pixels
+    uint16_t stepMs;     // time per pixel of motion
+  };
+
+  // Install the bands with the renderer, all at offset 0
+  void begin(CA_Render& r, const Band* bands, uint8_t n);
+
+  // Off holds every band where it is; on resumes from there
+  void setEnabled(bool on) { enabled = on; }
+
+  // Step the bands that are due and hand their new offsets to the renderer.
+  // Held while the renderer has scroll motion pending (call after scrollBy())
+  void update(CA_Render& r, uint32_t now);
+
+private:
+  const Band* band = nullptr;           // PROGMEM
+  uint8_t  bandN = 0;
+  int16_t  phase[MAX_BANDS];            // sway position 0..4·amp-1
+  uint16_t due[MAX_BANDS];              // low 16 bits of millis() of the next step
+  bool     enabled = true;
+  bool     started = false;
+};
+
+#endif
@@ -0,0 +1,240 @@
+#include "Particles.h"
+#include "Render.h"
+
+static_assert(CA_PARTICLES_MAX <= 50, "particle state must fit a render log record");
+
+namespace {
+  // Cheap 50/50 blend in RGB565
+  inline uint16_t blend565(uint16_t a, uint16_t b) {
+    return (uint16_t)(((a & 0xF7DE) >> 1) + ((b & 0xF7DE) >> 1));
+  }
+
+  inline uint16_t bright565(uint16_t c) {
+    return (uint16_t)(((c >> 11) & 0x1F) * 2 + ((c >> 5) & 0x3F) + (c & 0x1F) * 2);
+  }
+
+  const int8_t GRAVITY = 3;   // splash, 1/16 px per step²
+}
+
+void CA_Particles::begin(const CA_BlitConfig& cfg, const uint16_t* bgPal, int16_t surfaceY){
+  scrW = cfg.screenW; scrH = cfg.screenH;
+  if (scrH > (int16_t)BANDS * 8) scrH = (int16_t)BANDS * 8;
+  surface = surfaceY;
+  pal = bgPal;
+
+  // Foam: the brightest entry; spray: the brightest one leaning blue
+  uint16_t bf = 0, bs = 0;
+  for (uint16_t i=0;i<256;++i){
+    const uint16_t c = bgPal[i], v = bright565(c);
+    if (v >= bf) { bf = v; foam = (uint8_t)i; }
+    if ((c & 0x1F) >= ((c >> 11) & 0x1F) && v >= bs) { bs = v; spray = (uint8_t)i; }
+  }
+
+  foamC = bgPal[foam]; sprayC = bgPal[spray];
+  memset(life, 0, sizeof(life));
+  memset(head, NONE, sizeof(head));
+  spanY = 0; cellN = 0; rr = 0;
+  due = millis();
+}
+
+void CA_Particles::setCellBudget(uint8_t cells){
+  if (cells < 8) cells = 8;
+  if (cells > MAX_CELLS) cells = MAX_CELLS;
+  budget = cells;
+}
+
+void CA_Particles::emit(Kind k, int16_t x, int16_t y, uint8_t n){
+  for (uint8_t i=0;i<MAX && n;++i){
+    if (life[i]) continue;
+    --n;
+    const uint16_t r = rnd();
+    int16_t jx = (int16_t)((r & 7) - 4);
+    switch (k){
+      case SPLASH:
+        vx[i] = (int8_t)((int8_t)((r >> 3) & 31) - 16);
+        vy[i] = (int8_t)(-22 - (int8_t)((r >> 8) & 15));
+        life[i] = 24;
+        col[i] = (r & 0x100) ? foam : spray;
+        break;
+      case RIPPLE:
+        vx[i] = (int8_t)((r & 0x10) ? 8 + ((r >> 5) & 7) : -8 - ((r >> 5) & 7));
+        vy[i] = 0;
+        life[i] = (uint8_t)(10 + ((r >> 9) & 3));
+        col[i] = foam;
+        break;
+      default:   // BUBBLE
+        jx = (int16_t)((r & 3) - 2);
+        vx[i] = (int8_t)((r & 0x10) ? 3 : -3);
+        vy[i] = (int8_t)(-6 - (int8_t)((r >> 5) & 3));
+        life[i] = 160;
+        col[i] = spray;
+        break;
+    }
+    px[i] = (int16_t)((x + jx) * 16);
+    py[i] = (int16_t)(y * 16);
+    kind[i] = (uint8_t)(k | FRESH);
+  }
+}
+
+// One step of particle i; false when it is gone (time, water, screen edge)
+bool CA_Particles::step(uint8_t i){
+  const uint8_t k = kind[i];
+  if (k == SPLASH && vy[i] < 96) vy[i] = (int8_t)(vy[i] + GRAVITY);
+  if (k == BUBBLE && !(life[i] & 7)) vx[i] = (int8_t)-vx[i];   // wobble
+  px[i] = (int16_t)(px[i] + vx[i]);
+  py[i] = (int16_t)(py[i] + vy[i]);
+  if (!--life[i]) return false;
+  const int16_t x = (int16_t)(px[i] >> 4), y = (int16_t)(py[i] >> 4);
+  if (k == SPLASH && vy[i] > 0 && y >= surface + 2) return false;
+  if (k == BUBBLE && y <= surface) return false;
+  return x >= 0 && y >= 0 && x + 2 <= scrW && y + 2 <= scrH;
+}
+
+// Cells under a particle at (x, y) (up to 4 for a 2×2 square on a cell corner)
+void CA_Particles::mark(int16_t x, int16_t y){
+  const uint8_t cx0 = (uint8_t)(x / CELL), cx1 = (uint8_t)((x + 1) / CELL);
+  const uint8_t cy0 = (uint8_t)(y / CELL), cy1 = (uint8_t)((y + 1) / CELL);
+  addCell(cx0, cy0);
+  if (cx1 != cx0) addCell(cx1, cy0);
+  if (cy1 != cy0) { addCell(cx0, cy1); if (cx1 != cx0) addCell(cx1, cy1); }
+}
+
+// Sorted insert without duplicates, so runs fall out of one pass
+void CA_Particles::addCell(uint8_t cx, uint8_t cy){
+  const uint16_t key = (uint16_t)((cy << 6) | cx);
+  uint8_t j = cellN;
+  while (j && cell[j - 1] > key) --j;
+  if (j && cell[j - 1] == key) return;
+  if (cellN >= MAX_CELLS + 8) return;
+  memmove(cell + j + 1, cell + j, (size_t)(cellN - j) * sizeof(cell[0]));
+  cell[j] = key;
+  ++cellN;
+}
+
+// Horizontal runs of cells, one box each
+void CA_Particles::flushCells(CA_Render& r) const {
+  for (uint8_t j=0;j<cellN;){
+    uint8_t n = 1;
+    while (j + n < cellN && cell[j + n] == cell[j] + n && (cell[j + n] >> 6) == (cell[j] >> 6)) ++n;
+    r.addDirtyWorldRect((int16_t)((cell[j] & 63) * CELL), (int16_t)((cell[j] >> 6) * CELL),
+                        (int16_t)(n * CELL), CELL, CA_Render::PRIO_WORLD);
+    j = (uint8_t)(j + n);
+  }
+}
+
+void CA_Particles::update(CA_Render& r, uint32_t now){
+  cellN = 0;
+
+  // Palette edits (time of day) reach particles that hold still this way
+  if (pal && (pal[foam] != foamC || pal[spray] != sprayC)) {
+    foamC = pal[foam]; sprayC = pal[spray];
+    if (spanY) r.addDirtyWorldRect(minX, minY, (int16_t)(maxX - minX), (int16_t)spanY, CA_Render::PRIO_AMBIENT);
+  }
+
+  // New particles appear where they were emitted
+  for (uint8_t i=0;i<MAX;++i){
+    if (!life[i] || !(kind[i] & FRESH) || cellN >= budget) continue;
+    kind[i] &= (uint8_t)~FRESH;
+    mark((int16_t)(px[i] >> 4), (int16_t)(py[i] >> 4));
+  }
+
+  if ((int32_t)(now - due) >= 0) {
+    due += STEP_MS;
+    if ((int32_t)(now - due) >= 0) due = now + STEP_MS;   // fell behind: resync
+    uint8_t i = rr;
+    for (uint8_t k=0;k<MAX;++k){
+      if (life[i] && !(kind[i] & FRESH)) {
+        if (cellN >= budget) { rr = i; break; }   // the rest holds still
+        const int16_t x = (int16_t)(px[i] >> 4), y = (int16_t)(py[i] >> 4);
+        const bool alive = step(i);
+        if (!alive) life[i] = 0;
+        if (!alive || (px[i] >> 4) != x || (py[i] >> 4) != y) {
+          mark(x, y);                                          // cells it leaves
+          if (alive) mark((int16_t)(px[i] >> 4), (int16_t)(py[i] >> 4));  // and enters
+        }
+      }
+      if (++i == MAX) i = 0;
+    }
+  }
+
+  flushCells(r);
+  rebuildBands();
+}
+
+void CA_Particles::rebuildBands(){
+  memset(head, NONE, sizeof(head));
+  int16_t y0 = 0x7FFF, y1 = -1, x0 = 0x7FFF, x1 = -1;
+  for (uint8_t i=0;i<MAX;++i){
+    if (!life[i] || (kind[i] & FRESH)) continue;
+    const int16_t x = (int16_t)(px[i] >> 4), y = (int16_t)(py[i] >> 4);
+    const uint8_t b = (uint8_t)(y >> 3);
+    next[i] = head[b]; head[b] = i;
+    if (y < y0) y0 = y;
+    if (y > y1) y1 = y;
+    if (x < x0) x0 = x;
+    if (x > x1) x1 = x;
+  }
+  if (y1 < 0) { spanY = 0; return; }
+  minY = y0; spanY = (uint16_t)(y1 - y0 + 2);
+  minX = x0; maxX = (int16_t)(x1 + 2);
+}
+
+bool CA_Particles::bounds(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const {
+  if (!spanY) return false;
+  x = minX; y = minY; w = (int16_t)(maxX - minX); h = (int16_t)spanY;
+  return true;
+}
+
+void CA_Particles::applyLineSlow(int16_t y, int16_t x0, int16_t w, const uint16_t* bgPal) const {
+  // A particle's two rows can straddle bands: the first row of a band also
+  // shows the particles of the band above that start on its last row
+  const uint8_t b = (uint8_t)(y >> 3);
+  applyBand(b, y, x0, w, bgPal);
+  if (!(y & 7) && b) applyBand((uint8_t)(b - 1), y, x0, w, bgPal);
+}
+
+void CA_Particles::applyBand(uint8_t b, int16_t y, int16_t x0, int16_t w, const uint16_t* bgPal) const {
+  uint16_t* lb = CA_Blit::lineBuffer();
+  for (uint8_t i=head[b]; i!=NONE; i=next[i]){
+    const int16_t ty = (int16_t)(py[i] >> 4);
+    if (ty != y && ty + 1 != y) continue;
+    const int16_t dx = (int16_t)((px[i] >> 4) - x0);
+    const uint16_t c = bgPal[col[i]];
+    // Splashes are solid; ripples and bubbles let the water through
+    if (kind[i] == SPLASH) {
+      if ((uint16_t)dx < (uint16_t)w) lb[dx] = c;
+      if ((uint16_t)(dx + 1) < (uint16_t)w) lb[dx + 1] = c;
+    } else {
+      if ((uint16_t)dx < (uint16_t)w) lb[dx] = blend565(lb[dx], c);
+      if ((uint16_t)(dx + 1) < (uint16_t)w) lb[dx + 1] = blend565(lb[dx + 1], c);
+    }
+  }
+}
+
+uint8_t CA_Particles::saveState(uint8_t* out) const {
+  uint8_t n = 1, k = 0;
+  for (uint8_t i=0;i<MAX;++i){
+    if (!life[i] || (kind[i] & FRESH)) continue;
+    const int16_t x = (int16_t)(px[i] >> 4), y = (int16_t)(py[i] >> 4);
+    out[n++] = (uint8_t)x; out[n++] = (uint8_t)(x >> 8);
+    out[n++] = (uint8_t)y; out[n++] = (uint8_t)(y >> 8);
+    out[n++] = kind[i];    out[n++] = col[i];
+    ++k;
+  }
+  out[0] = k;
+  return n;
+}
+
+void CA_Particles::loadState(const uint8_t* in, uint8_t n){
+  memset(life, 0, sizeof(life));
+  uint8_t k = n ? in[0] : 0;
+  if (k > MAX) k = MAX;
+  if (n < 1 + k * 6) k = (uint8_t)((n - 1) / 6);
+  for (uint8_t i=0;i<k;++i){
+    const uint8_t* p = in + 1 + i * 6;
+    px[i] = (int16_t)((int16_t)(p[0] | (p[1] << 8)) * 16);
+    py[i] = (int16_t)((int16_t)(p[2] | (p[3] << 8)) * 16);
+    kind[i] = p[4]; col[i] = p[5]; life[i] = 1;
+  }
+  rebuildBands();
+}
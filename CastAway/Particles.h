@@ -0,0 +1,108 @@
+#ifndef CA_PARTICLES_H
+#define CA_PARTICLES_H
+
+#include <Arduino.h>
+#include "Blitter.h"     // CA_BlitConfig (screen dims)
+
+class CA_Render;
+
+// Particle slots (SRAM: 10 B each). At most 50, so a render log can carry them
+#ifndef CA_PARTICLES_MAX
+#define CA_PARTICLES_MAX 32
+#endif
+
+// -----------------------------------------------------------------------------
+// CA_Particles
+// Catch splashes, bite ripples and bubbles: a fixed pool of 2×2 particles kept
+// as parallel arrays, one per field, so each pass reads only what it needs.
+// Positions and velocities are 12.4 fixed point; the pool steps at most once
+// per update(), every STEP_MS.
+//
+// Like CA_WaterFx the effect owns its dirty region. update() collects the
+// CELL×CELL cells particles leave and enter when they move by a pixel, merges
+// them into runs per cell row and queues the runs (PRIO_WORLD). Once the cells
+// of an update reach the budget (setCellBudget; the last particle may add up
+// to 7 more), the remaining particles hold still until the next one, so a
+// burst never costs much more than the budget in a frame. When the palette
+// entries they use change, the rect around them is repainted once.
+//
+// After each update the particles on screen are chained per 8-row band, and
+// the renderer composes them over the world sprites in the same scanline pass
+// (applyLine). Colors are BG palette indices, so palette edits carry over.
+// -----------------------------------------------------------------------------
+class CA_Particles {
+public:
+  static const uint8_t MAX       = CA_PARTICLES_MAX;
+  static const uint8_t MAX_CELLS = 48;     // cell budget, at most (SRAM: 2 B per cell)
+  static const uint8_t CELL      = 8;      // dirty cell size, px
+  static const uint8_t BANDS     = 40;     // 8-row bands: screens up to 320 rows
+  static const uint8_t STEP_MS   = 40;
+
+  enum Kind : uint8_t { SPLASH, RIPPLE, BUBBLE };
+
+  // Colors from the 256-entry BG palette in RAM. Splashes fall back into the
+  // water at surfaceY (screen row), bubbles burst there
+  void begin(const CA_BlitConfig& cfg, const uint16_t* bgPal, int16_t surfaceY);
+
+  // Cells repainted per update() (8..MAX_CELLS)
+  void setCellBudget(uint8_t cells);
+
+  // Spawn up to n particles of kind k around screen (x, y), in free slots
+  void emit(Kind k, int16_t x, int16_t y, uint8_t n);
+
+  // Step the pool when due, queue the cells that changed, rebuild the bands
+  void update(CA_Render& r, uint32_t now);
+
+  // Compose the particles covering scanline y into the line buffer
+  // (x0,w is the horizontal span held by the buffer)
+  inline void applyLine(int16_t y, int16_t x0, int16_t w, const uint16_t* bgPal) const {
+    if ((uint16_t)(y - minY) >= spanY) return;
+    applyLineSlow(y, x0, w, bgPal);
+  }
+
+  // Screen rect around the particles on screen; false if there are none
+  bool bounds(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const;
+
+  // What applyLine() draws, for render logs: saveState() fills up to
+  // STATE_BYTES and returns the count, loadState() puts it back
+  static const uint8_t STATE_BYTES = 1 + MAX * 6;
+  uint8_t saveState(uint8_t* out) const;
+  void    loadState(const uint8_t* in, uint8_t n);
+
+private:
+  static const uint8_t NONE  = 0xFF;
+  static const uint8_t FRESH = 0x80;   // kind flag: spawned, not on screen yet
+
+  int16_t  px[MAX], py[MAX];  // top-left, 12.4 screen pixels
+  int8_t   vx[MAX], vy[MAX];  // 1/16 px per step
+  uint8_t  life[MAX];         // steps left, 0 = free slot
+  uint8_t  kind[MAX];         // Kind | FRESH
+  uint8_t  col[MAX];          // BG palette index
+  uint8_t  next[MAX];         // band chain
+
+  uint8_t  head[BANDS];       // first particle per 8-row band
+  int16_t  minX = 0, maxX = 0, minY = 0;
+  uint16_t spanY = 0;         // rows [minY, minY+spanY) hold particles
+
+  uint16_t cell[MAX_CELLS + 8];   // dirty cells this update, sorted (row << 6 | col)
+  uint8_t  cellN = 0, budget = MAX_CELLS;
+
+  int16_t  scrW = 320, scrH = 240, surface = 0;
+  const uint16_t* pal = nullptr;
+  uint8_t  foam = 0, spray = 0;
+  uint16_t foamC = 0, sprayC = 0;   // their colors when last drawn
+  uint8_t  rr = 0;            // slot the next step starts at (round robin)
+  uint32_t due = 0;
+  uint32_t rng = 0x5EA5A1F5;
+
+  uint16_t rnd(){ rng ^= rng << 7; rng ^= rng >> 9; rng ^= rng << 8; return (uint16_t)rng; }
+  bool     step(uint8_t i);
+  void     mark(int16_t x, int16_t y);
+  void     addCell(uint8_t cx, uint8_t cy);
+  void     flushCells(CA_Render& r) const;
+  void     rebuildBands();
+  void     applyLineSlow(int16_t y, int16_t x0, int16_t w, const uint16_t* bgPal) const;
+  void     applyBand(uint8_t b, int16_t y, int16_t x0, int16_t w, const uint16_t* bgPal) const;
+};
+
+#endif
@@ -0,0 +1,60 @@
+#include "Quality.h"
+
+namespace {
+  struct Knobs { uint8_t shimmerPct; uint8_t cycleStep10; uint8_t manEvery; uint8_t fishEvery; uint8_t skip; uint8_t parallax; uint8_t ptCells; };
+
+  // cycleStep10 is the palette step in 10 ms units
+  const Knobs KNOBS[CA_Quality::LEVELS] PROGMEM = {
+    { 100, 22, 1, 1, 0, 1, 48 },
+    {  60, 33, 2, 1, 0, 1, 32 },
+    {  40, 66, 3, 1, 0, 0, 24 },
+    {  20,  0, 3, 2, 0, 0, 16 },
+    {   0,  0, 4, 2, 1, 0,  8 },
+  };
+}
+
+void CA_Quality::begin(uint8_t targetFps, uint32_t now){
+  if (!targetFps) targetFps = 1;
+  targetMs16 = (uint16_t)((1000u * 16u) / targetFps);
+  emaMs16 = targetMs16;
+  lastMs = now;
+  lvl = 0;
+  overN = underN = 0;
+  hold = HOLD_FRAMES;
+}
+
+bool CA_Quality::sample(uint32_t now, bool rendered){
+  // A skipped frame's time goes into the next rendered one
+  if (!rendered) return false;
+  uint32_t dt = now - lastMs;
+  lastMs = now;
+  // Clamp outliers (blocking modal, first frame) to 4× target
+  const uint32_t cap = ((uint32_t)targetMs16 * 4) >> 4;
+  if (dt > cap) dt = cap;
+
+  // EMA, alpha = 1/8
+  emaMs16 = (uint16_t)(emaMs16 - (emaMs16 >> 3) + ((uint16_t)(dt << 4) >> 3));
+
+  if (hold) { --hold; return false; }
+
+  const bool over  = emaMs16 > (uint16_t)(targetMs16 + (targetMs16 >> 3));   // > 112%
+  const bool under = emaMs16 < (uint16_t)(targetMs16 - (targetMs16 >> 2));   // < 75%
+  overN  = over  ? (uint8_t)(overN  + (overN  < 255)) : 0;
+  underN = under ? (uint8_t)(underN + (underN < 255)) : 0;
+
+  if (overN >= DOWN_FRAMES && lvl + 1 < LEVELS) { ++lvl; }
+  else if (underN >= UP_FRAMES && lvl > 0)      { --lvl; }
+  else return false;
+
+  overN = underN = 0;
+  hold = HOLD_FRAMES;
+  return true;
+}
+
+uint8_t  CA_Quality::shimmerPct()  const { return pgm_read_byte(&KNOBS[lvl].shimmerPct); }
+uint16_t CA_Quality::cycleStepMs() const { return (uint16_t)pgm_read_byte(&KNOBS[lvl].cycleStep10) * 10u; }
+uint8_t  CA_Quality::manEvery()    const { return pgm_read_byte(&KNOBS[lvl].manEvery); }
+uint8_t  CA_Quality::fishEvery()   const { return pgm_read_byte(&KNOBS[lvl].fishEvery); }
+bool     CA_Quality::frameSkip()   const { return pgm_read_byte(&KNOBS[lvl].skip) != 0; }
+bool     CA_Quality::parallax()    const { return pgm_read_byte(&KNOBS[lvl].parallax) != 0; }
+uint8_t  CA_Quality::particleCells() const { return pgm_read_byte(&KNOBS[lvl].ptCells); }
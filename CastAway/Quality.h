@@ -0,0 +1,64 @@
+#ifndef CA_QUALITY_H
+#define CA_QUALITY_H
+
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+
+// Target frame rate the governor defends (frames per second)
+#ifndef CA_TARGET_FPS
+#define CA_TARGET_FPS 20
+#endif
+
+// -----------------------------------------------------------------------------
+// CA_Quality
+// Adaptive quality governor. Fed the tick time once per frame, it keeps a
+// smoothed frame time and steps a quality level against the target FPS:
+//   0  full quality
+//   1  fewer shimmer squares, slower palette cycle, particles on a smaller
+//      repaint budget (again at each level below)
+//   2  ambient animation (man pose, palette cycle) at a lower rate, parallax
+//      bands held
+//   3  fish AI every other frame, palette cycle paused
+//   4  frame skip: render every other frame (last resort)
+//
+// Hysteresis: degrading needs the frame time over target for DOWN_FRAMES in a
+// row, upgrading needs clear headroom for UP_FRAMES, and after any change the
+// level holds for HOLD_FRAMES so the effect of the change can be measured.
+// Frame time is measured between rendered frames: a tick that frame skip left
+// undrawn adds its time to the next sample, so level 4 is judged by the rate
+// it shows and not by its cheap skipped ticks.
+// -----------------------------------------------------------------------------
+class CA_Quality {
+public:
+  static const uint8_t LEVELS      = 5;
+  static const uint8_t DOWN_FRAMES = 12;
+  static const uint8_t UP_FRAMES   = 90;
+  static const uint8_t HOLD_FRAMES = 30;
+
+  void begin(uint8_t targetFps, uint32_t now);
+
+  // One sample per tick; `rendered` = the last tick pushed a frame. Returns
+  // true when the level changed (apply the knobs)
+  bool sample(uint32_t now, bool rendered);
+
+  uint8_t  level() const { return lvl; }
+  uint16_t frameMs() const { return (uint16_t)(emaMs16 >> 4); }   // smoothed
+
+  // Knobs for the current level
+  uint8_t  shimmerPct()  const;   // % of the full shimmer density
+  uint16_t cycleStepMs() const;   // palette cycle step (0 = paused)
+  uint8_t  manEvery()    const;   // re-pick the man pose every N frames
+  uint8_t  fishEvery()   const;   // run fish AI every N frames
+  bool     frameSkip()   const;
+  bool     parallax()    const;   // BG bands drift / sway
+  uint8_t  particleCells() const; // particle repaint cells per frame
+
+private:
+  uint16_t targetMs16 = 0;       // target frame time, 1/16 ms
+  uint16_t emaMs16 = 0;          // smoothed frame time, 1/16 ms
+  uint32_t lastMs = 0;
+  uint8_t  lvl = 0;
+  uint8_t  overN = 0, underN = 0, hold = 0;
+};
+
+#endif
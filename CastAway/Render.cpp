@@ -1,231 +1,382 @@
 #include "Render.h"
 #include "Blitter.h"
 #include "DrawSetup.h"
-#include "assets/BACKGROUND.h"
+#include "WaterFx.h"
+#include "Particles.h"
+#include "RenderLog.h"
 #include <string.h>
 
-// Fast PRNG for shimmer effects (replaces Arduino random())
-static uint32_t s_shimmerRNG = 0xBADC0FFE;
-inline uint16_t shimmerRand() { 
-  s_shimmerRNG ^= s_shimmerRNG << 7; 
-  s_shimmerRNG ^= s_shimmerRNG >> 9; 
-  s_shimmerRNG ^= s_shimmerRNG << 8; 
-  return (uint16_t)s_shimmerRNG; 
-}
-inline uint16_t shimmerRandRange(uint16_t max) {
-  return shimmerRand() % max;
-}
+#if CA_RENDER_LOG
+  #define CA_RLOG(call) do { if (rlog) rlog->call; } while (0)
+#else
+  #define CA_RLOG(call) do {} while (0)
+#endif
 
 // Masking and tiling paths removed. Stable scanline + dirty rects only
 
 namespace {
-  // Shimmer state
-  uint32_t s_nextShimmerMs = 0;
-  int16_t  s_shimmerY0 = -1;
-  uint8_t  s_shimmerH = 0;
-  uint8_t  s_shimmerN = 0;
-  int16_t  s_shX[16];
-  uint8_t  s_shRow[16];
-  uint16_t s_shCol[16];
-  uint8_t  s_shRows2xH = 0;  // shimmer rows in 2× vertical units (pairs of lines)
-
-  // Small cache to reuse the BG line for vertically paired scanlines during 2× scaling
-  // For a given dirty box (fixed x0 and width), y and y+1 share the same srcY (y>>1),
-  // so the background line is identical and can be copied instead of recomposed
-  static uint16_t s_bgLineCache[320];
-}
-
-  inline bool isBlueish(uint16_t c) {
-    uint8_t r = (uint8_t)((c >> 11) & 0x1F);
-    uint8_t g = (uint8_t)((c >> 5)  & 0x3F);
-    uint8_t b = (uint8_t)(c & 0x1F);
-    uint8_t thresh = (uint8_t)(r + (g >> 2));
-    if (thresh < 10) thresh = 10;
-    return b >= thresh;
-  }
-
-  // Bright “white-blue”: high overall brightness, still blue-leaning
-  inline bool isWhiteBlue(uint16_t c) {
-    uint8_t r = (uint8_t)((c >> 11) & 0x1F);
-    uint8_t g = (uint8_t)((c >> 5)  & 0x3F);
-    uint8_t b = (uint8_t)(c & 0x1F);
-    // brightness ~ (2*r + g + 2*b) in [0..187]
-    uint16_t bright = (uint16_t)r + r + g + b + b;
-    // blue not lower than red, and quite bright
-    return (b >= r) && (bright >= 120);
-  }
-
-  inline void maybeUpdateShimmer(const CA_BlitConfig& cfg, uint16_t* bgPal) {
-    if (!bgPal) return;
-    
-  // Reduce shimmer update frequency to save cycles (every 6th frame)
-  static uint8_t s_shimmerFrameCounter = 0;
-  if (++s_shimmerFrameCounter < 6) return;
-    s_shimmerFrameCounter = 0;
-    
-    uint32_t now = millis();
-    if (now < s_nextShimmerMs) return;
-
-    // Surface band: 8 px above waterline, 5 rows tall
-    int16_t seaTop = (int16_t)((cfg.screenH * 72) / 100);  // Revert to original calculation
-    int16_t y0 = (int16_t)(seaTop - 8);
-    if (y0 < 0) y0 = 0;
-    uint8_t h = 5;
-    if ((int32_t)y0 + h > cfg.screenH) h = (uint8_t)(cfg.screenH - y0);
-    if (h == 0) { s_shimmerN = 0; s_shimmerY0 = -1; s_shimmerH = 0; s_shRows2xH = 0; s_nextShimmerMs = now + 100; return; }
-
-    s_shimmerY0 = y0;
-    s_shimmerH  = h;
-    // 2× vertical units (pair two lines into one shimmer row)
-    s_shRows2xH = (uint8_t)((h + 1) >> 1); // ceil(h/2)
-    if (s_shRows2xH == 0) { s_shimmerN = 0; s_nextShimmerMs = now + 100; return; }
-
-    // Keep shimmer count modest and deterministic per refresh to reduce rng calls
-    uint8_t rnd = shimmerRandRange(16);
-  s_shimmerN  = (uint8_t)(5 + (rnd & 3)); // 5..8
-  if (s_shimmerN > 8) s_shimmerN = 8;     // tighter cap for perf
-
-    for (uint8_t i=0; i<s_shimmerN; ++i) {
-      // Align shimmer to even X so we can draw 2 px wide squares cleanly
-      uint16_t rx = shimmerRandRange((uint16_t)cfg.screenW);
-      s_shX[i] = (int16_t)(rx & ~1);
-      // Choose row in 2× units so it repeats for y and y+1 (2×2 block)
-      s_shRow[i] = shimmerRandRange(s_shRows2xH);
-
-      // pick a blue-ish or white-blue color from BG palette; fallback to pure blue
-      uint16_t c = 0x001F;
-      for (uint8_t tries=0; tries<4; ++tries) {
-        uint8_t idx = shimmerRandRange(256);
-        uint16_t samp = bgPal[idx];
-        if (isBlueish(samp) || isWhiteBlue(samp)) { c = samp; break; }
-      }
-      s_shCol[i] = c;
+  // Small cache to reuse the BG line for scanlines showing the same source row
+  // For a given dirty box (fixed x0 and width), y and y+1 share the same srcY
+  // (y>>1 at 2×), so the background line is identical and can be copied
+  static uint16_t s_bgLineCache[CA_LINE_MAX];
+
+  // All-opaque palette: composing FG over a zeroed line leaves its mask behind
+  static uint16_t s_maskPal[16];
+
+  // Columns [c0, c1) of a frame row held at p (c0 even), as a one-row sprite
+  inline void composeCols(const CA_Frame4& f, const uint8_t* p, uint16_t c0, uint16_t c1,
+                          int16_t vx, int16_t y, uint16_t* pal, bool hFlip, uint8_t key,
+                          int16_t x0, int16_t W){
+    if (c1 <= c0) return;
+    const int16_t cx = hFlip ? (int16_t)(vx + (int16_t)(f.w - c1)) : (int16_t)(vx + c0);
+    CA_Blit::composeOver4bppKeyIdx_P(p, (uint16_t)(c1 - c0), 1, cx, y, pal, hFlip, key, y, x0, W);
+  }
+
+  // Scanline y of frame f. A delta frame's row is its keyframe's with the
+  // changed bytes swapped in: up to three runs, none of them copied. A
+  // streamed frame's row comes from the asset row cache
+  void composeFrameLine(const CA_Frame4& f, int16_t vx, int16_t vy, uint16_t* pal,
+                        bool hFlip, uint8_t key, int16_t y, int16_t x0, int16_t W){
+#if CA_ASSET_STREAM
+    if (f.src) {
+      const int16_t row = (int16_t)(y - vy);
+      if (row < 0 || row >= (int16_t)f.h) return;
+      CA_Blit::composeOver4bppKeyIdxRow(CA_Anim::streamRow(f, row), f.w, vx, pal, hFlip, key, x0, W);
+      return;
     }
+#endif
+    if (!f.delta) { CA_Blit::composeOver4bppKeyIdx_P(f.data, f.w, f.h, vx, vy, pal, hFlip, key, y, x0, W); return; }
+    const int16_t row = (int16_t)(y - vy);
+    if (row < 0 || row >= (int16_t)f.h) return;
+    uint8_t b0, b1; const uint8_t* span = nullptr;
+    const uint8_t* src = CA_Anim::deltaRow(f, row, b0, b1, span);
+    if (b0 == b1) { composeCols(f, src, 0, f.w, vx, y, pal, hFlip, key, x0, W); return; }
+    const uint16_t c0 = (uint16_t)(b0 << 1), c1 = (uint16_t)(b1 << 1) < f.w ? (uint16_t)(b1 << 1) : f.w;
+    composeCols(f, src, 0, c0, vx, y, pal, hFlip, key, x0, W);
+    composeCols(f, span, c0, c1, vx, y, pal, hFlip, key, x0, W);
+    composeCols(f, src + b1, c1, f.w, vx, y, pal, hFlip, key, x0, W);
+  }
+}
 
-  s_nextShimmerMs = now + 820 + shimmerRandRange(120);
-  }
-
-  inline void applyShimmerLine(int16_t y, int16_t x0, int16_t w) {
-    if (s_shimmerN == 0) return;
-    if (y < s_shimmerY0 || y >= (s_shimmerY0 + s_shimmerH)) return;
-    // Use 2× vertical row index so shimmer appears as 2×2 squares (same on y and y+1)
-    uint8_t row2x = (uint8_t)((y - s_shimmerY0) >> 1);
-    for (uint8_t i=0; i<s_shimmerN; ++i) {
-      if (s_shRow[i] != row2x) continue;
-      int16_t dx = (int16_t)(s_shX[i] - x0);
-      if ((uint16_t)dx < (uint16_t)w) {
-        uint16_t* lb = CA_Blit::lineBuffer();
-        auto blend565 = [](uint16_t a, uint16_t b){
-          // Cheap 50/50 blend in RGB565
-          uint16_t ar = (a >> 11) & 0x1F, ag = (a >> 5) & 0x3F, ab = a & 0x1F;
-          uint16_t br = (b >> 11) & 0x1F, bg = (b >> 5) & 0x3F, bb = b & 0x1F;
-          uint16_t r = (uint16_t)((ar + br) >> 1);
-          uint16_t g = (uint16_t)((ag + bg) >> 1);
-          uint16_t bl= (uint16_t)((ab + bb) >> 1);
-          return (uint16_t)((r << 11) | (g << 5) | bl);
-        };
-        // Draw 2× horizontally (dx and dx+1) with a soft blend over BG
-        lb[dx] = blend565(lb[dx], s_shCol[i]);
-        if ((uint16_t)(dx + 1) < (uint16_t)w) lb[dx + 1] = blend565(lb[dx + 1], s_shCol[i]);
-      }
+void CA_Render::attachPools(const Pools& p) {
+  // World and FG keep their historical policies; extra layers dirty what
+  // they queue, so particles or overlays need no bookkeeping in the game
+  layers = p.layers; layerN = (uint8_t)(3 + p.xl);
+  const LayerDesc desc = { LK_SPRITES, LD_EXPLICIT, PRIO_WORLD, false, -32768, 32767 };
+  for (uint8_t l=0;l<layerN;++l){
+    Layer& L = layers[l];
+    L.d = desc; L.n = L.visN = L.prevN = 0; L.mark = false;
+    if (l == LAYER_WORLD) {
+      L.q = p.spr; L.ord = p.sprOrd; L.vis = p.sprVis; L.cap = p.sprCap;
+    } else if (l == LAYER_FG) {
+      L.q = p.fg;  L.ord = p.fgOrd;  L.vis = p.fgVis;  L.cap = p.fgCap;
+      L.d.dirty = LD_ON_MARK; L.d.cached = true;
+    } else if (l + 1 < layerN) {
+      const uint16_t o = (uint16_t)(l - LAYER_XTRA) * p.xCap;
+      L.q = p.x + o; L.ord = p.xOrd + o; L.vis = p.xVis + o; L.cap = p.xCap;
+      L.d.dirty = LD_ON_ADD;
+    } else {
+      L.q = nullptr; L.ord = L.vis = nullptr; L.cap = 0;
+      L.d.kind = LK_UI;
     }
   }
-  // (dead mask/tile helpers removed)
+  cacheLayer = LAYER_FG;
+  sdesc = p.sdesc; sdescCap = p.sdescCap;
+  rec = p.rec; recOrd = p.recOrd; recCap = p.recCap;
+  bar = p.bar; barOrd = p.barOrd; barCap = p.barCap;
+  txt = p.txt; txtOrd = p.txtOrd; txtCap = p.txtCap;
+  lin = p.lin; linOrd = p.linOrd; linCap = p.linCap;
+  wbox = p.wbox; wbCap = p.wbCap;
+  ui   = p.ui;   uibCap = p.uibCap;
+  fgc = p.fgc; fgcMask = p.fgcMask; fgcCap = p.fgcCap;
+}
 
-CA_Render::CA_Render() {}
+#if CA_RENDER_LOG
+void CA_Render::setRenderLog(CA_RenderLog* log){
+  rlog = log;
+  if (rlog) rlog->attach(this);
+}
+#endif
 
 void CA_Render::begin(const CA_BlitConfig* cfg) {
   blitCfg = *cfg;
+  fgcH = 0; fgcN = 0; linPrevN = 0; sdescN = 0;
   clearDirty();
   clearQueues();
+  resetZBuckets();
 }
 
 void CA_Render::beginFrame() {
   clearQueues();
+  if (zbOverflow) resetZBuckets();
+}
+
+// ---- layers ----
+void CA_Render::setLayer(uint8_t l, const LayerDesc& d){
+  if (l >= layerN) return;
+  CA_RLOG(layer(l, d));
+  Layer& L = layers[l];
+  const uint8_t kind = L.d.kind;
+  L.d = d; L.d.kind = kind;
+  if (L.d.prio >= PRIO_N) L.d.prio = PRIO_AMBIENT;
+  if (kind != LK_SPRITES) L.d.cached = false;
+  // One cached layer: flagging another moves the cache there
+  if (L.d.cached) {
+    if (cacheLayer != NO_LAYER && cacheLayer != l) layers[cacheLayer].d.cached = false;
+    cacheLayer = l;
+  } else if (cacheLayer == l) {
+    cacheLayer = NO_LAYER;
+  }
+  fgcH = 0; fgcW = 0;   // rebuilt by the next syncFgCache()
+}
+
+void CA_Render::markLayerDirty(uint8_t l){
+  CA_RLOG(layerDirty(l));
+  if (l < layerN) layers[l].mark = true;
+}
+
+// ---- enqueue ----
+void CA_Render::queueSprite(uint8_t l, const CA_Frame4& f, int16_t vx, int16_t vy, bool hFlip,
+                            uint16_t* palRam, uint8_t keyIdx, int16_t z){
+  if (l >= layerN || layers[l].d.kind != LK_SPRITES) return;
+  Layer& L = layers[l];
+  if (L.n >= L.cap) { bump(l == LAYER_WORLD ? stats.droppedSpr : stats.droppedFG); return; }
+  if (L.d.dirty == LD_ON_ADD) {
+    // The slot's record from last frame is where this sprite was drawn
+    if (L.n < L.prevN) { const Sprite& o = L.q[L.n]; addWorldRect(o.vx, o.vy, o.w, o.h, L.d.prio); }
+    addWorldRect(vx, vy, f.w, f.h, L.d.prio);
+  }
+  Sprite s = { &f, vx, vy, f.w, f.h, hFlip, palRam, keyIdx, zBucket(clampZ(L, z)) };
+  L.q[L.n++] = s;
+  peak(l == LAYER_WORLD ? stats.peakSpr : stats.peakFG, L.n);
+}
+
+void CA_Render::addSpriteTo(uint8_t l, const CA_Frame4& f, int16_t vx, int16_t vy, bool hFlip,
+                            uint16_t* palRam, int16_t z){
+  queueSprite(l, f, vx, vy, hFlip, palRam, CA_Draw::topLeftKeyIndex(f), z);
+}
+
+void CA_Render::addSpriteId(uint8_t l, uint8_t id, int16_t vx, int16_t vy, bool hFlip, int16_t z){
+  if (id >= sdescN) return;
+  const SpriteDesc& d = sdesc[id];
+  queueSprite(l, *d.f, vx, vy, hFlip, d.palRam, d.keyIdx, z);
+}
+
+uint8_t CA_Render::registerFrames(const CA_Frame4* frames, uint8_t n, uint16_t* palRam){
+  if (!n || (uint16_t)sdescN + n > sdescCap) return NO_DESC;
+  const uint8_t first = sdescN;
+  for (uint8_t i=0;i<n;++i){
+    const CA_Frame4& f = frames[i];
+    sdesc[sdescN++] = { &f, palRam ? palRam : CA_Draw::ensurePaletteRAM(f.pal565), CA_Draw::topLeftKeyIndex(f) };
+  }
+  return first;
+}
+
+uint8_t CA_Render::registerAnim(const CA_Anim4& a){
+  return registerFrames(a.frames, a.count, a.pal565 ? CA_Draw::ensurePaletteRAM(a.pal565) : nullptr);
 }
 
-// ---- enqueue (unchanged) ----
 void CA_Render::addSprite(const CA_Frame4& f, int16_t vx, int16_t vy, bool hFlip,
                           uint16_t* palRam, uint16_t /*key565*/, int16_t z){
-  if (sprN < MAX_SPR) {
-    const uint8_t keyIdx = CA_Draw::topLeftKeyIndex(f);
-    Sprite s = { f, vx, vy, hFlip, palRam, keyIdx, z };
-    spr[sprN++] = s;
-  }
+  addSpriteTo(LAYER_WORLD, f, vx, vy, hFlip, palRam, z);
 }
 
 void CA_Render::addSpriteFG(const CA_Frame4& f, int16_t vx, int16_t vy, bool hFlip,
                             uint16_t* palRam, uint16_t /*key565*/, int16_t z){
-  if (fgN < MAX_FG) {
-    const uint8_t keyIdx = CA_Draw::topLeftKeyIndex(f);
-    Sprite s = { f, vx, vy, hFlip, palRam, keyIdx, z };
-    fg[fgN++] = s;
-  }
+  addSpriteTo(LAYER_FG, f, vx, vy, hFlip, palRam, z);
 }
-void CA_Render::markForegroundDirty(){ fgNeedsFullPass = true; }
+void CA_Render::markForegroundDirty(){ markLayerDirty(LAYER_FG); }
 
 void CA_Render::addSolid(int16_t rx, int16_t ry, int16_t rw, int16_t rh, uint16_t c, int16_t z){
-  if (recN < MAX_REC) rec[recN++] = { rx, ry, rw, rh, c, z, false };
+  if (recN >= recCap) { bump(stats.droppedRec); return; }
+  rec[recN++] = { rx, ry, rw, rh, c, zBucket(clampZ(layers[layerN-1], z)), false };
+  peak(stats.peakRec, recN);
 }
 void CA_Render::addOutline(int16_t rx, int16_t ry, int16_t rw, int16_t rh, uint16_t c, int16_t z){
-  if (recN < MAX_REC) rec[recN++] = { rx, ry, rw, rh, c, z, true };
+  if (recN >= recCap) { bump(stats.droppedRec); return; }
+  rec[recN++] = { rx, ry, rw, rh, c, zBucket(clampZ(layers[layerN-1], z)), true };
+  peak(stats.peakRec, recN);
 }
 void CA_Render::addHBar(int16_t bx, int16_t by, int16_t bw, int16_t bh, int16_t fillW, uint16_t c, int16_t z){
-  if (barN < MAX_BAR) bar[barN++] = { bx, by, bw, bh, fillW, c, z };
+  if (barN >= barCap) { bump(stats.droppedBar); return; }
+  bar[barN++] = { bx, by, bw, bh, fillW, c, zBucket(clampZ(layers[layerN-1], z)) };
+  peak(stats.peakBar, barN);
 }
 void CA_Render::addText(const char* s, int16_t tx, int16_t ty, uint16_t c, int16_t z){
-  if (txtN >= MAX_TXT) return;
+  if (txtN >= txtCap) { bump(stats.droppedTxt); return; }
   strncpy(txt[txtN].str, s, sizeof(txt[txtN].str)-1);
   txt[txtN].str[sizeof(txt[txtN].str)-1]=0;
-  txt[txtN].tx = tx; txt[txtN].ty = ty; txt[txtN].color565 = c; txt[txtN].z = z;
+  txt[txtN].tx = tx; txt[txtN].ty = ty; txt[txtN].color565 = c; txt[txtN].zb = zBucket(clampZ(layers[layerN-1], z));
   ++txtN;
+  peak(stats.peakTxt, txtN);
 }
 void CA_Render::addTextOpaque(const char* s, int16_t tx, int16_t ty, uint16_t fg, uint16_t bg,
                               uint8_t cols, int16_t z){
-  if (txtN >= MAX_TXT) return;
+  if (txtN >= txtCap) { bump(stats.droppedTxt); return; }
   strncpy(txt[txtN].str, s, sizeof(txt[txtN].str)-1);
   txt[txtN].str[sizeof(txt[txtN].str)-1]=0;
   // Do not render beyond the cleared run; clamp to `cols` characters
   if (cols < sizeof(txt[txtN].str)-1) {
     txt[txtN].str[cols] = '\0';
   }
-  txt[txtN].tx = tx; txt[txtN].ty = ty; txt[txtN].color565 = fg; txt[txtN].z = z;
+  txt[txtN].tx = tx; txt[txtN].ty = ty; txt[txtN].color565 = fg; txt[txtN].zb = zBucket(clampZ(layers[layerN-1], z));
   // piggyback extra state using spare bytes in Text (none available),
   // so instead enqueue a solid clear rect followed by normal text
   // Clear width = cols * 6, height = 7 (font). We clear the full reserved span
   addSolid(tx, (int16_t)ty, (int16_t)(cols * 6), (int16_t)7, bg, (int16_t)(z-1));
   ++txtN; // the prior addSolid already queued; keep text via addText below
+  peak(stats.peakTxt, txtN);
+}
+void CA_Render::addLine(int16_t xa, int16_t ya, int16_t xb, int16_t yb, uint16_t c, int16_t z){
+  CA_RLOG(line(xa, ya, xb, yb, c, z));
+  if (linN >= linCap) { bump(stats.droppedLin); return; }
+  Line& q = lin[linN];
+  CA_LineDDA s;
+  CA_Blit::lineInit(s, xa, ya, xb, yb);
+  const uint8_t zb = zBucket(clampZ(layers[layerN-1], z));
+  // The slot's record from last frame is the line on screen
+  const bool had = (linN < linPrevN);
+  if (!had || q.s.xa != s.xa || q.s.ya != s.ya || q.s.xb != s.xb || q.s.yb != s.yb ||
+      q.color565 != c || q.zb != zb) {
+    if (had) addLineRects(q.s);
+    addLineRects(s);
+  }
+  q.s = s; q.color565 = c; q.zb = zb;
+  ++linN;
+  peak(stats.peakLin, linN);
+}
+
+void CA_Render::addPolyline(const int16_t* xy, uint8_t n, uint16_t c, int16_t z){
+  for (uint8_t i=1;i<n;++i, xy+=2) addLine(xy[0], xy[1], xy[2], xy[3], c, z);
+}
+
+// Thin boxes along a line, each about LINE_SEG pixels of it: LINE_SEG rows of
+// a steep line, fewer rows of a shallow one. Boxes start on even rows and
+// span an even count, so the even rounding in renderFrame() keeps them apart
+void CA_Render::addLineRects(CA_LineDDA s){
+  const int16_t dy = (int16_t)(s.yb - s.ya + 1);
+  int16_t dx = (int16_t)(s.xb - s.xa); if (dx < 0) dx = (int16_t)-dx; ++dx;
+  int16_t k = (dy >= dx) ? (int16_t)LINE_SEG : (int16_t)(((int32_t)LINE_SEG * dy) / dx);
+  const int16_t kMin = (int16_t)((dy + LINE_BOXES - 1) / LINE_BOXES);
+  if (k < kMin) k = kMin;
+  k = (int16_t)((k + 1) & ~1);
+  for (int16_t y = (int16_t)(s.ya & ~1); y <= s.yb; y = (int16_t)(y + k)){
+    const int16_t r0 = max(y, s.ya), r1 = min((int16_t)(y + k - 1), s.yb);
+    int16_t L0, R0, L1, R1;
+    CA_Blit::lineSpan(s, r0, L0, R0);
+    CA_Blit::lineSpan(s, r1, L1, R1);
+    const int16_t L = min(L0, L1), R = max(R0, R1);
+    addWorldRect(L, r0, (int16_t)(R - L + 1), (int16_t)(r1 - r0 + 1), PRIO_HIGH);
+  }
+}
+
+void CA_Render::addDirtyRect(int16_t x, int16_t y, int16_t w, int16_t h){ CA_RLOG(dirtyUI(x,y,w,h)); addUIRect(x,y,w,h); }
+void CA_Render::addDirtyWorldRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t prio){
+  CA_RLOG(dirtyWorld(x,y,w,h,prio));
+  if (prio >= PRIO_N) prio = PRIO_AMBIENT;
+  addWorldRect(x,y,w,h,prio);
+}
+void CA_Render::addDirtyBgSpans_P(const uint8_t (*spans)[3], uint16_t n){
+  if (!n) return;
+  CA_RLOG(bgSpans(spans, n));
+  // Span maps describe the picture at origin 0; a scrolled tile world
+  // repaints their rows instead (below)
+  const CA_BgMap& m = blitCfg.bg;
+  const bool scrolled = m.ox || m.oy;
+  // The spans changed color: cached FG rows over them go stale
+  if (fgcH && !scrolled) {
+    for (uint16_t i=0;i<n;++i){
+      Box g[2];
+      const uint8_t ng = bgSpanBoxes((int16_t)pgm_read_byte(&spans[i][0]), (int16_t)pgm_read_byte(&spans[i][1]),
+                                     (int16_t)pgm_read_byte(&spans[i][2]), g);
+      for (uint8_t s=0;s<ng;++s){
+        if (g[s].minX >= fgcX + fgcW || g[s].maxX <= fgcX) continue;
+        for (int16_t r = (int16_t)(g[s].minY - fgcY); r < g[s].maxY - fgcY; ++r)
+          if ((uint16_t)r < fgcH) fgcStale[r >> 3] |= (uint8_t)(1 << (r & 7));
+      }
+    }
+  }
+  // (Re)queueing restarts the list: spans already drawn used the old colors
+  if (!scrolled && (!bgSpans || bgSpans == spans)) { bgSpans = spans; bgSpanN = n; bgSpanPos = 0; return; }
+  // One list at a time; a second one falls back to its bounding rows (all
+  // rows when the world is scrolled vertically)
+  const int16_t r0 = (int16_t)pgm_read_byte(&spans[0][0]);
+  const int16_t r1 = (int16_t)pgm_read_byte(&spans[n-1][0]);
+  int16_t y0 = m.screenRow(r0), y1 = m.screenRow((int16_t)(r1 + 1));
+  if (m.oy) { y0 = m.y0; y1 = (int16_t)(m.y0 + m.h); }
+  addWorldRect(0, y0, blitCfg.screenW, (int16_t)(y1 - y0), PRIO_AMBIENT);
+  if (scrolled)
+    for (int16_t r = (int16_t)(y0 - fgcY); r < y1 - fgcY; ++r)
+      if ((uint16_t)r < fgcH) fgcStale[r >> 3] |= (uint8_t)(1 << (r & 7));
+}
+
+void CA_Render::addDirtyBgRows(int16_t row0, int16_t rows){
+  if (rows <= 0) return;
+  CA_RLOG(bgRows(row0, rows));
+  addBgRowsRect(row0, rows);
+}
+
+void CA_Render::addDirtyPalette(const uint16_t* palRam){
+  if (dirtyPalN > MAX_DIRTY_PALS) return;
+  for (uint8_t i=0;i<dirtyPalN;++i) if (dirtyPal[i] == palRam) return;
+  if (dirtyPalN < MAX_DIRTY_PALS) dirtyPal[dirtyPalN] = palRam;
+  ++dirtyPalN;
+}
+
+// Sprites drawn with a palette that changed become dirty rects (logged as
+// such, so a replay needs no palette pointers)
+void CA_Render::resolveDirtyPalettes(){
+  if (!dirtyPalN) return;
+  for (uint8_t l=0;l+1<layerN;++l){
+    Layer& L = layers[l];
+    for (uint8_t i=0;i<L.n;++i){
+      const Sprite& s = L.q[i];
+      bool hit = dirtyPalN > MAX_DIRTY_PALS;
+      for (uint8_t k=0;k<dirtyPalN && !hit;++k) hit = dirtyPal[k] == s.palRam;
+      if (!hit) continue;
+      if (l == cacheLayer) { markLayerDirty(l); break; }
+      addDirtyWorldRect(s.vx, s.vy, s.w, s.h, PRIO_AMBIENT);
+    }
+  }
+  dirtyPalN = 0;
 }
-void CA_Render::addDirtyRect(int16_t x, int16_t y, int16_t w, int16_t h){ addUIRect(x,y,w,h); }
-void CA_Render::addDirtyWorldRect(int16_t x, int16_t y, int16_t w, int16_t h){ addWorldRect(x,y,w,h); }
 
 // ---- render ----
 void CA_Render::renderFrame() {
-  // Frame skipping for performance - skip every other frame if needed
-  static uint8_t s_frameSkipCounter = 0;
-  static bool s_skipEnabled = false;
-  
-  // Auto-enable frame skipping if performance is poor
-  if (++s_frameSkipCounter >= 60) {  // Check every 60 frames
-    s_frameSkipCounter = 0;
-    // Disable frame skipping for now - let's try other optimizations first
-    s_skipEnabled = false;
-  }
-  
-  static bool s_skipThisFrame = false;
-  if (s_skipEnabled) {
-    s_skipThisFrame = !s_skipThisFrame;
-    if (s_skipThisFrame) {
+  resolveDirtyPalettes();
+  CA_RLOG(frame());
+  // Layers that dirty what they queue: slots not reused this frame leave
+  // their last footprint behind
+  bool marked = false;
+  for (uint8_t l=0;l<layerN;++l){
+    Layer& L = layers[l];
+    marked |= L.mark;
+    if (L.d.dirty != LD_ON_ADD) continue;
+    for (uint8_t i=L.n;i<L.prevN;++i) addWorldRect(L.q[i].vx, L.q[i].vy, L.q[i].w, L.q[i].h, L.d.prio);
+    L.prevN = L.n;
+  }
+  for (uint8_t i=linN;i<linPrevN;++i) addLineRects(lin[i].s);
+  linPrevN = linN;
+
+  // Frame skipping (set by the quality governor): every other frame pushes
+  // nothing; its dirty boxes stay queued and are drawn with the next one
+  if (frameSkip) {
+    skipThisFrame = !skipThisFrame;
+    if (skipThisFrame) {
       clearQueues();
       return;  // Skip this frame entirely
     }
   }
 
   // Early-out if nothing queued and no dirty at all
-  bool anyDirty = (wBoxN || uiBoxN);
-  if (!fgNeedsFullPass && !anyDirty) { clearQueues(); return; }
+  bool anyDirty = (wBoxN || uiBoxN || bgSpanN || scPend);
+  if (!marked && !anyDirty) { clearQueues(); return; }
+
+  // Hardware scroll first: it turns into repaint boxes like any other change
+  applyScroll();
 
-  sortSprites(); sortFG(); sortRects(); sortBars(); sortTexts();
+  for (uint8_t l=0;l<layerN;++l) zOrder(layers[l].q, layers[l].n, layers[l].ord);
+  sortRects(); sortBars(); sortTexts(); sortLines();
 
   // Clamp existing boxes (round to even boundaries for 2x BG); do not skip small ones
   for (uint8_t i=0;i<wBoxN;++i) {
@@ -249,51 +400,60 @@ void CA_Render::renderFrame() {
   }
 
   if (!bgPalRam) bgPalRam = CA_Draw::getBgPaletteRAM();
-  maybeUpdateShimmer(blitCfg, bgPalRam);
+  syncFgCache();
 
-  // Ensure FG area will be painted on first frame if requested
-  if (fgNeedsFullPass){
-    for (uint8_t i=0;i<fgN;++i){
-      const Sprite& s = fg[i];
-      addWorldRect(s.vx, s.vy, s.f.w, s.f.h);
-    }
-    fgNeedsFullPass = false;
+  // Paint the whole of every layer marked dirty (FG on the first frame)
+  for (uint8_t l=0;l<layerN;++l){
+    Layer& L = layers[l];
+    if (!L.mark) continue;
+    for (uint8_t i=0;i<L.n;++i) addWorldRect(L.q[i].vx, L.q[i].vy, L.q[i].w, L.q[i].h, L.d.prio);
+    L.mark = false;
   }
 
-  // Clamp again after FG expansion
+  // Clamp again after the layer expansion
   for (uint8_t i=0;i<wBoxN;++i) if (wbox[i].valid) clampBox(wbox[i].valid, wbox[i].minX,wbox[i].minY,wbox[i].maxX,wbox[i].maxY, blitCfg.screenW, blitCfg.screenH);
 
-  // Merge UI boxes into world boxes to minimize windows
+  // Merge UI boxes into world boxes to minimize windows. Under a frame budget
+  // only boxes that always render take UI in, so a HUD update never drags a
+  // large world box to the front
   for (uint8_t i=0;i<uiBoxN;++i){
     if (!ui[i].valid) continue;
     // Try to merge into an existing world box
     bool merged = false;
     for (uint8_t j=0;j<wBoxN;++j){
       if (!wbox[j].valid) continue;
+      if (budgeted() && wbox[j].prio > PRIO_HIGH) continue;
+      if (wbox[j].field) continue;
       if (intersects(wbox[j], ui[i].minX, ui[i].minY, (int16_t)(ui[i].maxX-ui[i].minX), (int16_t)(ui[i].maxY-ui[i].minY))){
         // Unconditionally union when intersecting (prior stable behavior)
         wbox[j].minX = min(wbox[j].minX, ui[i].minX);
         wbox[j].minY = min(wbox[j].minY, ui[i].minY);
         wbox[j].maxX = max(wbox[j].maxX, ui[i].maxX);
         wbox[j].maxY = max(wbox[j].maxY, ui[i].maxY);
+        wbox[j].prio = PRIO_UI;
         merged = true;
         break;
       }
     }
     if (!merged) {
-      if (wBoxN < MAX_WB) {
+      if (wBoxN < wbCap) {
         // No intersect, but we still need this UI area drawn—add as its own box
         wbox[wBoxN++] = ui[i];
+        peak(stats.peakWB, wBoxN);
       } else {
-        // Fallback: union into the first world box to avoid dropping UI redraw (e.g., tension bar)
-        uint8_t j = 0; // choose 0 as conservative union target
+        // Fallback: union into the box it grows least to avoid dropping UI redraw (e.g., tension bar)
+        bump(stats.wbOverflows);
+        const uint8_t j = growTarget(ui[i], true);
         wbox[j].minX = min(wbox[j].minX, ui[i].minX);
         wbox[j].minY = min(wbox[j].minY, ui[i].minY);
         wbox[j].maxX = max(wbox[j].maxX, ui[i].maxX);
         wbox[j].maxY = max(wbox[j].maxY, ui[i].maxY);
+        wbox[j].prio = PRIO_UI;
+        wbox[j].field = FIELD_ALL;
       }
     }
   }
+  for (uint8_t i=0;i<uiBoxN;++i) ui[i].valid = false;
   uiBoxN = 0; // all UI handled via merged world boxes
 
   // Re-round world boxes to even boundaries after UI merges for consistent 2x BG
@@ -307,115 +467,521 @@ void CA_Render::renderFrame() {
     }
   }
 
-  // Render each world box (UI already merged)
+  // Render each world box (UI already merged), by priority. UI and HIGH boxes
+  // always go out; WORLD and AMBIENT spend what is left of the frame budget,
+  // and a box that does not fit is cut after the rows that do. Its remainder
+  // stays queued for the next frame.
+  // Boxes over the interlace area push one field (every other line) now and
+  // keep the other field queued, so they converge on the next frame
+  uint32_t pxLeft = pxBudget ? pxBudget : 0xFFFFFFFFul;
+  const uint32_t t0 = micros();
+  bool progressed = false;   // a budgeted box moved forward this frame
+  fieldOdd = !fieldOdd;
   MCUFRIEND_kbv* t = blitCfg.tft;
   t->startWrite();
+  for (uint8_t pr=0; pr<PRIO_N; ++pr){
+    for (uint8_t bi=0; bi<wBoxN; ++bi){
+      Box& b = wbox[bi];
+      if (!b.valid || b.prio != pr) continue;
+      const int16_t W = (int16_t)(b.maxX - b.minX);
+      uint32_t area = (uint32_t)W * (uint32_t)(b.maxY - b.minY);
+      bool split = false;
+      if (!b.field && ilArea && area > ilArea){
+        b.field = fieldOdd ? FIELD_ODD : FIELD_EVEN;
+        split = true;
+      }
+      if (b.field) area >>= 1;
+      if (pr > PRIO_HIGH){
+        if (usBudget && (uint32_t)(micros() - t0) >= usBudget) pxLeft = 0;
+        if (!pxLeft && progressed) { if (split) b.field = FIELD_ALL; continue; }
+        if (area > pxLeft){
+          // Top rows that fit (even for the 2× BG); never stall completely.
+          // A box cut here is not interlaced: its remainder is still whole
+          if (split) { b.field = FIELD_ALL; area <<= 1; }
+          const uint32_t pairPx = (uint32_t)W << (b.field ? 0 : 1);
+          int16_t rows = (int16_t)((pxLeft / pairPx) << 1);
+          if (rows < 2 && !progressed) rows = 2;
+          if (rows >= 2){
+            Box top = b; top.maxY = (int16_t)(b.minY + rows);
+            drawBox(top);
+            b.minY = top.maxY;
+          }
+          pxLeft = 0; progressed = true;
+          continue;
+        }
+        progressed = true;
+      }
+      drawBox(b);
+      if (split) b.field ^= (FIELD_EVEN | FIELD_ODD);   // other field next frame
+      else       b.prio = PRIO_DONE;
+      pxLeft = (area < pxLeft) ? pxLeft - area : 0;
+    }
+    if (pr == PRIO_AMBIENT) renderBgSpans(pxLeft, t0, progressed);
+  }
+  t->endWrite();
+
+  // Keep what was cut, oldest first. Carried AMBIENT work joins WORLD, and a
+  // box cut by the budget no longer grows (addWorldRect), so the budgeted
+  // pass finishes it before it reaches anything queued after it
+  uint8_t kept = 0;
   for (uint8_t bi=0; bi<wBoxN; ++bi){
-    const Box& b = wbox[bi]; if (!b.valid) continue;
-    const int16_t W = (int16_t)(b.maxX - b.minX); if (W <= 0) continue;
+    Box b = wbox[bi];
+    if (!b.valid || b.prio == PRIO_DONE) continue;
+    if (b.prio > PRIO_HIGH) { b.prio = PRIO_WORLD; if (b.age < 0xFF) ++b.age; }
+    uint8_t k = kept++;
+    for (; k && wbox[k-1].age < b.age; --k) wbox[k] = wbox[k-1];
+    wbox[k] = b;
+  }
+  for (uint8_t bi=kept; bi<wBoxN; ++bi) wbox[bi].valid = false;
+  wBoxN = kept;
+  if (kept || bgSpans) bump(stats.carriedFrames);
+  clearQueues();
+}
+
+// Follow the cached layer: on a new bounding box (or markLayerDirty()) rebuild
+// the mask for the rows that fit Caps::FGC and mark them all stale
+void CA_Render::syncFgCache(){
+  if (!fgcCap || cacheLayer == NO_LAYER) return;
+  const Layer& L = layers[cacheLayer];
+  int16_t x0 = blitCfg.screenW, y0 = blitCfg.screenH, x1 = 0, y1 = 0;
+  for (uint8_t i=0;i<L.n;++i){
+    const Sprite& s = L.q[i];
+    x0 = min(x0, s.vx); y0 = min(y0, s.vy);
+    x1 = max(x1, (int16_t)(s.vx + s.w)); y1 = max(y1, (int16_t)(s.vy + s.h));
+  }
+  bool valid = L.n != 0;
+  clampBox(valid, x0, y0, x1, y1, blitCfg.screenW, blitCfg.screenH);
+  if (!valid) { fgcH = 0; fgcN = 0; return; }
+  const int16_t w = (int16_t)(x1 - x0), h = (int16_t)(y1 - y0);
+  if (!L.mark && fgcN == L.n && x0 == fgcX && y0 == fgcY && w == fgcW && h == fgcBoxH) return;
+
+  fgcX = x0; fgcY = y0; fgcW = w; fgcBoxH = h; fgcN = L.n;
+  uint16_t rows = (uint16_t)(fgcCap / (uint16_t)w);
+  if (rows > (uint16_t)h) rows = (uint16_t)h;
+  if (rows > FGC_ROWS) rows = FGC_ROWS;
+  fgcH = (uint8_t)rows;
+
+  for (uint8_t k=0;k<16;++k) s_maskPal[k] = 0xFFFF;
+  memset(fgcMask, 0, ((uint16_t)fgcH * (uint16_t)w + 7) >> 3);
+  uint16_t* lb = CA_Blit::lineBuffer();
+  for (uint8_t r=0;r<fgcH;++r){
+    const int16_t y = (int16_t)(fgcY + r);
+    memset(lb, 0, (size_t)w * sizeof(uint16_t));
+    for (uint8_t i=0;i<L.n;++i){
+      const Sprite& s = L.q[i];
+      composeFrameLine(*s.f, s.vx, s.vy, s_maskPal, s.hFlip, s.keyIdx, y, fgcX, w);
+    }
+    uint16_t m = (uint16_t)(r * (uint16_t)w);
+    for (int16_t dx=0; dx<w; ++dx, ++m) if (lb[dx]) fgcMask[m >> 3] |= (uint8_t)(1 << (m & 7));
+  }
+  invalidateFgCache();
+}
+
+// Recompose one cached row (full cache width) with the current BG palette
+void CA_Render::refreshFgcRow(uint8_t r){
+  const int16_t y = (int16_t)(fgcY + r);
+  CA_Draw::composeBgLine(blitCfg, bgPalRam, y, fgcX, fgcW, bgDx(blitCfg.bg.srcRow(y)));
+  const Layer& L = layers[cacheLayer];
+  for (uint8_t k=0;k<L.n;++k){
+    const Sprite& s = L.q[L.ord[k]];
+    composeFrameLine(*s.f, s.vx, s.vy, s.palRam, s.hFlip, s.keyIdx, y, fgcX, fgcW);
+  }
+  memcpy(fgc + (uint16_t)r * (uint16_t)fgcW, CA_Blit::lineBuffer(), (size_t)fgcW * sizeof(uint16_t));
+  fgcStale[r >> 3] &= (uint8_t)~(1 << (r & 7));
+}
+
+// UI layer over one line: lines, rects, outlines, bars, then text
+void CA_Render::composeUILine(int16_t y, int16_t x0, int16_t W, uint16_t* lb){
+  for (uint8_t i=0;i<linN;++i){ Line& q = lin[linOrd[i]]; CA_Blit::composeSegmentLine(y, x0, W, q.s, q.color565); }
+  for (uint8_t i=0;i<recN;++i){ const Rect& r = rec[recOrd[i]]; if (r.isOutline) continue; CA_Blit::composeSolidRectLine(y, x0, W, r.rx, r.ry, r.rw, r.rh, r.color565); }
+  for (uint8_t i=0;i<recN;++i){ const Rect& r = rec[recOrd[i]]; if (!r.isOutline) continue; CA_Blit::composeRectOutlineLine(y, x0, W, r.rx, r.ry, r.rw, r.rh, r.color565); }
+  for (uint8_t i=0;i<barN;++i){ const HBar& hb = bar[barOrd[i]]; CA_Blit::composeHBarLine(y, x0, W, hb.bx, hb.by, hb.bw, hb.bh, hb.fillW, hb.color565); }
+  for (uint8_t j=0;j<txtN;++j){
+    const Text& tx = txt[txtOrd[j]];
+    if (y < tx.ty || y >= tx.ty + 7) continue;
+    const uint8_t rowMask = (uint8_t)(1 << (y - tx.ty));
+    int16_t cx = tx.tx;
+    for (const char* c = tx.str; *c; ++c){
+      uint8_t ch = (uint8_t)*c;
+      if (ch < 32 || ch > 127){ cx += 6; continue; }
+      ch -= 32;
+      for (uint8_t col=0; col<5; ++col){
+        // Read glyph column directly from PROGMEM to avoid any pointer-decay quirks
+        uint8_t colBits = pgm_read_byte(&FONT5x7[ch][col]);
+        if (colBits & rowMask){
+          int16_t dx = (int16_t)((cx + col) - x0);
+          if ((uint16_t)dx < (uint16_t)W) lb[dx] = tx.color565;
+        }
+      }
+      cx += 6;
+    }
+  }
+}
+
+// Compose and push one screen box: BG (+ water), then the layer table.
+// (shX, shY) move the GRAM window and the BG source away from the on-screen
+// position; only non-zero inside a hardware scroll band (see drawBox())
+void CA_Render::renderBox(const Box& b, int16_t shX, int16_t shY){
+  const int16_t W = (int16_t)(b.maxX - b.minX); if (W <= 0) return;
   // Track last composed BG srcY for this box to reuse on the next line when possible
   int16_t lastSrcY = -1;
   bool bgCachedValid = false;
 
-  // Collect visible sprites for this box once
-  uint8_t visWIdx[MAX_SPR]; uint8_t visWN = 0;
-  uint8_t visFIdx[MAX_FG ]; uint8_t visFN = 0;
-    auto rectIntersects = [](int16_t ax,int16_t ay,int16_t aw,int16_t ah,
-                             int16_t bx,int16_t by,int16_t bw,int16_t bh)->bool{
-      return !(ax+aw<=bx || ay+ah<=by || ax>=bx+bw || ay>=by+bh);
-    };
-    for (uint8_t i=0;i<sprN;++i){
-      const Sprite& s = spr[i];
-      if (rectIntersects(s.vx, s.vy, s.f.w, s.f.h, b.minX, b.minY, W, (int16_t)(b.maxY - b.minY))){
-        if (visWN < MAX_SPR) visWIdx[visWN++] = i;
+  // Collect visible sprites of every layer for this box once
+  auto rectIntersects = [](int16_t ax,int16_t ay,int16_t aw,int16_t ah,
+                           int16_t bx,int16_t by,int16_t bw,int16_t bh)->bool{
+    return !(ax+aw<=bx || ay+ah<=by || ax>=bx+bw || ay>=by+bh);
+  };
+  for (uint8_t l=0;l<layerN;++l){
+    Layer& L = layers[l];
+    L.visN = 0;
+    for (uint8_t k=0;k<L.n;++k){
+      const uint8_t i = L.ord[k];
+      const Sprite& s = L.q[i];
+      if (rectIntersects(s.vx, s.vy, s.w, s.h, b.minX, b.minY, W, (int16_t)(b.maxY - b.minY))){
+        L.vis[L.visN++] = i;
       }
     }
-    for (uint8_t i=0;i<fgN;++i){
-      const Sprite& s = fg[i];
-      if (rectIntersects(s.vx, s.vy, s.f.w, s.f.h, b.minX, b.minY, W, (int16_t)(b.maxY - b.minY))){
-        if (visFN < MAX_FG) visFIdx[visFN++] = i;
+  }
+
+  // Part of the box served by the FG cache [cx0, cx1) (line buffer x); only
+  // where the BG is not shifted by the scroll band
+  int16_t cx0 = 0, cx1 = 0;
+  if (fgcH && !shX && !shY && b.minX < fgcX + fgcW && b.maxX > fgcX &&
+      b.minY < fgcY + fgcH && b.maxY > fgcY) {
+    cx0 = (int16_t)(max(b.minX, fgcX) - b.minX);
+    cx1 = (int16_t)(min(b.maxX, (int16_t)(fgcX + fgcW)) - b.minX);
+  }
+  const uint16_t cOff = (uint16_t)(b.minX + cx0 - fgcX);   // cache x of cx0
+  bool lastCut = false;
+
+  // One field of an interlaced box: each line gets its own window. A
+  // streamed BG is read a band of lines at a time before the band's window
+  // opens, so no line waits on the card; other sources take the box in one
+  const int16_t yStep = b.field ? 2 : 1;
+  const int16_t gx0 = (int16_t)(b.minX + shX), gx1 = (int16_t)(b.maxX - 1 + shX);
+  int16_t bandEnd = b.minY;
+
+  bool first = true;
+  for (int16_t y = (int16_t)(b.minY + (b.field == FIELD_ODD)); y < b.maxY; y += yStep){
+    if (y >= bandEnd) {
+      bandEnd = (int16_t)(CA_Draw::fetchBgLines(blitCfg, (int16_t)(y + shY), (int16_t)(b.maxY + shY)) - shY);
+      if (!b.field) {
+        blitCfg.tft->setAddrWindow(gx0, (int16_t)(y + shY), gx1, (int16_t)(bandEnd - 1 + shY));
+        CA_RLOG(window(gx0, (int16_t)(y + shY), gx1, (int16_t)(bandEnd - 1 + shY)));
+        first = true;
       }
     }
+    if (b.field) {
+      blitCfg.tft->setAddrWindow(gx0, (int16_t)(y + shY), gx1, (int16_t)(y + shY));
+      CA_RLOG(window(gx0, (int16_t)(y + shY), gx1, (int16_t)(y + shY)));
+      first = true;
+    }
+    // FG cache row for this line (-1 = compose BG and FG as usual). The
+    // shimmer band changes under the boat every frame, so it is never cached
+    int16_t cr = -1;
+    if (cx1 > cx0) {
+      const int16_t r = (int16_t)(y - fgcY);
+      if ((uint16_t)r < fgcH &&
+          !(waterFx && (uint16_t)(y - waterFx->bandTop()) < waterFx->bandHeight())) {
+        if (fgcStale[r >> 3] & (1 << (r & 7))) refreshFgcRow((uint8_t)r);
+        cr = r;
+      }
+    }
+    const bool cut = cr >= 0;
+    uint16_t* lb = CA_Blit::lineBuffer();
 
-    blitCfg.tft->setAddrWindow(b.minX, b.minY, (int16_t)(b.maxX - 1), (int16_t)(b.maxY - 1));
-
-    bool first = true;
-    for (int16_t y = b.minY; y < b.maxY; ++y){
-      // Efficient 2× BG: reuse the previous line when it maps to the same srcY
-      const int16_t srcY = (int16_t)(y >> 1);
-      if (bgCachedValid && srcY == lastSrcY) {
-        // Copy cached BG pixels into the current line buffer
-        memcpy(CA_Blit::lineBuffer(), s_bgLineCache, (size_t)W * sizeof(uint16_t));
+    // Efficient 2× BG: reuse the previous line when it maps to the same srcY
+    // (and the same part of it comes from the FG cache)
+    const int16_t srcY = blitCfg.bg.srcRow((int16_t)(y + shY));
+    const int16_t dx = bgDx(srcY);
+    if (bgCachedValid && srcY == lastSrcY && cut == lastCut) {
+      // Copy cached BG pixels into the current line buffer
+      memcpy(lb, s_bgLineCache, (size_t)W * sizeof(uint16_t));
+    } else {
+      if (!cut) {
+        CA_Draw::composeBgLine(blitCfg, bgPalRam, (int16_t)(y + shY), (int16_t)(b.minX + shX), W, dx);
       } else {
-        CA_Blit::composeBGLine_160to320_quads_P(
-          BG8_q0, BG8_q1, BG8_q2, BG8_q3,
-          BG8_W, BG8_H, BG8_cw, BG8_ch,
-          bgPalRam, y, b.minX, W
-        );
-        // Cache for the immediate next line with the same srcY
-        memcpy(s_bgLineCache, CA_Blit::lineBuffer(), (size_t)W * sizeof(uint16_t));
-        lastSrcY = srcY; bgCachedValid = true;
+        // Only the parts left and right of the cached span (no shift here);
+        // the composer writes from lb[0], so the right part is moved over
+        if (cx1 < W) {
+          CA_Draw::composeBgLine(blitCfg, bgPalRam, y, (int16_t)(b.minX + cx1), (int16_t)(W - cx1), dx);
+          memmove(lb + cx1, lb, (size_t)(W - cx1) * sizeof(uint16_t));
+        }
+        if (cx0 > 0) {
+          CA_Draw::composeBgLine(blitCfg, bgPalRam, y, b.minX, cx0, dx);
+        }
       }
-      applyShimmerLine(y, b.minX, W);
-
-      // World sprites: simple per-line scan (stable)
-      for (uint8_t k=0;k<visWN;++k){
-        const Sprite& s = spr[visWIdx[k]];
-        if (y < s.vy || y >= (int16_t)(s.vy + s.f.h)) continue;
-        CA_Blit::composeOver4bppKeyIdx_P(
-          s.f.data, s.f.w, s.f.h,
-          s.vx, s.vy, s.palRam,
-          s.hFlip, s.keyIdx,
-          y, b.minX, W
-        );
+      // Cache for the immediate next line with the same srcY
+      memcpy(s_bgLineCache, lb, (size_t)W * sizeof(uint16_t));
+      lastSrcY = srcY; bgCachedValid = true; lastCut = cut;
+    }
+    if (cut) memcpy(lb + cx0, fgc + (uint16_t)cr * (uint16_t)fgcW + cOff, (size_t)(cx1 - cx0) * sizeof(uint16_t));
+    if (waterFx) waterFx->applyLine(y, b.minX, W, bgPalRam);
+
+    // Layers bottom-up (stable per-line scan); the cached layer only puts
+    // back the pixels it covers over the layers below
+    for (uint8_t l=0;l<layerN;++l){
+      const Layer& L = layers[l];
+      if (l == LAYER_FG && particles) particles->applyLine(y, b.minX, W, bgPalRam);
+      if (L.d.kind == LK_UI) { composeUILine(y, b.minX, W, lb); continue; }
+      if (cut && l == cacheLayer) {
+        uint16_t m = (uint16_t)((uint16_t)cr * (uint16_t)fgcW + cOff);
+        for (int16_t dx=cx0; dx<cx1; ++dx, ++m)
+          if (fgcMask[m >> 3] & (1 << (m & 7))) lb[dx] = fgc[m];
+        continue;
       }
-      // FG sprites
-      for (uint8_t k=0;k<visFN;++k){
-        const Sprite& s = fg[visFIdx[k]];
-        if (y < s.vy || y >= (int16_t)(s.vy + s.f.h)) continue;
-        CA_Blit::composeOver4bppKeyIdx_P(
-          s.f.data, s.f.w, s.f.h,
-          s.vx, s.vy, s.palRam,
-          s.hFlip, s.keyIdx,
-          y, b.minX, W
-        );
+      for (uint8_t k=0;k<L.visN;++k){
+        const Sprite& s = L.q[L.vis[k]];
+        if (y < s.vy || y >= (int16_t)(s.vy + s.h)) continue;
+        composeFrameLine(*s.f, s.vx, s.vy, s.palRam, s.hFlip, s.keyIdx, y, b.minX, W);
       }
+    }
 
-      // UI overlay
-      for (uint8_t i=0;i<recN;++i){ const Rect& r = rec[i]; if (r.isOutline) continue; CA_Blit::composeSolidRectLine(y, b.minX, W, r.rx, r.ry, r.rw, r.rh, r.color565); }
-      for (uint8_t i=0;i<recN;++i){ const Rect& r = rec[i]; if (!r.isOutline) continue; CA_Blit::composeRectOutlineLine(y, b.minX, W, r.rx, r.ry, r.rw, r.rh, r.color565); }
-      for (uint8_t i=0;i<barN;++i){ const HBar& hb = bar[i]; CA_Blit::composeHBarLine(y, b.minX, W, hb.bx, hb.by, hb.bw, hb.bh, hb.fillW, hb.color565); }
-      if (txtN){
-        uint16_t* lb = CA_Blit::lineBuffer();
-        for (uint8_t j=0;j<txtN;++j){
-          const Text& tx = txt[j];
-          if (y < tx.ty || y >= tx.ty + 7) continue;
-          const uint8_t rowMask = (uint8_t)(1 << (y - tx.ty));
-          int16_t cx = tx.tx;
-          for (const char* c = tx.str; *c; ++c){
-            uint8_t ch = (uint8_t)*c;
-            if (ch < 32 || ch > 127){ cx += 6; continue; }
-            ch -= 32;
-            for (uint8_t col=0; col<5; ++col){
-              // Read glyph column directly from PROGMEM to avoid any pointer-decay quirks
-              uint8_t colBits = pgm_read_byte(&FONT5x7[ch][col]);
-              if (colBits & rowMask){
-                int16_t dx = (int16_t)((cx + col) - b.minX);
-                if ((uint16_t)dx < (uint16_t)W) lb[dx] = tx.color565;
-              }
-            }
-            cx += 6;
-          }
+    CA_Blit::pushLinePhysicalNoAddr(blitCfg, W, first);
+    first = false;
+  }
+}
+
+// Repaint the queued BG span list as boxes of one source row each, within
+// the frame budget; the rest resumes next frame. Spans inside a world box are
+// (or will be) repainted with the new colors there
+void CA_Render::renderBgSpans(uint32_t& pxLeft, uint32_t t0, bool& progressed){
+  if (!bgSpans) return;
+  for (uint16_t i=bgSpanPos;i<bgSpanN;++i){
+    const int16_t row = (int16_t)pgm_read_byte(&bgSpans[i][0]);
+    const int16_t x0  = (int16_t)pgm_read_byte(&bgSpans[i][1]);
+    const int16_t len = (int16_t)pgm_read_byte(&bgSpans[i][2]);
+    Box g[2];
+    const uint8_t ng = bgSpanBoxes(row, x0, len, g);
+    uint32_t area = 0;
+    for (uint8_t s=0;s<ng;++s){
+      clampBox(g[s].valid, g[s].minX,g[s].minY,g[s].maxX,g[s].maxY, blitCfg.screenW, blitCfg.screenH);
+      if (g[s].valid) area += (uint32_t)(g[s].maxX - g[s].minX) * (uint32_t)(g[s].maxY - g[s].minY);
+    }
+    if (!area) continue;
+    if (usBudget && (uint32_t)(micros() - t0) >= usBudget) pxLeft = 0;
+    if (area > pxLeft && progressed) { bgSpanPos = i; return; }
+    // Spans are in BG (= GRAM) space; inside a scroll band they show elsewhere
+    for (uint8_t s=0;s<ng;++s){
+      if (!g[s].valid) continue;
+      Box part[4];
+      const uint8_t np = gramToScreen(g[s], part);
+      for (uint8_t k=0;k<np;++k){
+        const Box& b = part[k];
+        bool covered = false;
+        for (uint8_t j=0;j<wBoxN && !covered;++j){
+          const Box& w = wbox[j];
+          covered = w.valid && w.minX <= b.minX && w.minY <= b.minY && w.maxX >= b.maxX && w.maxY >= b.maxY;
         }
+        if (!covered) drawBox(b);
       }
-
-      CA_Blit::pushLinePhysicalNoAddr(blitCfg, W, first);
-      first = false;
     }
+    pxLeft = (area < pxLeft) ? pxLeft - area : 0;
+    progressed = true;
   }
-  t->endWrite();
-  clearDirty();
-  clearQueues();
+  bgSpans = nullptr; bgSpanN = 0; bgSpanPos = 0;
+}
+
+// ---- parallax bands ----
+void CA_Render::setBgBand(uint8_t i, uint8_t row0, uint8_t rows){
+  if (i >= MAX_BG_BANDS) return;
+  BgBand& bb = bgBand[i];
+  if (bb.row0 == row0 && bb.rows == rows) return;
+  CA_RLOG(bgBand(i, row0, rows, bb.dx));
+  // A shifted band leaves its old rows shifted and shows up shifted elsewhere
+  if (bb.dx && bb.rows) addBgRowsRect(bb.row0, bb.rows);
+  bb.row0 = row0; bb.rows = rows;
+  if (!rows) bb.dx = 0;
+  if (bb.dx && bb.rows) addBgRowsRect(bb.row0, bb.rows);
+}
+
+void CA_Render::setBgBandOffset(uint8_t i, int16_t dx){
+  if (i >= MAX_BG_BANDS) return;
+  BgBand& bb = bgBand[i];
+  const int16_t bw = blitCfg.bg.w;
+  dx = (int16_t)(dx % bw); if (dx < 0) dx = (int16_t)(dx + bw);
+  if (!bb.rows || dx == bb.dx) return;
+  CA_RLOG(bgBand(i, bb.row0, bb.rows, dx));
+  bb.dx = dx;
+  addBgRowsRect(bb.row0, bb.rows);
+}
+
+// Offset of the band holding source row srcY (0 outside every band)
+int16_t CA_Render::bgDx(int16_t srcY) const {
+  for (uint8_t i=0;i<MAX_BG_BANDS;++i){
+    const BgBand& bb = bgBand[i];
+    if ((uint16_t)(srcY - bb.row0) < bb.rows) return bb.dx;
+  }
+  return 0;
+}
+
+// Repaint source rows across the BG, with the FG cache rows over them
+void CA_Render::addBgRowsRect(int16_t row0, int16_t rows){
+  const CA_BgMap& m = blitCfg.bg;
+  const int16_t y0 = m.screenRow(row0), y1 = m.screenRow((int16_t)(row0 + rows));
+  addWorldRect(m.x0, y0, m.w, (int16_t)(y1 - y0), PRIO_AMBIENT);
+  for (int16_t r = (int16_t)(y0 - fgcY); r < y1 - fgcY; ++r)
+    if ((uint16_t)r < fgcH) fgcStale[r >> 3] |= (uint8_t)(1 << (r & 7));
+}
+
+// Screen boxes of BG span { row, x0, len } with its band offset applied:
+// one, or two where the shift wraps it around the BG edge
+uint8_t CA_Render::bgSpanBoxes(int16_t row, int16_t x0, int16_t len, Box out[2]) const {
+  const CA_BgMap& m = blitCfg.bg;
+  const int16_t y0 = m.screenRow(row), y1 = m.screenRow((int16_t)(row + 1));
+  int16_t s0 = (int16_t)(x0 * m.sx - bgDx(row));
+  if (s0 < 0) s0 = (int16_t)(s0 + m.w);
+  const int16_t n = (int16_t)(len * m.sx);
+  const int16_t n0 = min(n, (int16_t)(m.w - s0));
+  out[0] = { true, (int16_t)(m.x0 + s0), y0, (int16_t)(m.x0 + s0 + n0), y1, PRIO_AMBIENT, FIELD_ALL, 0 };
+  if (n0 == n) return 1;
+  out[1] = { true, m.x0, y0, (int16_t)(m.x0 + n - n0), y1, PRIO_AMBIENT, FIELD_ALL, 0 };
+  return 2;
+}
+
+// ---- tile-map world ----
+void CA_Render::setBgOrigin(int16_t ox, int16_t oy){
+  if (!blitCfg.tiles) return;
+  const int16_t ww = (int16_t)((int16_t)blitCfg.tiles->mapW << 3);
+  const int16_t wh = (int16_t)((int16_t)blitCfg.tiles->mapH << 3);
+  ox = (int16_t)(ox % ww); if (ox < 0) ox = (int16_t)(ox + ww);
+  oy = (int16_t)(oy % wh); if (oy < 0) oy = (int16_t)(oy + wh);
+  CA_BgMap& m = blitCfg.bg;
+  if (ox == m.ox && oy == m.oy) return;
+  CA_RLOG(bgOrigin(ox, oy));
+  m.ox = ox; m.oy = oy;
+  addWorldRect(m.x0, m.y0, m.w, m.h);
+  memset(fgcStale, 0xFF, sizeof(fgcStale));
+}
+
+// ---- hardware scroll band ----
+void CA_Render::setScrollBand(int16_t a0, int16_t len, bool alongX){
+  CA_RLOG(scrollBand(a0, len, alongX));
+  const int16_t lim = alongX ? blitCfg.screenW : blitCfg.screenH;
+  if (a0 < 0) a0 = 0;
+  if (len < 0 || a0 + len > lim) len = (int16_t)(lim - a0);
+  // Restore the unscrolled mapping before moving or dropping the band
+  if (scLen && scOff) {
+    blitCfg.tft->vertScroll(scA0, scLen, 0);
+    addWorldRect(0, 0, blitCfg.screenW, blitCfg.screenH);
+  }
+  scA0 = a0; scLen = (len > 1) ? len : 0; scAlongX = alongX;
+  scOff = 0; scPend = 0;
+}
+
+void CA_Render::scrollBy(int16_t d){ CA_RLOG(scrollBy(d)); if (scLen) scPend = (int16_t)((scPend + d) % scLen); }
+
+// The part of a rect inside the band, where it is now and where the band
+// carried its old pixels (d lines back, wrapping around the band ends), at
+// the priority of whatever drew it
+void CA_Render::addScrollRepair(int16_t x, int16_t y, int16_t w, int16_t h, int16_t d, uint8_t prio){
+  const int16_t u0 = max(scAlongX ? x : y, scA0);
+  const int16_t u1 = min((int16_t)((scAlongX ? x + w : y + h)), (int16_t)(scA0 + scLen));
+  if (u1 <= u0) return;
+  addBandSpan(x, y, w, h, u0, (int16_t)(u1 - u0), prio);
+  int16_t s0 = (int16_t)(u0 - d); if (s0 < scA0) s0 = (int16_t)(s0 + scLen);
+  addBandSpan(x, y, w, h, s0, (int16_t)(u1 - u0), prio);
+}
+
+// Queue [u, u+n) along the band axis (other axis from the rect), split at the
+// band end; u lies inside the band and n <= band length
+void CA_Render::addBandSpan(int16_t x, int16_t y, int16_t w, int16_t h, int16_t u, int16_t n, uint8_t prio){
+  const int16_t end = (int16_t)(scA0 + scLen);
+  const int16_t n0 = min(n, (int16_t)(end - u));
+  if (scAlongX) addWorldRect(u, y, n0, h, prio); else addWorldRect(x, u, w, n0, prio);
+  if (n0 < n) {
+    if (scAlongX) addWorldRect(scA0, y, (int16_t)(n - n0), h, prio); else addWorldRect(x, scA0, w, (int16_t)(n - n0), prio);
+  }
+}
+
+// Move the band by the pending amount. The BG repeats with the band period,
+// so hardware scrolling leaves it correct; everything drawn over it (sprites,
+// UI, shimmer, boxes still pending) moved with it and is repainted in place
+void CA_Render::applyScroll(){
+  int16_t d = scPend; scPend = 0;
+  if (!scLen || !d) return;
+  if (d < 0) d = (int16_t)(d + scLen);
+  const uint8_t n = wBoxN;
+  for (uint8_t i=0;i<n;++i){
+    Box& b = wbox[i];
+    if (!b.valid) continue;
+    // Its own repair may grow it, even while carrying
+    const uint8_t age = b.age;
+    b.field = FIELD_ALL; b.age = 0;
+    addScrollRepair(b.minX, b.minY, (int16_t)(b.maxX - b.minX), (int16_t)(b.maxY - b.minY), d, b.prio);
+    b.age = age;
+  }
+  for (uint8_t i=0;i<uiBoxN;++i){
+    const Box& b = ui[i];
+    if (b.valid) addScrollRepair(b.minX, b.minY, (int16_t)(b.maxX - b.minX), (int16_t)(b.maxY - b.minY), d, PRIO_UI);
+  }
+  for (uint8_t l=0;l<layerN;++l){
+    const Layer& L = layers[l];
+    for (uint8_t i=0;i<L.n;++i) addScrollRepair(L.q[i].vx, L.q[i].vy, L.q[i].w, L.q[i].h, d, L.d.prio);
+  }
+  for (uint8_t i=0;i<recN;++i) addScrollRepair(rec[i].rx, rec[i].ry, rec[i].rw, rec[i].rh, d, PRIO_UI);
+  for (uint8_t i=0;i<barN;++i) addScrollRepair(bar[i].bx, bar[i].by, bar[i].bw, bar[i].bh, d, PRIO_UI);
+  for (uint8_t i=0;i<txtN;++i) addScrollRepair(txt[i].tx, txt[i].ty, (int16_t)(strlen(txt[i].str) * 6), 7, d, PRIO_UI);
+  for (uint8_t i=0;i<linN;++i){
+    const CA_LineDDA& s = lin[i].s;
+    const int16_t x0 = min(s.xa, s.xb), x1 = max(s.xa, s.xb);
+    addScrollRepair(x0, s.ya, (int16_t)(x1 - x0 + 1), (int16_t)(s.yb - s.ya + 1), d, PRIO_HIGH);
+  }
+  if (waterFx && waterFx->bandHeight())
+    addScrollRepair(0, waterFx->bandTop(), blitCfg.screenW, waterFx->bandHeight(), d, PRIO_AMBIENT);
+  int16_t px, py, pw, ph;
+  if (particles && particles->bounds(px, py, pw, ph)) addScrollRepair(px, py, pw, ph, d, PRIO_WORLD);
+
+  scOff = (int16_t)((scOff + d) % scLen);
+  blitCfg.tft->vertScroll(scA0, scLen, scOff);
+}
+
+// Push a screen-space box. Inside the band, screen u shows GRAM line
+// a0 + ((u - a0 + off) mod len): split at the band edges and the wrap point
+void CA_Render::drawBox(const Box& b){
+  if (!scLen || !scOff) { renderBox(b, 0, 0); return; }
+  const int16_t lo = scAlongX ? b.minX : b.minY;
+  const int16_t hi = scAlongX ? b.maxX : b.maxY;
+  const int16_t wrapU = (int16_t)(scA0 + scLen - scOff);   // first screen u that wraps
+  // [lo,hi) against: before band | band up to wrap | band after wrap | after band
+  const int16_t cut[5]  = { lo, scA0, wrapU, (int16_t)(scA0 + scLen), hi };
+  const int16_t sh[4]   = { 0, scOff, (int16_t)(scOff - scLen), 0 };
+  for (uint8_t k=0;k<4;++k){
+    const int16_t s0 = (k == 0) ? lo : max(lo, cut[k]);
+    const int16_t s1 = (k == 3) ? hi : min(hi, cut[k+1]);
+    if (s1 <= s0) continue;
+    Box p = b;
+    if (scAlongX) { p.minX = s0; p.maxX = s1; renderBox(p, sh[k], 0); }
+    else          { p.minY = s0; p.maxY = s1; renderBox(p, 0, sh[k]); }
+  }
+}
+
+// Inverse of drawBox()'s mapping for a box given in GRAM (= BG) space; the
+// part inside the band may come out as two screen boxes
+uint8_t CA_Render::gramToScreen(const Box& g, Box out[4]) const {
+  if (!scLen || !scOff) { out[0] = g; return 1; }
+  const int16_t lo = scAlongX ? g.minX : g.minY;
+  const int16_t hi = scAlongX ? g.maxX : g.maxY;
+  const int16_t end = (int16_t)(scA0 + scLen);
+  uint8_t n = 0;
+  auto put = [&](int16_t a, int16_t b){
+    if (b <= a) return;
+    out[n] = g;
+    if (scAlongX) { out[n].minX = a; out[n].maxX = b; } else { out[n].minY = a; out[n].maxY = b; }
+    ++n;
+  };
+  put(lo, min(hi, scA0));                       // before the band: unscrolled
+  put(max(lo, end), hi);                        // after the band: unscrolled
+  const int16_t g0 = max(lo, scA0), g1 = min(hi, end);
+  if (g1 > g0) {
+    int16_t u0 = (int16_t)(g0 - scOff); if (u0 < scA0) u0 = (int16_t)(u0 + scLen);
+    const int16_t len = (int16_t)(g1 - g0);
+    const int16_t first = min(len, (int16_t)(end - u0));
+    put(u0, (int16_t)(u0 + first));
+    put(scA0, (int16_t)(scA0 + len - first));
+  }
+  return n;
 }
 
 // ---- utils (unchanged) ----
@@ -439,45 +1005,126 @@ void CA_Render::addUIRect(int16_t x,int16_t y,int16_t w,int16_t h){
       return;
     }
   }
-  if (uiBoxN<MAX_UIB) ui[uiBoxN++] = { true, x,y,(int16_t)(x+w),(int16_t)(y+h) };
+  if (uiBoxN<uibCap) {
+    ui[uiBoxN++] = { true, x,y,(int16_t)(x+w),(int16_t)(y+h), PRIO_UI, FIELD_ALL, 0 };
+    peak(stats.peakUIB, uiBoxN);
+  } else {
+    // Out of UI boxes: repaint it as world area rather than lose the update
+    bump(stats.uibOverflows);
+    addWorldRect(x,y,w,h);
+  }
 }
 
-void CA_Render::addWorldRect(int16_t x,int16_t y,int16_t w,int16_t h){
+void CA_Render::addWorldRect(int16_t x,int16_t y,int16_t w,int16_t h, uint8_t prio){
   if (w<=0 || h<=0) return;
-  // Legacy union
+  // Legacy union; a merged box takes the more urgent priority. Under a budget,
+  // always-drawn and budgeted rects stay apart so one cannot drag the other
+  const bool forced = (prio <= PRIO_HIGH);
   for (uint8_t i=0;i<wBoxN;++i){
+    if (budgeted() && forced != (wbox[i].prio <= PRIO_HIGH)) continue;
+    if (wbox[i].field) continue;   // pending second field: converge, do not grow
+    if (wbox[i].age) {             // carrying: takes only what it already covers
+      if (x >= wbox[i].minX && y >= wbox[i].minY && x + w <= wbox[i].maxX && y + h <= wbox[i].maxY) return;
+      continue;
+    }
     if (intersects(wbox[i], x,y,w,h)){
       wbox[i].minX=min(wbox[i].minX,x); wbox[i].minY=min(wbox[i].minY,y);
       wbox[i].maxX=max(wbox[i].maxX,(int16_t)(x+w)); wbox[i].maxY=max(wbox[i].maxY,(int16_t)(y+h));
+      if (prio < wbox[i].prio) wbox[i].prio = prio;
       return;
     }
   }
-  if (wBoxN<MAX_WB) {
-    wbox[wBoxN++] = { true, x,y,(int16_t)(x+w),(int16_t)(y+h) };
+  // Budgeted rects leave Caps::UIB boxes free for UI and HIGH work
+  const uint8_t cap = (budgeted() && !forced && wbCap > uibCap) ? (uint8_t)(wbCap - uibCap) : wbCap;
+  const Box r = { true, x,y,(int16_t)(x+w),(int16_t)(y+h), prio, FIELD_ALL, 0 };
+  if (wBoxN<cap) {
+    wbox[wBoxN++] = r;
+    peak(stats.peakWB, wBoxN);
   } else {
-    wbox[0].minX = min(wbox[0].minX, x);
-    wbox[0].minY = min(wbox[0].minY, y);
-    wbox[0].maxX = max(wbox[0].maxX, (int16_t)(x+w));
-    wbox[0].maxY = max(wbox[0].maxY, (int16_t)(y+h));
+    bump(stats.wbOverflows);
+    Box& b = wbox[growTarget(r, forced)];
+    b.minX = min(b.minX, x);
+    b.minY = min(b.minY, y);
+    b.maxX = max(b.maxX, (int16_t)(x+w));
+    b.maxY = max(b.maxY, (int16_t)(y+h));
+    if (prio < b.prio) b.prio = prio;
+    b.field = FIELD_ALL;
+  }
+}
+// Out of boxes: the box of the same kind (forced or budgeted) that r grows
+// least, carrying or not; any box if there is none of that kind
+uint8_t CA_Render::growTarget(const Box& r, bool forced) const {
+  uint8_t best = 0; uint32_t bestGrow = 0xFFFFFFFFul; bool bestKind = false;
+  for (uint8_t i=0;i<wBoxN;++i){
+    const Box& b = wbox[i];
+    const bool kind = !budgeted() || forced == (b.prio <= PRIO_HIGH);
+    if (bestKind && !kind) continue;
+    const uint32_t area = (uint32_t)(b.maxX - b.minX) * (uint32_t)(b.maxY - b.minY);
+    const uint32_t grow = (uint32_t)(max(b.maxX, r.maxX) - min(b.minX, r.minX)) *
+                          (uint32_t)(max(b.maxY, r.maxY) - min(b.minY, r.minY)) - area;
+    if ((kind && !bestKind) || grow < bestGrow) { best = i; bestGrow = grow; bestKind = kind; }
   }
+  return best;
+}
+void CA_Render::clearDirty(){ wBoxN=0; uiBoxN=0; bgSpans=nullptr; bgSpanN=0; bgSpanPos=0; for(uint8_t i=0;i<wbCap;++i) wbox[i].valid=false; for(uint8_t i=0;i<uibCap;++i) ui[i].valid=false; }
+void CA_Render::clearQueues(){
+  for (uint8_t l=0;l<layerN;++l) layers[l].n = 0;
+  recN=barN=txtN=linN=0;
+}
+
+// ---- z buckets ----
+void CA_Render::resetZBuckets(){ zbN = 0; zbLast = 0; zbOverflow = false; }
+
+// Map a z value to its bucket id. Ids are assigned in first-seen order and stay
+// stable, so records queued earlier in the frame never need fixing up
+uint8_t CA_Render::zBucket(int16_t z){
+  if (zbLast < zbN && zbVal[zbLast] == z) return zbLast;
+  for (uint8_t i=0;i<zbN;++i) if (zbVal[i] == z) { zbLast = i; return i; }
+  if (zbN >= MAX_ZB) {
+    // Table full: borrow the closest lower bucket (or the lowest) for this frame
+    // and start over on the next beginFrame()
+    zbOverflow = true;
+    int8_t lo = -1; uint8_t lowest = 0;
+    for (uint8_t i=0;i<zbN;++i){
+      if (zbVal[i] <= z && (lo < 0 || zbVal[i] > zbVal[lo])) lo = (int8_t)i;
+      if (zbVal[i] < zbVal[lowest]) lowest = i;
+    }
+    return (lo >= 0) ? (uint8_t)lo : lowest;
+  }
+  const uint8_t id = zbN++;
+  zbVal[id] = z;
+  // Re-rank (rare: only when a new z value appears)
+  for (uint8_t i=0;i<zbN;++i){
+    uint8_t r = 0;
+    for (uint8_t j=0;j<zbN;++j) if (zbVal[j] < zbVal[i]) ++r;
+    zbRank[i] = r;
+  }
+  zbLast = id;
+  return id;
 }
-void CA_Render::clearDirty(){ wBoxN=0; uiBoxN=0; for(uint8_t i=0;i<MAX_WB;++i) wbox[i].valid=false; for(uint8_t i=0;i<MAX_UIB;++i) ui[i].valid=false; }
-void CA_Render::clearQueues(){ sprN=recN=barN=txtN=0; fgN=0; }
 
-// z sorts in place, not in buffer
+// Stable counting sort of queue indices by z rank; records themselves never move
+// Most frames enqueue in the same order as last time, so check that first
 template<typename T>
-void CA_Render::zSort(T* arr, uint8_t n){
-  for (uint8_t i=1;i<n;++i){
-    T v = arr[i]; uint8_t j = i;
-    while (j && arr[j-1].z > v.z){ arr[j] = arr[j-1]; --j; }
-    arr[j] = v;
-  }
-}
-void CA_Render::sortSprites(){ zSort(spr, sprN); }
-void CA_Render::sortFG     (){ zSort(fg,  fgN ); }
-void CA_Render::sortRects  (){ zSort(rec, recN); }
-void CA_Render::sortBars   (){ zSort(bar, barN); }
-void CA_Render::sortTexts  (){ zSort(txt, txtN); }
+void CA_Render::zOrder(const T* arr, uint8_t n, uint8_t* ord) const {
+  bool sorted = true;
+  for (uint8_t i=0;i<n;++i){
+    ord[i] = i;
+    if (i && zbRank[arr[i-1].zb] > zbRank[arr[i].zb]) sorted = false;
+  }
+  if (sorted) return;
+
+  uint8_t start[MAX_ZB];
+  memset(start, 0, zbN);
+  for (uint8_t i=0;i<n;++i) ++start[zbRank[arr[i].zb]];
+  uint8_t sum = 0;
+  for (uint8_t r=0;r<zbN;++r){ const uint8_t c = start[r]; start[r] = sum; sum += c; }
+  for (uint8_t i=0;i<n;++i) ord[start[zbRank[arr[i].zb]]++] = i;
+}
+void CA_Render::sortRects  (){ zOrder(rec, recN, recOrd); }
+void CA_Render::sortBars   (){ zOrder(bar, barN, barOrd); }
+void CA_Render::sortTexts  (){ zOrder(txt, txtN, txtOrd); }
+void CA_Render::sortLines  (){ zOrder(lin, linN, linOrd); }
 
 // Cheap font!
 // 5x7 ASCII (0x20..0x7F)
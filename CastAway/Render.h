@@ -8,44 +8,164 @@
 #include "Blitter.h"
 #include "Anim.h"
 
+// Render command log (CA_RenderLog): built in on host builds, opt-in on AVR
+#ifndef CA_RENDER_LOG
+  #if defined(__AVR__)
+    #define CA_RENDER_LOG 0
+  #else
+    #define CA_RENDER_LOG 1
+  #endif
+#endif
+
+class CA_WaterFx;
+class CA_Particles;
+class CA_RenderLog;
+
 /**
  * CA_Render
  * ---------
  * Scanline renderer that composites:
- *   1) Background (2× scaled from 160×120 into 320×240 via BG composer)
- *   2) World sprites (z-sorted amongst themselves)
- *   3) Foreground sprites (z-sorted amongst themselves; always above world)
- *   4) UI primitives (rects, outlines, bars, text) — always top-most
+ *   1) Background (160×120 scaled by the panel's CA_BgMap, 2× into 320×240
+ *      on the stock panel, via the BG composer), plus
+ *      the water shimmer (CA_WaterFx) when one is attached
+ *   2) Sprite layers, bottom-up: world, foreground, then Caps::XL extra layers
+ *      (z-sorted within each layer); particles (CA_Particles), when attached,
+ *      go between world and foreground
+ *   3) The UI layer (lines, rects, outlines, bars, text) — always top-most
+ *
+ * Layers are a table the compose loop walks once per line. Each one declares
+ * what it holds (LayerKind), how it makes dirty regions (LayerDirty), the z
+ * range its primitives are clamped to and whether it is the cached layer;
+ * setLayer() changes a layer's policy, addSpriteTo() queues into any sprite
+ * layer. addSprite()/addSpriteFG()/markForegroundDirty() are the world and FG
+ * shorthands
  *
  * Rendering happens only inside "dirty" boxes (screen-space unions), to minimize
  * writes to the LCD. World dirty boxes are usually driven by moving game objects
  * UI dirty boxes are merged into any overlapping world box so their scanlines
  * are pushed once.
  *
+ * Each box carries a priority (Prio). With a frame budget set, renderFrame()
+ * draws UI and HIGH boxes first and always, then WORLD and AMBIENT boxes until
+ * the budget runs out; whatever did not fit stays dirty for the next frame, so
+ * a full-screen event is spread over several frames instead of stalling input.
+ * Optionally, boxes larger than an interlace area are pushed as two fields
+ * (even lines, then odd lines on the next frame); the 2× background hides
+ * most of the half-updated frame.
+ *
+ * Static layer cache (opt-in, Caps::FGC pixels of SRAM; the FG layer unless
+ * setLayer() moves the `cached` flag): the rows of the cached layer's bounding
+ * box that fit are kept composited (BG + that layer, RGB565) with a 1-bit
+ * mask. Lines crossing it copy the cached span instead of composing BG and the
+ * layer there, and put the masked pixels back over the layers below. Rows in
+ * the shimmer band and boxes shifted by the scroll band compose as usual; rows
+ * touched by addDirtyBgSpans_P() are refreshed on their next use. The cache
+ * follows the layer's bounding box; call markLayerDirty() when its frames or
+ * palettes change in place
+ *
  * Key details:
  *  - Coordinates are screen-space pixels (0..screenW/H-1)
  *  - Colors are 16-bit RGB565 (uint16_t)
- *  - Sprites are 4bpp paletted frames (CA_Frame4). Transparency is per-sprite
- *    via a key color (key565). Use CA_Draw::frameKey565(frame, palRAM) to pick
- *    the key from the frame's top-left pixel if you want "topleftkey" semantics
+ *  - Sprites are 4bpp paletted frames (CA_Frame4). Transparency is per-sprite:
+ *    the index of the frame's top-left pixel (the key565 arguments are kept for
+ *    older callers and ignored). Frames registered at begin() are queued by
+ *    descriptor id (addSpriteId), with palette and key resolved once
  *  - Foreground sprites do NOT expand dirty regions by themselves, but can be
  *    forced to redraw fully for one frame via markForegroundDirty(), useful on
  *    startup or when the FG set changes
+ *  - Queue capacities are fixed at compile time by the CA_RenderCaps policy of
+ *    CA_RenderT<>. CA_Render itself holds the logic and only sees the pools, so
+ *    different capacities do not duplicate the renderer code in flash
  */
+// -----------------------------------------------------------------------------
+// CA_RenderCaps
+// Compile-time queue capacities for CA_RenderT<>. Derive and override only what
+// a deployment needs, e.g.
+//   struct BigLakeCaps : CA_RenderCaps { static constexpr uint8_t SPR = 40; };
+//   CA_RenderT<BigLakeCaps> renderer;
+// Approximate SRAM per slot: sprite 17 B, rect 13 B, bar 14 B, text 32 B, line 21 B,
+// box 12 B, FG cache 2 B + 1 bit per pixel, layer 19 B, sprite descriptor 5 B
+// -----------------------------------------------------------------------------
+struct CA_RenderCaps {
+  static constexpr uint8_t SPR = 16; // world sprites
+  static constexpr uint8_t FG  = 2;  // foreground sprites
+  static constexpr uint8_t XL  = 0;  // extra sprite layers above FG
+  static constexpr uint8_t XSPR = 8; // sprites per extra layer
+  static constexpr uint8_t REC = 16; // solid + outline rects
+  static constexpr uint8_t BAR = 4;  // HUD bars
+  static constexpr uint8_t TXT = 8;  // text runs
+  static constexpr uint8_t LIN = 4;  // line segments
+  static constexpr uint8_t WB  = 28; // world dirty boxes
+  static constexpr uint8_t UIB = 8;  // UI dirty boxes
+  static constexpr uint16_t FGC = 0; // static FG cache, pixels (0 = off)
+  static constexpr uint8_t DESC = 16; // sprite descriptors (registerFrames)
+};
+
 class CA_Render {
 public:
-  CA_Render();
   void begin(const CA_BlitConfig* cfg);
   void beginFrame();
-  void setBgPalette(uint16_t* palRam) { bgPalRam = palRam; }
+  void setBgPalette(uint16_t* palRam) { bgPalRam = palRam; invalidateFgCache(); }
+  // Attach the surface shimmer; it queues its own dirty cells (nullptr = none)
+  void setWaterFx(const CA_WaterFx* fx) { waterFx = fx; }
+  // Attach a particle pool; it queues its own dirty cells (nullptr = none)
+  void setParticles(const CA_Particles* p) { particles = p; }
+#if CA_RENDER_LOG
+  // Record every frame into a command log (nullptr = stop recording)
+  void setRenderLog(CA_RenderLog* log);
+#endif
 
   // PUBLIC DRAW API (declared in header, defined in Render.cpp)
+  // Queued frames are read by renderFrame(): keep them valid until it returns
+  // (a local CA_Frame4 in the same tick is fine)
   void addSprite(const CA_Frame4& f, int16_t vx, int16_t vy, bool hFlip,
                  uint16_t* palRam, uint16_t key565, int16_t z);
   void addSpriteFG(const CA_Frame4& f, int16_t vx, int16_t vy, bool hFlip,
                    uint16_t* palRam, uint16_t key565, int16_t z);
   void markForegroundDirty();
 
+  // Sprite descriptors: frames registered once (after begin(), which clears
+  // the table) keep their RAM palette (CA_Draw::ensurePaletteRAM) and key
+  // index, so queueing by id costs no lookups or PROGMEM reads. Ids are
+  // consecutive per call; NO_DESC when Caps::DESC is full. Frames must stay
+  // put (static tables)
+  struct SpriteDesc { const CA_Frame4* f; uint16_t* palRam; uint8_t keyIdx; };
+  static constexpr uint8_t NO_DESC = 0xFF;
+  uint8_t registerFrames(const CA_Frame4* frames, uint8_t n, uint16_t* palRam = nullptr);
+  uint8_t registerAnim(const CA_Anim4& a);   // the set's palette when it has one
+  const SpriteDesc& spriteDesc(uint8_t id) const { return sdesc[id]; }
+  void addSpriteId(uint8_t l, uint8_t id, int16_t vx, int16_t vy, bool hFlip, int16_t z);
+
+  // Recompose the static layer cache on its next use (after editing BG palette
+  // entries without queueing their spans)
+  void invalidateFgCache() { memset(fgcStale, 0xFF, sizeof(fgcStale)); }
+
+  // ------------------------------- Layers -------------------------------
+  // Sprite layers in compose order; extra layers (Caps::XL) follow LAYER_FG.
+  // The UI layer is always the last entry of the table
+  enum LayerId : uint8_t { LAYER_WORLD, LAYER_FG, LAYER_XTRA };
+  enum LayerKind : uint8_t { LK_SPRITES, LK_UI };
+  // How a layer contributes to the dirty regions
+  enum LayerDirty : uint8_t {
+    LD_EXPLICIT,   // not at all; the game queues rects (world sprites, UI)
+    LD_ON_MARK,    // every primitive's rect after markLayerDirty() (FG)
+    LD_ON_ADD      // every primitive's rect as it is queued (short-lived overlays)
+  };
+  struct LayerDesc {
+    uint8_t kind;        // LayerKind, fixed by the pools
+    uint8_t dirty;       // LayerDirty
+    uint8_t prio;        // Prio of the rects LD_ON_MARK / LD_ON_ADD queue
+    bool    cached;      // served by the static layer cache (one layer at most)
+    int16_t zMin, zMax;  // z of queued primitives is clamped to this range
+  };
+  uint8_t layerCount() const { return layerN; }
+  const LayerDesc& layerDesc(uint8_t l) const { return layers[l].d; }
+  // Change a layer's policy (kind is kept); out-of-range ids are ignored
+  void setLayer(uint8_t l, const LayerDesc& d);
+  void addSpriteTo(uint8_t l, const CA_Frame4& f, int16_t vx, int16_t vy, bool hFlip,
+                   uint16_t* palRam, int16_t z);
+  void markLayerDirty(uint8_t l);
+
   void addSolid(int16_t rx, int16_t ry, int16_t rw, int16_t rh, uint16_t c, int16_t z);
   void addOutline(int16_t rx, int16_t ry, int16_t rw, int16_t rh, uint16_t c, int16_t z);
   void addHBar(int16_t bx, int16_t by, int16_t bw, int16_t bh, int16_t fillW, uint16_t c, int16_t z);
@@ -53,65 +173,302 @@ public:
   // Draw text after clearing a fixed background run (cols * 6 px) from (tx,ty)
   void addTextOpaque(const char* s, int16_t tx, int16_t ty, uint16_t fg, uint16_t bg,
                      uint8_t cols, int16_t z);
+  // 1px line from (xa,ya) to (xb,yb), both ends included; composed under the
+  // other UI primitives. Unlike them, a line dirties itself: a few thin boxes
+  // along it (PRIO_HIGH), and where it was last frame when it moved or went
+  // away. A line queued unchanged in the same slot costs nothing
+  void addLine(int16_t xa, int16_t ya, int16_t xb, int16_t yb, uint16_t c, int16_t z);
+  // n points as x,y pairs, n-1 lines
+  void addPolyline(const int16_t* xy, uint8_t n, uint16_t c, int16_t z);
+
+  // Dirty box priority, most urgent first. UI and HIGH ignore the frame budget
+  enum Prio : uint8_t { PRIO_UI, PRIO_HIGH, PRIO_WORLD, PRIO_AMBIENT, PRIO_N };
+
+  void addDirtyRect(int16_t x, int16_t y, int16_t w, int16_t h);   // PRIO_UI
+  void addDirtyWorldRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t prio = PRIO_WORLD);
+  // Repaint a PROGMEM list of BG source spans { row, x0, len } (160×120 units)
+  // this frame, e.g. the palette-cycle map. The list must stay valid until
+  // renderFrame(); spans are drawn as their own one-source-row boxes, sprites and UI
+  // included, so the list is not folded into the world boxes
+  void addDirtyBgSpans_P(const uint8_t (*spans)[3], uint16_t n);
+  // Repaint BG source rows [row0, row0+rows) across the BG at PRIO_AMBIENT,
+  // e.g. rows using palette entries that changed; FG cache rows over them
+  // are recomposed
+  void addDirtyBgRows(int16_t row0, int16_t rows);
+  // A sprite palette (RAM copy) changed: every sprite queued with it this
+  // frame is repainted (its layer, if that one is cached). Resolved when
+  // renderFrame() runs, so it can be called before the sprites are queued
+  void addDirtyPalette(const uint16_t* palRam);
+
+  // Per-frame budget for WORLD/AMBIENT boxes: pixels pushed and/or µs spent
+  // in renderFrame() (0 = unlimited, the default). A budgeted frame always
+  // moves the first pending box forward by at least two lines
+  void setPixelBudget(uint32_t px) { pxBudget = px; }
+  void setTimeBudgetUs(uint32_t us) { usBudget = us; }
+  // Boxes above this many pixels are drawn one field per frame (0 = off)
+  void setInterlaceArea(uint32_t px) { ilArea = px; }
+  // ------------------------- Hardware scroll band -------------------------
+  // Scroll a band of the screen with the controller's vertical scrolling area
+  // (MCUFRIEND_kbv::vertScroll). The scroll axis is the panel's native one:
+  // screen Y in portrait, screen X in landscape (rotation 1/3), where the band
+  // is a set of full-height columns. Pass alongX to match the rotation.
+  // The BG inside the band is treated as repeating with the band length, so a
+  // scroll step costs no BG pixels; sprites, UI and pending boxes in the band
+  // are repainted at their screen position and where the scroll carried them.
+  // Everything else keeps using screen coordinates. len 0 switches it off
+  void setScrollBand(int16_t a0, int16_t len, bool alongX);
+  void scrollBy(int16_t d);          // d > 0: content moves toward a0; applied by renderFrame()
+  bool scrollPending() const { return scPend != 0; }   // scrollBy() motion not yet applied
+  int16_t scrollOffset() const { return scOff; }
 
-  void addDirtyRect(int16_t x, int16_t y, int16_t w, int16_t h);
-  void addDirtyWorldRect(int16_t x, int16_t y, int16_t w, int16_t h);
+  // ---------------------------- Parallax bands ----------------------------
+  // Shift BG source rows [row0, row0+rows) left by dx screen pixels, wrapping
+  // around the BG width; everything drawn on top stays put. Changing a band's
+  // offset repaints that band only (PRIO_AMBIENT), so drifting clouds or a
+  // swaying sea cost the same compose work as any other BG repaint.
+  // rows 0 removes the band; bands should not overlap (the first one wins)
+  static constexpr uint8_t MAX_BG_BANDS = 4;
+  void setBgBand(uint8_t i, uint8_t row0, uint8_t rows);
+  void setBgBandOffset(uint8_t i, int16_t dx);
+  int16_t bgBandOffset(uint8_t i) const { return i < MAX_BG_BANDS ? bgBand[i].dx : 0; }
+
+  // ---------------------------- Tile-map world ----------------------------
+  // Show the window of a tile-map BG (blitCfg.tiles) at world source pixel
+  // (ox, oy); wraps at the world size, ignored for the bitmap. Moving it
+  // repaints the whole BG at PRIO_WORLD (spread by the frame budget), so it
+  // suits scene changes and slow pans. Away from (0, 0), BG span lists no
+  // longer match the picture: their rows are repainted whole instead
+  void setBgOrigin(int16_t ox, int16_t oy);
+  int16_t bgOriginX() const { return blitCfg.bg.ox; }
+  int16_t bgOriginY() const { return blitCfg.bg.oy; }
+
+  // Skip every other renderFrame() (dirty regions accumulate meanwhile)
+  void setFrameSkip(bool on) { frameSkip = on; if (!on) skipThisFrame = false; }
+  // True when the last renderFrame() was skipped that way
+  bool frameSkipped() const { return skipThisFrame; }
+  // True while cut boxes or spans are still waiting for a later frame
+  bool hasCarryOver() const { return wBoxN != 0 || bgSpans != nullptr; }
 
   void renderFrame();
 
+  // ---------------------------- Telemetry ----------------------------
+  // Counters accumulate until resetStats(); they saturate instead of wrapping
+  //  dropped*    : primitives rejected because their queue was full (invisible!);
+  //                *FG counts every sprite layer above the world
+  //  wbOverflows : world dirty rects folded into a queued box because WB was reached
+  //  uibOverflows: UI dirty rects that found no free UI box (queued as world
+  //                dirty instead)
+  //  carriedFrames: frames that ran out of budget and left work for the next
+  //  peak*       : per-frame high-water marks, to size CA_RenderCaps with margin
+  struct Stats {
+    uint16_t droppedSpr, droppedFG, droppedRec, droppedBar, droppedTxt, droppedLin;
+    uint16_t wbOverflows, uibOverflows, carriedFrames;
+    uint8_t  peakSpr, peakFG, peakRec, peakBar, peakTxt, peakLin, peakWB, peakUIB;
+  };
+  const Stats& getStats() const { return stats; }
+  void resetStats() { memset(&stats, 0, sizeof(stats)); }
+
   // Expose Sprite so render helpers (in Render.cpp) can reference it
+  // `zb` is the z-bucket id (see zBucket()); the raw z lives in the bucket table.
+  // `f` points at the caller's frame and is only read until renderFrame()
+  // returns; `w`/`h` keep its footprint for the next frame's repaint (LD_ON_ADD)
   struct Sprite {
-    CA_Frame4 f;
+    const CA_Frame4* f;
     int16_t vx, vy;
+    uint16_t w, h;
     bool    hFlip;
     uint16_t* palRam;
     uint8_t keyIdx;
-    int16_t z;
-  };private:
+    uint8_t zb;
+  };
+
   // ---------------------------- Data structures ----------------------------
-  struct Rect { int16_t rx, ry, rw, rh; uint16_t color565; int16_t z; bool isOutline; };
-  struct HBar { int16_t bx, by, bw, bh, fillW; uint16_t color565; int16_t z; };
+  // A layer: its policy and, for sprite layers, the queue. `ord` is the draw
+  // order, `vis` per-box scratch, `mark` a pending markLayerDirty(). The UI
+  // layer has no queue here (rec/bar/txt below)
+  struct Layer {
+    LayerDesc d;
+    Sprite* q; uint8_t* ord; uint8_t* vis;
+    uint8_t n, cap, visN;
+    uint8_t prevN;               // slots queued last frame (LD_ON_ADD)
+    bool    mark;
+  };
+  struct Rect { int16_t rx, ry, rw, rh; uint16_t color565; uint8_t zb; bool isOutline; };
+  struct HBar { int16_t bx, by, bw, bh, fillW; uint16_t color565; uint8_t zb; };
   // Slightly larger to avoid truncation of HUD strings
-  struct Text { char str[24]; int16_t tx, ty; uint16_t color565; int16_t z; };
-  struct Box  { bool valid; int16_t minX, minY, maxX, maxY; };
-
-  // ---------------------------- Capacity limits ----------------------------
-  static constexpr uint8_t MAX_SPR = 16; // reduce the number of sprites (increase if using more fish)
-  static constexpr uint8_t MAX_FG  = 2;
-  static constexpr uint8_t MAX_REC = 16;
-  static constexpr uint8_t MAX_BAR = 4;
-  static constexpr uint8_t MAX_TXT = 8;
-  static constexpr uint8_t MAX_WB  = 28; // control the number of world boxes
-  static constexpr uint8_t MAX_UIB = 8;
+  struct Text { char str[24]; int16_t tx, ty; uint16_t color565; uint8_t zb; };
+  struct Line { CA_LineDDA s; uint16_t color565; uint8_t zb; };
+  // `field` is FIELD_ALL, or the lines of an interlaced box still to draw
+  enum Field : uint8_t { FIELD_ALL = 0, FIELD_EVEN = 1, FIELD_ODD = 2 };
+  struct Box  { bool valid; int16_t minX, minY, maxX, maxY; uint8_t prio; uint8_t field; uint8_t age; };
+
+protected:
+  // Storage handed over by CA_RenderT<>. `*Ord` arrays hold the draw order per
+  // queue and `*Vis` are per-box scratch lists, both sized like their queue.
+  // The extra sprite layers get `xl` consecutive slices of `xCap` from x*
+  struct Pools {
+    Sprite* spr; uint8_t* sprOrd; uint8_t* sprVis; uint8_t sprCap;
+    Sprite* fg;  uint8_t* fgOrd;  uint8_t* fgVis;  uint8_t fgCap;
+    Sprite* x;   uint8_t* xOrd;   uint8_t* xVis;   uint8_t xCap; uint8_t xl;
+    Layer*  layers;              // 3 + xl entries
+    Rect*   rec; uint8_t* recOrd; uint8_t recCap;
+    HBar*   bar; uint8_t* barOrd; uint8_t barCap;
+    Text*   txt; uint8_t* txtOrd; uint8_t txtCap;
+    Line*   lin; uint8_t* linOrd; uint8_t linCap;
+    Box*    wbox; uint8_t wbCap;
+    Box*    ui;   uint8_t uibCap;
+    uint16_t* fgc; uint8_t* fgcMask; uint16_t fgcCap;
+    SpriteDesc* sdesc; uint8_t sdescCap;
+  };
+  CA_Render() {}
+  void attachPools(const Pools& p);
+
+private:
+  friend class CA_RenderLog;
+
+  static constexpr uint8_t MAX_ZB = 32; // distinct z values tracked by the bucket table
+  static constexpr uint8_t PRIO_DONE = 0xFF; // box rendered this frame
+  static constexpr uint8_t FGC_ROWS = 64;    // FG cache rows tracked for staleness
+  static constexpr uint8_t NO_LAYER = 0xFF;
+  static constexpr uint8_t LINE_SEG = 16;    // line pixels per dirty box, about
+  static constexpr uint8_t LINE_BOXES = 8;   // dirty boxes per line, at most
 
   // ---------------------------- Per-frame queues ----------------------------
-  Sprite spr[MAX_SPR]; uint8_t sprN=0;
-  Sprite fg [MAX_FG ]; uint8_t fgN =0;
-  Rect   rec[MAX_REC]; uint8_t recN=0;
-  HBar   bar[MAX_BAR]; uint8_t barN=0;
-  Text   txt[MAX_TXT]; uint8_t txtN=0;
+  // Draw order per queue (indices into the queue arrays, ascending z, stable)
+  // Records never move; only these byte-sized indices are rebuilt each frame
+  Layer*  layers = nullptr; uint8_t layerN = 0;   // sprite layers, then UI
+  uint8_t cacheLayer = NO_LAYER;                  // layer with `cached` set
+  Rect*   rec = nullptr; uint8_t* recOrd = nullptr; uint8_t recN=0, recCap=0;
+  HBar*   bar = nullptr; uint8_t* barOrd = nullptr; uint8_t barN=0, barCap=0;
+  Text*   txt = nullptr; uint8_t* txtOrd = nullptr; uint8_t txtN=0, txtCap=0;
+  Line*   lin = nullptr; uint8_t* linOrd = nullptr; uint8_t linN=0, linCap=0;
+  uint8_t linPrevN = 0;        // slots queued last frame (their lines are on screen)
+  SpriteDesc* sdesc = nullptr; uint8_t sdescN = 0, sdescCap = 0;
+
+  // ---------------------------- Z buckets ----------------------------
+  // Distinct z values seen so far, in first-seen order, so a bucket id stays
+  // valid across frames. zbRank maps id -> ascending z rank and is rebuilt only
+  // when a new z value shows up. Game z values are a handful of constants, so
+  // after the first frames this table is static
+  int16_t zbVal [MAX_ZB];
+  uint8_t zbRank[MAX_ZB];
+  uint8_t zbN = 0;
+  uint8_t zbLast = 0;          // last hit (consecutive enqueues often share z)
+  bool    zbOverflow = false;  // table filled up; relearn on the next beginFrame()
 
   // ---------------------------- Dirty region unions ----------------------------
-  Box wbox[MAX_WB]; uint8_t wBoxN=0;
-  Box ui  [MAX_UIB]; uint8_t uiBoxN=0;
+  Box* wbox = nullptr; uint8_t wBoxN=0, wbCap=0;
+  Box* ui   = nullptr; uint8_t uiBoxN=0, uibCap=0;
+  const uint8_t (*bgSpans)[3] = nullptr; uint16_t bgSpanN = 0, bgSpanPos = 0;   // PROGMEM
 
   // ---------------------------- Global state ----------------------------
   CA_BlitConfig blitCfg;
   uint16_t* bgPalRam = nullptr;
-  bool fgNeedsFullPass = false;
+  const CA_WaterFx* waterFx = nullptr;
+  const CA_Particles* particles = nullptr;
+  uint32_t pxBudget = 0, usBudget = 0;
+  bool frameSkip = false, skipThisFrame = false;
+  uint32_t ilArea = 0;
+  int16_t scA0 = 0, scLen = 0, scOff = 0, scPend = 0;   // scroll band (len 0 = off)
+  bool scAlongX = true;
+  struct BgBand { uint8_t row0, rows; int16_t dx; };
+  BgBand bgBand[MAX_BG_BANDS] = {};
+  static constexpr uint8_t MAX_DIRTY_PALS = 4;
+  const uint16_t* dirtyPal[MAX_DIRTY_PALS];
+  uint8_t dirtyPalN = 0;                // MAX_DIRTY_PALS + 1: overflowed, all sprites
+  bool fieldOdd = false;   // field drawn first by boxes split this frame
+  Stats stats = {};
+#if CA_RENDER_LOG
+  CA_RenderLog* rlog = nullptr;
+#endif
+
+  // ---------------------------- Static layer cache ----------------------------
+  uint16_t* fgc = nullptr; uint8_t* fgcMask = nullptr; uint16_t fgcCap = 0;
+  int16_t fgcX = 0, fgcY = 0, fgcW = 0, fgcBoxH = 0;  // layer bounding box (screen)
+  uint8_t fgcH = 0;                 // rows cached from fgcY (0 = cache off)
+  uint8_t fgcN = 0;                 // sprites the cache was built for
+  uint8_t fgcStale[FGC_ROWS / 8];   // rows to recompose before use
   
   // ---------------------------- Helpers ----------------------------
   static void clampBox(bool& valid, int16_t& x0,int16_t& y0,int16_t& x1,int16_t& y1, int16_t W,int16_t H);
   static bool intersects(const Box& b, int16_t x,int16_t y,int16_t w,int16_t h);
+  bool budgeted() const { return pxBudget || usBudget; }
+  static void bump(uint16_t& c) { if (c != 0xFFFF) ++c; }
+  static void peak(uint8_t& p, uint8_t n) { if (n > p) p = n; }
   void addUIRect(int16_t x, int16_t y, int16_t w, int16_t h);
-  void addWorldRect(int16_t x, int16_t y, int16_t w, int16_t h);
+  void addWorldRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t prio = PRIO_WORLD);
+  void queueSprite(uint8_t l, const CA_Frame4& f, int16_t vx, int16_t vy, bool hFlip,
+                   uint16_t* palRam, uint8_t keyIdx, int16_t z);
   void clearDirty();
+  int16_t clampZ(const Layer& L, int16_t z) const { return z < L.d.zMin ? L.d.zMin : (z > L.d.zMax ? L.d.zMax : z); }
+  void syncFgCache();
+  void refreshFgcRow(uint8_t r);
+  void renderBox(const Box& b, int16_t shX, int16_t shY);
+  void drawBox(const Box& b);
+  uint8_t gramToScreen(const Box& g, Box out[4]) const;
+  int16_t bgDx(int16_t srcY) const;
+  void addBgRowsRect(int16_t row0, int16_t rows);
+  void resolveDirtyPalettes();
+  uint8_t bgSpanBoxes(int16_t row, int16_t x0, int16_t len, Box out[2]) const;
+  void applyScroll();
+  uint8_t growTarget(const Box& r, bool forced) const;
+  void addScrollRepair(int16_t x, int16_t y, int16_t w, int16_t h, int16_t d, uint8_t prio);
+  void addBandSpan(int16_t x, int16_t y, int16_t w, int16_t h, int16_t u, int16_t n, uint8_t prio);
+  void renderBgSpans(uint32_t& pxLeft, uint32_t t0, bool& progressed);
   void clearQueues();
-  template<typename T> static void zSort(T* arr, uint8_t n);
-  void sortSprites(); void sortFG(); void sortRects(); void sortBars(); void sortTexts();
+  uint8_t zBucket(int16_t z);
+  void resetZBuckets();
+  template<typename T> void zOrder(const T* arr, uint8_t n, uint8_t* ord) const;
+  void sortRects(); void sortBars(); void sortTexts(); void sortLines();
+  void addLineRects(CA_LineDDA s);
+  void composeUILine(int16_t y, int16_t x0, int16_t W, uint16_t* lb);
 
   // 5×7 ASCII
   static const uint8_t FONT5x7[96][5] PROGMEM;
 };
 
+// -----------------------------------------------------------------------------
+// CA_RenderT<Caps>
+// The renderer you instantiate: owns queue storage sized by Caps and hands it
+// to CA_Render. All capacities are compile-time, so SRAM use is visible in the
+// link map and no allocation ever happens
+// -----------------------------------------------------------------------------
+template<class Caps = CA_RenderCaps>
+class CA_RenderT : public CA_Render {
+public:
+  typedef Caps CapsType;
+
+  CA_RenderT() {
+    Pools p;
+    p.spr = sprBuf; p.sprOrd = sprOrdBuf; p.sprVis = sprVisBuf; p.sprCap = Caps::SPR;
+    p.fg  = fgBuf;  p.fgOrd  = fgOrdBuf;  p.fgVis  = fgVisBuf;  p.fgCap  = Caps::FG;
+    p.x   = xBuf;   p.xOrd   = xOrdBuf;   p.xVis   = xVisBuf;   p.xCap   = Caps::XSPR; p.xl = Caps::XL;
+    p.layers = layerBuf;
+    p.rec = recBuf; p.recOrd = recOrdBuf; p.recCap = Caps::REC;
+    p.bar = barBuf; p.barOrd = barOrdBuf; p.barCap = Caps::BAR;
+    p.txt = txtBuf; p.txtOrd = txtOrdBuf; p.txtCap = Caps::TXT;
+    p.lin = linBuf; p.linOrd = linOrdBuf; p.linCap = Caps::LIN;
+    p.wbox = wboxBuf; p.wbCap = Caps::WB;
+    p.ui   = uiBuf;   p.uibCap = Caps::UIB;
+    p.fgc = fgcBuf; p.fgcMask = fgcMaskBuf; p.fgcCap = Caps::FGC;
+    p.sdesc = sdescBuf; p.sdescCap = Caps::DESC;
+    attachPools(p);
+  }
+
+private:
+  Sprite  sprBuf[Caps::SPR]; uint8_t sprOrdBuf[Caps::SPR]; uint8_t sprVisBuf[Caps::SPR];
+  Sprite  fgBuf [Caps::FG ]; uint8_t fgOrdBuf [Caps::FG ]; uint8_t fgVisBuf [Caps::FG ];
+  static constexpr uint16_t XN = Caps::XL ? (uint16_t)Caps::XL * Caps::XSPR : 1;
+  Sprite  xBuf  [XN];        uint8_t xOrdBuf  [XN];        uint8_t xVisBuf  [XN];
+  Layer   layerBuf[3 + Caps::XL];
+  Rect    recBuf[Caps::REC]; uint8_t recOrdBuf[Caps::REC];
+  HBar    barBuf[Caps::BAR]; uint8_t barOrdBuf[Caps::BAR];
+  Text    txtBuf[Caps::TXT]; uint8_t txtOrdBuf[Caps::TXT];
+  Line    linBuf[Caps::LIN ? Caps::LIN : 1]; uint8_t linOrdBuf[Caps::LIN ? Caps::LIN : 1];
+  Box     wboxBuf[Caps::WB];
+  Box     uiBuf  [Caps::UIB];
+  uint16_t fgcBuf[Caps::FGC ? Caps::FGC : 1]; uint8_t fgcMaskBuf[Caps::FGC ? (Caps::FGC + 7) / 8 : 1];
+  SpriteDesc sdescBuf[Caps::DESC ? Caps::DESC : 1];
+};
+
 #endif
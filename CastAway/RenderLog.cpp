@@ -0,0 +1,221 @@
+#include "RenderLog.h"
+
+#if CA_RENDER_LOG
+#include "WaterFx.h"
+#include "Particles.h"
+#include "DrawSetup.h"
+
+// ---- frame ids ----
+void CA_FrameRegistry::add(const CA_Frame4* frames, uint8_t n){
+  if (sets >= MAX_SETS) return;
+  set[sets] = frames; setN[sets] = n; ++sets;
+}
+
+// Same pixels: same data (and delta) pointer, or same place in the same pack
+static bool sameFrame(const CA_Frame4& a, const CA_Frame4& b){
+#if CA_ASSET_STREAM
+  if (a.src != b.src || a.off != b.off) return false;
+#endif
+  return a.data == b.data && a.delta == b.delta;
+}
+
+uint8_t CA_FrameRegistry::idOf(const CA_Frame4& f) const {
+  uint8_t id = 0;
+  for (uint8_t s=0;s<sets;++s)
+    for (uint8_t i=0;i<setN[s];++i,++id)
+      if (sameFrame(set[s][i], f)) return id;
+  return NONE;
+}
+
+uint8_t CA_FrameRegistry::idOfPal(const uint16_t* pal565) const {
+  uint8_t id = 0;
+  for (uint8_t s=0;s<sets;++s)
+    for (uint8_t i=0;i<setN[s];++i,++id) if (set[s][i].pal565 == pal565) return id;
+  return NONE;
+}
+
+const CA_Frame4* CA_FrameRegistry::frame(uint8_t id) const {
+  for (uint8_t s=0;s<sets;++s){
+    if (id < setN[s]) return &set[s][id];
+    id = (uint8_t)(id - setN[s]);
+  }
+  return nullptr;
+}
+
+// ---- log writer ----
+void CA_RenderLog::begin(Print& o, const CA_FrameRegistry* frames){
+  out = &o; reg = frames;
+  started = false; written = 0;
+  cfgSkip = 0xFF;
+  memset(palHash, 0, sizeof(palHash));
+  memset(sprPalHash, 0, sizeof(sprPalHash));
+  fxHash = 0; ptHash = 0;
+}
+
+uint32_t CA_RenderLog::fnv(const uint8_t* p, uint16_t n){
+  uint32_t h = 2166136261ul;
+  while (n--) { h ^= *p++; h *= 16777619ul; }
+  return h;
+}
+
+void CA_RenderLog::u8(uint8_t v){
+  if (!out) return;
+  out->write(v);
+  ++written;
+}
+
+void CA_RenderLog::op(uint8_t code){
+  if (!started && rnd) {
+    started = true;
+    const CA_Render& r = *rnd;
+    u8('C'); u8('A'); u8('L'); u8(VERSION);
+    u16(r.blitCfg.screenW); u16(r.blitCfg.screenH);
+    u8((uint8_t)(r.layerN - 1));
+    for (uint8_t l=0;l+1<r.layerN;++l) u8(r.layers[l].cap);
+    u8(r.recCap); u8(r.barCap); u8(r.txtCap);
+    u8(r.wbCap); u8(r.uibCap); u8(r.linCap); u16(r.fgcCap);
+    // Layer policies, BG bands and origin in force when recording starts; later
+    // changes follow
+    for (uint8_t l=0;l<r.layerN;++l) layer(l, r.layers[l].d);
+    for (uint8_t i=0;i<CA_Render::MAX_BG_BANDS;++i){
+      const CA_Render::BgBand& bb = r.bgBand[i];
+      if (bb.rows) bgBand(i, bb.row0, bb.rows, bb.dx);
+    }
+    if (r.blitCfg.bg.ox || r.blitCfg.bg.oy) bgOrigin(r.blitCfg.bg.ox, r.blitCfg.bg.oy);
+  }
+  u8(code);
+}
+
+void CA_RenderLog::dirtyUI(int16_t x, int16_t y, int16_t w, int16_t h){
+  op(OP_DIRTY_UI); rect(x, y, w, h);
+}
+
+void CA_RenderLog::dirtyWorld(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t prio){
+  op(OP_DIRTY_WORLD); rect(x, y, w, h); u8(prio);
+}
+
+void CA_RenderLog::bgSpans(const uint8_t (*spans)[3], uint16_t n){
+  op(OP_BG_SPANS); u16(n);
+  for (uint16_t i=0;i<n;++i)
+    for (uint8_t k=0;k<3;++k) u8(pgm_read_byte(&spans[i][k]));
+}
+
+void CA_RenderLog::layerDirty(uint8_t l){ op(OP_LAYER_DIRTY); u8(l); }
+
+void CA_RenderLog::layer(uint8_t l, const CA_Render::LayerDesc& d){
+  op(OP_LAYER); u8(l); u8(d.dirty); u8(d.prio); u8(d.cached); u16(d.zMin); u16(d.zMax);
+}
+
+void CA_RenderLog::scrollBand(int16_t a0, int16_t len, bool alongX){
+  op(OP_SCROLL_BAND); u16(a0); u16(len); u8(alongX);
+}
+
+void CA_RenderLog::scrollBy(int16_t d){ op(OP_SCROLL_BY); u16(d); }
+
+void CA_RenderLog::bgBand(uint8_t i, uint8_t row0, uint8_t rows, int16_t dx){
+  op(OP_BG_BAND); u8(i); u8(row0); u8(rows); u16(dx);
+}
+
+void CA_RenderLog::bgOrigin(int16_t ox, int16_t oy){ op(OP_BG_ORIGIN); u16(ox); u16(oy); }
+
+void CA_RenderLog::bgRows(int16_t row0, int16_t rows){ op(OP_BG_ROWS); u16(row0); u16(rows); }
+
+// Lines dirty their own boxes, so they are logged where they were queued
+void CA_RenderLog::line(int16_t xa, int16_t ya, int16_t xb, int16_t yb, uint16_t c, int16_t z){
+  op(OP_LINE); rect(xa, ya, xb, yb); u16(c); u16(z);
+}
+
+void CA_RenderLog::window(int16_t x0, int16_t y0, int16_t x1, int16_t y1){
+  op(OP_WINDOW); rect(x0, y0, x1, y1);
+}
+
+void CA_RenderLog::frame(){
+  if (!rnd) return;
+  const CA_Render& r = *rnd;
+
+  // Settings, only when they change
+  if (r.pxBudget != cfgPx || r.usBudget != cfgUs || r.ilArea != cfgIl || (uint8_t)r.frameSkip != cfgSkip) {
+    cfgPx = r.pxBudget; cfgUs = r.usBudget; cfgIl = r.ilArea; cfgSkip = (uint8_t)r.frameSkip;
+    op(OP_CONFIG); u32(cfgPx); u32(cfgUs); u32(cfgIl); u8(cfgSkip);
+  }
+
+  // BG palette blocks edited since the last frame (all of them the first time)
+  if (r.bgPalRam) {
+    for (uint8_t b=0;b<16;++b){
+      const uint16_t* p = r.bgPalRam + ((uint16_t)b << 4);
+      const uint32_t h = fnv((const uint8_t*)p, 32);
+      if (h == palHash[b]) continue;
+      palHash[b] = h;
+      op(OP_BG_PAL); u8(b);
+      for (uint8_t k=0;k<16;++k) u16(p[k]);
+    }
+  }
+
+  // Sprite palettes edited in RAM (CA_TimeOfDay tints), by a frame using them
+  const uint8_t slots = CA_Draw::paletteSlots();
+  for (uint8_t i=0;i<slots;++i){
+    const uint16_t* src;
+    const uint16_t* p = CA_Draw::paletteSlot(i, &src);
+    const uint32_t h = fnv((const uint8_t*)p, 32);
+    if (h == sprPalHash[i]) continue;
+    const uint8_t id = reg ? reg->idOfPal(src) : CA_FrameRegistry::NONE;
+    if (id == CA_FrameRegistry::NONE) continue;
+    sprPalHash[i] = h;
+    op(OP_SPR_PAL); u8(id);
+    for (uint8_t k=0;k<16;++k) u16(p[k]);
+  }
+
+  // Shimmer squares, when any moved
+  if (r.waterFx) {
+    uint8_t st[CA_WaterFx::STATE_BYTES];
+    const uint8_t n = r.waterFx->saveState(st);
+    const uint32_t h = fnv(st, n);
+    if (h != fxHash) {
+      fxHash = h;
+      op(OP_SHIMMER); u8(n);
+      for (uint8_t i=0;i<n;++i) u8(st[i]);
+    }
+  }
+
+  // Particles, when any moved
+  if (r.particles) {
+    uint8_t st[CA_Particles::STATE_BYTES];
+    const uint8_t n = r.particles->saveState(st);
+    const uint32_t h = fnv(st, n);
+    if (h != ptHash) {
+      ptHash = h;
+      op(OP_PARTICLES); u8(n);
+      for (uint8_t i=0;i<n;++i) u8(st[i]);
+    }
+  }
+
+  // Primitive queues in the order they were added (renderFrame sorts them)
+  for (uint8_t l=0;l<r.layerN;++l){
+    const CA_Render::Layer& L = r.layers[l];
+    for (uint8_t i=0;i<L.n;++i){
+      const CA_Render::Sprite& s = L.q[i];
+      op(OP_SPR); u8(l); u8(reg ? reg->idOf(*s.f) : CA_FrameRegistry::NONE);
+      u16(s.vx); u16(s.vy); u8(s.hFlip); u16(r.zbVal[s.zb]);
+    }
+  }
+  for (uint8_t i=0;i<r.recN;++i){
+    const CA_Render::Rect& q = r.rec[i];
+    op(q.isOutline ? OP_OUTLINE : OP_SOLID);
+    rect(q.rx, q.ry, q.rw, q.rh); u16(q.color565); u16(r.zbVal[q.zb]);
+  }
+  for (uint8_t i=0;i<r.barN;++i){
+    const CA_Render::HBar& hb = r.bar[i];
+    op(OP_BAR); rect(hb.bx, hb.by, hb.bw, hb.bh); u16(hb.fillW);
+    u16(hb.color565); u16(r.zbVal[hb.zb]);
+  }
+  for (uint8_t i=0;i<r.txtN;++i){
+    const CA_Render::Text& t = r.txt[i];
+    const uint8_t n = (uint8_t)strlen(t.str);
+    op(OP_TEXT); u16(t.tx); u16(t.ty); u16(t.color565); u16(r.zbVal[t.zb]);
+    u8(n);
+    for (uint8_t k=0;k<n;++k) u8((uint8_t)t.str[k]);
+  }
+  op(OP_RENDER);
+}
+
+#endif // CA_RENDER_LOG
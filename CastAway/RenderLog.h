@@ -0,0 +1,127 @@
+#ifndef CA_RENDER_LOG_H
+#define CA_RENDER_LOG_H
+
+#include <Arduino.h>
+#include "Anim.h"
+#include "Render.h"
+#include "DrawSetup.h"    // CA_PAL_SLOTS
+
+#if CA_RENDER_LOG
+
+// -----------------------------------------------------------------------------
+// CA_FrameRegistry
+// Small ids for sprite frames, so a render log can name them. Ids are handed
+// out in registration order; the recording device and the replay tool fill
+// their registries from the same code (CastAwayGame::registerFrames) to agree.
+// Only frame sets are stored, not copies of the frames
+// -----------------------------------------------------------------------------
+class CA_FrameRegistry {
+public:
+  static const uint8_t MAX_SETS = 8;
+  static const uint8_t NONE = 0xFF;    // frame not registered
+
+  void add(const CA_Frame4* frames, uint8_t n);
+  uint8_t idOf(const CA_Frame4& f) const;        // by data (and delta) pointer or pack offset
+  uint8_t idOfPal(const uint16_t* pal565) const; // first frame using the palette
+  const CA_Frame4* frame(uint8_t id) const;      // nullptr if unknown
+
+private:
+  const CA_Frame4* set[MAX_SETS];
+  uint8_t setN[MAX_SETS];
+  uint8_t sets = 0;
+};
+
+// -----------------------------------------------------------------------------
+// CA_RenderLog
+// Binary log of what CA_Render was asked to draw, frame by frame: dirty rects
+// and span lists as they are queued, the primitive queues, BG palette and
+// shimmer and particle changes, sprite palette edits and the settings in force when renderFrame() runs, then the
+// address windows it opened. host/castaway_replay.cpp feeds a log back through
+// the same compositors against the framebuffer mock, so kernel or dirty-
+// tracking changes can be measured on identical frame sequences.
+//
+// The sink is any Print: Serial on the board (use a fast baud rate; a busy
+// frame is a few hundred bytes), a file on the host. Sprites are logged by
+// frame id and replayed with the frame's own palette (ensurePaletteRAM()).
+// Direct TFT writes outside the renderer are not part of the log.
+//
+// Format: little-endian. A header ("CAL", version, screen size, sprite layer
+// count and caps, the other queue caps)
+// is written before the first record. Every record is an opcode byte and a
+// fixed payload, except BG_SPANS, SHIMMER, PARTICLES and TEXT which carry a
+// count first
+// -----------------------------------------------------------------------------
+class CA_RenderLog {
+public:
+  static const uint8_t VERSION = 8;
+
+  enum Op : uint8_t {
+    OP_DIRTY_UI = 1,  // x y w h                        (i16 ×4)
+    OP_DIRTY_WORLD,   // x y w h (i16 ×4), prio (u8)
+    OP_BG_SPANS,      // n (u16), n × { row, x0, len }
+    OP_LAYER_DIRTY,   // markLayerDirty(): layer (u8)
+    OP_SCROLL_BAND,   // a0 len (i16 ×2), alongX (u8)
+    OP_SCROLL_BY,     // d (i16)
+    OP_CONFIG,        // px budget, µs budget, interlace area (u32 ×3), frame skip (u8)
+    OP_BG_PAL,        // block (u8), 16 × RGB565 for entries block*16 ..
+    OP_SHIMMER,       // n (u8), CA_WaterFx::saveState() bytes
+    OP_SPR,           // layer (u8), frame id (u8), vx vy (i16 ×2), hFlip (u8), z (i16)
+    OP_LAYER,         // setLayer(): layer dirty prio cached (u8 ×4), zMin zMax (i16 ×2)
+    OP_SOLID,         // x y w h (i16 ×4), color (u16), z (i16)
+    OP_OUTLINE,       // same as OP_SOLID
+    OP_BAR,           // x y w h fillW (i16 ×5), color (u16), z (i16)
+    OP_TEXT,          // x y (i16 ×2), color (u16), z (i16), n (u8), n chars
+    OP_RENDER,        // renderFrame() ran with everything above
+    OP_WINDOW,        // x0 y0 x1 y1 (i16 ×4), address window it opened
+    OP_BG_BAND,       // parallax band: index row0 rows (u8 ×3), dx (i16)
+    OP_BG_ORIGIN,     // tile-map window: ox oy (i16 ×2)
+    OP_BG_ROWS,       // addDirtyBgRows(): row0 rows (i16 ×2)
+    OP_SPR_PAL,       // frame id (u8) naming the palette, 16 × RGB565
+    OP_LINE,          // xa ya xb yb (i16 ×4), color (u16), z (i16); logged as queued
+    OP_PARTICLES      // n (u8), CA_Particles::saveState() bytes
+  };
+
+  // Start logging to `out`; sprite frames are looked up in `frames`
+  void begin(Print& out, const CA_FrameRegistry* frames);
+
+  // Hooks called by CA_Render (see CA_Render::setRenderLog)
+  void attach(const CA_Render* r) { rnd = r; }
+  void dirtyUI(int16_t x, int16_t y, int16_t w, int16_t h);
+  void dirtyWorld(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t prio);
+  void bgSpans(const uint8_t (*spans)[3], uint16_t n);
+  void layerDirty(uint8_t l);
+  void layer(uint8_t l, const CA_Render::LayerDesc& d);
+  void scrollBand(int16_t a0, int16_t len, bool alongX);
+  void scrollBy(int16_t d);
+  void bgBand(uint8_t i, uint8_t row0, uint8_t rows, int16_t dx);
+  void bgOrigin(int16_t ox, int16_t oy);
+  void bgRows(int16_t row0, int16_t rows);
+  void line(int16_t xa, int16_t ya, int16_t xb, int16_t yb, uint16_t c, int16_t z);
+  void frame();         // state + queues at renderFrame() entry
+  void window(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+  uint32_t bytes() const { return written; }
+
+private:
+  Print* out = nullptr;
+  const CA_FrameRegistry* reg = nullptr;
+  const CA_Render* rnd = nullptr;
+  bool     started = false;
+  uint32_t written = 0;
+  uint32_t cfgPx = 0, cfgUs = 0, cfgIl = 0;
+  uint8_t  cfgSkip = 0xFF;            // 0xFF: nothing logged yet
+  uint32_t palHash[16];               // per 16-entry block of the BG palette
+  uint32_t sprPalHash[CA_PAL_SLOTS];  // per CA_Draw palette slot
+  uint32_t fxHash = 0;
+  uint32_t ptHash = 0;
+
+  void op(uint8_t code);              // header on first use, then the opcode
+  void u8(uint8_t v);
+  void u16(uint16_t v) { u8((uint8_t)v); u8((uint8_t)(v >> 8)); }
+  void u32(uint32_t v) { u16((uint16_t)v); u16((uint16_t)(v >> 16)); }
+  void rect(int16_t x, int16_t y, int16_t w, int16_t h) { u16(x); u16(y); u16(w); u16(h); }
+  static uint32_t fnv(const uint8_t* p, uint16_t n);
+};
+
+#endif // CA_RENDER_LOG
+#endif
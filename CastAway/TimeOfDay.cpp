@@ -0,0 +1,105 @@
+#include "TimeOfDay.h"
+#include "Render.h"
+#include "DrawSetup.h"
+#include "PalCycle.h"
+
+void CA_TimeOfDay::begin(const CA_BlitConfig& cfg, uint16_t* bgPal, const uint16_t* bgSrc,
+                         CA_PalCycle* cycle, const Phase* phases, uint8_t n, uint32_t now){
+  pal = bgPal; src = bgSrc; cyc = cycle;
+  sched = phases; schedN = n; cur = 0;
+  if (n) memcpy_P(&to, &phases[0].tint, sizeof(Tint));
+  from = to; step = to;
+  phaseStart = now; lastNow = now;
+  pos = 0;
+
+  // Where each block is used: one pass over the BG source
+  uint8_t idx[BG8_W];
+  memset(rowMask, 0, sizeof(rowMask));
+  for (int16_t y=0;y<(int16_t)BG8_H;++y){
+    CA_Draw::readBgRow(cfg, y, idx);
+    uint16_t seen = 0;
+    for (uint8_t x=0;x<BG8_W;++x) seen |= (uint16_t)(1u << (idx[x] >> 4));
+    for (uint8_t b=0;b<BLOCKS;++b) if (seen & (1u << b)) rowMask[b] |= 1ul << (y >> 2);
+  }
+}
+
+uint16_t CA_TimeOfDay::tint(uint16_t c, const Tint& t){
+  uint16_t r = (uint16_t)(((c >> 11)        * t.r) >> 7); if (r > 31) r = 31;
+  uint16_t g = (uint16_t)((((c >> 5) & 63) * t.g) >> 7); if (g > 63) g = 63;
+  uint16_t b = (uint16_t)(((c & 31)         * t.b) >> 7); if (b > 31) b = 31;
+  return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+// Tint for `now`: the fade toward `to`, in CA_TOD_STEPS steps
+CA_TimeOfDay::Tint CA_TimeOfDay::goal(uint32_t now){
+  if (!schedN) return to;
+  if (!enabled) { phaseStart += now - lastNow; lastNow = now; return step; }
+  lastNow = now;
+  uint16_t fade = pgm_read_word(&sched[cur].fadeMs);
+  uint32_t el = now - phaseStart;
+  if (el >= (uint32_t)fade + pgm_read_word(&sched[cur].holdMs)) {
+    // Next phase, fading from where this one ended
+    from = to;
+    phaseStart = now; el = 0;
+    if (++cur >= schedN) cur = 0;
+    memcpy_P(&to, &sched[cur].tint, sizeof(Tint));
+    fade = pgm_read_word(&sched[cur].fadeMs);
+  }
+  if (el >= fade) return to;
+  const int16_t k = (int16_t)((el * CA_TOD_STEPS) / fade);
+  Tint t;
+  t.r = (uint8_t)(from.r + ((int16_t)(to.r - from.r) * k) / CA_TOD_STEPS);
+  t.g = (uint8_t)(from.g + ((int16_t)(to.g - from.g) * k) / CA_TOD_STEPS);
+  t.b = (uint8_t)(from.b + ((int16_t)(to.b - from.b) * k) / CA_TOD_STEPS);
+  return t;
+}
+
+// Recolor BG block b at the step tint; true if any entry changed
+bool CA_TimeOfDay::sweepBlock(uint8_t b){
+  bool changed = false;
+  const uint16_t i0 = (uint16_t)b << 4;
+  for (uint16_t i=i0;i<i0+16;++i){
+    const uint16_t c = tint(pgm_read_word(&src[i]), step);
+    uint8_t k = 0;
+    const uint8_t ringN = cyc ? cyc->ringSize() : 0;
+    while (k < ringN && cyc->ringIndex(k) != i) ++k;
+    if (k < ringN) changed |= cyc->setBase(k, c);
+    else if (pal[i] != c) { pal[i] = c; changed = true; }
+  }
+  return changed;
+}
+
+void CA_TimeOfDay::update(CA_Render& r, uint32_t now){
+  if (!pal || !schedN) return;
+  const Tint g = goal(now);
+  if (!enabled) return;
+
+  // A sweep starts only once the last one's repaint went out
+  if (pos == 0) {
+    if (r.hasCarryOver()) return;
+    step = g;
+  }
+  if (pos < BLOCKS) {
+    // Rows of a block that changed, as runs. Queued right away, so the
+    // screen never waits a whole sweep for new colors; when the renderer is
+    // behind, they merge with the rows still pending there
+    const uint32_t m = sweepBlock(pos) ? rowMask[pos] : 0;
+    for (uint8_t g0=0;g0<32;){
+      if (!(m & (1ul << g0))) { ++g0; continue; }
+      uint8_t g1 = g0;
+      while (g1 < 32 && (m & (1ul << g1))) ++g1;
+      r.addDirtyBgRows((int16_t)(g0 << 2), (int16_t)((g1 - g0) << 2));
+      g0 = g1;
+    }
+  } else {
+    const uint16_t* ps;
+    uint16_t* ram = CA_Draw::paletteSlot((uint8_t)(pos - BLOCKS), &ps);
+    bool changed = false;
+    for (uint8_t k=0;k<16;++k){
+      const uint16_t c = tint(pgm_read_word(&ps[k]), step);
+      if (ram[k] != c) { ram[k] = c; changed = true; }
+    }
+    if (changed) r.addDirtyPalette(ram);
+  }
+  if (++pos >= BLOCKS + CA_Draw::paletteSlots()) pos = 0;
+}
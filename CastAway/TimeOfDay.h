@@ -0,0 +1,73 @@
+#ifndef CA_TIME_OF_DAY_H
+#define CA_TIME_OF_DAY_H
+
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+#include "Blitter.h"
+
+class CA_Render;
+class CA_PalCycle;
+
+// Color steps per fade; each step is one sweep over the palettes
+#ifndef CA_TOD_STEPS
+#define CA_TOD_STEPS 8
+#endif
+
+// -----------------------------------------------------------------------------
+// CA_TimeOfDay
+// Day, dusk and night as tints of the stock palettes: every RGB565 entry is
+// its PROGMEM color with per-channel gains, so no extra assets. A fade moves
+// the gains in CA_TOD_STEPS steps. A step is a sweep over the palettes, one
+// BG block (16 entries) or one cached sprite palette per frame.
+//
+// Repaint: begin() scans the BG once for the rows each BG block appears in
+// (4-row groups, 4 B per block). When a block actually changes color its rows
+// are queued with the renderer, which spreads them over frames within its
+// budget. Sprites with a changed palette go through
+// CA_Render::addDirtyPalette(). The next step waits until the renderer has
+// caught up, so a fade never piles up work
+// -----------------------------------------------------------------------------
+class CA_TimeOfDay {
+public:
+  // Channel gains, 128 = unchanged (up to ~2×)
+  struct Tint { uint8_t r, g, b; };
+
+  // One entry of the schedule: fade to `tint` over fadeMs, then hold it.
+  // The schedule loops. PROGMEM
+  struct Phase { Tint tint; uint16_t fadeMs, holdMs; };
+
+  // Bind to the RAM palettes; bgSrc is the PROGMEM BG palette they came from.
+  // Ring entries of `cycle` (optional) are recolored through it. Starts at
+  // the first phase's tint, already applied on the next sweeps
+  void begin(const CA_BlitConfig& cfg, uint16_t* bgPal, const uint16_t* bgSrc,
+             CA_PalCycle* cycle, const Phase* phases, uint8_t n, uint32_t now);
+
+  // Off freezes the clock and the colors where they are
+  void setEnabled(bool on) { enabled = on; }
+
+  // One sweep slot per call, with its repaint
+  void update(CA_Render& r, uint32_t now);
+
+  uint8_t phase() const { return cur; }
+
+private:
+  static const uint8_t BLOCKS = 16;
+
+  uint16_t*       pal = nullptr;
+  const uint16_t* src = nullptr;     // PROGMEM
+  CA_PalCycle*    cyc = nullptr;
+  const Phase*    sched = nullptr;   // PROGMEM
+  uint8_t  schedN = 0, cur = 0;
+  Tint     from = {128, 128, 128}, to = {128, 128, 128};
+  Tint     step = {128, 128, 128};   // tint of the sweep in progress
+  uint32_t phaseStart = 0, lastNow = 0;
+  uint32_t rowMask[BLOCKS];          // 4-row groups each BG block appears in
+  uint8_t  pos = 0;                  // sweep slot: BG blocks, then sprite palettes
+  bool     enabled = true;
+
+  Tint goal(uint32_t now);
+  static uint16_t tint(uint16_t c, const Tint& t);
+  bool sweepBlock(uint8_t b);
+};
+
+#endif
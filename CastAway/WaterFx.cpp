@@ -0,0 +1,167 @@
+#include "WaterFx.h"
+#include "Render.h"
+
+namespace {
+  inline bool isBlueish(uint16_t c) {
+    uint8_t r = (uint8_t)((c >> 11) & 0x1F);
+    uint8_t g = (uint8_t)((c >> 5)  & 0x3F);
+    uint8_t b = (uint8_t)(c & 0x1F);
+    uint8_t thresh = (uint8_t)(r + (g >> 2));
+    if (thresh < 10) thresh = 10;
+    return b >= thresh;
+  }
+
+  // Bright “white-blue”: high overall brightness, still blue-leaning
+  inline bool isWhiteBlue(uint16_t c) {
+    uint8_t r = (uint8_t)((c >> 11) & 0x1F);
+    uint8_t g = (uint8_t)((c >> 5)  & 0x3F);
+    uint8_t b = (uint8_t)(c & 0x1F);
+    // brightness ~ (2*r + g + 2*b) in [0..187]
+    uint16_t bright = (uint16_t)r + r + g + b + b;
+    // blue not lower than red, and quite bright
+    return (b >= r) && (bright >= 120);
+  }
+
+  // Cheap 50/50 blend in RGB565
+  inline uint16_t blend565(uint16_t a, uint16_t b) {
+    return (uint16_t)(((a & 0xF7DE) >> 1) + ((b & 0xF7DE) >> 1));
+  }
+
+  const uint16_t MOVE_MS_BASE = 820;  // average time a square stays put
+  const uint8_t  MOVE_MS_JIT  = 120;  // + 0..119 ms
+  const uint8_t  MOVE_PX      = 8;    // a move repaints the old and new 2×2 cell
+}
+
+void CA_WaterFx::begin(const CA_BlitConfig& cfg, const uint16_t* bgPal){
+  // Squares stay on the picture (not the letterbox, if any)
+  bandX0 = cfg.bg.x0 < 0 ? 0 : cfg.bg.x0;
+  bandW  = cfg.bg.w < cfg.screenW ? cfg.bg.w : cfg.screenW;
+
+  // Surface band: 8 px above waterline, 5 rows tall
+  const int16_t seaTop = (int16_t)(cfg.bg.y0 + ((int32_t)cfg.bg.h * 72) / 100);
+  int16_t y0 = (int16_t)(seaTop - 8);
+  if (y0 < 0) y0 = 0;
+  int16_t h = 5;
+  if (y0 + h > cfg.screenH) h = (int16_t)(cfg.screenH - y0);
+  if (h < 0) h = 0;
+  bandY0 = y0;
+  bandH  = (uint16_t)h;
+  rows2x = (uint8_t)((h + 1) >> 1);   // 2× vertical units (ceil(h/2))
+
+  // Blueish palette entries, sampled evenly when there are more than fit
+  uint16_t total = 0;
+  for (uint16_t i=0;i<256;++i) if (isBlueish(bgPal[i]) || isWhiteBlue(bgPal[i])) ++total;
+  blueN = 0;
+  uint16_t seen = 0;
+  for (uint16_t i=0;i<256 && blueN<MAX_BLUE;++i){
+    if (!(isBlueish(bgPal[i]) || isWhiteBlue(bgPal[i]))) continue;
+    // keep entry `seen` when it crosses the next sampling step
+    if ((uint32_t)seen * MAX_BLUE / total == blueN || total <= MAX_BLUE) blue[blueN++] = (uint8_t)i;
+    ++seen;
+  }
+
+  for (uint8_t i=0;i<MAX_SQ;++i) sq[i].row = HIDDEN;
+  sqShown = 0;
+  sqN = 0;
+  setDensity((uint8_t)(5 + (rnd() & 3)));   // 5..8
+  needFullPaint = true;                     // first update() places every square
+}
+
+void CA_WaterFx::setDensity(uint8_t n){
+  if (n > MAX_SQ) n = MAX_SQ;
+  for (uint8_t i=sqN;i<n;++i){
+    if (i >= sqShown) sq[i].row = HIDDEN;
+    sq[i].due = (uint16_t)millis();         // appear on the next update()
+  }
+  sqN = n;
+  if (sqN > sqShown) sqShown = sqN;
+}
+
+void CA_WaterFx::respawn(Square& s, uint16_t now16){
+  // Align shimmer to even X so we draw 2 px wide squares cleanly
+  s.x   = (int16_t)((bandX0 + rnd() % (uint16_t)bandW) & ~1);
+  s.row = (uint8_t)(rnd() % rows2x);
+  s.palIdx = blueN ? blue[rnd() % blueN] : 0;
+  s.due = (uint16_t)(now16 + MOVE_MS_BASE + (rnd() % MOVE_MS_JIT));
+}
+
+void CA_WaterFx::markCell(CA_Render& r, const Square& s) const {
+  if (s.row == HIDDEN) return;
+  r.addDirtyWorldRect(s.x, (int16_t)(bandY0 + (s.row << 1)), 2, 2, CA_Render::PRIO_AMBIENT);
+}
+
+void CA_WaterFx::update(CA_Render& r, uint32_t now){
+  if (!bandH || !rows2x) return;
+  const uint16_t now16 = (uint16_t)now;
+
+  if (needFullPaint) {
+    // First frame: place every square at once (one band-wide box) and stagger
+    // their timers so they do not all jump on the same frame later
+    for (uint8_t i=0;i<sqN;++i) {
+      respawn(sq[i], now16);
+      sq[i].due = (uint16_t)(now16 + (rnd() % MOVE_MS_BASE));
+    }
+    sqShown = sqN;
+    r.addDirtyWorldRect(bandX0, bandY0, bandW, (int16_t)bandH, CA_Render::PRIO_AMBIENT);
+    needFullPaint = false;
+    return;
+  }
+
+  // Erase squares switched off by setDensity()
+  while (sqShown > sqN) {
+    Square& s = sq[--sqShown];
+    markCell(r, s);
+    s.row = HIDDEN;
+  }
+
+  uint16_t budget = budgetPx;
+  for (uint8_t i=0;i<sqN;++i){
+    Square& s = sq[i];
+    if ((int16_t)(now16 - s.due) < 0) continue;
+    if (budget < MOVE_PX) break;              // rest waits for the next frame
+    budget -= MOVE_PX;
+    markCell(r, s);                           // cell it leaves
+    respawn(s, now16);
+    markCell(r, s);                           // cell it enters
+  }
+}
+
+uint8_t CA_WaterFx::saveState(uint8_t* out) const {
+  uint8_t n = 0;
+  out[n++] = sqN;
+  for (uint8_t i=0;i<sqN;++i){
+    out[n++] = (uint8_t)sq[i].x; out[n++] = (uint8_t)(sq[i].x >> 8);
+    out[n++] = sq[i].row;        out[n++] = sq[i].palIdx;
+  }
+  return n;
+}
+
+void CA_WaterFx::loadState(const uint8_t* in, uint8_t n){
+  sqN = 0;
+  if (!n) return;
+  uint8_t k = in[0];
+  if (k > MAX_SQ) k = MAX_SQ;
+  if (n < 1 + k * 4) k = (uint8_t)((n - 1) / 4);
+  for (uint8_t i=0;i<k;++i){
+    const uint8_t* p = in + 1 + i * 4;
+    sq[i].x = (int16_t)(p[0] | (p[1] << 8));
+    sq[i].row = p[2]; sq[i].palIdx = p[3];
+  }
+  sqN = sqShown = k;
+  needFullPaint = false;
+}
+
+void CA_WaterFx::applyLineSlow(int16_t y, int16_t x0, int16_t w, const uint16_t* bgPal) const {
+  // Use 2× vertical row index so shimmer appears as 2×2 squares (same on y and y+1)
+  const uint8_t row2x = (uint8_t)((y - bandY0) >> 1);
+  uint16_t* lb = CA_Blit::lineBuffer();
+  for (uint8_t i=0;i<sqN;++i){
+    const Square& s = sq[i];
+    if (s.row != row2x) continue;
+    const int16_t dx = (int16_t)(s.x - x0);
+    const uint16_t c = bgPal[s.palIdx];
+    // Draw 2× horizontally (dx and dx+1) with a soft blend over BG
+    if ((uint16_t)dx < (uint16_t)w) lb[dx] = blend565(lb[dx], c);
+    if ((uint16_t)(dx + 1) < (uint16_t)w) lb[dx + 1] = blend565(lb[dx + 1], c);
+  }
+}
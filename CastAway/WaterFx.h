@@ -0,0 +1,86 @@
+#ifndef CA_WATER_FX_H
+#define CA_WATER_FX_H
+
+#include <Arduino.h>
+#include "Blitter.h"     // CA_BlitConfig (screen dims)
+
+class CA_Render;
+
+// -----------------------------------------------------------------------------
+// CA_WaterFx
+// Shimmer on the water surface: a few 2×2 squares blended over the background
+// in a thin band just above the waterline.
+//
+// The effect owns its dirty cells. Every square keeps its own timer; when it
+// moves, update() marks the cell it leaves and the cell it enters dirty, so the
+// screen always matches the state applyLine() composes. Moves are paced by a
+// per-frame pixel budget; squares that do not fit wait for the next frame.
+//
+// Colors come from a short list of "blueish" BG palette indices built once in
+// begin(). Squares store the index, not the color, so palette edits carry over.
+// -----------------------------------------------------------------------------
+class CA_WaterFx {
+public:
+  static const uint8_t MAX_SQ   = 16;  // square slots (SRAM: 6 B each)
+  static const uint8_t MAX_BLUE = 32;  // palette indices kept for colors
+
+  // Place the band relative to the waterline and build the color list from the
+  // 256-entry BG palette in RAM
+  void begin(const CA_BlitConfig& cfg, const uint16_t* bgPal);
+
+  // Number of live squares (0..MAX_SQ). Squares switched off are erased
+  void setDensity(uint8_t n);
+  uint8_t getDensity() const { return sqN; }
+
+  // Pixel budget for moves in one update() (each move repaints two 2×2 cells)
+  void setPixelBudget(uint16_t px) { budgetPx = px; }
+
+  // Advance square timers and queue dirty cells for the squares that moved
+  void update(CA_Render& r, uint32_t now);
+
+  // Blend the squares that cover scanline y into the current line buffer
+  // (x0,w is the horizontal span held by the buffer)
+  inline void applyLine(int16_t y, int16_t x0, int16_t w, const uint16_t* bgPal) const {
+    if ((uint16_t)(y - bandY0) >= bandH) return;
+    applyLineSlow(y, x0, w, bgPal);
+  }
+
+  int16_t bandTop() const { return bandY0; }
+  uint8_t bandHeight() const { return (uint8_t)bandH; }
+
+  // What applyLine() draws (live squares), for render logs: saveState() fills
+  // up to STATE_BYTES and returns the count, loadState() puts it back
+  static const uint8_t STATE_BYTES = 1 + MAX_SQ * 4;
+  uint8_t saveState(uint8_t* out) const;
+  void    loadState(const uint8_t* in, uint8_t n);
+
+private:
+  static const uint8_t HIDDEN = 0xFF;  // row value of a square that is not on screen
+
+  struct Square {
+    int16_t  x;        // even screen x
+    uint8_t  row;      // row in 2× units inside the band, HIDDEN if not drawn
+    uint8_t  palIdx;   // BG palette index used as shimmer color
+    uint16_t due;      // low 16 bits of millis() when this square moves next
+  };
+
+  Square   sq[MAX_SQ];
+  uint8_t  sqN = 0;          // live squares
+  uint8_t  sqShown = 0;      // slots that may still be on screen (>= sqN until erased)
+  uint8_t  blue[MAX_BLUE];
+  uint8_t  blueN = 0;
+  int16_t  bandY0 = 0;
+  uint16_t bandH = 0;        // 0 disables the effect
+  uint8_t  rows2x = 0;
+  int16_t  bandX0 = 0, bandW = 320;   // columns over the BG picture
+  uint16_t budgetPx = 32;
+  bool     needFullPaint = false;
+  uint32_t rng = 0xBADC0FFE;
+
+  uint16_t rnd(){ rng ^= rng << 7; rng ^= rng >> 9; rng ^= rng << 8; return (uint16_t)rng; }
+  void     respawn(Square& s, uint16_t now16);
+  void     markCell(CA_Render& r, const Square& s) const;
+  void     applyLineSlow(int16_t y, int16_t x0, int16_t w, const uint16_t* bgPal) const;
+};
+
+#endif
@@ -0,0 +1,423 @@
+#ifndef ANGLER_H_
+#define ANGLER_H_
+
+#include <Arduino.h>
+
+// Generated by tools/ca_assetc.cpp (4bpp, idx0 transparent)
+//  ca_assetc -nocrop -merge -delta -o CastAway/assets/ANGLER.h CastAway/assets/ANGLER.h:MAN1 CastAway/assets/ANGLER.h:MAN2 CastAway/assets/ANGLER.h:MAN3 CastAway/assets/ANGLER.h:MAN4 CastAway/assets/ANGLER.h:MAN5 CastAway/assets/ANGLER.h:MAN6 CastAway/assets/ANGLER.h:FISHINGROD1 CastAway/assets/ANGLER.h:FISHINGROD2 CastAway/assets/ANGLER.h:FISHINGROD3 CastAway/assets/ANGLER.h:FISHINGROD4 CastAway/assets/ANGLER.h:FISHINGROD5 CastAway/assets/ANGLER.h:FISHINGROD6 CastAway/assets/ANGLER.h:FISHINGROD7
+
+const uint16_t ANGLER_pal565[16] PROGMEM = {
+  0x0000, 0xDD0C, 0xDB84, 0xDAAC, 0x8AA7, 0x61C6, 0x31E7, 0xA986, 0x4147, 0x2106, 0xCEDF, 0x64DF, 0x5244, 0x0000, 0x0000, 0x0000
+};
+
+const uint16_t MAN1_W = 16;
+const uint16_t MAN1_H = 23;
+const uint8_t MAN1_KEY = 0;
+#define MAN1_pal565 ANGLER_pal565
+#define MAN1_delta nullptr   // keyframe
+
+const uint8_t MAN1_data[184] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x90, 0x00, 0x00,
+  0x00, 0x09, 0x22, 0x22, 0x22, 0x49, 0x00, 0x00, 0x00, 0x09, 0x42, 0x22, 0x24, 0x49, 0x00, 0x00,
+  0x00, 0x94, 0x44, 0x44, 0x45, 0x79, 0x00, 0x00, 0x09, 0x22, 0x22, 0x22, 0x24, 0x44, 0x99, 0x00,
+  0x09, 0x99, 0x99, 0x99, 0x92, 0x22, 0x22, 0x90, 0x00, 0x93, 0x93, 0x23, 0x59, 0x99, 0x99, 0x90,
+  0x09, 0x21, 0x22, 0x22, 0x59, 0x29, 0x00, 0x00, 0x09, 0x95, 0x52, 0x55, 0x58, 0x99, 0x00, 0x00,
+  0x00, 0x95, 0x55, 0x55, 0x89, 0x77, 0x99, 0x00, 0x00, 0x98, 0x88, 0x88, 0x97, 0x77, 0x78, 0x90,
+  0x00, 0x98, 0x88, 0x88, 0x97, 0x77, 0x78, 0x90, 0x00, 0x09, 0x99, 0x99, 0x77, 0x77, 0x78, 0x90,
+  0x00, 0x09, 0x77, 0x77, 0x79, 0x77, 0x78, 0x90, 0x00, 0x08, 0x77, 0x77, 0x97, 0x77, 0x78, 0x90,
+  0x09, 0x22, 0x27, 0x59, 0x22, 0x49, 0x78, 0x90, 0x09, 0x22, 0x54, 0x42, 0x24, 0x97, 0x78, 0x90,
+  0x09, 0x96, 0x69, 0x99, 0x99, 0x99, 0x99, 0x00, 0x09, 0x96, 0x66, 0x66, 0x66, 0x69, 0x90, 0x00,
+  0x09, 0x96, 0x69, 0x99, 0x99, 0x99, 0x90, 0x00, 0x98, 0x95, 0x89, 0x90, 0x00, 0x09, 0x90, 0x00,
+  0x99, 0x55, 0x89, 0x90, 0x00, 0x09, 0x90, 0x00
+};
+
+const uint16_t MAN2_W = 16;
+const uint16_t MAN2_H = 23;
+const uint8_t MAN2_KEY = 0;
+#define MAN2_pal565 ANGLER_pal565
+#define MAN2_delta nullptr   // keyframe
+
+const uint8_t MAN2_data[184] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x92, 0x22, 0x22, 0x24, 0x90, 0x00,
+  0x00, 0x00, 0x94, 0x22, 0x22, 0x44, 0x90, 0x00, 0x00, 0x09, 0x44, 0x44, 0x44, 0x57, 0x90, 0x00,
+  0x00, 0x92, 0x22, 0x22, 0x22, 0x44, 0x49, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x22, 0x22, 0x29,
+  0x00, 0x09, 0x39, 0x32, 0x35, 0x99, 0x99, 0x90, 0x00, 0x92, 0x12, 0x22, 0x25, 0x92, 0x90, 0x00,
+  0x00, 0x99, 0x55, 0x25, 0x55, 0x89, 0x99, 0x00, 0x00, 0x09, 0x55, 0x55, 0x58, 0x97, 0x78, 0x90,
+  0x00, 0x09, 0x88, 0x88, 0x89, 0x77, 0x78, 0x90, 0x00, 0x09, 0x88, 0x88, 0x89, 0x77, 0x78, 0x90,
+  0x00, 0x00, 0x99, 0x99, 0x99, 0x77, 0x78, 0x90, 0x00, 0x08, 0x77, 0x77, 0x97, 0x77, 0x78, 0x90,
+  0x09, 0x22, 0x27, 0x59, 0x22, 0x49, 0x78, 0x90, 0x09, 0x22, 0x54, 0x42, 0x24, 0x97, 0x78, 0x90,
+  0x09, 0x96, 0x69, 0x99, 0x99, 0x99, 0x99, 0x00, 0x09, 0x96, 0x66, 0x66, 0x66, 0x69, 0x90, 0x00,
+  0x09, 0x96, 0x69, 0x99, 0x99, 0x99, 0x90, 0x00, 0x98, 0x95, 0x89, 0x90, 0x00, 0x09, 0x90, 0x00,
+  0x99, 0x55, 0x89, 0x90, 0x00, 0x09, 0x90, 0x00
+};
+
+const uint16_t MAN3_W = 16;
+const uint16_t MAN3_H = 23;
+const uint8_t MAN3_KEY = 0;
+#define MAN3_pal565 ANGLER_pal565
+#define MAN3_data MAN1_data
+
+const uint8_t MAN3_delta[4] PROGMEM = {   // against MAN1
+  0x00, 0x00, 0x00, 0x00
+};
+
+const uint16_t MAN4_W = 16;
+const uint16_t MAN4_H = 23;
+const uint8_t MAN4_KEY = 0;
+#define MAN4_pal565 ANGLER_pal565
+#define MAN4_data MAN1_data
+
+const uint8_t MAN4_delta[37] PROGMEM = {   // against MAN1
+  0x0E, 0x05, 0x02, 0x0B, 0x04, 0x06, 0x00, 0x00, 0x01, 0x05, 0x02, 0x00, 0x02, 0x04, 0x06, 0x00,
+  0x01, 0x04, 0x08, 0x00, 0x02, 0x04, 0x0B, 0x00, 0x77, 0x97, 0x22, 0x22, 0x75, 0x79, 0x54, 0x49,
+  0x96, 0x69, 0x92, 0x66, 0x69
+};
+
+const uint16_t MAN5_W = 16;
+const uint16_t MAN5_H = 23;
+const uint8_t MAN5_KEY = 0;
+#define MAN5_pal565 ANGLER_pal565
+#define MAN5_data MAN1_data
+
+const uint8_t MAN5_delta[9] PROGMEM = {   // against MAN1
+  0x0F, 0x01, 0x02, 0x03, 0x01, 0x02, 0x00, 0x00, 0x28
+};
+
+const uint16_t MAN6_W = 16;
+const uint16_t MAN6_H = 23;
+const uint8_t MAN6_KEY = 0;
+#define MAN6_pal565 ANGLER_pal565
+#define MAN6_data MAN1_data
+
+const uint8_t MAN6_delta[49] PROGMEM = {   // against MAN1
+  0x07, 0x09, 0x02, 0x07, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00,
+  0x01, 0x04, 0x02, 0x00, 0x01, 0x04, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x01, 0x02, 0x08, 0x00, 0x22, 0x59, 0x99, 0x99, 0x95, 0x99, 0x99, 0x98,
+  0x28
+};
+
+const uint16_t FISHINGROD1_W = 53;
+const uint16_t FISHINGROD1_H = 55;
+const uint8_t FISHINGROD1_KEY = 0;
+#define FISHINGROD1_pal565 ANGLER_pal565
+#define FISHINGROD1_delta nullptr   // keyframe
+
+const uint8_t FISHINGROD1_data[1485] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x99, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0xAA, 0x00, 0x00, 0x99, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0xAA, 0x00,
+  0x00, 0x00, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0xAA, 0x00, 0x00, 0x00, 0x99, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA0, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0x00, 0x09, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x09, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAA, 0xAA, 0xA9, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
+  0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x09, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xA0, 0x09, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x99, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x09, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xA0, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0x09, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x99, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAA, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xBB, 0xBB, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const uint16_t FISHINGROD2_W = 53;
+const uint16_t FISHINGROD2_H = 55;
+const uint8_t FISHINGROD2_KEY = 0;
+#define FISHINGROD2_pal565 ANGLER_pal565
+#define FISHINGROD2_data FISHINGROD1_data
+
+const uint8_t FISHINGROD2_delta[207] PROGMEM = {   // against FISHINGROD1
+  0x0E, 0x28, 0x0A, 0x10, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x07, 0x08, 0x01, 0x00, 0x07, 0x08, 0x02, 0x00, 0x07, 0x08, 0x03, 0x00,
+  0x07, 0x08, 0x04, 0x00, 0x07, 0x08, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x08, 0x06, 0x00, 0x06, 0x08, 0x08, 0x00,
+  0x06, 0x08, 0x0A, 0x00, 0x06, 0x08, 0x0C, 0x00, 0x06, 0x08, 0x0E, 0x00, 0x06, 0x08, 0x10, 0x00,
+  0x06, 0x08, 0x12, 0x00, 0x06, 0x08, 0x14, 0x00, 0x06, 0x08, 0x16, 0x00, 0x06, 0x07, 0x18, 0x00,
+  0x06, 0x07, 0x19, 0x00, 0x06, 0x07, 0x1A, 0x00, 0x06, 0x07, 0x1B, 0x00, 0x06, 0x07, 0x1C, 0x00,
+  0x06, 0x07, 0x1D, 0x00, 0x06, 0x07, 0x1E, 0x00, 0x05, 0x07, 0x1F, 0x00, 0x05, 0x07, 0x21, 0x00,
+  0x05, 0x07, 0x23, 0x00, 0x05, 0x07, 0x25, 0x00, 0x05, 0x06, 0x27, 0x00, 0x05, 0x06, 0x28, 0x00,
+  0x05, 0x07, 0x29, 0x00, 0x00, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
+  0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xA0, 0xA0, 0xA0, 0xA0,
+  0xA0, 0xA0, 0xA0, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xA0, 0xA0, 0xB0, 0xB0
+};
+
+const uint16_t FISHINGROD3_W = 53;
+const uint16_t FISHINGROD3_H = 55;
+const uint8_t FISHINGROD3_KEY = 0;
+#define FISHINGROD3_pal565 ANGLER_pal565
+#define FISHINGROD3_data FISHINGROD1_data
+
+const uint8_t FISHINGROD3_delta[4] PROGMEM = {   // against FISHINGROD1
+  0x00, 0x00, 0x00, 0x00
+};
+
+const uint16_t FISHINGROD4_W = 53;
+const uint16_t FISHINGROD4_H = 55;
+const uint8_t FISHINGROD4_KEY = 0;
+#define FISHINGROD4_pal565 ANGLER_pal565
+#define FISHINGROD4_data FISHINGROD1_data
+
+const uint8_t FISHINGROD4_delta[339] PROGMEM = {   // against FISHINGROD1
+  0x0D, 0x2A, 0x05, 0x28, 0x08, 0x0C, 0x00, 0x00, 0x07, 0x0E, 0x04, 0x00, 0x07, 0x0E, 0x0B, 0x00,
+  0x07, 0x0D, 0x12, 0x00, 0x08, 0x0F, 0x18, 0x00, 0x07, 0x10, 0x1F, 0x00, 0x07, 0x10, 0x28, 0x00,
+  0x07, 0x11, 0x31, 0x00, 0x07, 0x12, 0x3B, 0x00, 0x07, 0x13, 0x46, 0x00, 0x07, 0x13, 0x52, 0x00,
+  0x07, 0x13, 0x5E, 0x00, 0x07, 0x14, 0x6A, 0x00, 0x07, 0x14, 0x77, 0x00, 0x13, 0x14, 0x84, 0x00,
+  0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00,
+  0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x06, 0x08, 0x85, 0x00, 0x06, 0x08, 0x87, 0x00,
+  0x06, 0x08, 0x89, 0x00, 0x06, 0x08, 0x8B, 0x00, 0x06, 0x08, 0x8D, 0x00, 0x06, 0x08, 0x8F, 0x00,
+  0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x91, 0x00, 0x06, 0x07, 0x91, 0x00,
+  0x06, 0x07, 0x92, 0x00, 0x06, 0x07, 0x93, 0x00, 0x06, 0x07, 0x94, 0x00, 0x00, 0x00, 0x95, 0x00,
+  0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 0x00, 0x05, 0x09, 0x95, 0x00,
+  0x02, 0x0B, 0x99, 0x00, 0x05, 0x09, 0xA2, 0x00, 0x05, 0x06, 0xA6, 0x00, 0x00, 0x00, 0x99, 0x99,
+  0x00, 0x00, 0x99, 0x9A, 0xA9, 0x99, 0x99, 0x00, 0x99, 0x90, 0xAA, 0xAA, 0x00, 0x09, 0x09, 0x90,
+  0x0A, 0xA0, 0x0A, 0xA0, 0xAA, 0xA0, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xA0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xA0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x09, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xA0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xA0, 0xA0, 0xA0,
+  0xA0, 0x00, 0xA0, 0x00, 0xB0, 0x0B, 0x00, 0x0B, 0x00, 0xA0, 0xB0, 0x00, 0x00, 0xB0, 0xB0, 0xB0,
+  0xB0, 0xB0, 0x0B
+};
+
+const uint16_t FISHINGROD5_W = 53;
+const uint16_t FISHINGROD5_H = 55;
+const uint8_t FISHINGROD5_KEY = 0;
+#define FISHINGROD5_pal565 ANGLER_pal565
+#define FISHINGROD5_data FISHINGROD1_data
+
+const uint8_t FISHINGROD5_delta[605] PROGMEM = {   // against FISHINGROD1
+  0x0B, 0x2B, 0x04, 0x34, 0x0B, 0x0D, 0x00, 0x00, 0x0A, 0x0E, 0x02, 0x00, 0x08, 0x0F, 0x06, 0x00,
+  0x07, 0x10, 0x0D, 0x00, 0x07, 0x10, 0x16, 0x00, 0x07, 0x11, 0x1F, 0x00, 0x07, 0x12, 0x29, 0x00,
+  0x07, 0x12, 0x34, 0x00, 0x0E, 0x13, 0x3F, 0x00, 0x0E, 0x13, 0x44, 0x00, 0x0F, 0x14, 0x49, 0x00,
+  0x10, 0x14, 0x4E, 0x00, 0x07, 0x15, 0x52, 0x00, 0x07, 0x15, 0x60, 0x00, 0x07, 0x16, 0x6E, 0x00,
+  0x07, 0x16, 0x7D, 0x00, 0x06, 0x17, 0x8C, 0x00, 0x06, 0x17, 0x9D, 0x00, 0x06, 0x18, 0xAE, 0x00,
+  0x06, 0x18, 0xC0, 0x00, 0x06, 0x18, 0xD2, 0x00, 0x06, 0x17, 0xE4, 0x00, 0x06, 0x18, 0xF5, 0x00,
+  0x06, 0x19, 0x07, 0x01, 0x06, 0x1A, 0x1A, 0x01, 0x05, 0x1A, 0x2E, 0x01, 0x05, 0x1A, 0x43, 0x01,
+  0x05, 0x19, 0x58, 0x01, 0x05, 0x19, 0x6C, 0x01, 0x05, 0x07, 0x80, 0x01, 0x05, 0x07, 0x82, 0x01,
+  0x05, 0x07, 0x84, 0x01, 0x05, 0x07, 0x86, 0x01, 0x05, 0x07, 0x88, 0x01, 0x04, 0x07, 0x8A, 0x01,
+  0x04, 0x07, 0x8D, 0x01, 0x04, 0x07, 0x90, 0x01, 0x03, 0x07, 0x93, 0x01, 0x02, 0x08, 0x97, 0x01,
+  0x02, 0x07, 0x9D, 0x01, 0x03, 0x06, 0xA2, 0x01, 0x02, 0x06, 0xA5, 0x01, 0x04, 0x08, 0xA9, 0x01,
+  0x99, 0x99, 0x99, 0x9A, 0xA9, 0x99, 0x00, 0x99, 0x90, 0xAA, 0xAA, 0xAA, 0x99, 0x00, 0x09, 0x90,
+  0xAA, 0xA0, 0x0A, 0xA0, 0x09, 0x90, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x00, 0x0A, 0xA0, 0x99, 0x00,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA9, 0x90, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0x99, 0x90, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x09, 0x99, 0x00,
+  0x00, 0xA0, 0x99, 0x90, 0x00, 0x00, 0x0A, 0xA0, 0x99, 0x00, 0x00, 0x0A, 0x09, 0x90, 0x00, 0x00,
+  0xA0, 0x99, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x90,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x99, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x09, 0x90, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x99, 0x0A, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x09, 0x90, 0x0A, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x99, 0x0A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x09, 0x90,
+  0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xA0, 0x99, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0x09, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x99, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x99, 0x00, 0x0A, 0xA0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xA9, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x90, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x0A, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99,
+  0x0A, 0x00, 0xAA, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x0A, 0x00, 0x00,
+  0x0A, 0x00, 0x00, 0xB0, 0x0A, 0x00, 0x00, 0xB0, 0x00, 0xA0, 0x00, 0x00, 0xB0, 0xB0, 0x0B, 0xA0,
+  0x00, 0xBB, 0xBB, 0xBB, 0xB0, 0x0B, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const uint16_t FISHINGROD6_W = 53;
+const uint16_t FISHINGROD6_H = 55;
+const uint8_t FISHINGROD6_KEY = 0;
+#define FISHINGROD6_pal565 ANGLER_pal565
+#define FISHINGROD6_data FISHINGROD1_data
+
+const uint8_t FISHINGROD6_delta[647] PROGMEM = {   // against FISHINGROD1
+  0x05, 0x31, 0x06, 0x34, 0x0E, 0x0F, 0x00, 0x00, 0x0D, 0x11, 0x01, 0x00, 0x0C, 0x12, 0x05, 0x00,
+  0x0C, 0x12, 0x0B, 0x00, 0x0B, 0x13, 0x11, 0x00, 0x0B, 0x13, 0x19, 0x00, 0x0B, 0x13, 0x21, 0x00,
+  0x0B, 0x14, 0x29, 0x00, 0x08, 0x14, 0x32, 0x00, 0x07, 0x15, 0x3E, 0x00, 0x07, 0x15, 0x4C, 0x00,
+  0x07, 0x15, 0x5A, 0x00, 0x07, 0x16, 0x68, 0x00, 0x07, 0x16, 0x77, 0x00, 0x07, 0x16, 0x86, 0x00,
+  0x07, 0x16, 0x95, 0x00, 0x07, 0x17, 0xA4, 0x00, 0x07, 0x17, 0xB4, 0x00, 0x07, 0x18, 0xC4, 0x00,
+  0x07, 0x18, 0xD5, 0x00, 0x07, 0x18, 0xE6, 0x00, 0x07, 0x19, 0xF7, 0x00, 0x07, 0x19, 0x09, 0x01,
+  0x07, 0x19, 0x1B, 0x01, 0x07, 0x19, 0x2D, 0x01, 0x07, 0x19, 0x3F, 0x01, 0x07, 0x1A, 0x51, 0x01,
+  0x07, 0x1A, 0x64, 0x01, 0x07, 0x1A, 0x77, 0x01, 0x07, 0x18, 0x8A, 0x01, 0x07, 0x08, 0x9B, 0x01,
+  0x00, 0x00, 0x9C, 0x01, 0x00, 0x00, 0x9C, 0x01, 0x18, 0x1A, 0x9C, 0x01, 0x06, 0x08, 0x9E, 0x01,
+  0x00, 0x00, 0xA0, 0x01, 0x00, 0x00, 0xA0, 0x01, 0x00, 0x00, 0xA0, 0x01, 0x06, 0x07, 0xA0, 0x01,
+  0x06, 0x07, 0xA1, 0x01, 0x06, 0x07, 0xA2, 0x01, 0x05, 0x07, 0xA3, 0x01, 0x05, 0x07, 0xA5, 0x01,
+  0x04, 0x07, 0xA7, 0x01, 0x03, 0x09, 0xAA, 0x01, 0x03, 0x08, 0xB0, 0x01, 0x04, 0x07, 0xB5, 0x01,
+  0x03, 0x06, 0xB8, 0x01, 0x04, 0x08, 0xBB, 0x01, 0x09, 0x09, 0x99, 0x99, 0x90, 0x09, 0x99, 0x09,
+  0x00, 0x99, 0x90, 0x99, 0x0A, 0xAA, 0xAA, 0xA0, 0x99, 0x0A, 0xAA, 0xA0, 0x00, 0x00, 0xA0, 0x09,
+  0x90, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x90, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0x99, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x90, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0x99, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xA9, 0x90, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xA0, 0x90, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x99,
+  0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x09, 0x90, 0x00,
+  0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x99, 0x00, 0x00,
+  0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x99, 0x00, 0x00, 0x00,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x00, 0x00, 0x0A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x90, 0x00, 0x00, 0x0A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x99, 0x00, 0x00, 0x0A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x90, 0x00, 0x00, 0xA0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x99, 0x00,
+  0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x09,
+  0x90, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xA0, 0x90, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0x09, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x90, 0x00, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x99, 0x0A,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xA9, 0x99, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0x99, 0x00, 0x0A, 0x00, 0xA0, 0xA0, 0xA0, 0x0A, 0x00, 0x0A, 0x00, 0xB0,
+  0x0A, 0x00, 0xB0, 0x00, 0xA0, 0x00, 0x00, 0xB0, 0xB0, 0x0B, 0xA0, 0x00, 0xBB, 0xBB, 0xBB, 0xB0,
+  0x0B, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00
+};
+
+const uint16_t FISHINGROD7_W = 53;
+const uint16_t FISHINGROD7_H = 55;
+const uint8_t FISHINGROD7_KEY = 0;
+#define FISHINGROD7_pal565 ANGLER_pal565
+#define FISHINGROD7_data FISHINGROD1_data
+
+const uint8_t FISHINGROD7_delta[828] PROGMEM = {   // against FISHINGROD1
+  0x01, 0x35, 0x02, 0x34, 0x12, 0x13, 0x00, 0x00, 0x11, 0x15, 0x01, 0x00, 0x11, 0x16, 0x05, 0x00,
+  0x11, 0x16, 0x0A, 0x00, 0x10, 0x17, 0x0F, 0x00, 0x10, 0x17, 0x16, 0x00, 0x10, 0x17, 0x1D, 0x00,
+  0x0F, 0x17, 0x24, 0x00, 0x0F, 0x17, 0x2C, 0x00, 0x0F, 0x17, 0x34, 0x00, 0x0F, 0x18, 0x3C, 0x00,
+  0x0E, 0x18, 0x45, 0x00, 0x08, 0x18, 0x4F, 0x00, 0x07, 0x18, 0x5F, 0x00, 0x07, 0x18, 0x70, 0x00,
+  0x07, 0x18, 0x81, 0x00, 0x07, 0x18, 0x92, 0x00, 0x07, 0x18, 0xA3, 0x00, 0x07, 0x19, 0xB4, 0x00,
+  0x07, 0x19, 0xC6, 0x00, 0x07, 0x19, 0xD8, 0x00, 0x07, 0x19, 0xEA, 0x00, 0x07, 0x19, 0xFC, 0x00,
+  0x07, 0x19, 0x0E, 0x01, 0x07, 0x19, 0x20, 0x01, 0x07, 0x1A, 0x32, 0x01, 0x07, 0x1A, 0x45, 0x01,
+  0x07, 0x1A, 0x58, 0x01, 0x07, 0x1A, 0x6B, 0x01, 0x07, 0x1A, 0x7E, 0x01, 0x07, 0x1A, 0x91, 0x01,
+  0x07, 0x1A, 0xA4, 0x01, 0x07, 0x1A, 0xB7, 0x01, 0x07, 0x1A, 0xCA, 0x01, 0x07, 0x1A, 0xDD, 0x01,
+  0x07, 0x1A, 0xF0, 0x01, 0x07, 0x1A, 0x03, 0x02, 0x07, 0x1A, 0x16, 0x02, 0x07, 0x19, 0x29, 0x02,
+  0x06, 0x08, 0x3B, 0x02, 0x06, 0x08, 0x3D, 0x02, 0x06, 0x08, 0x3F, 0x02, 0x06, 0x08, 0x41, 0x02,
+  0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x43, 0x02, 0x06, 0x07, 0x43, 0x02, 0x00, 0x00, 0x44, 0x02,
+  0x04, 0x07, 0x44, 0x02, 0x05, 0x07, 0x47, 0x02, 0x01, 0x0A, 0x49, 0x02, 0x04, 0x09, 0x52, 0x02,
+  0x01, 0x07, 0x57, 0x02, 0x01, 0x08, 0x5D, 0x02, 0x09, 0x09, 0x99, 0x99, 0x90, 0x99, 0xAA, 0xA9,
+  0x99, 0x90, 0xAA, 0x00, 0x0A, 0xAA, 0x99, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x90, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0xA9, 0x90, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x0A, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x99, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xA9, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x90, 0x0A, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x99,
+  0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x90, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x99, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x0A, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00,
+  0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0x90, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x09, 0x00, 0x0A, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0xA0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99,
+  0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0xA0, 0x00, 0xA0, 0xA0, 0xB0, 0x0A, 0x00, 0x0A,
+  0xBB, 0x0B, 0x00, 0xB0, 0x0B, 0xA0, 0xB0, 0xB0, 0x00, 0xB0, 0xB0, 0xBB, 0x0B, 0x00, 0xB0, 0xBB,
+  0x00, 0x0B, 0xBB, 0x00, 0x0B, 0x0B, 0xB0, 0x00, 0xB0, 0x0B, 0x00, 0x00
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef BG8_CYCLE_H_
+#define BG8_CYCLE_H_
+
+#include <Arduino.h>
+
+// Generated by tools/ca_assetc.cpp (palette-cycle span map of BACKGROUND; CA_PalCycle)
+//  ca_assetc -bg -cycle 191,172,173,196,198 -set BG8_CYCLE -o CastAway/assets/BG_CYCLE.h CastAway/assets/BACKGROUND.h
+// Cycled BG8 indices, in ring order: each step every entry takes the color
+// of the next one. Spans list the 160x120 source pixels that use any of them,
+// as { row, x0, len }, sorted by row then x. Runs closer than 3 px are merged
+const uint8_t BG8_CYC_N = 5;
+const uint8_t BG8_cyc_idx[BG8_CYC_N] PROGMEM = { 191, 172, 173, 196, 198 };
+
+const uint16_t BG8_CYC_SPANS = 129;   // 428 source px
+const uint8_t BG8_cyc_span[BG8_CYC_SPANS][3] PROGMEM = {
+  { 86, 20, 5}, { 86, 34, 4}, { 86, 42,14}, { 86, 81, 7}, { 86,113,10}, { 86,134, 6},
+  { 87, 24, 2}, { 87, 30,14}, { 87, 50, 6}, { 87, 66, 1}, { 87, 80, 2}, { 87, 87, 2},
+  { 87, 97, 1}, { 87,102, 1}, { 87,109, 5}, { 87,119, 4}, { 87,126, 1}, { 87,131, 1},
+  { 88, 24, 1}, { 88, 37, 7}, { 88, 49, 8}, { 88, 64, 1}, { 88, 73, 1}, { 88, 82, 1},
+  { 88, 87, 1}, { 88,109, 1}, { 88,119, 9}, { 88,136, 1}, { 89, 32, 1}, { 89, 40, 5},
+  { 89, 51, 6}, { 89, 64, 4}, { 89,118, 9}, { 89,130, 1}, { 90, 29, 1}, { 90, 34, 1},
+  { 90, 39, 9}, { 90, 52, 2}, { 90, 57, 1}, { 90, 70, 1}, { 90, 75, 1}, { 90,116, 8},
+  { 90,129, 3}, { 91, 42, 1}, { 91, 47, 1}, { 91, 51, 3}, { 91, 57, 1}, { 91, 63, 1},
+  { 91, 68, 1}, { 91, 80, 1}, { 91,116, 5}, { 92, 39, 1}, { 92, 45, 1}, { 92, 53, 5},
+  { 92, 80, 1}, { 92,111, 3}, { 92,118, 1}, { 92,126, 1}, { 93, 39, 1}, { 93, 43, 2},
+  { 93, 51, 3}, { 93, 57, 2}, { 93, 63, 4}, { 93,111, 7}, { 94, 44, 2}, { 94, 51, 7},
+  { 94, 68, 1}, { 94, 75, 1}, { 94, 85, 1}, { 94,111, 4}, { 95, 43, 2}, { 95, 48, 1},
+  { 95, 59, 3}, { 95,108, 7}, { 96, 46, 1}, { 96, 54, 2}, { 96, 60, 4}, { 96,108, 1},
+  { 96,112, 1}, { 97, 54,11}, { 97,107, 5}, { 98, 51,11}, { 98, 67, 1}, { 98, 87, 1},
+  { 98, 92, 1}, { 99, 48, 5}, { 99, 56,12}, { 99, 73, 1}, { 99,106, 1}, { 99,115, 1},
+  {100, 47, 8}, {100, 58, 6}, {100, 98, 1}, {100,104, 5}, {101, 51, 7}, {101, 61, 6},
+  {101, 98, 1}, {101,103, 1}, {102, 57, 1}, {102, 61, 5}, {102, 80, 1}, {102, 92, 1},
+  {102,101, 6}, {103, 60, 1}, {103, 64, 3}, {103, 98, 6}, {104, 70, 1}, {104, 94, 1},
+  {105, 65, 8}, {105, 80, 1}, {105, 84, 1}, {105, 92, 1}, {105, 96, 5}, {106, 68, 2},
+  {106, 73, 2}, {106, 83, 4}, {106, 93, 6}, {107, 70, 1}, {107, 74, 5}, {107, 82, 1},
+  {107, 87, 5}, {107, 95, 3}, {108, 73, 1}, {108, 77, 1}, {108, 85, 8}, {109, 86, 3},
+  {110, 83, 1}, {111, 83, 3}, {117, 91, 1},
+};
+
+#endif
@@ -0,0 +1,1131 @@
+#ifndef BG_RLE_H_
+#define BG_RLE_H_
+
+#include <Arduino.h>
+
+// Generated by tools/ca_assetc.cpp (8bpp row RLE of BACKGROUND; CA_BG_RLE)
+//  ca_assetc -bg -o CastAway/assets/BG_RLE.h CastAway/assets/BACKGROUND.h
+// BG8_W x BG8_H and BG8_pal565 are in the source header
+
+const uint16_t BG8_rle_row[121] PROGMEM = {
+  0, 122, 236, 361, 481, 606, 721, 835, 958, 1092, 1222, 1359, 1498, 1634, 1766, 1897,
+  2038, 2191, 2341, 2498, 2654, 2801, 2956, 3109, 3270, 3429, 3589, 3751, 3906, 4058, 4218, 4379,
+  4536, 4690, 4849, 5007, 5167, 5329, 5490, 5650, 5810, 5968, 6124, 6283, 6441, 6602, 6759, 6914,
+  7063, 7219, 7372, 7519, 7668, 7816, 7971, 8130, 8290, 8447, 8606, 8755, 8910, 9063, 9224, 9374,
+  9528, 9685, 9841, 9992, 10152, 10307, 10461, 10611, 10768, 10919, 11077, 11233, 11388, 11541, 11697, 11842,
+  11965, 12110, 12241, 12372, 12493, 12619, 12704, 12838, 12980, 13123, 13250, 13404, 13541, 13680, 13821, 13966,
+  14116, 14264, 14403, 14555, 14705, 14852, 14998, 15144, 15296, 15449, 15607, 15764, 15903, 16049, 16204, 16354,
+  16510, 16664, 16816, 16969, 17105, 17245, 17392, 17549, 17702
+};
+
+const uint8_t BG8_rle[17702] PROGMEM = {
+  0x0C, 0x35, 0x3B, 0x35, 0x41, 0x33, 0x35, 0x41, 0x41, 0x35, 0x33, 0x35, 0x35, 0x38, 0x8B, 0x35,
+  0x23, 0x38, 0x35, 0x35, 0x33, 0x3A, 0x38, 0x38, 0x35, 0x38, 0x41, 0x41, 0x38, 0x3B, 0x35, 0x38,
+  0x35, 0x38, 0x35, 0x35, 0x38, 0x38, 0x35, 0x41, 0x41, 0x35, 0x38, 0x38, 0x2F, 0x3F, 0x38, 0x41,
+  0x41, 0x3A, 0x38, 0x35, 0x41, 0x80, 0x38, 0x04, 0x35, 0x35, 0x38, 0x2F, 0x2F, 0x82, 0x38, 0x06,
+  0x3B, 0x38, 0x41, 0x38, 0x38, 0x41, 0x3B, 0x80, 0x38, 0x00, 0x3B, 0x80, 0x38, 0x02, 0x30, 0x41,
+  0x30, 0x83, 0x38, 0x04, 0x35, 0x35, 0x38, 0x35, 0x30, 0x8A, 0x38, 0x01, 0x3A, 0x35, 0x80, 0x38,
+  0x84, 0x35, 0x00, 0x38, 0x86, 0x35, 0x02, 0x38, 0x2E, 0x2F, 0x81, 0x35, 0x04, 0x2F, 0x38, 0x35,
+  0x35, 0x2F, 0x80, 0x35, 0x02, 0x38, 0x33, 0x2F, 0x80, 0x35, 0x0C, 0x35, 0x41, 0x3F, 0x3F, 0x38,
+  0x35, 0x33, 0x35, 0x35, 0x3F, 0x35, 0x41, 0x3B, 0x80, 0x35, 0x04, 0x2F, 0x35, 0x33, 0x33, 0x41,
+  0x83, 0x35, 0x00, 0x38, 0x82, 0x35, 0x00, 0x3F, 0x80, 0x35, 0x83, 0x38, 0x05, 0x30, 0x33, 0x35,
+  0x35, 0x38, 0x33, 0x80, 0x35, 0x01, 0x38, 0x38, 0x81, 0x35, 0x0A, 0x38, 0x38, 0x30, 0x38, 0x35,
+  0x35, 0x38, 0x38, 0x35, 0x35, 0x2F, 0x87, 0x38, 0x04, 0x2F, 0x2F, 0x38, 0x38, 0x30, 0x83, 0x38,
+  0x00, 0x30, 0x82, 0x38, 0x00, 0x3B, 0x81, 0x38, 0x03, 0x2F, 0x38, 0x35, 0x30, 0x88, 0x38, 0x01,
+  0x30, 0x35, 0x81, 0x38, 0x00, 0x35, 0x80, 0x38, 0x04, 0x35, 0x38, 0x3B, 0x38, 0x33, 0x8B, 0x35,
+  0x04, 0x2F, 0x35, 0x38, 0x35, 0x33, 0x81, 0x35, 0x00, 0x30, 0x82, 0x35, 0x04, 0x35, 0x41, 0x3B,
+  0x41, 0x41, 0x81, 0x35, 0x00, 0x3F, 0x82, 0x35, 0x00, 0x41, 0x84, 0x35, 0x12, 0x41, 0x35, 0x41,
+  0x35, 0x35, 0x38, 0x35, 0x35, 0x3A, 0x3B, 0x35, 0x38, 0x35, 0x38, 0x3B, 0x38, 0x35, 0x35, 0x41,
+  0x80, 0x35, 0x01, 0x38, 0x38, 0x82, 0x35, 0x0D, 0x3F, 0x35, 0x33, 0x33, 0x41, 0x35, 0x35, 0x38,
+  0x41, 0x35, 0x38, 0x41, 0x38, 0x30, 0x85, 0x38, 0x00, 0x3B, 0x82, 0x38, 0x00, 0x3B, 0x81, 0x38,
+  0x00, 0x30, 0x85, 0x38, 0x0C, 0x35, 0x2F, 0x2F, 0x3B, 0x38, 0x2F, 0x35, 0x30, 0x3A, 0x38, 0x38,
+  0x30, 0x35, 0x81, 0x38, 0x0A, 0x30, 0x3B, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x38, 0x3A, 0x38,
+  0x81, 0x35, 0x00, 0x43, 0x80, 0x35, 0x02, 0x33, 0x2F, 0x3F, 0x83, 0x35, 0x03, 0x3B, 0x35, 0x35,
+  0x33, 0x88, 0x35, 0x00, 0x33, 0x81, 0x35, 0x00, 0x38, 0x81, 0x41, 0x80, 0x35, 0x02, 0x3F, 0x35,
+  0x41, 0x82, 0x35, 0x00, 0x3F, 0x81, 0x35, 0x01, 0x3F, 0x3F, 0x83, 0x35, 0x07, 0x38, 0x35, 0x38,
+  0x38, 0x41, 0x38, 0x38, 0x35, 0x80, 0x38, 0x0C, 0x3B, 0x35, 0x35, 0x41, 0x35, 0x33, 0x38, 0x35,
+  0x3B, 0x35, 0x35, 0x38, 0x41, 0x84, 0x35, 0x01, 0x3F, 0x38, 0x81, 0x35, 0x00, 0x30, 0x81, 0x38,
+  0x00, 0x3B, 0x83, 0x38, 0x00, 0x3B, 0x89, 0x38, 0x00, 0x30, 0x80, 0x38, 0x00, 0x3B, 0x84, 0x38,
+  0x01, 0x2F, 0x35, 0x82, 0x38, 0x02, 0x30, 0x38, 0x3B, 0x80, 0x38, 0x10, 0x35, 0x38, 0x38, 0x35,
+  0x35, 0x38, 0x38, 0x35, 0x35, 0x38, 0x38, 0x41, 0x35, 0x35, 0x38, 0x35, 0x38, 0x82, 0x35, 0x06,
+  0x33, 0x33, 0x38, 0x2F, 0x35, 0x35, 0x38, 0x85, 0x35, 0x04, 0x3F, 0x3F, 0x35, 0x38, 0x3F, 0x80,
+  0x35, 0x08, 0x41, 0x43, 0x3B, 0x3B, 0x41, 0x41, 0x35, 0x35, 0x3F, 0x81, 0x35, 0x00, 0x3F, 0x80,
+  0x35, 0x04, 0x38, 0x38, 0x35, 0x35, 0x38, 0x82, 0x35, 0x00, 0x38, 0x83, 0x35, 0x00, 0x38, 0x80,
+  0x35, 0x00, 0x3A, 0x80, 0x38, 0x04, 0x35, 0x38, 0x35, 0x35, 0x38, 0x83, 0x35, 0x0B, 0x33, 0x35,
+  0x38, 0x30, 0x38, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x35, 0x82, 0x38, 0x00, 0x3A, 0x82, 0x38,
+  0x00, 0x3B, 0x80, 0x38, 0x05, 0x3B, 0x38, 0x3B, 0x38, 0x38, 0x30, 0x85, 0x38, 0x00, 0x3B, 0x83,
+  0x38, 0x00, 0x3B, 0x86, 0x38, 0x07, 0x30, 0x38, 0x38, 0x35, 0x38, 0x38, 0x35, 0x30, 0x82, 0x38,
+  0x07, 0x30, 0x35, 0x3A, 0x35, 0x38, 0x35, 0x35, 0x30, 0x82, 0x35, 0x02, 0x2F, 0x33, 0x33, 0x85,
+  0x35, 0x00, 0x2F, 0x80, 0x35, 0x01, 0x2F, 0x33, 0x80, 0x35, 0x02, 0x41, 0x35, 0x35, 0x03, 0x41,
+  0x41, 0xB5, 0x3B, 0x82, 0x41, 0x04, 0x35, 0x3F, 0x35, 0x38, 0x38, 0x82, 0x35, 0x0A, 0x3B, 0x35,
+  0x38, 0x35, 0x35, 0x41, 0x35, 0x35, 0x38, 0x35, 0x35, 0x81, 0x38, 0x80, 0x35, 0x05, 0x41, 0x35,
+  0x38, 0x3B, 0x38, 0x35, 0x81, 0x38, 0x80, 0x35, 0x00, 0x3F, 0x82, 0x35, 0x00, 0x38, 0x81, 0x35,
+  0x04, 0x38, 0x38, 0x41, 0x35, 0x35, 0x80, 0x38, 0x00, 0x33, 0x97, 0x38, 0x00, 0x3B, 0x81, 0x38,
+  0x00, 0x3B, 0x89, 0x38, 0x0D, 0x35, 0x38, 0x3B, 0x38, 0x41, 0x38, 0x38, 0x3B, 0x38, 0x38, 0x35,
+  0x38, 0x35, 0x35, 0x80, 0x38, 0x02, 0x35, 0x2F, 0x38, 0x80, 0x35, 0x04, 0x38, 0x35, 0x35, 0x38,
+  0x38, 0x80, 0x35, 0x03, 0x33, 0x35, 0x35, 0x2F, 0x80, 0x35, 0x03, 0x30, 0x35, 0x38, 0x38, 0x81,
+  0x35, 0x02, 0x41, 0x40, 0xBD, 0x81, 0x41, 0x05, 0x3B, 0x3F, 0x41, 0x41, 0x35, 0x41, 0x80, 0x35,
+  0x03, 0x33, 0x35, 0x35, 0x2F, 0x81, 0x35, 0x00, 0x38, 0x82, 0x35, 0x00, 0x41, 0x80, 0x35, 0x03,
+  0x38, 0x30, 0x35, 0x38, 0x80, 0x35, 0x14, 0x38, 0x38, 0x35, 0x38, 0x35, 0x35, 0x38, 0x35, 0x38,
+  0x30, 0x35, 0x38, 0x35, 0x35, 0x38, 0x33, 0x38, 0x38, 0x35, 0x38, 0x38, 0x80, 0x35, 0x01, 0x38,
+  0x35, 0x85, 0x38, 0x05, 0x43, 0x38, 0x36, 0x3E, 0x3C, 0x37, 0x81, 0x38, 0x00, 0x2F, 0x86, 0x38,
+  0x00, 0x35, 0x8E, 0x38, 0x02, 0x2F, 0x38, 0x35, 0x81, 0x38, 0x04, 0x35, 0x38, 0x35, 0x38, 0x35,
+  0x80, 0x38, 0x80, 0x35, 0x00, 0x33, 0x82, 0x35, 0x03, 0x33, 0x38, 0x35, 0x33, 0x87, 0x35, 0x00,
+  0x33, 0x85, 0x35, 0x09, 0x3B, 0x43, 0xB5, 0x41, 0x41, 0x3F, 0x35, 0x35, 0x3B, 0x41, 0x80, 0x35,
+  0x00, 0x41, 0x84, 0x35, 0x00, 0x33, 0x84, 0x35, 0x80, 0x38, 0x22, 0x35, 0x33, 0x38, 0x35, 0x38,
+  0x35, 0x30, 0x35, 0x35, 0x38, 0x35, 0x33, 0x38, 0x35, 0x35, 0x38, 0x2F, 0x3B, 0x3A, 0x38, 0x38,
+  0x35, 0x38, 0x35, 0x38, 0x35, 0x2F, 0x30, 0x35, 0x3F, 0x35, 0x35, 0x38, 0x35, 0x35, 0x84, 0x38,
+  0x06, 0x30, 0x38, 0x41, 0x2D, 0x09, 0x00, 0x33, 0x81, 0x38, 0x00, 0x3B, 0x81, 0x38, 0x00, 0x2F,
+  0x81, 0x38, 0x00, 0x35, 0x8F, 0x38, 0x0A, 0x35, 0x38, 0x35, 0x38, 0x38, 0x41, 0x3F, 0x38, 0x30,
+  0x38, 0x35, 0x80, 0x38, 0x03, 0x35, 0x38, 0x38, 0x33, 0x82, 0x35, 0x02, 0x38, 0x35, 0x38, 0x80,
+  0x35, 0x00, 0x3F, 0x81, 0x35, 0x00, 0x33, 0x80, 0x35, 0x01, 0x38, 0x38, 0x83, 0x35, 0x06, 0x41,
+  0xA8, 0x94, 0x44, 0x3F, 0x41, 0x3B, 0x80, 0x35, 0x01, 0x41, 0x41, 0x80, 0x35, 0x00, 0x2F, 0x80,
+  0x35, 0x00, 0x2F, 0x80, 0x35, 0x0D, 0x38, 0x35, 0x35, 0x38, 0x35, 0x38, 0x38, 0x35, 0x35, 0x2F,
+  0x35, 0x38, 0x30, 0x35, 0x80, 0x38, 0x03, 0x2F, 0x35, 0x38, 0x2F, 0x83, 0x38, 0x06, 0x35, 0x35,
+  0x3F, 0x35, 0x2F, 0x38, 0x38, 0x80, 0x35, 0x19, 0x38, 0x35, 0x35, 0x38, 0x35, 0x2F, 0x2F, 0x38,
+  0x2F, 0x35, 0x35, 0x2F, 0x3B, 0x38, 0x38, 0x41, 0x43, 0x0A, 0x02, 0x01, 0x00, 0x2F, 0x2F, 0x38,
+  0x38, 0x2F, 0x85, 0x38, 0x01, 0x35, 0x3A, 0x80, 0x38, 0x01, 0x35, 0x35, 0x81, 0x38, 0x00, 0x35,
+  0x85, 0x38, 0x08, 0x35, 0x33, 0x2F, 0x38, 0x38, 0x30, 0x2F, 0x35, 0x30, 0x81, 0x38, 0x06, 0x33,
+  0x38, 0x35, 0x38, 0x35, 0x35, 0x38, 0x80, 0x35, 0x08, 0x38, 0x38, 0x30, 0x35, 0x35, 0x38, 0x35,
+  0x35, 0x33, 0x8B, 0x35, 0x0E, 0x3C, 0x8F, 0x94, 0xB7, 0x43, 0x3F, 0x41, 0x41, 0x3F, 0x3F, 0x35,
+  0x41, 0x35, 0x35, 0x38, 0x83, 0x35, 0x0A, 0x33, 0x35, 0x38, 0x38, 0x35, 0x38, 0x38, 0x33, 0x41,
+  0x35, 0x33, 0x80, 0x38, 0x00, 0x35, 0x81, 0x38, 0x00, 0x3A, 0x80, 0x38, 0x06, 0x2F, 0x38, 0x38,
+  0x2F, 0x38, 0x38, 0x3A, 0x81, 0x38, 0x01, 0x35, 0x35, 0x80, 0x38, 0x05, 0x33, 0x38, 0x35, 0x38,
+  0x2F, 0x30, 0x85, 0x38, 0x03, 0x30, 0x30, 0x3E, 0x04, 0x80, 0x02, 0x00, 0x0A, 0x80, 0x38, 0x04,
+  0x2F, 0x2F, 0x30, 0x38, 0x2F, 0x82, 0x38, 0x00, 0x35, 0x83, 0x38, 0x00, 0x2F, 0x82, 0x38, 0x00,
+  0x2F, 0x82, 0x38, 0x06, 0x33, 0x38, 0x2F, 0x30, 0x30, 0x38, 0x38, 0x83, 0x35, 0x05, 0x38, 0x35,
+  0x38, 0x33, 0x35, 0x38, 0x80, 0x35, 0x0A, 0x3F, 0x35, 0x41, 0x35, 0x38, 0x35, 0x35, 0x41, 0x3B,
+  0x35, 0x3F, 0x89, 0x35, 0x00, 0x3F, 0x03, 0x3C, 0x93, 0x94, 0x44, 0x80, 0x41, 0x06, 0x35, 0x3F,
+  0x41, 0x35, 0x35, 0x38, 0x38, 0x85, 0x35, 0x04, 0x38, 0x30, 0x35, 0x33, 0x41, 0x80, 0x35, 0x03,
+  0x38, 0x35, 0x35, 0x2F, 0x80, 0x38, 0x0C, 0x35, 0x35, 0x2F, 0x38, 0x35, 0x35, 0x38, 0x38, 0x35,
+  0x2F, 0x33, 0x2F, 0x35, 0x80, 0x38, 0x02, 0x35, 0x35, 0x38, 0x80, 0x35, 0x01, 0x30, 0x35, 0x81,
+  0x38, 0x00, 0x30, 0x80, 0x38, 0x00, 0x2F, 0x81, 0x38, 0x0A, 0x41, 0x34, 0x0A, 0x03, 0x02, 0x0D,
+  0x0B, 0x08, 0x0A, 0x44, 0x37, 0x82, 0x38, 0x02, 0x3B, 0x38, 0x2F, 0x85, 0x38, 0x00, 0x3B, 0x8A,
+  0x38, 0x03, 0x35, 0x38, 0x38, 0x2F, 0x80, 0x35, 0x1A, 0x38, 0x2F, 0x38, 0x38, 0x35, 0x38, 0x35,
+  0x35, 0x38, 0x35, 0x35, 0x3B, 0x3B, 0x35, 0x35, 0x3F, 0x32, 0x2B, 0x31, 0x38, 0x41, 0x41, 0x38,
+  0x2D, 0x23, 0x2B, 0x36, 0x80, 0x35, 0x07, 0x41, 0x35, 0x38, 0x35, 0x2D, 0x2B, 0x24, 0x25, 0x03,
+  0x43, 0x8F, 0x9A, 0x50, 0x81, 0x41, 0x02, 0x38, 0x35, 0x3F, 0x83, 0x35, 0x00, 0x41, 0x83, 0x35,
+  0x0A, 0x2F, 0x35, 0x2F, 0x38, 0x38, 0x35, 0x33, 0x38, 0x35, 0x38, 0x38, 0x82, 0x35, 0x06, 0x38,
+  0x35, 0x35, 0x38, 0x35, 0x33, 0x35, 0x81, 0x38, 0x04, 0x35, 0x30, 0x35, 0x38, 0x35, 0x81, 0x38,
+  0x00, 0x35, 0x81, 0x38, 0x03, 0x30, 0x38, 0x38, 0x30, 0x82, 0x38, 0x0E, 0x3C, 0x3D, 0x04, 0x08,
+  0x03, 0x0D, 0x0D, 0x08, 0x02, 0x08, 0x3D, 0x3A, 0x38, 0x30, 0x30, 0x83, 0x38, 0x05, 0x35, 0x38,
+  0x38, 0x30, 0x35, 0x35, 0x80, 0x38, 0x00, 0x30, 0x81, 0x38, 0x00, 0x41, 0x82, 0x38, 0x22, 0x35,
+  0x35, 0x38, 0x30, 0x35, 0x35, 0x2F, 0x38, 0x38, 0x35, 0x33, 0x35, 0x38, 0x35, 0x38, 0x33, 0x35,
+  0x35, 0x38, 0x38, 0x41, 0x2F, 0x32, 0x2A, 0x21, 0x2D, 0x35, 0x33, 0x2E, 0x1D, 0x21, 0x22, 0x28,
+  0x25, 0x3F, 0x82, 0x35, 0x04, 0x32, 0x25, 0x20, 0x21, 0x21, 0x09, 0x47, 0xB0, 0x94, 0xB3, 0x3E,
+  0x39, 0x39, 0x3F, 0x41, 0x3F, 0x83, 0x35, 0x07, 0x33, 0x35, 0x35, 0x2F, 0x3F, 0x35, 0x35, 0x41,
+  0x85, 0x35, 0x06, 0x38, 0x35, 0x35, 0x2F, 0x38, 0x38, 0x3B, 0x80, 0x35, 0x00, 0x38, 0x80, 0x35,
+  0x00, 0x30, 0x82, 0x35, 0x82, 0x38, 0x01, 0x35, 0x35, 0x80, 0x38, 0x1A, 0x35, 0x35, 0x38, 0x35,
+  0x35, 0x38, 0x30, 0x3B, 0x38, 0x38, 0x3B, 0x38, 0x50, 0x02, 0x02, 0x07, 0x05, 0x0D, 0x0C, 0x0D,
+  0x02, 0x01, 0x04, 0x3C, 0x37, 0x32, 0x3A, 0x80, 0x38, 0x02, 0x30, 0x30, 0x3B, 0x88, 0x38, 0x08,
+  0x30, 0x38, 0x38, 0x41, 0x38, 0x30, 0x2F, 0x35, 0x3B, 0x82, 0x38, 0x80, 0x35, 0x0D, 0x38, 0x33,
+  0x38, 0x35, 0x35, 0x31, 0x34, 0x31, 0x40, 0x2F, 0x31, 0x38, 0x41, 0x32, 0x80, 0x20, 0x10, 0x24,
+  0x3A, 0x30, 0x30, 0x1C, 0x1C, 0x20, 0x20, 0x22, 0x23, 0x30, 0x33, 0x35, 0x35, 0x1E, 0x28, 0x22,
+  0x80, 0x20, 0x09, 0x44, 0xA8, 0x97, 0xE9, 0x2D, 0x43, 0x2D, 0x2E, 0x41, 0x3F, 0x87, 0x35, 0x01,
+  0x33, 0x2F, 0x80, 0x35, 0x04, 0x3F, 0x33, 0x35, 0x3F, 0x33, 0x80, 0x38, 0x02, 0x35, 0x35, 0x33,
+  0x80, 0x38, 0x81, 0x35, 0x02, 0x38, 0x35, 0x35, 0x80, 0x38, 0x05, 0x2F, 0x35, 0x38, 0x35, 0x35,
+  0x33, 0x81, 0x35, 0x02, 0x38, 0x35, 0x35, 0x84, 0x38, 0x0C, 0x3B, 0x38, 0x38, 0x41, 0x38, 0x06,
+  0x02, 0x09, 0x0C, 0x06, 0x04, 0x0C, 0x0F, 0x80, 0x01, 0x07, 0x00, 0x0C, 0x46, 0x34, 0x38, 0x30,
+  0x38, 0x2F, 0x8F, 0x38, 0x08, 0x35, 0x30, 0x38, 0x35, 0x35, 0x38, 0x35, 0x35, 0x38, 0x80, 0x35,
+  0x07, 0x38, 0x35, 0x2F, 0x35, 0x35, 0x32, 0x23, 0x1E, 0x80, 0x22, 0x19, 0x2D, 0x34, 0x32, 0x20,
+  0x24, 0x2B, 0x25, 0x1F, 0x23, 0x23, 0x24, 0x1E, 0x20, 0x24, 0x20, 0x2D, 0x2F, 0x33, 0x38, 0x32,
+  0x25, 0x25, 0x20, 0x24, 0x20, 0x20, 0x09, 0x40, 0xB7, 0x97, 0x94, 0x56, 0x21, 0x20, 0x21, 0x3E,
+  0x41, 0x80, 0x35, 0x01, 0x33, 0x41, 0x80, 0x3F, 0x03, 0x32, 0x19, 0x19, 0x2B, 0x86, 0x35, 0x00,
+  0x38, 0x80, 0x35, 0x01, 0x38, 0x35, 0x80, 0x38, 0x00, 0x35, 0x80, 0x38, 0x04, 0x30, 0x35, 0x38,
+  0x38, 0x2F, 0x83, 0x38, 0x05, 0x35, 0x38, 0x35, 0x35, 0x3B, 0x30, 0x86, 0x38, 0x0E, 0x35, 0x33,
+  0x46, 0x01, 0x03, 0x07, 0x0D, 0x0F, 0x0C, 0x0C, 0x0D, 0x0D, 0x01, 0x01, 0x02, 0x80, 0x01, 0x02,
+  0x3E, 0x38, 0x3B, 0x89, 0x38, 0x09, 0x2F, 0x41, 0x38, 0x38, 0x35, 0x35, 0x38, 0x38, 0x35, 0x38,
+  0x85, 0x35, 0x01, 0x38, 0x41, 0x80, 0x35, 0x03, 0x38, 0x3E, 0x20, 0x25, 0x80, 0x20, 0x09, 0x22,
+  0x1F, 0x36, 0x32, 0x20, 0x1E, 0x20, 0x22, 0x25, 0x2C, 0x81, 0x24, 0x0C, 0x20, 0x1C, 0x37, 0x21,
+  0x21, 0x33, 0x32, 0x25, 0x20, 0x20, 0x24, 0x20, 0x20, 0x17, 0x37, 0xA8, 0x9A, 0x93, 0x2C, 0x21,
+  0x21, 0x20, 0x1C, 0x39, 0x41, 0x33, 0x35, 0x3F, 0x35, 0x41, 0x2F, 0x2B, 0x19, 0x8F, 0x18, 0x23,
+  0x36, 0x33, 0x80, 0x35, 0x09, 0x38, 0x38, 0x35, 0x2F, 0x38, 0x35, 0x35, 0x38, 0x38, 0x35, 0x80,
+  0x38, 0x05, 0x33, 0x35, 0x35, 0x3A, 0x38, 0x35, 0x80, 0x38, 0x01, 0x35, 0x35, 0x80, 0x38, 0x02,
+  0x3A, 0x38, 0x35, 0x89, 0x38, 0x05, 0x30, 0x34, 0x44, 0x01, 0x06, 0x00, 0x80, 0x0D, 0x01, 0x0E,
+  0x0C, 0x81, 0x01, 0x06, 0x0D, 0x0B, 0x01, 0x03, 0x06, 0x43, 0x3B, 0x83, 0x38, 0x00, 0x3B, 0x84,
+  0x38, 0x03, 0x30, 0x38, 0x35, 0x35, 0x81, 0x38, 0x08, 0x35, 0x38, 0x33, 0x35, 0x38, 0x38, 0x35,
+  0x35, 0x41, 0x80, 0x35, 0x04, 0x33, 0x36, 0x1C, 0x23, 0x25, 0x80, 0x20, 0x03, 0x22, 0x1E, 0x1C,
+  0x23, 0x80, 0x20, 0x80, 0x22, 0x01, 0x20, 0x24, 0x81, 0x20, 0x0A, 0x23, 0x1D, 0x24, 0x24, 0x23,
+  0x22, 0x20, 0x20, 0x24, 0x20, 0x24, 0x1E, 0xBD, 0xB0, 0x99, 0x9B, 0x50, 0x2C, 0x19, 0x20, 0x19,
+  0x2A, 0x32, 0x38, 0x36, 0x35, 0x32, 0x2B, 0x20, 0x19, 0x19, 0x8F, 0x16, 0x19, 0x23, 0x35, 0x35,
+  0x2F, 0x35, 0x35, 0x38, 0x3F, 0x2F, 0x81, 0x35, 0x19, 0x38, 0x35, 0x33, 0x35, 0x38, 0x35, 0x41,
+  0x35, 0x35, 0x38, 0x35, 0x38, 0x30, 0x2F, 0x38, 0x30, 0x2F, 0x38, 0x38, 0x2F, 0x30, 0x38, 0x35,
+  0x35, 0x38, 0x30, 0x81, 0x38, 0x0A, 0x35, 0x35, 0x0C, 0x44, 0x33, 0x37, 0x09, 0x01, 0x0B, 0x0E,
+  0x07, 0x80, 0x0E, 0x0C, 0x14, 0x0B, 0x03, 0x02, 0x01, 0x07, 0x0A, 0x01, 0x02, 0x02, 0x0A, 0x3C,
+  0x36, 0x83, 0x38, 0x00, 0x2F, 0x80, 0x38, 0x0A, 0x3B, 0x38, 0x38, 0x35, 0x38, 0x38, 0x35, 0x35,
+  0x38, 0x38, 0x35, 0x82, 0x38, 0x1E, 0x35, 0x2F, 0x35, 0x35, 0x38, 0x2F, 0x30, 0x38, 0x2B, 0x22,
+  0x22, 0x24, 0x1F, 0x20, 0x2B, 0x21, 0x20, 0x24, 0x20, 0x1E, 0x22, 0x20, 0x20, 0x22, 0x24, 0x20,
+  0x22, 0x22, 0x20, 0x25, 0x24, 0x81, 0x22, 0x06, 0x20, 0x22, 0x25, 0x22, 0x5D, 0x24, 0x20, 0x0E,
+  0xE9, 0x9A, 0x97, 0x97, 0x27, 0x1C, 0x1C, 0x19, 0x1C, 0x1E, 0x25, 0x2D, 0x2E, 0x24, 0x1F, 0x81,
+  0x19, 0x05, 0x8F, 0x18, 0x1C, 0x24, 0x33, 0x2F, 0x80, 0x35, 0x1A, 0x38, 0x2F, 0x2F, 0x33, 0x35,
+  0x35, 0x2F, 0x38, 0x3F, 0x35, 0x35, 0x38, 0x35, 0x35, 0x38, 0x38, 0x30, 0x35, 0x38, 0x38, 0x35,
+  0x38, 0x30, 0x38, 0x38, 0x3B, 0x30, 0x86, 0x38, 0x21, 0x3B, 0x37, 0x3E, 0x01, 0x01, 0x14, 0x09,
+  0x03, 0x01, 0x01, 0x07, 0x0E, 0x0E, 0x13, 0x11, 0x09, 0x15, 0x06, 0x01, 0x01, 0x02, 0x06, 0x0D,
+  0x01, 0x02, 0x03, 0x06, 0x3E, 0x3A, 0x38, 0x34, 0x35, 0x38, 0x30, 0x84, 0x38, 0x22, 0x35, 0x35,
+  0x3A, 0x38, 0x38, 0x35, 0x38, 0x38, 0x35, 0x35, 0x3B, 0x41, 0x3F, 0x33, 0x37, 0x3A, 0x35, 0x38,
+  0x35, 0x35, 0x32, 0x24, 0x20, 0x20, 0x23, 0x30, 0x24, 0x28, 0x22, 0x23, 0x22, 0x20, 0x24, 0x22,
+  0x22, 0x80, 0x20, 0x10, 0x2A, 0x24, 0x20, 0x20, 0x22, 0x22, 0x24, 0x20, 0x22, 0x22, 0x24, 0x23,
+  0x1F, 0x1C, 0x8A, 0x1F, 0x21, 0x0D, 0xB0, 0x94, 0x94, 0x99, 0x94, 0x56, 0x19, 0x20, 0x19, 0x1C,
+  0x24, 0x1F, 0x21, 0x1F, 0x81, 0x19, 0x0E, 0x16, 0x9A, 0x97, 0x1E, 0x24, 0x38, 0x33, 0x35, 0x3F,
+  0x35, 0x35, 0x33, 0x2F, 0x35, 0x35, 0x80, 0x33, 0x0F, 0x30, 0x35, 0x38, 0x2F, 0x38, 0x35, 0x38,
+  0x35, 0x33, 0x35, 0x38, 0x38, 0x30, 0x38, 0x30, 0x30, 0x80, 0x38, 0x00, 0x3B, 0x80, 0x38, 0x00,
+  0x3B, 0x80, 0x38, 0x03, 0x3B, 0x3E, 0x14, 0x04, 0x80, 0x02, 0x80, 0x01, 0x19, 0x02, 0x01, 0x0B,
+  0x14, 0x11, 0x0E, 0x14, 0x1A, 0x0F, 0x02, 0x01, 0x0B, 0x0C, 0x0D, 0x0C, 0x01, 0x02, 0x04, 0x02,
+  0x0A, 0x16, 0x43, 0x37, 0x38, 0x30, 0x3B, 0x80, 0x38, 0x04, 0x3B, 0x38, 0x2F, 0x38, 0x30, 0x81,
+  0x38, 0x1B, 0x30, 0x30, 0x38, 0x38, 0x35, 0x35, 0x3A, 0x3B, 0x3F, 0x3A, 0x35, 0x35, 0x3B, 0x34,
+  0x32, 0x22, 0x1F, 0x2B, 0x2A, 0x2D, 0x21, 0x22, 0x20, 0x40, 0x24, 0x20, 0x20, 0x22, 0x81, 0x20,
+  0x10, 0x24, 0x20, 0x22, 0x20, 0x24, 0x24, 0x22, 0x20, 0x22, 0x2B, 0x2E, 0x32, 0x1F, 0x1C, 0x89,
+  0x15, 0x12, 0x1A, 0xBA, 0x9B, 0xB7, 0x92, 0x9A, 0x28, 0x23, 0x20, 0x19, 0x1C, 0x1B, 0x27, 0x1C,
+  0x57, 0x57, 0x19, 0x1E, 0x19, 0x19, 0x94, 0x98, 0x21, 0x2C, 0x33, 0x39, 0x3B, 0x33, 0x80, 0x35,
+  0x10, 0x38, 0x38, 0x43, 0x2E, 0x41, 0x35, 0x37, 0x35, 0x35, 0x2F, 0x35, 0x41, 0x38, 0x30, 0x38,
+  0x38, 0x30, 0x80, 0x38, 0x05, 0x35, 0x38, 0x38, 0x41, 0x38, 0x30, 0x84, 0x38, 0x21, 0x41, 0x37,
+  0x01, 0x06, 0x0D, 0x02, 0x01, 0x04, 0x01, 0x01, 0x02, 0x00, 0x13, 0x0B, 0x11, 0x14, 0x0C, 0x1A,
+  0x11, 0x04, 0x04, 0x01, 0x06, 0x0C, 0x0E, 0x0E, 0x04, 0x08, 0x09, 0x02, 0x02, 0x0B, 0x33, 0x3F,
+  0x80, 0x38, 0x02, 0x3B, 0x38, 0x2F, 0x81, 0x38, 0x34, 0x35, 0x2F, 0x38, 0x35, 0x38, 0x35, 0x35,
+  0x2F, 0x2F, 0x35, 0x37, 0x3E, 0x25, 0x3F, 0x38, 0x35, 0x3B, 0x25, 0x22, 0x20, 0x23, 0x25, 0x1C,
+  0x1C, 0x25, 0x1C, 0x2A, 0x23, 0x1F, 0x20, 0x29, 0x25, 0x24, 0x22, 0x20, 0x22, 0x20, 0x20, 0x1C,
+  0x25, 0x25, 0x22, 0x25, 0x25, 0x33, 0x3C, 0x19, 0x1C, 0x1B, 0x17, 0x8A, 0x5D, 0x16, 0x28, 0xBB,
+  0x9A, 0xB5, 0x9C, 0x8F, 0x93, 0x10, 0x20, 0x20, 0x19, 0x1E, 0x1E, 0x57, 0x58, 0x59, 0x57, 0x5A,
+  0x16, 0x16, 0x8F, 0x97, 0x28, 0x19, 0x2B, 0x2F, 0x3A, 0x34, 0x35, 0x35, 0x3F, 0x41, 0x3B, 0x35,
+  0x28, 0x25, 0x3C, 0x38, 0x35, 0x33, 0x35, 0x35, 0x83, 0x38, 0x03, 0x35, 0x35, 0x38, 0x3B, 0x81,
+  0x38, 0x00, 0x3B, 0x83, 0x38, 0x23, 0x3B, 0x38, 0x26, 0x04, 0x09, 0x0D, 0x05, 0x03, 0x02, 0x01,
+  0x01, 0x0B, 0x14, 0x08, 0x0E, 0x1A, 0x1A, 0x17, 0x0E, 0x13, 0x0C, 0x0F, 0x07, 0x01, 0x0D, 0x0E,
+  0x0D, 0x04, 0x05, 0x0C, 0x04, 0x01, 0x07, 0x11, 0x37, 0x3B, 0x85, 0x38, 0x0A, 0x30, 0x30, 0x38,
+  0x38, 0x3B, 0x38, 0x3A, 0x3A, 0x31, 0x30, 0x2D, 0x80, 0x25, 0x17, 0x2B, 0x2D, 0x37, 0x23, 0x2D,
+  0x1F, 0x20, 0x28, 0x1C, 0x12, 0x0A, 0x1A, 0x08, 0x0B, 0x15, 0x28, 0x20, 0x2A, 0x1E, 0x23, 0x1F,
+  0x1C, 0x20, 0x22, 0x82, 0x20, 0x0A, 0x36, 0x38, 0x2F, 0x1E, 0x15, 0x12, 0x16, 0x8A, 0x85, 0x5D,
+  0x15, 0x2A, 0xE8, 0xB0, 0x92, 0x92, 0x8D, 0x1C, 0x1C, 0x20, 0x20, 0x21, 0x1F, 0x1F, 0x7E, 0x7E,
+  0x7C, 0x57, 0x57, 0x15, 0x12, 0x8F, 0x97, 0x1B, 0x19, 0x19, 0x25, 0x23, 0x40, 0x39, 0x35, 0x34,
+  0x22, 0x2B, 0x25, 0x1F, 0x22, 0x1F, 0x25, 0x38, 0x37, 0x35, 0x33, 0x38, 0x33, 0x80, 0x38, 0x04,
+  0x35, 0x3B, 0x38, 0x2F, 0x30, 0x81, 0x38, 0x00, 0x30, 0x81, 0x38, 0x0F, 0x3B, 0x38, 0x34, 0x3E,
+  0x04, 0x08, 0x0E, 0x0C, 0x06, 0x0D, 0x02, 0x02, 0x0D, 0x14, 0x0B, 0x0E, 0x81, 0x1A, 0x12, 0x14,
+  0x26, 0x0C, 0x0D, 0x0B, 0x01, 0x01, 0x0F, 0x0C, 0x0C, 0x09, 0x0D, 0x0D, 0x08, 0x03, 0x01, 0x3D,
+  0x2E, 0x37, 0x83, 0x38, 0x01, 0x35, 0x2F, 0x80, 0x35, 0x06, 0x3B, 0x2E, 0x2B, 0x23, 0x32, 0x43,
+  0x23, 0x80, 0x25, 0x1F, 0x2D, 0x1E, 0x25, 0x20, 0x1E, 0x1C, 0x28, 0x18, 0x13, 0x09, 0x03, 0x01,
+  0x05, 0x01, 0x06, 0x23, 0x1F, 0x20, 0x22, 0x20, 0x20, 0x22, 0x25, 0x24, 0x20, 0x20, 0x1C, 0x24,
+  0x20, 0x20, 0x32, 0x25, 0x80, 0x12, 0x04, 0x16, 0x10, 0x85, 0x80, 0x0E, 0x2C, 0xB4, 0xB4, 0x99,
+  0x97, 0x94, 0x18, 0x1C, 0x20, 0x24, 0x3D, 0x23, 0x16, 0x5A, 0x81, 0x59, 0x7E, 0x58, 0x0F, 0xA8,
+  0x9A, 0x94, 0x16, 0x19, 0x19, 0x20, 0x25, 0x25, 0x2B, 0x2E, 0x2B, 0x22, 0x25, 0x25, 0x23, 0x25,
+  0x22, 0x25, 0x2D, 0x35, 0x38, 0x2F, 0x2F, 0x35, 0x2F, 0x38, 0x81, 0x35, 0x03, 0x38, 0x2F, 0x38,
+  0x30, 0x84, 0x38, 0x0F, 0x3B, 0x38, 0x40, 0x11, 0x04, 0x0D, 0x0C, 0x0C, 0x0E, 0x03, 0x03, 0x01,
+  0x00, 0x0D, 0x0E, 0x0E, 0x81, 0x1A, 0x80, 0x0E, 0x36, 0x0B, 0x07, 0x08, 0x05, 0x01, 0x0D, 0x0B,
+  0x0E, 0x0E, 0x0F, 0x07, 0x0C, 0x03, 0x02, 0x0E, 0x3E, 0x38, 0x38, 0x3B, 0x30, 0x38, 0x35, 0x3A,
+  0x38, 0x35, 0x33, 0x35, 0x3B, 0x23, 0x22, 0x22, 0x21, 0x20, 0x25, 0x22, 0x25, 0x25, 0x2F, 0x2E,
+  0x22, 0x25, 0x20, 0x19, 0x15, 0x0D, 0x04, 0x01, 0x04, 0x07, 0x03, 0x01, 0x02, 0x11, 0x24, 0x22,
+  0x81, 0x20, 0x11, 0x25, 0x1E, 0x24, 0x20, 0x20, 0x24, 0x20, 0x24, 0x22, 0x15, 0x16, 0x19, 0x18,
+  0x1A, 0x5B, 0x7E, 0x5C, 0x5B, 0x21, 0x9B, 0xB3, 0xB4, 0x9B, 0x99, 0x9B, 0x1C, 0x24, 0x2E, 0x5C,
+  0x0F, 0x1F, 0x81, 0x81, 0x7E, 0x57, 0x59, 0x57, 0x9C, 0xB0, 0x9A, 0x27, 0x19, 0x25, 0x22, 0x24,
+  0x20, 0x20, 0x25, 0x25, 0x24, 0x22, 0x25, 0x3E, 0x80, 0x22, 0x3F, 0x23, 0x32, 0x41, 0x34, 0x33,
+  0x35, 0x2F, 0x38, 0x2E, 0x42, 0x50, 0x50, 0x3E, 0x2E, 0x33, 0x34, 0x35, 0x38, 0x30, 0x38, 0x41,
+  0x41, 0x38, 0x37, 0x3C, 0x3E, 0x07, 0x07, 0x0E, 0x0E, 0x0F, 0x07, 0x05, 0x01, 0x07, 0x0F, 0x0E,
+  0x11, 0x1A, 0x15, 0x1A, 0x14, 0x11, 0x11, 0x0E, 0x0E, 0x0B, 0x01, 0x07, 0x05, 0x01, 0x08, 0x0D,
+  0x14, 0x0E, 0x0F, 0x04, 0x04, 0x02, 0x09, 0x00, 0x14, 0x3E, 0x34, 0x80, 0x38, 0x37, 0x35, 0x38,
+  0x3F, 0x35, 0x38, 0x41, 0x38, 0x20, 0x19, 0x19, 0x1C, 0x1C, 0x1D, 0x1E, 0x23, 0x23, 0x25, 0x23,
+  0x21, 0x1C, 0x1E, 0x14, 0x08, 0x08, 0x09, 0x08, 0x01, 0x03, 0x04, 0x05, 0x02, 0x03, 0x26, 0x23,
+  0x21, 0x20, 0x24, 0x20, 0x5B, 0x21, 0x24, 0x20, 0x24, 0x1B, 0x1B, 0x20, 0x20, 0x19, 0x24, 0x15,
+  0x12, 0x86, 0x81, 0x80, 0x5C, 0x15, 0x1A, 0x9B, 0x9B, 0x9C, 0x92, 0x92, 0x99, 0x32, 0x2D, 0x2D,
+  0x59, 0x59, 0x7E, 0x80, 0x57, 0x57, 0x58, 0x57, 0x57, 0x59, 0xB0, 0x97, 0x18, 0x19, 0x20, 0x24,
+  0x20, 0x20, 0x81, 0x22, 0x33, 0x25, 0x22, 0x1F, 0x22, 0x25, 0x25, 0x20, 0x24, 0x31, 0x33, 0x35,
+  0x33, 0x35, 0x33, 0x33, 0x01, 0x04, 0x01, 0x02, 0x00, 0x07, 0x2E, 0x2D, 0x41, 0x38, 0x38, 0x41,
+  0x41, 0x37, 0x32, 0x2C, 0x06, 0x08, 0x08, 0x0E, 0x0F, 0x0D, 0x0D, 0x05, 0x08, 0x0D, 0x0E, 0x11,
+  0x14, 0x15, 0x09, 0x1A, 0x14, 0x0E, 0x0E, 0x14, 0x1A, 0x81, 0x01, 0x40, 0x02, 0x01, 0x01, 0x10,
+  0x1A, 0x26, 0x01, 0x07, 0x09, 0x13, 0x1A, 0x04, 0x05, 0x34, 0x39, 0x38, 0x38, 0x3F, 0x38, 0x35,
+  0x33, 0x41, 0x43, 0x19, 0x24, 0x1D, 0x12, 0x12, 0x1A, 0x1B, 0x1F, 0x18, 0x22, 0x24, 0x24, 0x1F,
+  0x17, 0x06, 0x04, 0x08, 0x09, 0x0D, 0x02, 0x01, 0x0B, 0x05, 0xBE, 0x01, 0x02, 0x01, 0x13, 0x17,
+  0x19, 0x1C, 0x20, 0x5B, 0x21, 0x24, 0x24, 0x20, 0xB3, 0x16, 0x20, 0x20, 0x19, 0x80, 0x12, 0x04,
+  0x14, 0x8A, 0x57, 0x7E, 0x7E, 0x34, 0xB4, 0xB3, 0x99, 0x9A, 0x99, 0x99, 0x3D, 0x2E, 0x2D, 0x81,
+  0x58, 0x58, 0x59, 0x86, 0x7E, 0x58, 0x58, 0x57, 0x96, 0x9A, 0x94, 0x94, 0xB0, 0x20, 0x24, 0x20,
+  0x25, 0x22, 0x20, 0x22, 0x24, 0x22, 0x20, 0x25, 0x25, 0x22, 0x22, 0x21, 0x23, 0x2B, 0x41, 0x35,
+  0x2F, 0x33, 0x42, 0x26, 0x08, 0x08, 0x03, 0x05, 0x04, 0x00, 0x03, 0x80, 0x3D, 0x60, 0x3F, 0x41,
+  0x34, 0x3C, 0x08, 0x02, 0x01, 0x03, 0x06, 0x19, 0x04, 0x07, 0x08, 0x03, 0x09, 0x0E, 0x0E, 0x0F,
+  0x0B, 0x0E, 0x0C, 0x1A, 0x14, 0x11, 0x0E, 0x17, 0x15, 0x08, 0x07, 0x06, 0x04, 0x04, 0x01, 0x09,
+  0x18, 0x13, 0x14, 0x09, 0x0E, 0x0E, 0x14, 0x1A, 0x0C, 0x01, 0x05, 0x3D, 0x41, 0x38, 0x41, 0x3C,
+  0x2F, 0x32, 0x32, 0x1C, 0x1C, 0x23, 0x25, 0x15, 0x17, 0x10, 0x0F, 0x1A, 0x00, 0x26, 0x1F, 0x22,
+  0x28, 0x0B, 0x09, 0x05, 0x08, 0x0D, 0x0D, 0x00, 0x0E, 0x06, 0x03, 0xBE, 0x03, 0x02, 0x02, 0x04,
+  0x04, 0x1B, 0x19, 0x22, 0x5B, 0x24, 0x24, 0x20, 0x21, 0x9B, 0x92, 0x19, 0x1D, 0x1B, 0x17, 0x80,
+  0x12, 0x00, 0x85, 0x80, 0x57, 0x7F, 0xB5, 0xB3, 0xB3, 0x9B, 0x9A, 0x2D, 0x2D, 0x33, 0x2E, 0x5C,
+  0x59, 0x57, 0x58, 0x85, 0x7E, 0x58, 0x59, 0x92, 0xAF, 0xB3, 0x97, 0x9A, 0xAF, 0x1F, 0x20, 0x20,
+  0x22, 0x22, 0x20, 0x20, 0x25, 0x20, 0x22, 0x24, 0x25, 0x22, 0x25, 0x40, 0x1D, 0x2C, 0x2B, 0x38,
+  0x31, 0x40, 0x12, 0x10, 0x13, 0x08, 0x08, 0x0D, 0x0F, 0x0E, 0x0B, 0x07, 0x01, 0x07, 0x07, 0x42,
+  0x36, 0x09, 0x01, 0x06, 0x00, 0x04, 0x0B, 0x0B, 0x05, 0x05, 0x08, 0x07, 0x09, 0x06, 0x08, 0x08,
+  0x07, 0x11, 0x0C, 0x26, 0x0E, 0x13, 0x26, 0x1A, 0x0D, 0x0D, 0x09, 0x06, 0x00, 0x00, 0x06, 0x02,
+  0x0B, 0x1B, 0x11, 0x14, 0x0B, 0x0D, 0x09, 0x14, 0x1D, 0x09, 0x01, 0x07, 0x3E, 0x3F, 0x41, 0x43,
+  0x15, 0x10, 0x19, 0x18, 0x1B, 0x15, 0x12, 0x16, 0x1B, 0x10, 0x07, 0x07, 0x03, 0x07, 0x02, 0x0E,
+  0x0B, 0x06, 0x07, 0x02, 0x00, 0x0D, 0x16, 0x0C, 0x07, 0x0F, 0x01, 0x0C, 0xFF, 0x0B, 0x06, 0x03,
+  0x04, 0x06, 0x03, 0x3D, 0x12, 0x9A, 0x97, 0x19, 0x1B, 0x17, 0xB4, 0xBD, 0x12, 0x15, 0x80, 0x12,
+  0x05, 0x13, 0x85, 0x85, 0x7E, 0x7C, 0x7E, 0x16, 0xB5, 0x99, 0xB5, 0x9A, 0x92, 0x92, 0x2D, 0x30,
+  0x32, 0x7E, 0x59, 0x7E, 0x7E, 0x86, 0x7F, 0x59, 0x59, 0x57, 0x57, 0xBB, 0xB7, 0x1B, 0x19, 0x86,
+  0x20, 0x02, 0x24, 0x20, 0x22, 0x80, 0x20, 0x2D, 0x22, 0x2B, 0x2E, 0x35, 0x33, 0x12, 0x12, 0x17,
+  0x17, 0x03, 0x08, 0x09, 0x0E, 0x0C, 0x0C, 0x03, 0x07, 0x04, 0x03, 0x05, 0x05, 0x01, 0x0D, 0x0E,
+  0x09, 0x01, 0x03, 0x03, 0x07, 0x0B, 0x0D, 0x09, 0x05, 0x04, 0x03, 0x09, 0x0C, 0x1A, 0x1A, 0x0E,
+  0x0E, 0x0C, 0x1A, 0x1A, 0x01, 0x0D, 0x80, 0x0C, 0x48, 0x0D, 0x0C, 0x01, 0x02, 0x14, 0x1A, 0x1A,
+  0x09, 0x13, 0x1A, 0x09, 0x14, 0x26, 0x14, 0x01, 0x04, 0x2C, 0x40, 0x43, 0x3E, 0x19, 0x15, 0x15,
+  0x1B, 0x1B, 0x17, 0x10, 0x10, 0x0C, 0x0D, 0x05, 0x03, 0x05, 0x0D, 0x05, 0x02, 0x05, 0x07, 0x06,
+  0x0C, 0x0E, 0x0E, 0x0D, 0x05, 0x0B, 0x0E, 0xFF, 0x0E, 0x13, 0x0B, 0x03, 0x01, 0x01, 0x03, 0x1E,
+  0xB0, 0x50, 0x17, 0x16, 0x12, 0xB3, 0x99, 0x12, 0x12, 0x10, 0x12, 0x12, 0x8B, 0x82, 0x85, 0x81,
+  0x59, 0x7C, 0x16, 0xB3, 0x9A, 0xB3, 0x9B, 0x97, 0x94, 0x15, 0x32, 0x81, 0x80, 0x7E, 0x85, 0x81,
+  0x86, 0x7E, 0x59, 0x58, 0x57, 0x57, 0x88, 0x9B, 0x9B, 0x26, 0x85, 0x20, 0x00, 0x19, 0x84, 0x20,
+  0x78, 0x21, 0x1D, 0x2B, 0x12, 0x12, 0x18, 0x18, 0x26, 0x0F, 0x05, 0x08, 0x0B, 0x0F, 0x0E, 0x04,
+  0x0F, 0x02, 0x08, 0x0F, 0x0F, 0x0E, 0x14, 0x14, 0x09, 0x01, 0x03, 0x08, 0x07, 0x14, 0x06, 0x08,
+  0x0D, 0x15, 0x01, 0x14, 0x1A, 0x1A, 0x0E, 0x11, 0x14, 0x11, 0x1A, 0x26, 0x07, 0x05, 0x0C, 0x0E,
+  0x09, 0x0C, 0x0E, 0x01, 0x00, 0x14, 0x1B, 0x26, 0x0B, 0x06, 0x1A, 0x26, 0x00, 0x0A, 0x1A, 0x07,
+  0x00, 0x0A, 0x50, 0x44, 0x2C, 0x10, 0x0E, 0x09, 0x09, 0x12, 0x10, 0x10, 0x09, 0x03, 0x02, 0x01,
+  0x03, 0x03, 0x05, 0x01, 0x03, 0x05, 0x04, 0x0D, 0x0C, 0x0F, 0x0F, 0x05, 0x08, 0x0E, 0x04, 0x99,
+  0x90, 0x0A, 0x14, 0x02, 0x14, 0x04, 0x02, 0xBE, 0x9A, 0x97, 0x10, 0x12, 0x11, 0x9A, 0x94, 0x12,
+  0x12, 0x10, 0x12, 0x13, 0x14, 0x86, 0x85, 0x59, 0x59, 0x58, 0x38, 0xB3, 0xB3, 0x9A, 0xB4, 0x9C,
+  0x92, 0x15, 0x2D, 0x7F, 0x7F, 0x81, 0x86, 0x57, 0x81, 0x7E, 0x59, 0x59, 0x58, 0x57, 0x59, 0x9A,
+  0x97, 0x99, 0x21, 0x21, 0x24, 0x20, 0x1F, 0x19, 0x20, 0x19, 0x19, 0x21, 0x19, 0x1C, 0x15, 0x15,
+  0x1C, 0x19, 0x1C, 0x27, 0x3D, 0x12, 0x1B, 0x1B, 0x18, 0x28, 0x11, 0x0F, 0x06, 0x01, 0x08, 0x0F,
+  0x00, 0x0D, 0x0C, 0x08, 0x80, 0x0E, 0x37, 0x1A, 0x06, 0x0C, 0x04, 0x08, 0x06, 0x14, 0x14, 0x08,
+  0x14, 0x0F, 0x08, 0x00, 0x1A, 0x1A, 0x14, 0x0E, 0x11, 0x27, 0x27, 0x1B, 0x05, 0x0D, 0x01, 0x08,
+  0x06, 0x06, 0x0E, 0x07, 0x08, 0x02, 0x14, 0x1B, 0x27, 0x27, 0x08, 0x1A, 0x26, 0x1B, 0x00, 0x26,
+  0x00, 0x01, 0x05, 0x5B, 0x43, 0x3E, 0x10, 0x27, 0x00, 0x00, 0x02, 0x11, 0x14, 0x08, 0x05, 0x81,
+  0x04, 0x27, 0x06, 0x05, 0x01, 0x05, 0x0B, 0x0F, 0x0E, 0x04, 0x05, 0x05, 0x0A, 0x13, 0x13, 0x9A,
+  0x0D, 0x07, 0x13, 0x09, 0x13, 0x06, 0x05, 0x00, 0xBE, 0x97, 0x10, 0x12, 0x13, 0xB0, 0x94, 0x15,
+  0x0A, 0x93, 0x12, 0x81, 0x7F, 0x86, 0x7E, 0x7E, 0x58, 0x80, 0x1B, 0xB5, 0x99, 0x9A, 0x99, 0x92,
+  0x94, 0x2D, 0x2C, 0x3E, 0x7E, 0x89, 0x86, 0x7E, 0x7F, 0x85, 0x58, 0x7C, 0x59, 0x58, 0xB3, 0x9A,
+  0x94, 0x15, 0x20, 0x21, 0x21, 0x19, 0x1B, 0x80, 0x12, 0x03, 0x16, 0x19, 0x21, 0xB0, 0x80, 0x12,
+  0x04, 0x19, 0x15, 0x12, 0x12, 0x17, 0x80, 0x1B, 0x26, 0x18, 0x1A, 0x08, 0x09, 0x0D, 0x08, 0x08,
+  0x0B, 0x0E, 0x0E, 0x0F, 0x0E, 0x0E, 0x1B, 0x1A, 0x26, 0x1B, 0x0B, 0x0D, 0x0A, 0x28, 0x08, 0x04,
+  0x1A, 0x1A, 0x0D, 0x17, 0x1A, 0x0E, 0x11, 0x27, 0x1B, 0x24, 0x42, 0x1B, 0x03, 0x07, 0x0B, 0x04,
+  0x80, 0x0C, 0x47, 0x04, 0x02, 0x04, 0x08, 0x0A, 0x27, 0x27, 0x26, 0x18, 0x0A, 0x1B, 0x1A, 0x26,
+  0x1A, 0x02, 0x01, 0x08, 0x0A, 0x38, 0x42, 0x29, 0x13, 0x0C, 0x06, 0x07, 0x06, 0x05, 0x01, 0x09,
+  0x0B, 0x0D, 0x05, 0x07, 0x05, 0x05, 0x0D, 0x08, 0x07, 0x00, 0x0F, 0x07, 0x0F, 0x0E, 0x13, 0x11,
+  0x97, 0x92, 0x0E, 0x0B, 0x06, 0x06, 0x1A, 0x14, 0x0A, 0x99, 0x97, 0xB3, 0x12, 0x12, 0xB0, 0x97,
+  0x12, 0x10, 0x3D, 0x0A, 0x85, 0x7E, 0x86, 0x7E, 0x7C, 0x57, 0x57, 0x1A, 0xB3, 0xB3, 0x9B, 0x99,
+  0x9B, 0x97, 0x50, 0x5B, 0x85, 0x86, 0x7E, 0x7F, 0x82, 0x85, 0x7F, 0x85, 0x7E, 0x95, 0x99, 0x98,
+  0xB0, 0x94, 0x18, 0x21, 0x1C, 0x16, 0x15, 0x83, 0x12, 0x05, 0x16, 0xA8, 0x12, 0x12, 0x15, 0x15,
+  0x80, 0x12, 0x00, 0x17, 0x80, 0x1B, 0x05, 0x26, 0x14, 0x08, 0x05, 0x0D, 0x0B, 0x80, 0x08, 0x80,
+  0x0E, 0x1A, 0x1A, 0x14, 0x0D, 0x17, 0x06, 0x0B, 0x08, 0x0A, 0x29, 0x0E, 0x0C, 0x1B, 0x13, 0x0B,
+  0x1B, 0x13, 0x0E, 0x13, 0x42, 0x32, 0x2A, 0x42, 0x0E, 0x09, 0x08, 0x03, 0x04, 0x80, 0x0E, 0x47,
+  0x0B, 0x04, 0x02, 0x02, 0x07, 0x26, 0x27, 0x28, 0x1D, 0x1B, 0x27, 0x27, 0x1B, 0x0C, 0x0B, 0x06,
+  0x0B, 0x09, 0x43, 0x44, 0x32, 0x17, 0x12, 0x1C, 0x1D, 0x05, 0x03, 0x0B, 0x0D, 0x0C, 0x07, 0x03,
+  0x03, 0x05, 0x01, 0x03, 0x04, 0x04, 0x0A, 0x0D, 0x0B, 0x11, 0x13, 0x11, 0x8F, 0x9B, 0x92, 0x00,
+  0x13, 0x05, 0x14, 0x00, 0x0D, 0x11, 0xB0, 0x5B, 0x5B, 0x12, 0x10, 0xB4, 0x9A, 0xA8, 0xA8, 0x26,
+  0x10, 0x82, 0x85, 0x85, 0x80, 0x7E, 0x7F, 0x59, 0x06, 0x9B, 0xB3, 0x9B, 0x99, 0x97, 0x98, 0x7C,
+  0x80, 0x85, 0x0E, 0x89, 0x86, 0x86, 0x82, 0x82, 0x85, 0x7E, 0x81, 0x57, 0x58, 0xB3, 0x94, 0x8F,
+  0x10, 0x17, 0x86, 0x12, 0x01, 0x94, 0x0A, 0x81, 0x12, 0x2D, 0x17, 0x18, 0x1B, 0x18, 0x1B, 0x1B,
+  0x26, 0x26, 0x0E, 0x07, 0x08, 0x0F, 0x0C, 0x05, 0x0D, 0x0E, 0x0E, 0x13, 0x29, 0x1B, 0x1A, 0x0C,
+  0x0D, 0x07, 0x0C, 0x1B, 0x3D, 0x08, 0x17, 0x1A, 0x08, 0x26, 0x17, 0x0D, 0x11, 0x1D, 0x44, 0x45,
+  0x2B, 0x46, 0x14, 0x0F, 0x07, 0x07, 0x09, 0x0C, 0x80, 0x0E, 0x04, 0x02, 0x01, 0x0C, 0x07, 0x09,
+  0x80, 0x27, 0x00, 0x1D, 0x80, 0x27, 0x13, 0x26, 0x08, 0x0D, 0x03, 0x03, 0x00, 0x44, 0x45, 0x46,
+  0x19, 0x3D, 0x2A, 0x1A, 0x09, 0x01, 0x03, 0x09, 0x0D, 0x0D, 0x08, 0x80, 0x05, 0x23, 0x0D, 0x01,
+  0x0E, 0x04, 0x07, 0x0E, 0x14, 0x13, 0x9A, 0x99, 0x97, 0x04, 0x13, 0x09, 0x07, 0x15, 0x00, 0xB5,
+  0x99, 0x97, 0x99, 0x12, 0x10, 0x9A, 0x92, 0xA8, 0x7E, 0xA8, 0x7F, 0x7E, 0x82, 0x86, 0x86, 0x57,
+  0x82, 0x57, 0x0F, 0xBD, 0x9A, 0xB3, 0x97, 0x94, 0x7C, 0x59, 0x82, 0x57, 0x86, 0x89, 0x86, 0x81,
+  0x86, 0x89, 0x7C, 0x80, 0x57, 0x0A, 0x58, 0x57, 0xB7, 0x0A, 0x10, 0x12, 0x15, 0x12, 0x12, 0x1B,
+  0x17, 0x81, 0x12, 0x01, 0x94, 0x0A, 0x80, 0x12, 0x3E, 0x17, 0x12, 0x1A, 0x1B, 0x17, 0x18, 0x18,
+  0x26, 0x08, 0x1A, 0x0F, 0x0B, 0x00, 0x0D, 0x0D, 0x11, 0x13, 0x26, 0x27, 0x27, 0x13, 0x0A, 0x26,
+  0x00, 0x08, 0x26, 0x46, 0x3D, 0x0B, 0x1A, 0x26, 0x08, 0x1A, 0x0A, 0x13, 0x26, 0x46, 0x44, 0x45,
+  0x2D, 0x25, 0x06, 0x06, 0x14, 0x08, 0x0E, 0x0E, 0x14, 0x0E, 0x29, 0x26, 0x03, 0x0C, 0x14, 0x02,
+  0x00, 0x1F, 0x1B, 0x1D, 0x28, 0x3D, 0x27, 0x1A, 0x80, 0x03, 0x01, 0x05, 0x01, 0x81, 0x44, 0x29,
+  0x00, 0x12, 0x28, 0x1B, 0x06, 0x03, 0x04, 0x00, 0x06, 0x01, 0x03, 0x07, 0x00, 0x00, 0x0D, 0x06,
+  0x08, 0x0F, 0x13, 0x11, 0x26, 0xFF, 0x9B, 0x92, 0x04, 0x08, 0x0C, 0x06, 0x26, 0x15, 0xBC, 0xB0,
+  0x92, 0xBE, 0x10, 0x8F, 0x99, 0x94, 0x88, 0x93, 0xA8, 0x57, 0x80, 0x86, 0x03, 0x81, 0x59, 0x7E,
+  0x57, 0x80, 0xB4, 0x13, 0x99, 0x94, 0x97, 0x7E, 0x7E, 0x7C, 0x86, 0x89, 0x87, 0x82, 0x89, 0x8A,
+  0x89, 0x81, 0x59, 0x58, 0x96, 0xB3, 0x9B, 0x93, 0x81, 0x12, 0x02, 0x15, 0x12, 0x15, 0x81, 0x12,
+  0x7D, 0x92, 0x11, 0x12, 0x12, 0x15, 0x1B, 0x15, 0x1B, 0x27, 0x18, 0x1B, 0x1B, 0x26, 0x14, 0x06,
+  0x05, 0x05, 0x07, 0x09, 0x26, 0x13, 0x16, 0x13, 0x1B, 0x13, 0x0E, 0x13, 0x2A, 0x0F, 0x17, 0x18,
+  0x44, 0x50, 0x28, 0x19, 0x28, 0x09, 0x1A, 0x0A, 0x18, 0x47, 0x42, 0x2E, 0x45, 0x20, 0x19, 0x0C,
+  0x06, 0x27, 0x0C, 0x11, 0x0E, 0x13, 0x11, 0x1B, 0x29, 0x06, 0x08, 0x0A, 0x00, 0x08, 0x00, 0x3D,
+  0x27, 0x1D, 0x28, 0x00, 0x1B, 0x0B, 0x05, 0x00, 0x00, 0x03, 0x09, 0x40, 0x43, 0x44, 0x42, 0x1B,
+  0x1B, 0x2C, 0x2A, 0x0C, 0x03, 0x04, 0x08, 0x07, 0x07, 0x05, 0x07, 0x0D, 0x0D, 0x05, 0x07, 0x13,
+  0x1A, 0x15, 0x1B, 0xB4, 0x9C, 0x99, 0x0E, 0x02, 0x02, 0x0C, 0x09, 0x17, 0x12, 0xB3, 0x92, 0x9C,
+  0x12, 0xB0, 0x9A, 0x97, 0xA8, 0xA8, 0x94, 0x98, 0x7E, 0x89, 0x85, 0x7E, 0x7F, 0x7E, 0x59, 0x80,
+  0xB5, 0x28, 0x9B, 0x99, 0x91, 0x85, 0x89, 0x7E, 0x7E, 0x89, 0x86, 0x89, 0x7F, 0x86, 0x85, 0x81,
+  0x7C, 0x80, 0x84, 0x88, 0x84, 0x94, 0x1A, 0x1A, 0x15, 0x12, 0x15, 0x12, 0x15, 0x17, 0x15, 0x1A,
+  0xB0, 0x97, 0x0A, 0x12, 0x18, 0x16, 0x15, 0x1B, 0x27, 0x10, 0x1A, 0x80, 0x10, 0x01, 0x1A, 0x0E,
+  0x80, 0x0B, 0x29, 0x26, 0x13, 0x26, 0x29, 0x26, 0x26, 0x11, 0x29, 0x36, 0x21, 0x0C, 0x2C, 0x28,
+  0x45, 0x46, 0x13, 0x46, 0x1D, 0x26, 0x27, 0x29, 0x36, 0x45, 0x29, 0x44, 0x45, 0x42, 0x27, 0x07,
+  0x14, 0x14, 0x13, 0x13, 0x11, 0x0E, 0x13, 0x26, 0x2C, 0x29, 0x07, 0x08, 0x26, 0x80, 0x02, 0x3E,
+  0x26, 0x27, 0x1D, 0x28, 0x0B, 0x17, 0x09, 0x14, 0x11, 0x03, 0x04, 0x0A, 0x43, 0x3C, 0x44, 0x44,
+  0x22, 0x1B, 0x2C, 0x1B, 0x26, 0x06, 0x05, 0x0D, 0x0E, 0x0E, 0x0F, 0x0C, 0x0D, 0x0B, 0x0A, 0x17,
+  0x15, 0x10, 0x1A, 0xB4, 0x92, 0x97, 0x09, 0x0B, 0x09, 0x15, 0x17, 0xB5, 0xB7, 0x99, 0x97, 0x57,
+  0x57, 0x5D, 0xB0, 0x9A, 0x92, 0xB0, 0x9A, 0x97, 0x96, 0x89, 0x7E, 0x7E, 0x5A, 0x82, 0x80, 0x7F,
+  0xB5, 0xB5, 0xB7, 0xB5, 0x99, 0x97, 0x85, 0x86, 0x85, 0x89, 0x8A, 0x87, 0x89, 0x8A, 0x8C, 0x89,
+  0x7C, 0x80, 0x7F, 0x7E, 0x7E, 0x98, 0x99, 0x94, 0x29, 0x16, 0x12, 0x15, 0x16, 0x17, 0x19, 0x20,
+  0x18, 0x9A, 0x92, 0x14, 0x1B, 0x1D, 0x12, 0x12, 0x1B, 0x12, 0x17, 0x10, 0x12, 0x1A, 0x17, 0x1D,
+  0x1B, 0x0C, 0x09, 0x14, 0x1A, 0x13, 0x3D, 0x29, 0x29, 0x1A, 0x1A, 0x47, 0x45, 0x3E, 0x12, 0x2D,
+  0x28, 0x44, 0x46, 0x2C, 0x29, 0x27, 0x29, 0x2B, 0x2B, 0x47, 0x46, 0x25, 0x45, 0x2B, 0x1A, 0x0D,
+  0x13, 0x14, 0x0F, 0x07, 0x0F, 0x28, 0x14, 0x1B, 0x02, 0x3E, 0x1C, 0x0A, 0x3D, 0x27, 0x0F, 0x07,
+  0x06, 0x04, 0x14, 0x1D, 0x28, 0x26, 0x1D, 0x21, 0x09, 0x11, 0x0D, 0x07, 0x07, 0x09, 0x43, 0x44,
+  0x45, 0x44, 0x21, 0x27, 0x0F, 0x27, 0x27, 0x0D, 0x0B, 0x09, 0x0E, 0x0D, 0x09, 0x09, 0x0F, 0x26,
+  0x00, 0x27, 0x80, 0x10, 0x1B, 0xB0, 0xB7, 0x97, 0x9B, 0x0C, 0x50, 0x10, 0x1B, 0x11, 0xB5, 0xB7,
+  0x97, 0x9A, 0xB0, 0xA8, 0xB0, 0xB0, 0x94, 0x94, 0x9A, 0x92, 0x86, 0x89, 0x7E, 0x85, 0x5A, 0x82,
+  0x80, 0x35, 0xB7, 0xBB, 0xBB, 0xB4, 0x9B, 0x89, 0x89, 0x86, 0x86, 0x87, 0x89, 0x89, 0x8A, 0x89,
+  0x7E, 0x7D, 0x87, 0x82, 0x89, 0x87, 0x83, 0xB5, 0x92, 0x0A, 0x15, 0x16, 0xB0, 0x1A, 0x17, 0x10,
+  0x1C, 0x28, 0x2A, 0xB6, 0x94, 0x99, 0x15, 0x1C, 0x19, 0x19, 0x17, 0x10, 0x18, 0x10, 0x27, 0x18,
+  0x1A, 0x20, 0x07, 0x08, 0x08, 0x3D, 0x13, 0x3D, 0x80, 0x2C, 0x3F, 0x29, 0x13, 0x42, 0x46, 0x46,
+  0x40, 0x2B, 0x2A, 0x2E, 0x49, 0x46, 0x2A, 0x2A, 0x48, 0x2B, 0x47, 0x47, 0x45, 0x2B, 0x44, 0x2A,
+  0x1A, 0x1B, 0x14, 0x1A, 0x13, 0x07, 0x14, 0x28, 0x14, 0x2A, 0x2A, 0x0B, 0x3E, 0x29, 0x11, 0x21,
+  0x1A, 0x05, 0x04, 0x08, 0x04, 0x1B, 0x26, 0x19, 0x1D, 0x1D, 0x1B, 0x09, 0x03, 0x09, 0x09, 0x06,
+  0x02, 0x45, 0x45, 0x44, 0x45, 0x24, 0x0B, 0x26, 0x27, 0x28, 0x0C, 0x80, 0x08, 0x1B, 0x09, 0x13,
+  0x11, 0x27, 0x15, 0x1B, 0x1B, 0x93, 0xB0, 0x99, 0x8F, 0x12, 0x10, 0x94, 0x0A, 0x2A, 0x16, 0xB9,
+  0xB4, 0x99, 0x9C, 0x7F, 0x59, 0x96, 0x92, 0x94, 0xA8, 0x94, 0x80, 0x86, 0x04, 0x81, 0x81, 0x5A,
+  0x82, 0x7E, 0x47, 0xBC, 0xB4, 0xB4, 0x9A, 0xB3, 0xB3, 0x88, 0x8A, 0x89, 0x8A, 0x89, 0x81, 0x81,
+  0x86, 0x8C, 0x86, 0x80, 0x7C, 0x95, 0xB5, 0xB3, 0x99, 0x97, 0x10, 0x15, 0x16, 0xB0, 0x93, 0x1D,
+  0x10, 0x2A, 0x19, 0xE8, 0xB5, 0x99, 0x10, 0x16, 0x16, 0x2C, 0x2C, 0x13, 0x1A, 0x15, 0x1D, 0x2C,
+  0x2C, 0x1A, 0x0F, 0x08, 0x0C, 0x3D, 0x1B, 0x29, 0x2C, 0x3E, 0x32, 0x32, 0x1D, 0x45, 0x44, 0x24,
+  0x47, 0x47, 0x2A, 0x46, 0x42, 0x48, 0x2B, 0x22, 0x48, 0x47, 0x45, 0x81, 0x47, 0x18, 0x3E, 0x15,
+  0x1B, 0x18, 0x13, 0x3E, 0x1A, 0x29, 0x26, 0x3E, 0x26, 0x28, 0x43, 0x46, 0x36, 0x2B, 0x26, 0x1D,
+  0x1D, 0x09, 0x06, 0x03, 0x07, 0x00, 0x00, 0x80, 0x27, 0x37, 0x24, 0x1B, 0x27, 0x26, 0x26, 0x1B,
+  0x29, 0x14, 0x42, 0x2C, 0x44, 0x44, 0x2C, 0x26, 0x26, 0x1B, 0x1B, 0x09, 0x08, 0x0B, 0x14, 0x13,
+  0x27, 0x28, 0x28, 0x1B, 0x1B, 0x15, 0xB8, 0x97, 0x9B, 0x9C, 0x15, 0x99, 0x94, 0x12, 0xEA, 0x10,
+  0x9B, 0x98, 0x7C, 0x58, 0x57, 0x96, 0x99, 0x9A, 0x99, 0x9A, 0x91, 0x8A, 0x87, 0x8A, 0x8A, 0x5A,
+  0x86, 0x85, 0x46, 0xB5, 0xB4, 0xB5, 0x9B, 0xB3, 0x9C, 0x98, 0x8B, 0x8A, 0x8A, 0x89, 0x95, 0x8A,
+  0x8C, 0x8C, 0x89, 0x8B, 0x87, 0x96, 0xB3, 0x9A, 0xB3, 0x8D, 0x92, 0x8F, 0x15, 0xB0, 0x29, 0x28,
+  0x10, 0x15, 0x1F, 0x24, 0x9A, 0x99, 0x5E, 0x2B, 0x2C, 0x32, 0x21, 0x12, 0x15, 0x28, 0x2C, 0x42,
+  0x05, 0x3D, 0x0D, 0x0B, 0x2C, 0x32, 0x2A, 0x2C, 0x3E, 0x36, 0x3E, 0x1B, 0x45, 0x45, 0x46, 0x42,
+  0x46, 0x47, 0x45, 0x48, 0x48, 0x46, 0x2A, 0x2D, 0x47, 0x48, 0x81, 0x47, 0x54, 0x44, 0x29, 0x2C,
+  0x2C, 0x16, 0x14, 0x45, 0x2C, 0x29, 0x27, 0x2A, 0x28, 0x20, 0x44, 0x45, 0x2D, 0x45, 0x3E, 0x1B,
+  0x27, 0x27, 0x13, 0x00, 0x03, 0x0B, 0x04, 0x01, 0x13, 0x27, 0x1D, 0x1D, 0x28, 0x28, 0x2A, 0x32,
+  0x2A, 0x0C, 0x43, 0x2C, 0x44, 0x45, 0x45, 0x43, 0x2C, 0x29, 0x27, 0x32, 0x13, 0x28, 0x15, 0x13,
+  0x28, 0x1D, 0x3D, 0x3D, 0x1B, 0x5B, 0xB3, 0x9B, 0x92, 0x1B, 0x16, 0x78, 0x94, 0x50, 0xB0, 0xB5,
+  0x9B, 0x99, 0x5C, 0x7C, 0x59, 0x8C, 0x99, 0x99, 0x94, 0x9A, 0x94, 0x87, 0x89, 0x86, 0x8A, 0x5A,
+  0x82, 0x82, 0x0B, 0xB6, 0xB6, 0xB8, 0xB3, 0xB3, 0x8A, 0x8B, 0x95, 0x8B, 0x87, 0x8A, 0x80, 0x80,
+  0x8A, 0x29, 0x87, 0x8B, 0x86, 0x59, 0x8B, 0xB8, 0x9A, 0x9A, 0xB3, 0x93, 0x15, 0xB0, 0x9A, 0x2A,
+  0xA8, 0xB1, 0x1F, 0x6D, 0x9A, 0x94, 0x9A, 0x2C, 0x2B, 0x2C, 0x15, 0x2C, 0x42, 0x41, 0x2B, 0x0A,
+  0x08, 0x09, 0x15, 0x2C, 0x43, 0x1B, 0x29, 0x40, 0x42, 0x45, 0x45, 0x42, 0x82, 0x47, 0x05, 0x49,
+  0x48, 0x48, 0x3E, 0x2C, 0x2C, 0x80, 0x48, 0x80, 0x47, 0x0F, 0x46, 0x3D, 0x2C, 0x32, 0x45, 0x3E,
+  0x27, 0x45, 0x45, 0x3E, 0x25, 0x2C, 0x29, 0x28, 0x2A, 0x2D, 0x80, 0x45, 0x42, 0x1D, 0x2A, 0x28,
+  0x2A, 0x12, 0x04, 0x09, 0x04, 0x07, 0x07, 0x0F, 0x3D, 0x24, 0x29, 0x2A, 0x28, 0x2A, 0x47, 0x2E,
+  0x2B, 0x47, 0x24, 0x46, 0x47, 0x45, 0x47, 0x2A, 0x2A, 0x3D, 0x32, 0x40, 0x28, 0x1A, 0x27, 0x28,
+  0x3E, 0x29, 0x1B, 0x6D, 0x99, 0x9B, 0xB3, 0x5B, 0x2C, 0xB5, 0x9B, 0x5A, 0x86, 0xB5, 0x9B, 0x81,
+  0x80, 0x58, 0x57, 0x91, 0xB3, 0x99, 0x9A, 0xB7, 0x94, 0x98, 0x89, 0x86, 0x85, 0x5A, 0x89, 0x7E,
+  0x80, 0xB6, 0x04, 0xB5, 0xB3, 0x9B, 0x8C, 0x8B, 0x82, 0x8C, 0x03, 0x8A, 0x95, 0x95, 0x8A, 0x80,
+  0x59, 0x24, 0x9C, 0xB5, 0x9B, 0x94, 0x1A, 0x10, 0xB0, 0x3D, 0x2C, 0x15, 0xCE, 0x2D, 0xB0, 0xB3,
+  0xB3, 0x99, 0x3D, 0x1B, 0x1D, 0x2C, 0x42, 0x44, 0x45, 0x11, 0x0A, 0x0A, 0x42, 0x45, 0x44, 0x24,
+  0x46, 0x40, 0x42, 0x43, 0x44, 0x46, 0x32, 0x80, 0x47, 0x06, 0x48, 0x47, 0x48, 0x48, 0x47, 0x2C,
+  0x32, 0x81, 0x48, 0x80, 0x47, 0x55, 0x3E, 0x3D, 0x42, 0x40, 0x3E, 0x21, 0x2C, 0x45, 0x42, 0x2C,
+  0x2C, 0x45, 0x29, 0x29, 0x2A, 0x29, 0x46, 0x45, 0x47, 0x28, 0x42, 0x29, 0x32, 0x27, 0x0C, 0x00,
+  0x29, 0x06, 0x07, 0x07, 0x00, 0x2C, 0x29, 0x24, 0x2A, 0x28, 0x46, 0x47, 0x42, 0x45, 0x2C, 0x2E,
+  0x44, 0x45, 0x47, 0x45, 0x29, 0x2A, 0x28, 0x2A, 0x40, 0x32, 0x1D, 0x2A, 0x29, 0x29, 0x1C, 0xB5,
+  0x94, 0x92, 0x97, 0xB4, 0x28, 0xBD, 0xBB, 0x5C, 0x5C, 0xB9, 0x98, 0x82, 0x7E, 0x57, 0x58, 0x98,
+  0x9C, 0x94, 0xB3, 0xB4, 0x98, 0x98, 0x86, 0x89, 0x8C, 0x5A, 0x8A, 0x89, 0x09, 0xB9, 0xB5, 0xB7,
+  0x9B, 0x8B, 0x95, 0x8A, 0x8B, 0x8A, 0x8A, 0x80, 0x8C, 0x2D, 0x8B, 0x8A, 0x8C, 0x81, 0x80, 0x7E,
+  0x7E, 0x92, 0x97, 0xB3, 0xB3, 0x8D, 0x5B, 0x9A, 0x94, 0x1F, 0x76, 0xB6, 0x2C, 0x50, 0xB0, 0x92,
+  0x97, 0x43, 0x24, 0x2A, 0x40, 0x45, 0x45, 0x27, 0x2C, 0x15, 0x46, 0x47, 0x4A, 0x32, 0x44, 0x45,
+  0x46, 0x45, 0x44, 0x32, 0x2A, 0x45, 0x47, 0x47, 0x80, 0x48, 0x06, 0x49, 0x46, 0x2C, 0x47, 0x40,
+  0x49, 0x49, 0x82, 0x48, 0x0B, 0x1C, 0x1B, 0x47, 0x47, 0x39, 0x46, 0x42, 0x42, 0x40, 0x2C, 0x2B,
+  0x32, 0x80, 0x2A, 0x46, 0x2C, 0x2A, 0x48, 0x47, 0x42, 0x27, 0x26, 0x47, 0x42, 0x2A, 0x1A, 0x28,
+  0x1B, 0x28, 0x13, 0x15, 0x19, 0x29, 0x29, 0x42, 0x2C, 0x1B, 0x3E, 0x47, 0x45, 0x43, 0x2C, 0x2C,
+  0x42, 0x39, 0x45, 0x42, 0x45, 0x29, 0x28, 0x2C, 0x2B, 0x32, 0x2A, 0xB0, 0x8F, 0x46, 0x8F, 0xB5,
+  0x99, 0x94, 0x92, 0x90, 0xB4, 0xB5, 0xBA, 0xBB, 0xB8, 0xB7, 0xB4, 0x87, 0x7F, 0x57, 0x7D, 0x94,
+  0xB4, 0xB5, 0xB5, 0x8B, 0x89, 0x89, 0x85, 0x89, 0x7E, 0x85, 0x85, 0x27, 0xB8, 0xB5, 0xB8, 0xB3,
+  0x9B, 0x8C, 0x8B, 0x8C, 0x86, 0x8C, 0x95, 0x8C, 0x8C, 0x8B, 0x95, 0x85, 0x80, 0x80, 0x59, 0x8B,
+  0xB5, 0x9A, 0x99, 0x9A, 0x94, 0x9C, 0xA9, 0x93, 0x32, 0xA1, 0xA1, 0x42, 0xB0, 0xB5, 0x92, 0x97,
+  0xB0, 0x3E, 0x2D, 0x42, 0x81, 0x45, 0x16, 0x46, 0x32, 0x32, 0x48, 0x48, 0x44, 0x45, 0x44, 0x47,
+  0x42, 0x42, 0x23, 0x49, 0x47, 0x48, 0x49, 0x48, 0x4A, 0x49, 0x44, 0x49, 0x4C, 0x48, 0x82, 0x49,
+  0x57, 0x47, 0x49, 0x1E, 0x46, 0x48, 0x48, 0x47, 0x2D, 0x47, 0x4A, 0x49, 0x2C, 0x2C, 0x2B, 0x2B,
+  0x2C, 0x2A, 0x2A, 0x2C, 0x46, 0x47, 0x47, 0x29, 0x29, 0x45, 0x47, 0x32, 0x25, 0x28, 0x29, 0x29,
+  0x27, 0x42, 0x21, 0x2A, 0x29, 0x32, 0x44, 0x46, 0x2C, 0x2D, 0x47, 0x45, 0x48, 0x2C, 0x2B, 0x3A,
+  0x48, 0x47, 0x2B, 0x47, 0x1E, 0x28, 0x2A, 0x44, 0x46, 0x8F, 0x9A, 0x1F, 0xB7, 0xB4, 0x97, 0x97,
+  0x99, 0x15, 0x9B, 0xBD, 0xBE, 0xBD, 0xB6, 0x95, 0x98, 0x7C, 0x59, 0x7C, 0x57, 0xB7, 0x97, 0xB3,
+  0x88, 0x89, 0x8A, 0x86, 0x8A, 0x86, 0x7E, 0x8A, 0x81, 0x06, 0xB6, 0xB4, 0xBB, 0x9B, 0x9B, 0x91,
+  0x95, 0x80, 0x8B, 0x22, 0x8C, 0x95, 0x8C, 0x8B, 0x86, 0x82, 0x85, 0x81, 0x7E, 0x85, 0x9C, 0x98,
+  0x99, 0x97, 0x99, 0x83, 0xA9, 0xA8, 0xA9, 0xA1, 0xA1, 0x2B, 0xB5, 0xB4, 0xB3, 0x92, 0x50, 0x60,
+  0x37, 0x44, 0x55, 0x45, 0x42, 0x47, 0x49, 0x80, 0x47, 0x1A, 0x48, 0x47, 0x47, 0x4E, 0x49, 0x32,
+  0x48, 0x49, 0x49, 0x48, 0x49, 0x46, 0x49, 0x4C, 0x49, 0x4B, 0x4A, 0x4C, 0x4C, 0x4A, 0x49, 0x4A,
+  0x49, 0x4A, 0x49, 0x32, 0x43, 0x80, 0x49, 0x04, 0x44, 0x2E, 0x49, 0x4A, 0x49, 0x80, 0x2C, 0x12,
+  0x46, 0x2B, 0x2A, 0x2C, 0x47, 0x2C, 0x46, 0x47, 0x45, 0x2C, 0x29, 0x47, 0x40, 0x47, 0x28, 0x21,
+  0x40, 0x28, 0x1D, 0x80, 0x2A, 0x33, 0x2C, 0x46, 0x49, 0x45, 0x2F, 0x49, 0x48, 0x48, 0x47, 0x32,
+  0x2B, 0x42, 0x46, 0x48, 0x48, 0x49, 0x2C, 0x2C, 0x2B, 0x2B, 0xB5, 0xBB, 0x1F, 0xBE, 0xB4, 0x94,
+  0x92, 0x92, 0xB4, 0xB5, 0xBD, 0xBB, 0xB8, 0xBD, 0x81, 0x7E, 0x7C, 0x7C, 0x7E, 0x96, 0x98, 0x94,
+  0x9A, 0x8B, 0x8A, 0x8A, 0x89, 0x87, 0x8A, 0x81, 0x8B, 0x87, 0x07, 0xB6, 0xB9, 0xB5, 0xBB, 0x9B,
+  0xB9, 0x8B, 0x8B, 0x80, 0x95, 0x10, 0x96, 0x95, 0x8C, 0x89, 0x82, 0x7E, 0x80, 0x59, 0x7E, 0x59,
+  0xB4, 0xB3, 0x9B, 0x87, 0x5C, 0xA9, 0x94, 0x81, 0xA1, 0x0D, 0xB8, 0x9A, 0x94, 0x9B, 0xB3, 0x5F,
+  0x54, 0x54, 0x55, 0x6A, 0x48, 0x48, 0x49, 0x4A, 0x80, 0x49, 0x0D, 0x4C, 0x4A, 0x48, 0x47, 0x42,
+  0x4B, 0x49, 0x4A, 0x4A, 0x52, 0x42, 0x32, 0x2D, 0x4D, 0x81, 0x4C, 0x80, 0x4A, 0x1B, 0x49, 0x49,
+  0x2C, 0x4B, 0x49, 0x49, 0x4A, 0x49, 0x44, 0x48, 0x4A, 0x4C, 0x4C, 0x4A, 0x49, 0x2B, 0x2B, 0x46,
+  0x2B, 0x2C, 0x49, 0x2D, 0x2C, 0x45, 0x48, 0x2B, 0x42, 0x2C, 0x80, 0x47, 0x0C, 0x2A, 0x29, 0x45,
+  0x19, 0x47, 0x47, 0x46, 0x49, 0x32, 0x4A, 0x49, 0x49, 0x4C, 0x80, 0x49, 0x80, 0x48, 0x00, 0x1F,
+  0x80, 0x49, 0x07, 0x4C, 0x6A, 0x6F, 0xB0, 0xB5, 0xB3, 0x55, 0x99, 0x80, 0x97, 0x18, 0xB7, 0x97,
+  0x9A, 0xBB, 0xB5, 0xBE, 0x7E, 0x85, 0x86, 0x82, 0x7E, 0x7F, 0x57, 0x57, 0xB3, 0x9A, 0x8B, 0x88,
+  0x89, 0x8A, 0x8A, 0x8C, 0x5C, 0x8C, 0x8C, 0x08, 0xB9, 0xB6, 0xBD, 0xBD, 0x9C, 0x8E, 0x8C, 0x95,
+  0x98, 0x81, 0x96, 0x80, 0x87, 0x0B, 0x7F, 0x58, 0x7C, 0x59, 0xBE, 0xB3, 0xB7, 0x94, 0x98, 0x81,
+  0x93, 0x93, 0x80, 0xA1, 0x0E, 0xA9, 0xB6, 0xB4, 0x99, 0x97, 0x94, 0x5F, 0x60, 0x68, 0x68, 0x5E,
+  0x60, 0x5F, 0x6A, 0x4E, 0x80, 0x49, 0x00, 0x4C, 0x83, 0x4A, 0x07, 0x4C, 0x4C, 0x52, 0x43, 0x52,
+  0x4D, 0x4D, 0x4B, 0x80, 0x4D, 0x05, 0x4C, 0x4B, 0x48, 0x4A, 0x32, 0x50, 0x80, 0x4C, 0x02, 0x4B,
+  0x3E, 0x50, 0x81, 0x4C, 0x18, 0x51, 0x4C, 0x4B, 0x4B, 0x4C, 0x50, 0x2C, 0x2B, 0x4B, 0x50, 0x50,
+  0x32, 0x49, 0x49, 0x46, 0x2B, 0x47, 0x47, 0x46, 0x29, 0x2C, 0x45, 0x48, 0x47, 0x47, 0x80, 0x48,
+  0x30, 0x49, 0x49, 0x4A, 0x49, 0x4A, 0x49, 0x49, 0x4A, 0x4A, 0x4C, 0x4C, 0x52, 0x52, 0x6D, 0x6B,
+  0x5F, 0x60, 0xB8, 0xB8, 0x56, 0x9B, 0x97, 0x98, 0x92, 0x92, 0x99, 0xB3, 0x99, 0xBB, 0xBD, 0x96,
+  0x80, 0x85, 0x89, 0x7E, 0x7C, 0x7D, 0x5C, 0x9B, 0x9C, 0x99, 0x98, 0x8A, 0x8A, 0x8C, 0x86, 0x5C,
+  0x87, 0x87, 0x07, 0xB9, 0xB9, 0xB8, 0xB8, 0xBD, 0x95, 0x8C, 0x8C, 0x80, 0x95, 0x23, 0x8B, 0x95,
+  0x8A, 0x8A, 0x86, 0x80, 0x8C, 0x7E, 0x88, 0x9C, 0xBD, 0x99, 0x92, 0x98, 0x83, 0x94, 0x94, 0xA1,
+  0xA8, 0xA1, 0xA1, 0xB6, 0xB5, 0x98, 0x92, 0x99, 0xB4, 0x66, 0x60, 0x60, 0x6A, 0x5F, 0x5F, 0x60,
+  0x47, 0x4D, 0x80, 0x4C, 0x00, 0x4D, 0x80, 0x4C, 0x05, 0x4B, 0x4B, 0x51, 0x38, 0x4C, 0x51, 0x85,
+  0x4D, 0x05, 0x46, 0x31, 0x2B, 0x4C, 0x30, 0x47, 0x82, 0x4D, 0x0D, 0x4B, 0x4C, 0x52, 0x4E, 0x51,
+  0x4C, 0x4B, 0x51, 0x4A, 0x4C, 0x2D, 0x2B, 0x4C, 0x4C, 0x81, 0x49, 0x0B, 0x4A, 0x32, 0x48, 0x49,
+  0x47, 0x2D, 0x49, 0x2B, 0x49, 0x47, 0x47, 0x51, 0x80, 0x49, 0x80, 0x4A, 0x82, 0x4C, 0x0E, 0x4D,
+  0x5E, 0x4F, 0x4B, 0x6F, 0x6B, 0x6D, 0xE8, 0xB5, 0x9B, 0x50, 0xB3, 0x99, 0x94, 0x97, 0x80, 0x92,
+  0x15, 0xB7, 0xB6, 0xB8, 0xBD, 0x86, 0x82, 0x8A, 0x7E, 0x7F, 0x96, 0x9C, 0xB3, 0xB7, 0x8C, 0x8A,
+  0x8A, 0x87, 0x87, 0x95, 0x8C, 0x8A, 0x89, 0x3C, 0xB9, 0xB7, 0xB6, 0xB8, 0xBC, 0xBD, 0x8C, 0x8C,
+  0x8B, 0x8C, 0x8C, 0x95, 0x8C, 0x8A, 0x8C, 0x89, 0x86, 0x85, 0x7F, 0x7E, 0x9B, 0x99, 0xB4, 0x92,
+  0x8B, 0x83, 0x9B, 0x97, 0x93, 0xA1, 0x9F, 0xDC, 0xB5, 0xB4, 0x9B, 0x9B, 0x88, 0x6D, 0x6C, 0x85,
+  0x7C, 0x59, 0x5F, 0x65, 0x5F, 0x6A, 0x60, 0x4F, 0x52, 0x4F, 0x4F, 0x4E, 0x4D, 0x4D, 0x4E, 0x52,
+  0x44, 0x4E, 0x4D, 0x51, 0x4E, 0x81, 0x4D, 0x06, 0x4C, 0x4C, 0x40, 0x32, 0x4D, 0x4D, 0x4B, 0x81,
+  0x4D, 0x00, 0x4E, 0x81, 0x4D, 0x14, 0x51, 0x4C, 0x51, 0x4D, 0x4E, 0x44, 0x4D, 0x4B, 0x4C, 0x4C,
+  0x32, 0x4C, 0x4C, 0x4A, 0x4A, 0x4C, 0x4C, 0x4B, 0x4C, 0x55, 0x4A, 0x80, 0x49, 0x05, 0x4A, 0x49,
+  0x49, 0x3E, 0x4D, 0x4B, 0x82, 0x4C, 0x2B, 0x4E, 0x4F, 0x4E, 0x4B, 0x52, 0x65, 0x61, 0x6A, 0x6D,
+  0x6C, 0xB6, 0xB5, 0xB4, 0x99, 0x94, 0x9B, 0x9A, 0x98, 0x92, 0xB3, 0x97, 0x9A, 0xB7, 0xBC, 0x57,
+  0x7E, 0x81, 0x82, 0x85, 0x7D, 0x7F, 0x7C, 0x7E, 0x9A, 0xB4, 0x96, 0x8C, 0x8B, 0x8B, 0x8C, 0x8C,
+  0x86, 0x8A, 0x8A, 0x06, 0xB6, 0xBB, 0xBC, 0xBB, 0xB5, 0x99, 0x98, 0x82, 0x95, 0x02, 0x8B, 0x8C,
+  0x95, 0x80, 0x86, 0x0A, 0x89, 0xB4, 0xB8, 0xB3, 0x99, 0x97, 0x96, 0x98, 0x8B, 0x97, 0x94, 0x80,
+  0xA1, 0x14, 0xAF, 0xB8, 0xB3, 0x92, 0x96, 0x6C, 0x66, 0x86, 0x80, 0x80, 0x7E, 0x60, 0x60, 0x5F,
+  0x65, 0x5F, 0x5F, 0x6A, 0x4D, 0x6D, 0x51, 0x82, 0x4E, 0x01, 0x51, 0x51, 0x81, 0x4E, 0x08, 0x4D,
+  0x4C, 0x2D, 0x4C, 0x4D, 0x4C, 0x4C, 0x4D, 0x4D, 0x81, 0x4E, 0x00, 0x4D, 0x81, 0x4E, 0x05, 0x4F,
+  0x4E, 0x4D, 0x4E, 0x4F, 0x4C, 0x81, 0x4D, 0x0A, 0x4C, 0x2F, 0x4D, 0x4D, 0x4C, 0x4B, 0x4D, 0x4A,
+  0x49, 0x4B, 0x49, 0x80, 0x4A, 0x1B, 0x4B, 0x4D, 0x4C, 0x4D, 0x4B, 0x4D, 0x4C, 0x4C, 0x5E, 0x52,
+  0x52, 0x5E, 0x51, 0x60, 0x54, 0x65, 0x66, 0x66, 0x6B, 0x6B, 0xB8, 0xB8, 0xB5, 0xB7, 0x9B, 0x94,
+  0x9A, 0x97, 0x80, 0x92, 0x08, 0x9B, 0xB9, 0xB8, 0x7F, 0x7F, 0x85, 0x7E, 0x7F, 0x80, 0x80, 0x7C,
+  0x0A, 0xB8, 0xB6, 0xB8, 0x96, 0x95, 0x8B, 0x8B, 0x8C, 0x8A, 0x8A, 0x8C, 0x08, 0xB9, 0xB9, 0xB6,
+  0xB8, 0xB3, 0x9B, 0xB3, 0x95, 0x8B, 0x81, 0x95, 0x2B, 0x8A, 0x91, 0x87, 0x8C, 0x8A, 0x8A, 0x8B,
+  0x9A, 0x9B, 0x99, 0x98, 0x99, 0x8B, 0x88, 0x99, 0x97, 0xA1, 0xA1, 0xB6, 0xB5, 0xB9, 0x9A, 0x97,
+  0x99, 0x94, 0x87, 0x85, 0x80, 0x59, 0x5C, 0x64, 0x65, 0x61, 0x62, 0x5F, 0x61, 0x6B, 0x4F, 0x61,
+  0x54, 0x51, 0x51, 0x4E, 0x4E, 0x80, 0x51, 0x01, 0x52, 0x51, 0x81, 0x4E, 0x00, 0x51, 0x81, 0x4D,
+  0x88, 0x4E, 0x80, 0x4D, 0x04, 0x4E, 0x4E, 0x4D, 0x4D, 0x4E, 0x80, 0x4D, 0x0D, 0x3E, 0x51, 0x4A,
+  0x4D, 0x4D, 0x4B, 0x4C, 0x4D, 0x54, 0x55, 0x4B, 0x4C, 0x4C, 0x4B, 0x80, 0x4D, 0x80, 0x4E, 0x2E,
+  0x51, 0x5E, 0x4F, 0x4F, 0x5F, 0x4F, 0x60, 0x53, 0x63, 0x6C, 0x6C, 0x6E, 0x6B, 0x5E, 0xB8, 0xBB,
+  0xB3, 0xB7, 0x94, 0xB4, 0x97, 0x9C, 0x92, 0x99, 0x97, 0xB7, 0x5C, 0x89, 0x7E, 0x82, 0x80, 0x85,
+  0x7C, 0x59, 0x91, 0x9C, 0xB6, 0xB8, 0xB9, 0x91, 0x91, 0x8C, 0x8C, 0x96, 0x84, 0x95, 0x8C, 0x08,
+  0xB9, 0xB6, 0xB9, 0xB7, 0xB3, 0xBD, 0x98, 0x9C, 0x91, 0x80, 0x95, 0x2E, 0x91, 0x95, 0x95, 0x8B,
+  0x86, 0x86, 0x8A, 0x91, 0xB6, 0x9B, 0x9B, 0x9C, 0x97, 0x98, 0x8E, 0x97, 0x9A, 0xA9, 0xA4, 0xBA,
+  0xBC, 0xB4, 0x92, 0x9C, 0x8B, 0x94, 0x81, 0x85, 0x80, 0x7F, 0x6A, 0x6A, 0x63, 0x66, 0x62, 0x65,
+  0x65, 0x61, 0x5F, 0x60, 0x55, 0x54, 0x5E, 0x56, 0x53, 0x4F, 0x4F, 0x81, 0x51, 0x02, 0x4E, 0x4E,
+  0x51, 0x84, 0x4E, 0x80, 0x51, 0x03, 0x4E, 0x51, 0x4E, 0x4E, 0x80, 0x51, 0x82, 0x4E, 0x00, 0x4D,
+  0x81, 0x4E, 0x02, 0x52, 0x3E, 0x45, 0x82, 0x4D, 0x06, 0x4E, 0x54, 0x51, 0x4E, 0x4D, 0x51, 0x56,
+  0x80, 0x4E, 0x30, 0x6A, 0x51, 0x52, 0x5E, 0x61, 0x60, 0x5F, 0x60, 0x66, 0x6C, 0x6B, 0x6C, 0x6B,
+  0x6B, 0x72, 0xE8, 0xBB, 0xB3, 0x97, 0x92, 0xBD, 0x9A, 0x98, 0x97, 0x98, 0x99, 0x97, 0xBD, 0xBE,
+  0x95, 0x82, 0x85, 0x86, 0x89, 0x80, 0x7C, 0x7C, 0x7E, 0x83, 0xB8, 0xB8, 0xBE, 0x95, 0x8C, 0x95,
+  0x8C, 0x83, 0x96, 0x8C, 0x00, 0xB9, 0x80, 0xB6, 0x28, 0xB3, 0xB3, 0xB6, 0xB5, 0x96, 0x91, 0x95,
+  0x8C, 0x95, 0x8E, 0x91, 0x8B, 0x8A, 0x8A, 0xB3, 0x92, 0xB8, 0x9B, 0x9C, 0x94, 0x97, 0x99, 0x98,
+  0x99, 0x9A, 0xA9, 0xA1, 0x9C, 0xB4, 0xB5, 0xB4, 0xB7, 0x91, 0x82, 0x82, 0x80, 0x7E, 0x7E, 0x5B,
+  0x6C, 0x65, 0x80, 0x62, 0x00, 0x67, 0x80, 0x60, 0x0A, 0x5E, 0x62, 0x65, 0x6A, 0x53, 0x4D, 0x52,
+  0x51, 0x51, 0x4F, 0x52, 0x80, 0x51, 0x00, 0x4E, 0x80, 0x51, 0x03, 0x4E, 0x51, 0x51, 0x52, 0x88,
+  0x51, 0x04, 0x4E, 0x51, 0x4E, 0x51, 0x51, 0x80, 0x4E, 0x03, 0x51, 0x51, 0x4E, 0x4E, 0x80, 0x4D,
+  0x83, 0x4E, 0x09, 0x53, 0x60, 0x56, 0x51, 0x51, 0x6A, 0x53, 0x4F, 0x5F, 0x67, 0x81, 0x60, 0x27,
+  0x71, 0x67, 0x6C, 0x61, 0x5F, 0x9D, 0xBC, 0xB8, 0x99, 0x94, 0x97, 0x9B, 0x9A, 0x94, 0x97, 0x9C,
+  0x97, 0x9A, 0xB0, 0xBC, 0xBD, 0x83, 0x89, 0x89, 0x85, 0x86, 0x59, 0x7F, 0x7F, 0x98, 0xB8, 0xB4,
+  0xB3, 0xBB, 0x8C, 0x95, 0x8C, 0x5C, 0x8A, 0x95, 0x2C, 0xB9, 0xB9, 0xB3, 0xB3, 0xB9, 0xB9, 0x91,
+  0x96, 0x96, 0x95, 0x8B, 0x95, 0x91, 0x9C, 0xBB, 0x95, 0x8C, 0x8B, 0xBD, 0xB5, 0xBB, 0xBB, 0x99,
+  0x99, 0x97, 0x96, 0x92, 0x9B, 0x97, 0xA9, 0xAF, 0x84, 0xB9, 0xB5, 0xB8, 0xB7, 0x97, 0x91, 0x85,
+  0x82, 0x80, 0x7F, 0x59, 0x5F, 0x6B, 0x80, 0x67, 0x01, 0x66, 0x67, 0x80, 0x62, 0x13, 0x60, 0x65,
+  0x66, 0x54, 0x54, 0x52, 0x53, 0x53, 0x4F, 0x53, 0x4F, 0x51, 0x52, 0x53, 0x51, 0x52, 0x52, 0x51,
+  0x52, 0x4F, 0x80, 0x53, 0x00, 0x51, 0x81, 0x52, 0x03, 0x51, 0x51, 0x52, 0x52, 0x84, 0x51, 0x00,
+  0x4E, 0x81, 0x51, 0x0A, 0x4E, 0x51, 0x4E, 0x52, 0x4F, 0x52, 0x52, 0x51, 0x51, 0x54, 0x61, 0x80,
+  0x60, 0x30, 0x6A, 0x60, 0x60, 0x62, 0x65, 0x63, 0x5F, 0x5F, 0x61, 0x71, 0x6C, 0x74, 0x6C, 0x71,
+  0x70, 0x76, 0xB5, 0xB3, 0x97, 0x92, 0x99, 0xB8, 0x94, 0x97, 0x99, 0xB4, 0x9B, 0xB4, 0x80, 0xBD,
+  0x8A, 0x85, 0x80, 0x85, 0x7E, 0x7E, 0x82, 0x8A, 0x8A, 0xB6, 0xB9, 0xB8, 0xBD, 0xBB, 0x91, 0x8C,
+  0x5C, 0x95, 0x8C, 0x06, 0xB9, 0xBC, 0xB9, 0xB4, 0xB3, 0x9B, 0x8C, 0x80, 0x95, 0x14, 0x91, 0x96,
+  0x91, 0x96, 0x91, 0x8B, 0x8A, 0x8B, 0x8A, 0xBD, 0x92, 0xB7, 0x9B, 0x97, 0x98, 0x92, 0x9A, 0xB3,
+  0x94, 0xB0, 0xA9, 0x80, 0xB9, 0x0A, 0xB8, 0x98, 0x92, 0x92, 0x81, 0x86, 0x7E, 0x80, 0x6D, 0x64,
+  0x68, 0x82, 0x67, 0x01, 0x66, 0x67, 0x80, 0x62, 0x0B, 0x6B, 0x61, 0x6F, 0x54, 0x54, 0x6A, 0x54,
+  0x4F, 0x53, 0x53, 0x52, 0x53, 0x80, 0x52, 0x04, 0x53, 0x52, 0x52, 0x53, 0x52, 0x80, 0x53, 0x0E,
+  0x52, 0x51, 0x53, 0x51, 0x52, 0x53, 0x52, 0x52, 0x53, 0x51, 0x52, 0x51, 0x51, 0x4F, 0x51, 0x80,
+  0x52, 0x3F, 0x51, 0x52, 0x60, 0x47, 0x54, 0x60, 0x6A, 0x53, 0x6E, 0x56, 0x5F, 0x65, 0x65, 0x62,
+  0x67, 0x61, 0x60, 0x5F, 0x65, 0x62, 0x62, 0x6C, 0x5F, 0x6B, 0x71, 0x6E, 0x73, 0x74, 0x75, 0x6F,
+  0xB5, 0xB9, 0xBD, 0x99, 0x9C, 0xB3, 0xB5, 0x92, 0x9B, 0xB3, 0xB3, 0x9B, 0xB8, 0xBE, 0x87, 0x5C,
+  0x82, 0x80, 0x86, 0x86, 0x7F, 0x85, 0x85, 0xBE, 0xB8, 0xB9, 0xB9, 0x98, 0x91, 0x96, 0x96, 0x5C,
+  0x8C, 0x95, 0x44, 0xBA, 0xB9, 0xB6, 0x99, 0xB8, 0xB8, 0x95, 0x95, 0x8C, 0x95, 0x91, 0x96, 0x8C,
+  0x96, 0x96, 0x8A, 0x95, 0x9C, 0x8D, 0x9C, 0xBC, 0xB5, 0x99, 0x97, 0x96, 0xB3, 0x9A, 0x94, 0x99,
+  0xB0, 0xAF, 0xB8, 0xB9, 0xBB, 0x9A, 0xBB, 0x98, 0x96, 0x85, 0x89, 0x86, 0x81, 0x5B, 0x5B, 0x6D,
+  0x67, 0x6B, 0x65, 0x6B, 0x67, 0x69, 0x6B, 0x67, 0x6B, 0x6B, 0x68, 0x66, 0x67, 0x65, 0x60, 0x68,
+  0x5F, 0x4F, 0x54, 0x52, 0x53, 0x53, 0x52, 0x52, 0x81, 0x53, 0x00, 0x52, 0x80, 0x53, 0x10, 0x54,
+  0x52, 0x53, 0x53, 0x52, 0x52, 0x53, 0x52, 0x53, 0x51, 0x52, 0x52, 0x53, 0x4F, 0x5E, 0x3C, 0x4F,
+  0x80, 0x53, 0x09, 0x4F, 0x61, 0x65, 0x61, 0x6B, 0x60, 0x54, 0x6D, 0x5E, 0x60, 0x80, 0x62, 0x1F,
+  0x66, 0x62, 0x65, 0x62, 0x62, 0x64, 0x61, 0x6D, 0x6F, 0x6D, 0x71, 0x66, 0x74, 0x74, 0xDA, 0xE8,
+  0xE8, 0x9A, 0x9B, 0xB3, 0x94, 0xB5, 0x92, 0x98, 0x9C, 0xB3, 0x9B, 0x98, 0x82, 0xBE, 0x86, 0x89,
+  0x80, 0x80, 0x0E, 0x86, 0x82, 0x85, 0x82, 0x85, 0xB6, 0xB9, 0xB9, 0x92, 0x99, 0x92, 0x91, 0x83,
+  0x95, 0x96, 0x2F, 0xBC, 0xB6, 0xB9, 0xB9, 0xB8, 0xB7, 0xB7, 0x92, 0x95, 0x8B, 0x96, 0x9B, 0x95,
+  0x8C, 0x96, 0x98, 0x8C, 0xBC, 0xB8, 0xB7, 0xB9, 0x9A, 0xB8, 0x92, 0x9B, 0x99, 0x97, 0x9B, 0x9A,
+  0xB0, 0xAF, 0xBC, 0xB3, 0xB7, 0x9B, 0x9B, 0x98, 0x8B, 0x89, 0x89, 0x7F, 0x7E, 0x59, 0x59, 0x5B,
+  0x68, 0x66, 0x5E, 0x80, 0x6B, 0x0C, 0x67, 0x6B, 0x67, 0x6B, 0x67, 0x67, 0x66, 0x67, 0x62, 0x61,
+  0x61, 0x60, 0x60, 0x81, 0x53, 0x06, 0x54, 0x54, 0x53, 0x54, 0x53, 0x53, 0x54, 0x80, 0x53, 0x05,
+  0x52, 0x54, 0x54, 0x53, 0x53, 0x54, 0x80, 0x53, 0x11, 0x52, 0x53, 0x53, 0x66, 0x64, 0x61, 0x60,
+  0x60, 0x5F, 0x66, 0x60, 0x62, 0x62, 0x67, 0x66, 0x61, 0x65, 0x6D, 0x81, 0x62, 0x01, 0x67, 0x67,
+  0x82, 0x62, 0x17, 0x63, 0x71, 0x6E, 0x71, 0x71, 0x6E, 0x74, 0x74, 0x6E, 0x78, 0xB8, 0xBB, 0xB3,
+  0xB7, 0x97, 0xB4, 0xB5, 0x94, 0xB3, 0x99, 0xB5, 0xB7, 0x85, 0x86, 0x80, 0x85, 0x10, 0x80, 0x80,
+  0x89, 0x82, 0x82, 0x8B, 0x87, 0xB7, 0xB6, 0xB8, 0xBD, 0x91, 0x95, 0x96, 0x5D, 0x91, 0x95, 0x38,
+  0x95, 0xB8, 0xBA, 0xB6, 0xBC, 0xBD, 0xB5, 0xB7, 0xB7, 0x95, 0x98, 0xB7, 0x9C, 0xB7, 0x9B, 0xBD,
+  0xB8, 0xB8, 0xB5, 0xBC, 0xB4, 0xB8, 0xB7, 0x9A, 0x92, 0x91, 0x92, 0xB3, 0xB5, 0xB0, 0xB0, 0xB9,
+  0xBC, 0xB9, 0xBC, 0xB3, 0x9B, 0x98, 0x8A, 0x87, 0x82, 0x8A, 0x7E, 0x7C, 0x7C, 0x5D, 0x6C, 0xA9,
+  0xA4, 0x6C, 0x6B, 0x67, 0x67, 0x6B, 0x66, 0x63, 0x66, 0x80, 0x67, 0x0E, 0x63, 0x66, 0x62, 0x66,
+  0x60, 0x6A, 0x6A, 0x5E, 0x54, 0x54, 0x53, 0x53, 0x54, 0x53, 0x54, 0x81, 0x53, 0x02, 0x54, 0x53,
+  0x53, 0x80, 0x54, 0x06, 0x53, 0x54, 0x53, 0x54, 0x60, 0x5F, 0x64, 0x80, 0x61, 0x03, 0x65, 0x61,
+  0x65, 0x62, 0x80, 0x67, 0x06, 0x69, 0x67, 0x5F, 0x64, 0x67, 0x67, 0x66, 0x81, 0x62, 0x04, 0x5F,
+  0x66, 0x62, 0x6F, 0x74, 0x80, 0x71, 0x26, 0x73, 0x75, 0x71, 0xD7, 0xB9, 0xB9, 0xB3, 0x99, 0xB7,
+  0x94, 0x92, 0xB5, 0x99, 0xB4, 0xB7, 0x9C, 0x88, 0x89, 0x85, 0x85, 0x8A, 0x95, 0x89, 0x8A, 0x80,
+  0x7F, 0x7F, 0x7E, 0x89, 0xBD, 0xB6, 0xB8, 0x91, 0x96, 0x91, 0x91, 0x5D, 0x96, 0x95, 0x34, 0x84,
+  0xBA, 0xB9, 0xBD, 0xBA, 0xBD, 0xBC, 0xB4, 0xBC, 0x8E, 0x94, 0xB5, 0xB7, 0xB4, 0xBB, 0xBA, 0xBC,
+  0xB5, 0xB6, 0xB7, 0x9A, 0xB8, 0x9B, 0xB3, 0x97, 0xB3, 0x94, 0xB5, 0x99, 0xB0, 0xA8, 0xBC, 0xB9,
+  0xBC, 0xBA, 0xBD, 0x9B, 0x99, 0x98, 0x87, 0x8A, 0x87, 0x82, 0x7C, 0x7C, 0x75, 0x6C, 0xD7, 0xA1,
+  0x6C, 0x69, 0x69, 0x6B, 0x83, 0x67, 0x10, 0x62, 0x67, 0x62, 0x67, 0x67, 0x6B, 0x5F, 0x65, 0x5F,
+  0x48, 0x6A, 0x4F, 0x54, 0x53, 0x4D, 0x53, 0x53, 0x86, 0x54, 0x05, 0x53, 0x53, 0x4F, 0x5E, 0x5F,
+  0x60, 0x80, 0x62, 0x01, 0x5F, 0x62, 0x83, 0x67, 0x39, 0x62, 0x67, 0x62, 0x67, 0x62, 0x67, 0x67,
+  0x62, 0x66, 0x67, 0x62, 0x66, 0x61, 0x68, 0x67, 0x72, 0x6F, 0x71, 0x72, 0x73, 0x72, 0x6D, 0xB6,
+  0xB8, 0xB9, 0xB9, 0xB7, 0x98, 0x9B, 0x9C, 0xBD, 0xB0, 0xBB, 0xB3, 0xBD, 0x95, 0x87, 0x89, 0x89,
+  0x8A, 0x95, 0x8B, 0x8C, 0x7F, 0x7F, 0x89, 0x85, 0x89, 0xBB, 0xB8, 0xB6, 0xBD, 0x95, 0x91, 0x98,
+  0x83, 0x97, 0x95, 0x37, 0xBB, 0xBA, 0xB9, 0xBC, 0xB9, 0xB8, 0xB6, 0xBA, 0xB9, 0xBA, 0x92, 0xB6,
+  0xB9, 0xB8, 0xB4, 0xBC, 0xB9, 0xBC, 0xB3, 0xB7, 0xBC, 0xB8, 0xB4, 0x97, 0x9B, 0xB3, 0xB5, 0xB4,
+  0x94, 0xB0, 0xB9, 0xB8, 0xB8, 0xBC, 0xB7, 0x9B, 0xB4, 0x98, 0x8B, 0x8A, 0x86, 0x8C, 0x86, 0x7E,
+  0x7E, 0x5D, 0x72, 0xA1, 0xA1, 0x6C, 0x6A, 0x56, 0x6B, 0x67, 0x6B, 0x6B, 0x81, 0x67, 0x11, 0x62,
+  0x66, 0x62, 0x62, 0x65, 0x64, 0x66, 0x67, 0x6C, 0x66, 0x54, 0x66, 0x54, 0x55, 0x4F, 0x54, 0x53,
+  0x51, 0x80, 0x53, 0x0F, 0x54, 0x53, 0x54, 0x53, 0x4F, 0x6A, 0x68, 0x60, 0x64, 0x60, 0x62, 0x62,
+  0x66, 0x67, 0x62, 0x6B, 0x81, 0x67, 0x00, 0x66, 0x84, 0x67, 0x32, 0x61, 0x66, 0x5F, 0x61, 0x66,
+  0x6C, 0x6B, 0x70, 0x72, 0x6F, 0x72, 0x73, 0x74, 0x73, 0x73, 0x71, 0x70, 0xB9, 0xB4, 0xB4, 0x94,
+  0x9B, 0x92, 0xB4, 0xB0, 0x99, 0xB8, 0xB6, 0xBD, 0x91, 0x95, 0x8A, 0x82, 0x85, 0x95, 0x83, 0x8A,
+  0x7E, 0x7F, 0x85, 0x86, 0xB7, 0xB8, 0xB4, 0xB9, 0x9C, 0x96, 0x98, 0x5D, 0x9C, 0x98, 0x3A, 0x95,
+  0xBA, 0xBD, 0xBC, 0xBA, 0xB9, 0xB8, 0xB0, 0xBC, 0xB8, 0xB7, 0xBA, 0xBC, 0xBB, 0xBC, 0xB3, 0xBA,
+  0xB8, 0xB7, 0xB7, 0xB5, 0xB9, 0xB8, 0x99, 0xB7, 0x94, 0x9A, 0x9B, 0xB4, 0xB5, 0xA8, 0xB9, 0xBC,
+  0xB8, 0xB4, 0xB4, 0x9C, 0x91, 0x8C, 0x8A, 0x8A, 0x8C, 0x86, 0x82, 0x82, 0x8D, 0x74, 0xA1, 0x70,
+  0x78, 0x6D, 0x56, 0x6C, 0x6B, 0x67, 0x6B, 0x67, 0x6B, 0x67, 0x85, 0x62, 0x0A, 0x67, 0x67, 0x6B,
+  0x61, 0x64, 0x55, 0x61, 0x5E, 0x60, 0x6A, 0x6A, 0x80, 0x54, 0x0C, 0x53, 0x53, 0x6D, 0x6A, 0x5E,
+  0x66, 0x66, 0x6B, 0x66, 0x6A, 0x67, 0x62, 0x62, 0x82, 0x67, 0x20, 0x6B, 0x6B, 0x67, 0x62, 0x67,
+  0x67, 0x62, 0x67, 0x6B, 0x67, 0x61, 0x61, 0x62, 0x70, 0x72, 0x72, 0x74, 0x71, 0x73, 0x72, 0x72,
+  0x74, 0x74, 0x75, 0xA2, 0xCE, 0xDC, 0xBC, 0xB3, 0x9A, 0x9B, 0x97, 0xB4, 0x81, 0xB8, 0x02, 0xB9,
+  0xB8, 0x99, 0x80, 0x95, 0x03, 0x8C, 0x87, 0x83, 0x95, 0x80, 0x86, 0x0A, 0x8B, 0x91, 0x95, 0xB7,
+  0xBD, 0xB8, 0x98, 0xBD, 0x5D, 0x99, 0x99, 0x3F, 0x81, 0x83, 0x5C, 0xB6, 0xB4, 0xBA, 0x9A, 0xB7,
+  0xB9, 0xBC, 0xB0, 0xBC, 0x9A, 0xB5, 0xBD, 0xB4, 0xBC, 0xB9, 0xB9, 0xBC, 0xB8, 0xB8, 0xB4, 0xB9,
+  0x99, 0x97, 0x9B, 0xB3, 0xB5, 0xB0, 0xB6, 0xBC, 0xB5, 0xB4, 0xB4, 0xB8, 0xB4, 0x91, 0x8A, 0x8B,
+  0x95, 0x8C, 0x89, 0x85, 0x8D, 0x77, 0x77, 0xA1, 0x9F, 0x9E, 0x6D, 0x52, 0x6B, 0x6B, 0x66, 0x66,
+  0x6B, 0x62, 0x67, 0x67, 0x61, 0x66, 0x67, 0x66, 0x80, 0x62, 0x0B, 0x66, 0x66, 0x64, 0x65, 0x66,
+  0x5F, 0x6B, 0x6A, 0x65, 0x6A, 0x6C, 0x62, 0x80, 0x54, 0x0D, 0x6B, 0x65, 0x68, 0x61, 0x66, 0x66,
+  0x69, 0x68, 0x69, 0x67, 0x66, 0x67, 0x67, 0x66, 0x80, 0x67, 0x27, 0x66, 0x66, 0x67, 0x6B, 0x67,
+  0x67, 0x6B, 0x67, 0x6B, 0x6B, 0x6C, 0x71, 0x75, 0x72, 0x74, 0x71, 0x75, 0x74, 0x74, 0x72, 0x75,
+  0x77, 0x75, 0x74, 0x76, 0xB9, 0xB9, 0xBC, 0xB9, 0x99, 0xB3, 0x97, 0x97, 0xBD, 0xB8, 0xB8, 0xB6,
+  0xB9, 0xB9, 0xBC, 0x80, 0x96, 0x11, 0x8C, 0x86, 0x83, 0x95, 0x8C, 0x81, 0x89, 0x8C, 0x91, 0x95,
+  0xBD, 0xB8, 0xB6, 0xB8, 0xBA, 0x5A, 0xB8, 0xB9, 0x0F, 0x7F, 0x58, 0x84, 0xBD, 0xB9, 0xBA, 0xBB,
+  0xBC, 0xBA, 0xBC, 0x92, 0xB9, 0xB8, 0xBC, 0xBD, 0xBA, 0x80, 0xBC, 0x0E, 0xBD, 0x9A, 0xB9, 0xB3,
+  0x9A, 0x9A, 0x99, 0x99, 0xB4, 0xB4, 0xB5, 0xB9, 0xBC, 0xBC, 0xBA, 0x80, 0xB9, 0x14, 0xBD, 0x98,
+  0x88, 0x88, 0x95, 0x8C, 0x86, 0x8F, 0x7B, 0x7B, 0xA1, 0xA1, 0x9F, 0xDC, 0xAF, 0x72, 0x66, 0x67,
+  0x66, 0x6B, 0x62, 0x82, 0x67, 0x05, 0x62, 0x67, 0x67, 0x62, 0x62, 0x67, 0x82, 0x62, 0x04, 0x64,
+  0x60, 0x66, 0x67, 0x67, 0x81, 0x6C, 0x03, 0x67, 0x67, 0x62, 0x62, 0x82, 0x67, 0x00, 0x62, 0x83,
+  0x67, 0x01, 0x6B, 0x6B, 0x81, 0x67, 0x06, 0x69, 0x69, 0x66, 0x6B, 0x61, 0x71, 0x75, 0x80, 0x73,
+  0x11, 0x75, 0x73, 0x74, 0x72, 0x74, 0x7A, 0x73, 0x75, 0x70, 0x9D, 0xBA, 0xB3, 0xB4, 0xB7, 0x9C,
+  0x99, 0x97, 0xB6, 0x80, 0xB8, 0x17, 0xBC, 0x91, 0x8B, 0x8B, 0x8C, 0x96, 0x95, 0x96, 0x81, 0x86,
+  0x8A, 0x8A, 0x85, 0x87, 0x96, 0x91, 0xB9, 0xB3, 0xBD, 0xBC, 0xBB, 0x5A, 0xB8, 0xBD, 0x37, 0x87,
+  0x58, 0xB4, 0x9C, 0x94, 0x9B, 0xB6, 0x97, 0x88, 0xBE, 0x92, 0x9C, 0x92, 0xBE, 0xBE, 0xBA, 0xB7,
+  0xB8, 0xB6, 0xBC, 0xBD, 0xBA, 0xB5, 0xB8, 0x9B, 0x99, 0x9B, 0xB3, 0xB5, 0xB8, 0xB5, 0xBA, 0xBA,
+  0xB4, 0xBC, 0xBC, 0xB3, 0x9B, 0x96, 0x91, 0x86, 0x95, 0x8C, 0x80, 0x7E, 0x7E, 0xA1, 0x9F, 0x9F,
+  0x78, 0x78, 0xAF, 0x75, 0x65, 0x5F, 0x62, 0x81, 0x67, 0x06, 0x62, 0x67, 0x67, 0x62, 0x62, 0x67,
+  0x66, 0x86, 0x62, 0x04, 0x61, 0x67, 0x6B, 0x62, 0x6B, 0x80, 0x67, 0x08, 0x66, 0x67, 0x62, 0x67,
+  0x67, 0x62, 0x67, 0x67, 0x6B, 0x80, 0x67, 0x25, 0x66, 0x66, 0x6B, 0x67, 0x67, 0x6B, 0x67, 0x68,
+  0x67, 0x67, 0x6B, 0x68, 0x6C, 0x72, 0x73, 0x75, 0x73, 0x75, 0x74, 0x74, 0x75, 0x72, 0x72, 0x75,
+  0x79, 0x74, 0x76, 0x76, 0x78, 0xB1, 0xBC, 0xB0, 0xB8, 0xB4, 0x98, 0x92, 0x97, 0xBD, 0x80, 0xB9,
+  0x16, 0x9B, 0x91, 0x96, 0x95, 0x96, 0x96, 0x98, 0x5C, 0x89, 0x87, 0x89, 0x86, 0x8A, 0xBB, 0xB8,
+  0xBD, 0xBC, 0xB8, 0xB9, 0xB7, 0x5A, 0xBD, 0x94, 0x1D, 0x7F, 0x80, 0x5C, 0x87, 0x92, 0x8B, 0x9C,
+  0xB3, 0x7E, 0x58, 0xBE, 0x8E, 0xBE, 0x81, 0x87, 0xBD, 0x59, 0xBE, 0xB5, 0xBC, 0xB5, 0xBA, 0xB4,
+  0xB8, 0x9B, 0xB8, 0xB8, 0xB4, 0x9B, 0xB4, 0x80, 0xBA, 0x16, 0xB9, 0xB9, 0xB6, 0x9B, 0x98, 0x8A,
+  0x8A, 0x89, 0x8B, 0x8A, 0x59, 0x7F, 0x7D, 0x8F, 0xA1, 0x7B, 0x77, 0xB1, 0xA9, 0x78, 0x6A, 0x71,
+  0x62, 0x80, 0x67, 0x07, 0x66, 0x67, 0x62, 0x66, 0x62, 0x66, 0x62, 0x67, 0x80, 0x62, 0x00, 0x67,
+  0x81, 0x62, 0x04, 0x5F, 0x61, 0x62, 0x67, 0x5F, 0x81, 0x67, 0x00, 0x66, 0x82, 0x67, 0x02, 0x62,
+  0x67, 0x62, 0x80, 0x67, 0x00, 0x6B, 0x80, 0x67, 0x3B, 0x62, 0x67, 0x67, 0x6B, 0x67, 0x62, 0x6C,
+  0x6B, 0x6F, 0x71, 0x75, 0x72, 0x72, 0x6F, 0x73, 0x74, 0x77, 0x79, 0x73, 0x79, 0x79, 0x7A, 0x76,
+  0xB1, 0xB6, 0xB6, 0xB8, 0xBC, 0xB8, 0xB4, 0x9B, 0x94, 0xB4, 0xBA, 0xB9, 0xB9, 0xBC, 0xBC, 0x9C,
+  0x8B, 0xBE, 0x95, 0x96, 0x96, 0x83, 0x87, 0x8A, 0x86, 0x8A, 0x8C, 0xB3, 0xBD, 0xB7, 0xB9, 0xBA,
+  0xB3, 0xB7, 0x5A, 0x92, 0x8E, 0x42, 0x7D, 0x7C, 0x7D, 0x58, 0x86, 0x80, 0x7E, 0x59, 0x59, 0x7E,
+  0x5C, 0x58, 0x7D, 0x7D, 0x58, 0x82, 0x58, 0x5C, 0x57, 0x9C, 0xBD, 0x5C, 0x9C, 0xBA, 0xBC, 0xB3,
+  0xB8, 0xB5, 0xB3, 0xB0, 0xBC, 0xBA, 0xBC, 0xBC, 0xB9, 0x9B, 0xB4, 0x9B, 0x8B, 0x8B, 0x95, 0x8A,
+  0x82, 0x89, 0x7D, 0x80, 0x8F, 0xA1, 0x9F, 0x7A, 0xAA, 0xAF, 0x77, 0x6F, 0x75, 0x75, 0x70, 0x6D,
+  0x66, 0x6B, 0x61, 0x62, 0x67, 0x66, 0x66, 0x62, 0x62, 0x80, 0x66, 0x03, 0x62, 0x5F, 0x62, 0x61,
+  0x82, 0x62, 0x01, 0x66, 0x62, 0x82, 0x67, 0x04, 0x66, 0x67, 0x62, 0x67, 0x66, 0x80, 0x62, 0x80,
+  0x67, 0x1B, 0x66, 0x67, 0x68, 0x61, 0x75, 0x67, 0x73, 0x6B, 0x71, 0x74, 0x66, 0x75, 0x75, 0x74,
+  0x74, 0x75, 0x76, 0x79, 0x77, 0x79, 0x79, 0x75, 0x79, 0x79, 0x7A, 0x7B, 0x9D, 0xBA, 0x80, 0xBC,
+  0x06, 0xB5, 0x99, 0xB7, 0xBD, 0x98, 0xBC, 0xB6, 0x80, 0xB9, 0x08, 0xBC, 0xBA, 0xB7, 0x98, 0x91,
+  0x96, 0x5D, 0xBD, 0x88, 0x80, 0x96, 0x09, 0xB7, 0xB6, 0xB6, 0x8E, 0xBA, 0x9B, 0xBA, 0x5D, 0xB0,
+  0x8D, 0x80, 0x7D, 0x1A, 0x80, 0x7D, 0x82, 0x81, 0x7D, 0x58, 0x58, 0x57, 0x58, 0x89, 0x58, 0x58,
+  0x80, 0x80, 0x58, 0x57, 0xBE, 0x7D, 0x82, 0x59, 0x57, 0xBD, 0xBE, 0xBB, 0xBC, 0x9A, 0xB0, 0x81,
+  0xBA, 0x23, 0xB3, 0x9C, 0x96, 0x98, 0x96, 0x8B, 0x8C, 0x8B, 0x8C, 0x87, 0x80, 0x5D, 0xA1, 0x9F,
+  0x9F, 0xAB, 0xAF, 0xA9, 0x9F, 0x75, 0x75, 0x71, 0x70, 0x71, 0x5F, 0x67, 0x66, 0x62, 0x67, 0x67,
+  0x62, 0x62, 0x67, 0x62, 0x62, 0x66, 0x81, 0x62, 0x00, 0x5F, 0x83, 0x62, 0x08, 0x5F, 0x62, 0x67,
+  0x67, 0x62, 0x62, 0x6B, 0x62, 0x67, 0x81, 0x62, 0x80, 0x67, 0x0F, 0x5F, 0x67, 0x67, 0x71, 0x75,
+  0x6B, 0x72, 0x5F, 0x73, 0x74, 0x74, 0x75, 0x75, 0x74, 0x72, 0x75, 0x81, 0x79, 0x0F, 0x7A, 0x7A,
+  0x79, 0x7A, 0x9D, 0x77, 0x78, 0xBA, 0xBA, 0xBC, 0xBD, 0xB3, 0x99, 0x98, 0x9C, 0x92, 0x80, 0xBE,
+  0x80, 0xB9, 0x14, 0xBC, 0xB8, 0xBE, 0x91, 0x97, 0x5D, 0xB8, 0x5D, 0x92, 0x98, 0x92, 0xB9, 0xBE,
+  0xB3, 0x95, 0x8E, 0xB6, 0xBA, 0x5D, 0x96, 0x91, 0x18, 0x82, 0x85, 0x89, 0x86, 0x80, 0x80, 0x88,
+  0x80, 0x80, 0x7C, 0x7D, 0x80, 0x58, 0x80, 0x7D, 0x59, 0x59, 0x58, 0x7D, 0x59, 0x7D, 0x7F, 0x7D,
+  0x59, 0x7D, 0x80, 0x92, 0x12, 0x9A, 0xB5, 0xB0, 0xB6, 0xB9, 0xBA, 0x9B, 0x98, 0x9C, 0x9C, 0x98,
+  0x88, 0x96, 0x88, 0x95, 0x8B, 0x86, 0x87, 0x93, 0x80, 0xA1, 0x1A, 0xB2, 0xA9, 0x9D, 0x75, 0x75,
+  0x74, 0x73, 0x71, 0x71, 0x68, 0x67, 0x63, 0x62, 0x68, 0x67, 0x62, 0x62, 0x66, 0x62, 0x66, 0x62,
+  0x62, 0x5F, 0x62, 0x62, 0x5F, 0x66, 0x81, 0x62, 0x00, 0x67, 0x80, 0x62, 0x15, 0x66, 0x66, 0x62,
+  0x66, 0x62, 0x5F, 0x62, 0x62, 0x66, 0x62, 0x62, 0x67, 0x71, 0x6C, 0x6B, 0x6B, 0x75, 0x74, 0x75,
+  0x71, 0x72, 0x75, 0x80, 0x74, 0x02, 0x75, 0x79, 0x76, 0x80, 0x79, 0x2B, 0x7A, 0x79, 0x7A, 0x79,
+  0x7A, 0x7A, 0x7B, 0xB9, 0xBC, 0xB8, 0xB3, 0x9A, 0xB8, 0xBC, 0x97, 0x98, 0x9B, 0x5D, 0x58, 0x5C,
+  0xBA, 0xBC, 0xBC, 0xB8, 0x9A, 0x9B, 0xBC, 0xB8, 0x5D, 0xBC, 0x84, 0xBC, 0xB3, 0x83, 0x81, 0x92,
+  0x9A, 0x58, 0xB5, 0x7E, 0x91, 0x87, 0x81, 0x7F, 0x40, 0x7D, 0x83, 0x7F, 0x82, 0x80, 0x8E, 0x86,
+  0x7F, 0x85, 0x80, 0x7D, 0x80, 0x7D, 0x7D, 0x80, 0x7D, 0x7D, 0x59, 0x58, 0x7D, 0x7D, 0x7F, 0x7C,
+  0x59, 0x58, 0x59, 0x86, 0x81, 0x91, 0x92, 0x8E, 0xB3, 0xB9, 0xB8, 0xB8, 0x9C, 0x9B, 0x9C, 0x9B,
+  0x84, 0x96, 0x8C, 0x95, 0x87, 0x8D, 0xA2, 0xA1, 0xA4, 0xA1, 0xA4, 0xB1, 0xA9, 0x9F, 0x75, 0x75,
+  0x73, 0x73, 0x72, 0x73, 0x6D, 0x6B, 0x5F, 0x6D, 0x67, 0x67, 0x81, 0x62, 0x01, 0x61, 0x67, 0x81,
+  0x62, 0x0A, 0x5F, 0x67, 0x62, 0x67, 0x61, 0x62, 0x62, 0x67, 0x62, 0x67, 0x62, 0x80, 0x67, 0x82,
+  0x62, 0x09, 0x6B, 0x66, 0x6B, 0x72, 0x6C, 0x6C, 0x75, 0x73, 0x70, 0x75, 0x80, 0x74, 0x80, 0x75,
+  0x02, 0x77, 0x79, 0x79, 0x80, 0x7A, 0x00, 0x7B, 0x80, 0x7A, 0x1F, 0x79, 0x7B, 0x9D, 0x9E, 0xE6,
+  0xBC, 0xBC, 0xBA, 0xB9, 0xB9, 0xB4, 0x97, 0x98, 0x81, 0x7F, 0x59, 0x8E, 0xBD, 0xB4, 0x92, 0x92,
+  0xB4, 0xB5, 0xBD, 0x5D, 0xBB, 0x5D, 0x96, 0x8E, 0x80, 0x58, 0x83, 0x80, 0x58, 0x00, 0x57, 0x80,
+  0x81, 0x00, 0x7F, 0x47, 0x7D, 0x83, 0x80, 0x8A, 0x7E, 0x58, 0x7D, 0x7D, 0x59, 0x96, 0x7E, 0x85,
+  0x87, 0x80, 0x80, 0x85, 0x7F, 0x59, 0x7D, 0x58, 0x58, 0x7D, 0x7D, 0x59, 0x58, 0x58, 0x7D, 0x7D,
+  0x82, 0x88, 0x91, 0x8E, 0x9C, 0xBC, 0xB0, 0xB3, 0xB4, 0x9C, 0xB6, 0x84, 0xB3, 0x98, 0x91, 0x8A,
+  0x8F, 0xA1, 0x9F, 0xA4, 0x9D, 0xB1, 0xA9, 0xA4, 0xA1, 0x71, 0x75, 0x75, 0x7B, 0x72, 0x73, 0x73,
+  0x6E, 0x5F, 0x71, 0x67, 0x61, 0x62, 0x62, 0x65, 0x62, 0x62, 0x5F, 0x5F, 0x83, 0x62, 0x00, 0x5F,
+  0x80, 0x62, 0x00, 0x5F, 0x82, 0x62, 0x15, 0x66, 0x62, 0x63, 0x63, 0x5F, 0x71, 0x72, 0x6C, 0x6B,
+  0x75, 0x73, 0x74, 0x75, 0x74, 0x6E, 0x73, 0x74, 0x74, 0x75, 0x79, 0x75, 0x77, 0x80, 0x79, 0x81,
+  0x7A, 0x22, 0x7B, 0x7B, 0x7A, 0x79, 0x7B, 0x7B, 0xB6, 0xBA, 0xBC, 0xB4, 0xBC, 0xB8, 0x8B, 0x9C,
+  0xB3, 0x89, 0x89, 0x82, 0x80, 0x59, 0x82, 0x8E, 0x8E, 0x88, 0x8E, 0x88, 0x9C, 0x5D, 0xBD, 0x7E,
+  0x7E, 0x82, 0x7F, 0x7D, 0x80, 0x80, 0x58, 0x04, 0x7D, 0x59, 0x58, 0x58, 0x80, 0x06, 0x88, 0x88,
+  0x82, 0x80, 0xAF, 0x7D, 0x59, 0x80, 0x7D, 0x0C, 0x96, 0x82, 0x8C, 0x80, 0x85, 0x80, 0x81, 0x7D,
+  0x59, 0x80, 0x7D, 0x7F, 0x80, 0x80, 0x7D, 0x80, 0x58, 0x26, 0x81, 0x57, 0x7E, 0x57, 0x91, 0xBD,
+  0xBD, 0xB4, 0xBD, 0xB6, 0x84, 0xB7, 0x98, 0x91, 0x8B, 0xA1, 0xA2, 0xA2, 0xA4, 0x9E, 0xA9, 0xAA,
+  0xA1, 0xA1, 0x77, 0x75, 0x75, 0x9D, 0x9E, 0x73, 0x74, 0x73, 0x73, 0x72, 0x71, 0x6B, 0x73, 0x65,
+  0x65, 0x80, 0x62, 0x07, 0x5F, 0x60, 0x65, 0x62, 0x62, 0x67, 0x62, 0x5F, 0x84, 0x62, 0x0B, 0x6B,
+  0x67, 0x62, 0x67, 0x62, 0x6C, 0x75, 0x71, 0x73, 0x75, 0x71, 0x74, 0x80, 0x75, 0x07, 0x74, 0x71,
+  0x74, 0x75, 0x74, 0x75, 0x79, 0x75, 0x80, 0x79, 0x80, 0x7A, 0x84, 0x7B, 0x25, 0x9D, 0xB9, 0xB9,
+  0xBA, 0xB6, 0xBC, 0x8D, 0x87, 0x5C, 0x5C, 0x8A, 0x81, 0x80, 0x7D, 0x7F, 0x87, 0x83, 0x5C, 0x83,
+  0x81, 0x83, 0x89, 0x57, 0x7E, 0x7D, 0x7D, 0x57, 0x80, 0x7D, 0x7D, 0x7C, 0x7C, 0x80, 0x7F, 0x7C,
+  0x58, 0x57, 0x80, 0x4B, 0x8E, 0x90, 0x88, 0x86, 0xAF, 0x80, 0x8A, 0x80, 0x7D, 0x8A, 0xB0, 0x92,
+  0x80, 0x7F, 0x88, 0x7D, 0x7D, 0x82, 0x7E, 0x87, 0x7F, 0x7F, 0x7D, 0x7F, 0x7D, 0x58, 0x59, 0x58,
+  0x59, 0x82, 0x7D, 0x80, 0x80, 0x86, 0x96, 0xBE, 0x91, 0xBD, 0x8E, 0x88, 0xBC, 0xBC, 0x91, 0x88,
+  0xA4, 0xA1, 0x8F, 0x5C, 0xA2, 0xA9, 0xA9, 0xA4, 0xA1, 0x9F, 0x76, 0x76, 0x9D, 0x7B, 0x75, 0x74,
+  0x74, 0x73, 0x73, 0x72, 0x6C, 0x71, 0x5F, 0x5F, 0x62, 0x62, 0x68, 0x62, 0x62, 0x65, 0x62, 0x66,
+  0x83, 0x62, 0x08, 0x67, 0x67, 0x65, 0x65, 0x67, 0x67, 0x62, 0x67, 0x66, 0x80, 0x73, 0x03, 0x72,
+  0x73, 0x73, 0x74, 0x80, 0x75, 0x07, 0x74, 0x75, 0x73, 0x74, 0x77, 0x75, 0x79, 0x75, 0x80, 0x79,
+  0x00, 0x7A, 0x81, 0x7B, 0x23, 0x7A, 0x7A, 0x79, 0x78, 0x9D, 0x9E, 0x9D, 0xE8, 0xBE, 0x8F, 0xBE,
+  0x91, 0x86, 0x86, 0x59, 0x89, 0x81, 0x89, 0x7D, 0x86, 0x89, 0x86, 0x82, 0x57, 0x82, 0x7D, 0x7D,
+  0x58, 0x59, 0x80, 0x7D, 0x58, 0x57, 0x57, 0x58, 0x7D, 0x80, 0x82, 0x03, 0x87, 0x7D, 0x7D, 0x58,
+  0x10, 0x92, 0x93, 0xB0, 0x81, 0xAF, 0x87, 0x86, 0x87, 0x80, 0x7F, 0x89, 0x93, 0x81, 0x87, 0x92,
+  0x8B, 0x87, 0x80, 0x86, 0x06, 0x91, 0x87, 0x85, 0x7F, 0x7F, 0x7E, 0x89, 0x80, 0x7D, 0x18, 0x58,
+  0x7F, 0x7D, 0x58, 0x7D, 0x86, 0x87, 0x88, 0x82, 0x87, 0x88, 0x93, 0x58, 0x88, 0xA4, 0xA2, 0x92,
+  0x58, 0x7D, 0xAA, 0xA9, 0xB1, 0xA1, 0xA1, 0x76, 0x80, 0x9D, 0x00, 0x75, 0x80, 0x74, 0x00, 0x73,
+  0x81, 0x72, 0x09, 0x71, 0x6F, 0x67, 0x6C, 0x67, 0x5F, 0x65, 0x60, 0x5F, 0x66, 0x81, 0x65, 0x09,
+  0x62, 0x67, 0x67, 0x61, 0x75, 0x6C, 0x67, 0x62, 0x72, 0x70, 0x81, 0x73, 0x80, 0x74, 0x81, 0x75,
+  0x02, 0x74, 0x79, 0x72, 0x82, 0x79, 0x01, 0x7A, 0x7A, 0x82, 0x7B, 0x17, 0x7A, 0x7B, 0x78, 0x82,
+  0x87, 0x83, 0x88, 0x9C, 0x8E, 0x9C, 0x7E, 0x88, 0x82, 0x80, 0x80, 0x58, 0x89, 0x86, 0x88, 0x87,
+  0x82, 0x86, 0x7D, 0x57, 0x80, 0x7D, 0x0F, 0x89, 0x85, 0x80, 0x59, 0x80, 0x81, 0x82, 0x80, 0x80,
+  0x82, 0x7F, 0x58, 0x80, 0x82, 0x85, 0x86, 0x21, 0x83, 0xAF, 0x90, 0x8E, 0xAF, 0x8C, 0x87, 0x92,
+  0x88, 0x86, 0x96, 0x93, 0x88, 0x87, 0x92, 0xA8, 0x93, 0x8E, 0x91, 0x91, 0x88, 0x8B, 0x81, 0x82,
+  0x89, 0x87, 0x82, 0x7D, 0x7D, 0x80, 0x7D, 0x58, 0x7F, 0x59, 0x80, 0x58, 0x1B, 0x7E, 0x58, 0x59,
+  0x59, 0x57, 0x80, 0x92, 0x84, 0x81, 0x7E, 0x7D, 0x7D, 0x93, 0xA9, 0x9C, 0xA1, 0x5D, 0x9D, 0x9E,
+  0x9D, 0x9D, 0x76, 0x75, 0x75, 0x74, 0x74, 0x73, 0x71, 0x81, 0x72, 0x06, 0x6C, 0x71, 0x61, 0x6E,
+  0x60, 0x61, 0x61, 0x80, 0x65, 0x0B, 0x60, 0x70, 0x67, 0x67, 0x71, 0x6E, 0x71, 0x66, 0x6D, 0x70,
+  0x71, 0x72, 0x80, 0x73, 0x0B, 0x74, 0x73, 0x74, 0x74, 0x75, 0x77, 0x75, 0x75, 0x79, 0x79, 0x77,
+  0x7A, 0x80, 0x79, 0x02, 0x7A, 0x7A, 0x79, 0x81, 0x7B, 0x05, 0x8D, 0x8F, 0x7B, 0x88, 0x86, 0x87,
+  0x81, 0x88, 0x16, 0x8E, 0x87, 0x87, 0x7D, 0x7D, 0x7F, 0x87, 0x84, 0x87, 0x88, 0x88, 0x87, 0x7E,
+  0x7D, 0x7E, 0x82, 0x7C, 0x80, 0x82, 0x8A, 0x88, 0x80, 0x80, 0x80, 0x82, 0x07, 0x86, 0x8A, 0x86,
+  0x7D, 0x88, 0x8A, 0x7F, 0x87, 0x3D, 0x8E, 0xAF, 0x92, 0x93, 0xAF, 0x92, 0x92, 0x8D, 0x88, 0x88,
+  0x98, 0xA8, 0x93, 0x8E, 0xB0, 0xA8, 0x93, 0x8D, 0xA8, 0x8E, 0x8E, 0x93, 0x83, 0x98, 0x83, 0x88,
+  0x87, 0x89, 0x7E, 0x59, 0x85, 0x89, 0x81, 0x57, 0x80, 0x86, 0x7D, 0x58, 0x58, 0x59, 0x58, 0x58,
+  0x82, 0x96, 0x86, 0x7E, 0x59, 0x7F, 0x7D, 0x80, 0x7E, 0x85, 0x7D, 0x59, 0x9F, 0xA1, 0x9E, 0x9D,
+  0x9D, 0x74, 0x75, 0x74, 0x80, 0x73, 0x83, 0x72, 0x17, 0x71, 0x6F, 0x61, 0x5F, 0x5E, 0x71, 0x72,
+  0x6C, 0x72, 0x71, 0x5F, 0x6C, 0x72, 0x71, 0x71, 0x6E, 0x71, 0x71, 0x72, 0x71, 0x73, 0x74, 0x74,
+  0x73, 0x81, 0x75, 0x05, 0x79, 0x73, 0x79, 0x7A, 0x79, 0x79, 0x80, 0x7A, 0x04, 0x7B, 0x79, 0x79,
+  0x7A, 0x7B, 0x80, 0x7A, 0x05, 0x87, 0x87, 0x81, 0x83, 0x83, 0x8E, 0x80, 0x88, 0x15, 0x83, 0x84,
+  0x93, 0x83, 0x83, 0x7E, 0x87, 0x82, 0x83, 0x84, 0x8E, 0x90, 0x82, 0x81, 0x82, 0x5C, 0x86, 0x7D,
+  0x80, 0x82, 0x8B, 0x8E, 0x80, 0x87, 0x09, 0x92, 0x82, 0x92, 0x88, 0x91, 0x58, 0x95, 0x89, 0x88,
+  0x91, 0x01, 0xB0, 0xA8, 0x80, 0xAF, 0x42, 0xB1, 0x90, 0xAF, 0x8D, 0x90, 0x93, 0xA8, 0xAF, 0x90,
+  0xA8, 0xAF, 0x8F, 0xB0, 0x93, 0x90, 0x91, 0x8E, 0xAF, 0xA8, 0x90, 0x93, 0x88, 0x92, 0x88, 0x85,
+  0x59, 0x59, 0x88, 0x87, 0x88, 0x7D, 0x87, 0x88, 0x82, 0x7D, 0x80, 0x58, 0x7D, 0x82, 0x7F, 0x7D,
+  0x86, 0x87, 0x87, 0x7F, 0x7D, 0x82, 0x7D, 0x7D, 0x80, 0x58, 0x9E, 0x9D, 0x9D, 0x78, 0x7B, 0x75,
+  0x73, 0x74, 0x73, 0x73, 0x72, 0x71, 0x71, 0x73, 0x73, 0x72, 0x82, 0x71, 0x09, 0x72, 0x72, 0x71,
+  0x71, 0x72, 0x72, 0x71, 0x71, 0x72, 0x71, 0x82, 0x72, 0x00, 0x73, 0x80, 0x74, 0x03, 0x75, 0x79,
+  0x79, 0x7A, 0x81, 0x79, 0x03, 0x7A, 0x79, 0x79, 0x7B, 0x81, 0x7A, 0x2F, 0x7B, 0x79, 0x79, 0x8F,
+  0x87, 0x86, 0x87, 0x8F, 0x8E, 0x92, 0x93, 0x8E, 0x92, 0x8E, 0x96, 0x84, 0x88, 0x8E, 0x88, 0x84,
+  0x93, 0x93, 0xA8, 0x90, 0x83, 0x93, 0x82, 0x82, 0x92, 0x87, 0x86, 0x87, 0x86, 0x8E, 0x92, 0x88,
+  0x92, 0x90, 0x92, 0x91, 0x92, 0x9A, 0x88, 0x82, 0x8E, 0x88, 0x84, 0x92, 0x0C, 0xA8, 0x8D, 0x8E,
+  0x5D, 0xA8, 0x90, 0xB2, 0xAF, 0xAF, 0xA8, 0xAF, 0x8F, 0xA8, 0x80, 0xAF, 0x12, 0x93, 0xAF, 0xAF,
+  0xA8, 0xAF, 0x8D, 0x8F, 0xA8, 0x8F, 0x93, 0x8E, 0x93, 0x8B, 0x89, 0x88, 0x96, 0x83, 0x87, 0x87,
+  0x80, 0x88, 0x80, 0x8A, 0x0B, 0x7F, 0x81, 0x81, 0x82, 0x95, 0x82, 0x86, 0x87, 0x88, 0x7C, 0x8A,
+  0x86, 0x80, 0x7D, 0x01, 0xA1, 0x5D, 0x80, 0x9D, 0x08, 0x7B, 0x77, 0x72, 0x73, 0x73, 0x71, 0x71,
+  0x73, 0x73, 0x83, 0x71, 0x03, 0x72, 0x71, 0x72, 0x73, 0x80, 0x71, 0x00, 0x72, 0x81, 0x71, 0x80,
+  0x72, 0x07, 0x73, 0x74, 0x76, 0x75, 0x75, 0x7B, 0x7A, 0x7B, 0x82, 0x79, 0x05, 0x7A, 0x79, 0x7A,
+  0x7A, 0x7B, 0x7A, 0x80, 0x7B, 0x01, 0x84, 0x8D, 0x80, 0x83, 0x29, 0x88, 0x8E, 0x92, 0x92, 0x8E,
+  0x93, 0x93, 0x90, 0x8E, 0x92, 0x88, 0x90, 0x92, 0x90, 0xAF, 0xA8, 0xA8, 0x90, 0x8E, 0x93, 0x88,
+  0x83, 0xA8, 0x91, 0x82, 0x88, 0x82, 0x90, 0xAF, 0x90, 0x8E, 0xA8, 0x93, 0x90, 0xAF, 0xB2, 0x88,
+  0x87, 0xAF, 0x93, 0x93, 0xAF, 0x24, 0xA8, 0x90, 0x92, 0x84, 0x93, 0xA8, 0xAF, 0x5D, 0xA8, 0x93,
+  0x90, 0x90, 0x9C, 0x84, 0x84, 0x8D, 0x8E, 0xAF, 0xB0, 0x90, 0x8F, 0x93, 0x84, 0x5C, 0x84, 0xA8,
+  0x8D, 0xAF, 0x90, 0x88, 0x8F, 0x90, 0x93, 0x87, 0x8E, 0x8E, 0x8F, 0x80, 0x8E, 0x08, 0x8B, 0x88,
+  0x88, 0x92, 0x83, 0x93, 0x8E, 0x88, 0x8E, 0x80, 0x88, 0x0B, 0x8E, 0x7D, 0x81, 0x59, 0x82, 0x86,
+  0x58, 0x9E, 0x9E, 0x9D, 0x9D, 0x71, 0x80, 0x73, 0x03, 0x72, 0x73, 0x73, 0x72, 0x82, 0x71, 0x01,
+  0x72, 0x71, 0x80, 0x72, 0x02, 0x71, 0x72, 0x71, 0x83, 0x72, 0x0C, 0x73, 0x73, 0x74, 0x79, 0x79,
+  0x7A, 0x7A, 0x79, 0x79, 0x7A, 0x7A, 0x79, 0x7A, 0x80, 0x79, 0x35, 0x7A, 0x7A, 0x7B, 0x7A, 0x83,
+  0x83, 0x88, 0x88, 0x8E, 0x88, 0x90, 0x88, 0x88, 0x90, 0xAF, 0xAF, 0x93, 0x8E, 0x93, 0xA8, 0x93,
+  0xA8, 0xAF, 0xA8, 0x93, 0xA8, 0xAF, 0x8F, 0xAF, 0x90, 0x93, 0x90, 0xA8, 0x90, 0x90, 0x92, 0x90,
+  0x90, 0x93, 0xAF, 0xA8, 0x93, 0xA8, 0xAF, 0x90, 0xAF, 0xAF, 0xA8, 0xA8, 0x90, 0xB0, 0xB0, 0xAA,
+  0xAA, 0x0E, 0x90, 0x8D, 0x5D, 0x84, 0x90, 0x93, 0x5D, 0x5A, 0x5D, 0xA8, 0xA8, 0x8F, 0xA8, 0xA8,
+  0x93, 0x80, 0x5D, 0x05, 0x83, 0x8E, 0x5D, 0xAF, 0xAF, 0x5D, 0x80, 0x5A, 0x07, 0x90, 0x5A, 0x90,
+  0x93, 0x90, 0xAF, 0x93, 0x90, 0x80, 0x93, 0x0A, 0x90, 0x90, 0x93, 0x90, 0x8E, 0x8D, 0x84, 0xA8,
+  0xB0, 0x92, 0x8E, 0x80, 0x5A, 0x0E, 0x84, 0x88, 0x8E, 0x91, 0x8E, 0x8E, 0x88, 0x7E, 0x8F, 0x8F,
+  0x8D, 0x8F, 0x9D, 0x6D, 0x5F, 0x80, 0x60, 0x05, 0x5E, 0x5E, 0x60, 0x5E, 0x60, 0x5E, 0x83, 0x60,
+  0x83, 0x5E, 0x07, 0x60, 0x5E, 0x60, 0x60, 0x6A, 0x6D, 0x6A, 0x6C, 0x87, 0x6D, 0x08, 0x6E, 0x6E,
+  0x83, 0x8D, 0x88, 0x88, 0x8E, 0x8E, 0x90, 0x82, 0x93, 0x27, 0xAF, 0x8F, 0xAF, 0x8F, 0xAF, 0xB0,
+  0x8F, 0xA8, 0xB0, 0x93, 0xB0, 0x8F, 0x8D, 0xB0, 0xA8, 0xA8, 0x90, 0xAF, 0xA8, 0xB1, 0xA8, 0x8D,
+  0xA8, 0xA8, 0x93, 0x93, 0x8D, 0x8D, 0x8E, 0x90, 0xAF, 0x90, 0xAF, 0x93, 0x90, 0x92, 0x8E, 0xB0,
+  0xAA, 0xA8, 0x19, 0x8F, 0x84, 0x5A, 0x5C, 0x5A, 0x5B, 0x8E, 0x5D, 0x5C, 0x5C, 0x8D, 0x84, 0x5B,
+  0x90, 0xA8, 0x84, 0x84, 0x5D, 0x5D, 0x83, 0x5D, 0x84, 0x8D, 0x92, 0x84, 0x5D, 0x80, 0x5A, 0x0D,
+  0x5B, 0x8D, 0x5D, 0x90, 0x92, 0x8F, 0x8F, 0x8D, 0x84, 0x5D, 0x8F, 0x8D, 0x93, 0x8E, 0x80, 0x5D,
+  0x14, 0x90, 0x84, 0x5C, 0x5A, 0x83, 0x5A, 0x5A, 0x5D, 0x5C, 0x5D, 0x92, 0x83, 0x5D, 0x5A, 0x5B,
+  0x5C, 0x5A, 0x5D, 0x5D, 0x83, 0x8D, 0xA5, 0x55, 0x02, 0x8F, 0x8E, 0x84, 0x80, 0x8D, 0x04, 0xA8,
+  0x8D, 0x5D, 0x83, 0x84, 0x80, 0x8D, 0x04, 0x8F, 0xA8, 0x8D, 0x8D, 0x8E, 0x80, 0x8D, 0x80, 0x84,
+  0x1B, 0x8D, 0x84, 0x84, 0x8D, 0x8D, 0x84, 0x84, 0x5D, 0x8D, 0x83, 0x83, 0x84, 0x84, 0x8D, 0x84,
+  0x8D, 0x8E, 0x84, 0x8D, 0x8E, 0x8D, 0x8E, 0x90, 0x90, 0x93, 0x8D, 0x8F, 0x84, 0x07, 0x5D, 0x8D,
+  0x8D, 0x84, 0x5C, 0x5A, 0x5C, 0x84, 0x80, 0x5A, 0x03, 0x84, 0x84, 0x5D, 0x5D, 0x80, 0x84, 0x01,
+  0x5C, 0x5D, 0x80, 0x83, 0x19, 0x5D, 0x5D, 0x8E, 0x5A, 0x5C, 0x5D, 0x5D, 0x8E, 0x5D, 0x5D, 0x5C,
+  0x5D, 0x84, 0x5D, 0x84, 0x5C, 0x5C, 0x5D, 0x5D, 0x90, 0x5C, 0x5A, 0x5A, 0x5D, 0x8E, 0x84, 0x80,
+  0x5D, 0x82, 0x5A, 0x07, 0x5D, 0x5A, 0x5A, 0x8E, 0x5D, 0x5A, 0x5C, 0x5C, 0x80, 0x84, 0x0B, 0x50,
+  0x3C, 0x3A, 0x55, 0x3A, 0x47, 0x44, 0x3C, 0x55, 0x3C, 0x3C, 0x45, 0x84, 0x55, 0x01, 0x53, 0x54,
+  0x81, 0x55, 0x00, 0x47, 0x81, 0x55, 0x08, 0x47, 0x37, 0x47, 0x44, 0x55, 0x3C, 0x8F, 0x8D, 0x8D,
+  0x80, 0x8E, 0x81, 0x84, 0x05, 0x8D, 0x84, 0x83, 0x90, 0x90, 0x92, 0x81, 0x8D, 0x80, 0x84, 0x05,
+  0x8E, 0x84, 0x84, 0x8E, 0x8E, 0x5D, 0x80, 0x5C, 0x0B, 0x83, 0x5C, 0x83, 0x83, 0x84, 0x84, 0x83,
+  0x5C, 0x83, 0x84, 0x5C, 0x5D, 0x80, 0x84, 0x82, 0x8E, 0x03, 0x84, 0x8D, 0x83, 0x83, 0x82, 0x5B,
+  0x04, 0x5A, 0x5A, 0x83, 0x84, 0x84, 0x82, 0x5A, 0x0B, 0x5D, 0x5A, 0x5A, 0x84, 0x8D, 0x84, 0x5A,
+  0x5A, 0x5D, 0x84, 0x8D, 0x84, 0x82, 0x5A, 0x28, 0x5C, 0x83, 0x5A, 0x5B, 0x5D, 0x8D, 0x8F, 0x8F,
+  0x93, 0x90, 0xA8, 0x8F, 0x90, 0xA8, 0x8F, 0x9D, 0x9E, 0x9D, 0x9D, 0x9E, 0x77, 0x77, 0x76, 0x76,
+  0x70, 0x70, 0x6F, 0x70, 0x72, 0x70, 0x70, 0x6C, 0x5E, 0x5E, 0x55, 0x56, 0x5E, 0x55, 0x55, 0x56,
+  0x56, 0x82, 0x55, 0x00, 0x56, 0x8A, 0x55, 0x0A, 0x54, 0x6C, 0x6E, 0x6D, 0x5E, 0x6D, 0x56, 0x56,
+  0x55, 0x55, 0x6C, 0x80, 0x5E, 0x06, 0x60, 0x6D, 0x78, 0x77, 0x77, 0x78, 0x7B, 0x82, 0x78, 0x01,
+  0x7B, 0x9D, 0x83, 0x8F, 0x05, 0xA8, 0x8F, 0x90, 0xA8, 0x8F, 0x8F, 0x81, 0x90, 0x84, 0x8F, 0x05,
+  0x90, 0x90, 0x8F, 0x90, 0x90, 0x8F, 0x80, 0x90, 0x07, 0x8F, 0x8F, 0x90, 0x8F, 0x93, 0x93, 0x90,
+  0x90, 0x85, 0xA2, 0x01, 0xA0, 0xA0, 0x85, 0xA2, 0x80, 0xA0, 0x06, 0xA2, 0xA0, 0xA0, 0xA2, 0xA2,
+  0xA0, 0xA0, 0x84, 0x9F, 0x00, 0xA0, 0x80, 0x9F, 0x09, 0xA2, 0xA0, 0x9F, 0x9F, 0xA0, 0x78, 0x9E,
+  0x9D, 0x7B, 0x7B, 0x80, 0x77, 0x02, 0x6F, 0x77, 0x78, 0x80, 0x77, 0x12, 0x79, 0x6D, 0x6D, 0x71,
+  0x72, 0x6F, 0x6D, 0x70, 0x71, 0x70, 0x70, 0x6D, 0x70, 0x6E, 0x6F, 0x6E, 0x6E, 0x6D, 0x6E, 0x83,
+  0x70, 0x81, 0x6E, 0x81, 0x70, 0x01, 0x6F, 0x6F, 0x80, 0x6E, 0x01, 0x6D, 0x6D, 0x80, 0x6E, 0x00,
+  0x6D, 0x84, 0x6E, 0x04, 0x70, 0x6E, 0x6F, 0x70, 0x72, 0x80, 0x77, 0x0A, 0x9D, 0x9D, 0x77, 0x7B,
+  0x9E, 0x9F, 0xA0, 0x9F, 0x9F, 0x9D, 0x9E, 0x83, 0xA0, 0x12, 0x9F, 0x9E, 0x9F, 0x9E, 0x7B, 0x9D,
+  0x9D, 0x7B, 0xA2, 0xA0, 0x7B, 0x9D, 0x7B, 0x7B, 0xA0, 0xA0, 0x9F, 0x9F, 0xA0, 0x80, 0x9F, 0x03,
+  0xA2, 0xA2, 0xA0, 0xA0, 0x83, 0xA2, 0x05, 0x9E, 0x9D, 0x9D, 0xA2, 0xA2, 0x7B, 0x82, 0xA2, 0x0C,
+  0x9D, 0xA0, 0xA0, 0xA2, 0xA0, 0xA0, 0x7B, 0x78, 0x7B, 0x9E, 0x78, 0x7B, 0x78, 0x81, 0x9E, 0x0C,
+  0x9D, 0x7B, 0x7A, 0x78, 0x9D, 0x7B, 0x9D, 0x9E, 0x9F, 0x9E, 0x9D, 0x9D, 0x6F, 0x80, 0x78, 0x04,
+  0x79, 0x79, 0x7A, 0x77, 0x76, 0x81, 0x77, 0x01, 0x6F, 0x70, 0x81, 0x6F, 0x84, 0x6E, 0x05, 0x6F,
+  0x6E, 0x6F, 0x6E, 0x6E, 0x6F, 0x92, 0x6E, 0x00, 0x6F, 0x84, 0x6E, 0x80, 0x6F, 0x00, 0x70, 0x82,
+  0x77, 0x11, 0x78, 0x78, 0x77, 0x77, 0x79, 0x77, 0x7B, 0x9E, 0xA0, 0x9F, 0x9F, 0x9D, 0xA0, 0x9F,
+  0x9F, 0xA0, 0x9F, 0x9F, 0x80, 0xA0, 0x0F, 0xA2, 0xA0, 0xA2, 0xA0, 0xA0, 0x7B, 0x9D, 0x9F, 0xA0,
+  0xA0, 0x9E, 0xA0, 0x9E, 0x9E, 0xA0, 0xA2, 0x81, 0x9E, 0x02, 0x9D, 0xA0, 0xA0, 0x05, 0xA2, 0xA3,
+  0xA2, 0x9E, 0xA2, 0xA3, 0x85, 0xA2, 0x02, 0xA0, 0xA2, 0xA2, 0x81, 0xA0, 0x00, 0x9E, 0x81, 0xA0,
+  0x08, 0x7A, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E, 0x9D, 0x7B, 0x7A, 0x83, 0x9D, 0x0D, 0x9E, 0x9E, 0x9D,
+  0x7B, 0x76, 0x77, 0x77, 0x78, 0x77, 0x74, 0x78, 0x78, 0x77, 0x77, 0x81, 0x70, 0x00, 0x6F, 0x80,
+  0x70, 0x04, 0x6F, 0x6F, 0x6E, 0x6F, 0x6F, 0x80, 0x6E, 0x82, 0x6F, 0x03, 0x70, 0x70, 0x6F, 0x6E,
+  0x81, 0x6F, 0x80, 0x6E, 0x00, 0x6F, 0x86, 0x6E, 0x03, 0x6F, 0x6E, 0x6F, 0x6F, 0x83, 0x6E, 0x82,
+  0x6F, 0x80, 0x6E, 0x02, 0x77, 0x77, 0x78, 0x83, 0x77, 0x81, 0x9D, 0x80, 0x9F, 0x00, 0x9D, 0x80,
+  0x9E, 0x18, 0x9D, 0x9F, 0xA2, 0xA2, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F, 0x9D, 0x9E, 0xA0, 0xA0, 0xA2,
+  0xA2, 0x9D, 0x9E, 0x9D, 0x9E, 0x9E, 0x9D, 0x78, 0xA0, 0x9E, 0x9F, 0x02, 0x78, 0x77, 0x77, 0x80,
+  0x76, 0x06, 0x78, 0x70, 0x76, 0x74, 0x6E, 0x6D, 0x6E, 0x80, 0x76, 0x06, 0x77, 0x78, 0x6A, 0x6D,
+  0x74, 0x76, 0x60, 0x84, 0x6A, 0x07, 0x6D, 0x5E, 0x6D, 0x70, 0x74, 0x70, 0x6E, 0x60, 0x83, 0x5E,
+  0x80, 0x6A, 0x01, 0x6D, 0x6A, 0x81, 0x5E, 0xC1, 0x56, 0x80, 0x5E, 0x04, 0x6D, 0x77, 0x78, 0x76,
+  0x77, 0x80, 0x76, 0x05, 0x70, 0x70, 0x6D, 0x6D, 0x76, 0x78, 0x80, 0x76, 0x02, 0x77, 0x78, 0x78,
+  0x80, 0x77, 0x03, 0x76, 0x76, 0x6D, 0x70, 0x80, 0x6D, 0x05, 0x6A, 0x6D, 0x6D, 0x6A, 0x6D, 0x6D,
+  0x15, 0xD9, 0xDE, 0xD9, 0xD6, 0xD6, 0xD7, 0xD9, 0xD9, 0xD6, 0xD6, 0xD7, 0xD6, 0xD6, 0xD5, 0xD2,
+  0xCA, 0xCA, 0xD2, 0xCA, 0xC5, 0xC6, 0xCA, 0x80, 0xC6, 0x00, 0xC7, 0x85, 0xC5, 0x81, 0xC6, 0x81,
+  0xC5, 0x0A, 0xC6, 0xC4, 0xC5, 0xC4, 0xC4, 0xC5, 0xC4, 0xC3, 0xC3, 0xAD, 0xAD, 0x80, 0xAC, 0x01,
+  0xC1, 0xC1, 0x81, 0xA6, 0x05, 0xC1, 0xA6, 0xA5, 0xA5, 0xC1, 0xC1, 0x81, 0xA6, 0x01, 0xC1, 0xC1,
+  0x80, 0xA6, 0x80, 0xC1, 0x10, 0xA6, 0xAD, 0xAC, 0xAC, 0xC1, 0xAD, 0xC1, 0xAC, 0xC0, 0xA6, 0xC1,
+  0xA6, 0xC1, 0xC1, 0xA6, 0xA3, 0xC1, 0x80, 0xA6, 0x03, 0xA5, 0xA6, 0xA6, 0xA5, 0x81, 0xA6, 0x00,
+  0xC1, 0x80, 0xA6, 0x03, 0xC1, 0xAC, 0xA6, 0xC1, 0x81, 0xAC, 0x03, 0xA6, 0xA6, 0xAD, 0xA3, 0x87,
+  0xC5, 0x83, 0xC6, 0x0B, 0xCA, 0xD0, 0xC9, 0xCA, 0xCA, 0xD0, 0xCD, 0xD4, 0xD7, 0xD6, 0xD6, 0xD5,
+  0x82, 0xD7, 0x02, 0xD4, 0xD7, 0xD7, 0x13, 0xDE, 0xDE, 0xE4, 0xDF, 0xE1, 0xDB, 0xD9, 0xDA, 0xDB,
+  0xD9, 0xD6, 0xD6, 0xDA, 0xD4, 0xCD, 0xD0, 0xD0, 0xD2, 0xD0, 0xD2, 0x81, 0xCA, 0x01, 0xC6, 0xC6,
+  0x80, 0xCA, 0x00, 0xC7, 0x81, 0xC6, 0x0A, 0xCA, 0xC6, 0xCA, 0xC5, 0xC6, 0xC5, 0xC4, 0xC5, 0xC5,
+  0xC6, 0xC7, 0x81, 0xC5, 0x06, 0xAE, 0xAD, 0xC3, 0xAD, 0xAC, 0xAD, 0xAC, 0x81, 0xC1, 0x01, 0xA6,
+  0xA6, 0x81, 0xC1, 0x03, 0xAD, 0xA6, 0xA6, 0xC1, 0x82, 0xA6, 0x82, 0xC1, 0x0D, 0xAD, 0xAD, 0xA6,
+  0xC1, 0xC1, 0xA6, 0xC1, 0xAD, 0xBF, 0xA6, 0xA6, 0xC1, 0xA6, 0xC1, 0x80, 0xA6, 0x00, 0xAD, 0x81,
+  0xA6, 0x18, 0xAD, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xC1, 0xAC, 0xC1, 0xA6, 0xAC, 0xAD, 0xA6, 0xC1,
+  0xA3, 0xC1, 0xA6, 0xAC, 0xAC, 0xA6, 0xBF, 0xA6, 0xC7, 0xCA, 0xC6, 0x81, 0xC5, 0x00, 0xC6, 0x84,
+  0xCA, 0x04, 0xD0, 0xCA, 0xD2, 0xD0, 0xD2, 0x80, 0xCD, 0x07, 0xD4, 0xD3, 0xD6, 0xD6, 0xD7, 0xD8,
+  0xD6, 0xD7, 0x82, 0xD6, 0x01, 0xDE, 0xDB, 0x80, 0xDC, 0x01, 0xDE, 0xDE, 0x80, 0xD9, 0x03, 0xD6,
+  0xD9, 0xD9, 0xD6, 0x80, 0xD0, 0x07, 0xD2, 0xCA, 0xCA, 0xD0, 0xD0, 0xCA, 0xCA, 0xC6, 0x82, 0xCA,
+  0x01, 0xCC, 0xCC, 0x80, 0xCA, 0x0A, 0xC7, 0xCA, 0xC6, 0xCA, 0xCA, 0xC4, 0xC6, 0xC5, 0xC6, 0xC5,
+  0xC7, 0x80, 0xC5, 0x07, 0xC4, 0xAD, 0xAD, 0xAC, 0xC1, 0xAC, 0xA6, 0xAC, 0x81, 0xC1, 0x06, 0xA6,
+  0xC1, 0xC1, 0xBF, 0xA6, 0xA6, 0xC1, 0x81, 0xA6, 0x01, 0xC1, 0xAD, 0x80, 0xA6, 0x0E, 0xC1, 0xC1,
+  0xA6, 0xC1, 0xA6, 0xAD, 0xC1, 0xA5, 0xA6, 0xC1, 0xAD, 0xC1, 0xA6, 0xA6, 0xC1, 0x87, 0xA6, 0x00,
+  0xC1, 0x82, 0xA6, 0x03, 0xC1, 0xAD, 0xC1, 0xA6, 0x81, 0xC1, 0x0B, 0xA6, 0xA7, 0xC1, 0xAC, 0xA6,
+  0xC1, 0xAC, 0xAE, 0xC6, 0xCA, 0xC6, 0xC6, 0x80, 0xC5, 0x82, 0xCA, 0x09, 0xC6, 0xCA, 0xCA, 0xD0,
+  0xCA, 0xD4, 0xD4, 0xCD, 0xD4, 0xCD, 0x80, 0xD7, 0x80, 0xD9, 0x07, 0xDA, 0xD9, 0xD7, 0xDC, 0xDA,
+  0xDC, 0xD7, 0xDC, 0x05, 0xDC, 0xED, 0xF0, 0xEB, 0xEB, 0xE4, 0x80, 0xDB, 0x09, 0xD9, 0xD9, 0xD6,
+  0xD4, 0xD4, 0xD2, 0xD2, 0xD0, 0xCD, 0xCD, 0x81, 0xD0, 0x84, 0xCA, 0x06, 0xC9, 0xDB, 0xC6, 0xCA,
+  0xCA, 0xD9, 0xD4, 0x80, 0xCA, 0x05, 0xC6, 0xAE, 0xC5, 0xC6, 0xC6, 0xC7, 0x80, 0xC5, 0x07, 0xAE,
+  0xC3, 0xAC, 0xAC, 0xBF, 0xAC, 0xC1, 0xAC, 0x80, 0xC1, 0x0D, 0xA6, 0xA6, 0xC1, 0xC1, 0xBF, 0xC1,
+  0xC1, 0xAD, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xC1, 0x82, 0xA6, 0x01, 0xC1, 0xC1, 0x80, 0xA6, 0x00,
+  0xC1, 0x96, 0xA6, 0x02, 0xC1, 0xC1, 0xA6, 0x82, 0xC1, 0x05, 0xBF, 0xAC, 0xA6, 0xAD, 0xC3, 0xCF,
+  0x80, 0xC6, 0x06, 0xC5, 0xCA, 0xCA, 0xC6, 0xCA, 0xCA, 0xD0, 0x80, 0xCA, 0x81, 0xD0, 0x12, 0xDB,
+  0xDA, 0xD4, 0xD3, 0xDB, 0xE5, 0xDA, 0xD5, 0xDE, 0xD8, 0xD9, 0xDC, 0xDA, 0xED, 0xEB, 0xED, 0xD3,
+  0xFE, 0xEB, 0x09, 0xED, 0xF0, 0xEB, 0xE9, 0xEC, 0xE9, 0xE4, 0xDE, 0xDF, 0xDB, 0x80, 0xD9, 0x02,
+  0xD3, 0xD4, 0xCD, 0x80, 0xD2, 0x42, 0xCA, 0xCD, 0xD0, 0xCA, 0xCA, 0xD0, 0xCA, 0xD2, 0xD0, 0xD1,
+  0xC6, 0xC8, 0xD4, 0xD3, 0xCD, 0xC6, 0xD2, 0xD5, 0xD7, 0xCA, 0xC6, 0xC8, 0xC7, 0xC4, 0xC4, 0xCA,
+  0xCF, 0xC6, 0xC6, 0xC5, 0xAE, 0xC3, 0xC3, 0xAC, 0xBF, 0xC1, 0xC3, 0xC1, 0xBF, 0xC1, 0xA6, 0xA7,
+  0xC3, 0xA6, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xC1, 0xAD, 0xA6, 0xC1, 0xC1, 0xA6, 0xAD, 0xA6,
+  0xA6, 0xC1, 0xA6, 0xA6, 0xC1, 0xA5, 0xA6, 0xA6, 0xC1, 0x80, 0xA6, 0x00, 0xC1, 0x82, 0xA6, 0x07,
+  0xC1, 0xA6, 0xA6, 0xC1, 0xC1, 0xA6, 0xA6, 0xC1, 0x81, 0xA6, 0x04, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6,
+  0x81, 0xC1, 0x01, 0xAD, 0xBF, 0x81, 0xAC, 0x03, 0xC4, 0xC6, 0xCA, 0xCA, 0x80, 0xC5, 0x08, 0xC6,
+  0xCA, 0xC6, 0xCA, 0xD0, 0xD0, 0xCA, 0xCA, 0xD0, 0x80, 0xD2, 0x07, 0xDE, 0xDE, 0xD9, 0xDB, 0xDB,
+  0xDE, 0xD6, 0xDB, 0x80, 0xDE, 0x03, 0xDA, 0xE8, 0xEB, 0xEC, 0x81, 0xEB, 0x08, 0xF6, 0xF6, 0xEB,
+  0xEC, 0xEB, 0xF6, 0xEC, 0xDC, 0xDD, 0x81, 0xDB, 0x38, 0xE5, 0xD3, 0xB2, 0xCC, 0xD3, 0xCD, 0xD4,
+  0xD0, 0xD0, 0xD2, 0xD2, 0xCA, 0xD0, 0xD4, 0xCD, 0xD0, 0xD0, 0xCD, 0xCA, 0xD2, 0xD3, 0xC8, 0xC7,
+  0xD5, 0xDA, 0xD2, 0xCA, 0xD0, 0xCA, 0xC4, 0xCF, 0xC7, 0xC8, 0xCA, 0xC6, 0xC5, 0xC7, 0xAE, 0xAC,
+  0xAC, 0xBF, 0xC1, 0xA7, 0xA6, 0xBF, 0xA7, 0xA6, 0xA7, 0xA7, 0xC1, 0xAD, 0xA6, 0xC1, 0xA6, 0xC1,
+  0xAD, 0xC1, 0x80, 0xA6, 0x00, 0xC1, 0x80, 0xA6, 0x05, 0xC1, 0xC1, 0xA6, 0xAD, 0xA6, 0xC1, 0x89,
+  0xA6, 0x00, 0xA5, 0x88, 0xA6, 0x04, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6, 0x81, 0xC1, 0x05, 0xAC, 0xAD,
+  0xAE, 0xAE, 0xC6, 0xAE, 0x82, 0xCA, 0x00, 0xD0, 0x83, 0xCA, 0x19, 0xD0, 0xCA, 0xD2, 0xCD, 0xCD,
+  0xC8, 0xCC, 0xDA, 0xDB, 0xDB, 0xDE, 0xDE, 0xE2, 0xE3, 0xE3, 0xE5, 0xDB, 0xD8, 0xE9, 0xEA, 0xEB,
+  0xE9, 0xEB, 0xF1, 0xEB, 0xEB, 0x80, 0xEB, 0x00, 0xF1, 0x81, 0xEB, 0x0C, 0xE6, 0xDC, 0xE5, 0xE3,
+  0xE3, 0xE2, 0xE7, 0xE3, 0xE3, 0xDE, 0xCD, 0xDA, 0xCD, 0x80, 0xD0, 0x0F, 0xCB, 0xCC, 0xD7, 0xDB,
+  0xCD, 0xD2, 0xCC, 0xCB, 0xCD, 0xDE, 0xCB, 0xCB, 0xD7, 0xCD, 0xC8, 0xC6, 0x80, 0xCA, 0x04, 0xD0,
+  0xC5, 0xC4, 0xCA, 0xCA, 0x80, 0xC5, 0x0C, 0xA4, 0xA6, 0xAC, 0xAD, 0xAD, 0xAC, 0xBF, 0xA6, 0xC1,
+  0xC1, 0xA6, 0xC1, 0xC1, 0x80, 0xA6, 0x80, 0xC1, 0x0A, 0xA6, 0xA6, 0xC1, 0xA6, 0xC1, 0xA6, 0xC1,
+  0xA6, 0xC1, 0xA6, 0xAD, 0x81, 0xA6, 0x00, 0xC1, 0x87, 0xA6, 0x00, 0xC1, 0x89, 0xA6, 0x09, 0xC1,
+  0xA6, 0xAD, 0xAC, 0xAC, 0xC1, 0xC1, 0xAE, 0xAE, 0xC6, 0x82, 0xCA, 0x03, 0xD0, 0xCA, 0xC6, 0xD7,
+  0x80, 0xCA, 0x1C, 0xD0, 0xCA, 0xD0, 0xD0, 0xC9, 0xCD, 0xCB, 0xCB, 0xDB, 0xD8, 0xDE, 0xDE, 0xE3,
+  0xE3, 0xDE, 0xE3, 0xE4, 0xE4, 0xE3, 0xE4, 0xE6, 0xEC, 0xEC, 0xE9, 0xE9, 0xF1, 0xEB, 0xEB, 0xF1,
+  0x06, 0xF1, 0xF1, 0xEB, 0xF4, 0xF3, 0xEB, 0xEB, 0x80, 0xE9, 0x00, 0xE8, 0x80, 0xE7, 0x06, 0xE3,
+  0xE4, 0xE4, 0xE3, 0xD7, 0xD9, 0xDB, 0x81, 0xCD, 0x16, 0xD0, 0xCD, 0xD8, 0xD6, 0xD7, 0xCD, 0xCC,
+  0xD7, 0xDA, 0xD6, 0xCC, 0xD6, 0xDB, 0xD9, 0xC6, 0xD0, 0xD0, 0xCA, 0xC6, 0xC6, 0xC9, 0xCA, 0xCA,
+  0x80, 0xC5, 0x15, 0xC6, 0xAE, 0xAC, 0xC3, 0xAE, 0xAE, 0xAC, 0xAC, 0xA6, 0xA6, 0xC1, 0xC1, 0xAD,
+  0xA6, 0xC1, 0xAD, 0xA6, 0xC1, 0xA5, 0xA6, 0xC1, 0xC1, 0x83, 0xA6, 0x03, 0xC1, 0xA6, 0xA6, 0xC1,
+  0x80, 0xA6, 0x07, 0xC1, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xC1, 0x8C, 0xA6, 0x09, 0xC1, 0xA6,
+  0xAD, 0xAC, 0xAC, 0xC3, 0xAC, 0xC4, 0xC6, 0xC9, 0x83, 0xCA, 0x02, 0xD0, 0xD9, 0xD4, 0x80, 0xD0,
+  0x04, 0xCD, 0xD7, 0xD7, 0xCD, 0xCD, 0x81, 0xD4, 0x13, 0xD7, 0xE3, 0xE4, 0xE4, 0xE7, 0xE3, 0xE4,
+  0xDE, 0xE3, 0xE3, 0xE4, 0xED, 0xEA, 0xEE, 0xEB, 0xF1, 0xF1, 0xEB, 0xF3, 0xF1, 0x0C, 0xF1, 0xF1,
+  0xEB, 0xF1, 0xEC, 0xEC, 0xF1, 0xF1, 0xEC, 0xE9, 0xE8, 0xE7, 0xE7, 0x80, 0xE3, 0x25, 0xE7, 0xDE,
+  0xE3, 0xE3, 0xE7, 0xCC, 0xDB, 0xB2, 0xD4, 0xCD, 0xCD, 0xD4, 0xDB, 0xDB, 0xD3, 0xCC, 0xDB, 0xE5,
+  0xD8, 0xD9, 0xDB, 0xD8, 0xD8, 0xCD, 0xD0, 0xD0, 0xD2, 0xD1, 0xC4, 0xC4, 0xCA, 0xC7, 0xC5, 0xC5,
+  0xC7, 0xC6, 0xC7, 0xAE, 0x80, 0xC6, 0x03, 0xC4, 0xC2, 0xC1, 0xC2, 0x81, 0xC1, 0x03, 0xA6, 0xC1,
+  0xA6, 0xAD, 0x81, 0xC1, 0x06, 0xA6, 0xA6, 0xAD, 0xA6, 0xC1, 0xA6, 0xC1, 0x82, 0xA6, 0x03, 0xAD,
+  0xA6, 0xC1, 0xC1, 0x80, 0xA6, 0x00, 0xC1, 0x80, 0xA6, 0x00, 0xC1, 0x87, 0xA6, 0x03, 0xC0, 0xC1,
+  0xA6, 0xC1, 0x81, 0xAC, 0x01, 0xA4, 0xCF, 0x84, 0xCA, 0x23, 0xD0, 0xD9, 0xCD, 0xD0, 0xD0, 0xCD,
+  0xD0, 0xCD, 0xD8, 0xD3, 0xD4, 0xD4, 0xD3, 0xD7, 0xD5, 0xE3, 0xE3, 0xE2, 0xE6, 0xE1, 0xBA, 0xEB,
+  0xE6, 0xDC, 0xE3, 0xE0, 0xE8, 0xEE, 0xEB, 0xF1, 0xEB, 0xF3, 0xF1, 0xF1, 0xEB, 0xF2, 0x03, 0xF3,
+  0xEC, 0xF1, 0xF1, 0x80, 0xF3, 0x04, 0xF1, 0xEC, 0xEC, 0xFA, 0xE6, 0x84, 0xE7, 0x19, 0xE3, 0xE7,
+  0xE0, 0xE3, 0xE3, 0xE5, 0xD4, 0xD4, 0xD2, 0xD4, 0xD6, 0xDE, 0xD9, 0xE5, 0xD5, 0xD7, 0xDE, 0xDE,
+  0xE3, 0xDE, 0xDB, 0xD0, 0xD0, 0xCD, 0xC4, 0xC4, 0x80, 0xAE, 0x04, 0xC4, 0xAE, 0xAE, 0xC5, 0xC7,
+  0x82, 0xC5, 0x03, 0xAE, 0xAC, 0xAD, 0xAD, 0x81, 0xC1, 0x80, 0xA6, 0x02, 0xC1, 0xA6, 0xA6, 0x80,
+  0xC1, 0x80, 0xA6, 0x02, 0xC1, 0xA6, 0xA5, 0x80, 0xA6, 0x03, 0xC1, 0xA6, 0xC1, 0xC1, 0x80, 0xA6,
+  0x0A, 0xC1, 0xC1, 0xA6, 0xC1, 0xA6, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6, 0xA5, 0x82, 0xA6, 0x01, 0xC1,
+  0xBF, 0x80, 0xAC, 0x2B, 0xC3, 0xAC, 0xAC, 0xCD, 0xCA, 0xCA, 0xD0, 0xCA, 0xCA, 0xDB, 0xD4, 0xDB,
+  0xE7, 0xDF, 0xD7, 0xCD, 0xCD, 0xDB, 0xD4, 0xD8, 0xD6, 0xD4, 0xD4, 0xD9, 0xD6, 0xDB, 0xE7, 0xE4,
+  0xE6, 0xDC, 0xEB, 0xF0, 0xE9, 0xE9, 0xEA, 0xF5, 0xE9, 0xE6, 0xED, 0xEB, 0xF1, 0xEB, 0xF2, 0xEB,
+  0x80, 0xF1, 0x00, 0xF2, 0x00, 0xEC, 0x82, 0xF3, 0x00, 0xF1, 0x80, 0xF3, 0x0F, 0xEE, 0xEA, 0xE8,
+  0xE6, 0xE4, 0xE7, 0xE4, 0xE7, 0xE4, 0xE3, 0xE3, 0xE4, 0xE6, 0xE1, 0xD8, 0xD6, 0x81, 0xD4, 0x10,
+  0xE0, 0xD9, 0xDE, 0xD7, 0xD3, 0xDE, 0xDE, 0xD9, 0xD8, 0xD6, 0xDA, 0xCD, 0xD2, 0xCD, 0xC8, 0xC7,
+  0xC4, 0x81, 0xAE, 0x04, 0xD1, 0xC5, 0xC5, 0xC6, 0xC6, 0x80, 0xC5, 0x04, 0xC3, 0xAD, 0xAD, 0xC1,
+  0xAD, 0x81, 0xA6, 0x02, 0xC1, 0xA6, 0xC1, 0x80, 0xA6, 0x01, 0xC1, 0xC1, 0x82, 0xA6, 0x80, 0xC1,
+  0x08, 0xA6, 0xC1, 0xA6, 0xA5, 0xC1, 0xC1, 0xA6, 0xA6, 0xC1, 0x82, 0xA6, 0x00, 0xC1, 0x83, 0xA6,
+  0x03, 0xA5, 0xA5, 0xA7, 0xAD, 0x80, 0xAE, 0x00, 0xC6, 0x80, 0xC8, 0x23, 0xCA, 0xCA, 0xD0, 0xCA,
+  0xD0, 0xD8, 0xDE, 0xD7, 0xDB, 0xDE, 0xDE, 0xDB, 0xD3, 0xE1, 0xE1, 0xD7, 0xD4, 0xE5, 0xD9, 0xE0,
+  0xE3, 0xE3, 0xE4, 0xDE, 0xE4, 0xEA, 0xF3, 0xEE, 0xEE, 0xF3, 0xEC, 0xF6, 0xEE, 0xF6, 0xEC, 0xEA,
+  0x80, 0xF3, 0x04, 0xEB, 0xEC, 0xEB, 0xF1, 0xF1, 0x2E, 0xEC, 0xF3, 0xF3, 0xEC, 0xF3, 0xF3, 0xF1,
+  0xF3, 0xEC, 0xEC, 0xEF, 0xEC, 0xEF, 0xEA, 0xE9, 0xEB, 0xF6, 0xE6, 0xE4, 0xE4, 0xE3, 0xE4, 0xE8,
+  0xE6, 0xE8, 0xE5, 0xD6, 0xDB, 0xD6, 0xD5, 0xDE, 0xD3, 0xDB, 0xDE, 0xD4, 0xD6, 0xDB, 0xDE, 0xD4,
+  0xCD, 0xD9, 0xDA, 0xCC, 0xD0, 0xC8, 0xCB, 0xC7, 0x83, 0xAE, 0x0B, 0xC9, 0xC6, 0xC6, 0xC5, 0xC7,
+  0xC6, 0xAC, 0xAD, 0xAC, 0xAC, 0xBF, 0xAD, 0x82, 0xC1, 0x00, 0xA6, 0x80, 0xC1, 0x01, 0xA6, 0xA6,
+  0x80, 0xC1, 0x84, 0xA6, 0x00, 0xA5, 0x83, 0xA6, 0x01, 0xC1, 0xC1, 0x88, 0xA6, 0x02, 0xC1, 0xAC,
+  0xAC, 0x80, 0xC6, 0x80, 0xC8, 0x2C, 0xCF, 0xCA, 0xCA, 0xD0, 0xD7, 0xD8, 0xD8, 0xCD, 0xDB, 0xE5,
+  0xDE, 0xDB, 0xDA, 0xE3, 0xE5, 0xD5, 0xD7, 0xD4, 0xD5, 0xD7, 0xE3, 0xE4, 0xE3, 0xE4, 0xE7, 0xDC,
+  0xEA, 0xEE, 0xF6, 0xF7, 0xEF, 0xF3, 0xEF, 0xEA, 0xEE, 0xED, 0xF3, 0xEE, 0xEE, 0xEB, 0xF1, 0xF6,
+  0xF1, 0xEB, 0xF2, 0x05, 0xF1, 0xF3, 0xF1, 0xF3, 0xF3, 0xF1, 0x81, 0xF3, 0x20, 0xEC, 0xEB, 0xF3,
+  0xEC, 0xEB, 0xEF, 0xEA, 0xED, 0xE7, 0xE4, 0xE6, 0xE6, 0xEF, 0xEA, 0xED, 0xEB, 0xD9, 0xE4, 0xE3,
+  0xDB, 0xD5, 0xD6, 0xDE, 0xDE, 0xE3, 0xD9, 0xDB, 0xDE, 0xDB, 0xD7, 0xD7, 0xCD, 0xCD, 0x80, 0xD0,
+  0x1D, 0xCA, 0xC7, 0xAE, 0xAE, 0xC8, 0xC4, 0xC7, 0xC7, 0xC6, 0xCA, 0xC6, 0xC5, 0xC6, 0xC7, 0xAC,
+  0xBF, 0xC1, 0xC1, 0xA6, 0xA5, 0xA7, 0xBF, 0xA6, 0xC1, 0xA6, 0xC1, 0xA6, 0xC1, 0xC1, 0xA6, 0x80,
+  0xC1, 0x81, 0xA6, 0x0B, 0xC1, 0xC1, 0xA6, 0xA6, 0xAD, 0xA6, 0xC1, 0xA6, 0xA6, 0xAD, 0xC1, 0xC1,
+  0x80, 0xA6, 0x0D, 0xC1, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6, 0xA5, 0xA6, 0xC1, 0xA7, 0xC7, 0xC8, 0xCA,
+  0xCA, 0x80, 0xD0, 0x07, 0xCA, 0xCA, 0xCD, 0xDD, 0xE5, 0xE0, 0xDE, 0xD8, 0x84, 0xDE, 0x12, 0xD3,
+  0xD5, 0xDE, 0xDE, 0xDC, 0xE6, 0xE3, 0xE3, 0xE7, 0xE7, 0xE8, 0xEC, 0xEE, 0xEE, 0xF3, 0xF6, 0xF8,
+  0xF3, 0xFC, 0x82, 0xF3, 0x05, 0xF2, 0xF3, 0xF3, 0xF1, 0xEC, 0xF3, 0x05, 0xF3, 0xF5, 0xEB, 0xF3,
+  0xF3, 0xF1, 0x82, 0xF3, 0x29, 0xF1, 0xF1, 0xF4, 0xEC, 0xF1, 0xF3, 0xEF, 0xE6, 0xE7, 0xE4, 0xEB,
+  0xEE, 0xEA, 0xEA, 0xF8, 0xF6, 0xF0, 0xE6, 0xE3, 0xDA, 0xD6, 0xE5, 0xD5, 0xDE, 0xE3, 0xD7, 0xDE,
+  0xDB, 0xD8, 0xD2, 0xCD, 0xD0, 0xD1, 0xCA, 0xD0, 0xCA, 0xC8, 0xC6, 0xC4, 0xC6, 0xC7, 0xC6, 0x80,
+  0xCA, 0x08, 0xC6, 0xC5, 0xC6, 0xC8, 0xC6, 0xAE, 0xAC, 0xAC, 0xA6, 0x80, 0xBF, 0x0A, 0xC1, 0xC1,
+  0xA5, 0xA6, 0xC1, 0xAD, 0xC1, 0xA6, 0xA5, 0xA6, 0xC1, 0x81, 0xA6, 0x03, 0xC1, 0xA6, 0xC1, 0xC1,
+  0x81, 0xA6, 0x06, 0xA5, 0xA6, 0xA6, 0xC1, 0xA6, 0xC1, 0xC1, 0x80, 0xA6, 0x01, 0xA7, 0xC0, 0x80,
+  0xA6, 0x01, 0xAC, 0xA7, 0x80, 0xCA, 0x00, 0xCD, 0x80, 0xCA, 0x08, 0xC6, 0xD3, 0xD9, 0xDE, 0xDB,
+  0xDE, 0xDE, 0xDB, 0xE3, 0x83, 0xDE, 0x10, 0xD9, 0xDB, 0xE4, 0xE7, 0xDC, 0xE6, 0xE4, 0xE3, 0xE7,
+  0xE6, 0xF6, 0xEC, 0xF6, 0xEF, 0xEF, 0xED, 0xEC, 0x84, 0xF3, 0x05, 0xF2, 0xF1, 0xF1, 0xF0, 0xF1,
+  0xF1, 0x00, 0xEC, 0x80, 0xF3, 0x00, 0xEF, 0x82, 0xF3, 0x21, 0xF1, 0xF3, 0xF1, 0xF3, 0xF3, 0xF1,
+  0xEE, 0xEF, 0xF6, 0xE6, 0xE6, 0xEB, 0xEB, 0xF1, 0xEC, 0xF3, 0xEC, 0xEA, 0xDC, 0xDB, 0xDB, 0xD9,
+  0xD8, 0xE3, 0xD5, 0xE3, 0xE7, 0xDB, 0xDB, 0xDE, 0xD4, 0xD0, 0xD0, 0xCD, 0x80, 0xD0, 0x0A, 0xC6,
+  0xD0, 0xC6, 0xC7, 0xC6, 0xCA, 0xCA, 0xC6, 0xC8, 0xAE, 0xD1, 0x81, 0xC6, 0x05, 0xA4, 0xAC, 0xA6,
+  0xA6, 0xC1, 0xC1, 0x82, 0xA6, 0x02, 0xC1, 0xA6, 0xC1, 0x85, 0xA6, 0x00, 0xC1, 0x82, 0xA6, 0x0D,
+  0xA5, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6, 0xA5, 0xC1, 0xBF, 0xA6, 0xA5, 0xA7, 0xA6, 0xA6, 0x80, 0xAC,
+  0x09, 0xC4, 0xC6, 0xDA, 0xD8, 0xD8, 0xDA, 0xD0, 0xCA, 0xDB, 0xDB, 0x80, 0xDE, 0x1D, 0xE3, 0xE3,
+  0xDE, 0xE3, 0xDE, 0xE3, 0xE3, 0xDE, 0xE3, 0xE5, 0xDC, 0xE0, 0xDB, 0xED, 0xEB, 0xF1, 0xDC, 0xE6,
+  0xE6, 0xE9, 0xF4, 0xEC, 0xF1, 0xF3, 0xF1, 0xFC, 0xF1, 0xF3, 0xF1, 0xF1, 0x80, 0xF3, 0x81, 0xF1,
+  0x02, 0xEB, 0xF3, 0xF1, 0x23, 0xF3, 0xF3, 0xEF, 0xFE, 0xEC, 0xFC, 0xF3, 0xF1, 0xF1, 0xF3, 0xF2,
+  0xF3, 0xF1, 0xF3, 0xFC, 0xF2, 0xFA, 0xF4, 0xED, 0xF1, 0xED, 0xEF, 0xF1, 0xEB, 0xEC, 0xF3, 0xF3,
+  0xE9, 0xE9, 0xE8, 0xE5, 0xD9, 0xE5, 0xDB, 0xDE, 0xDE, 0x81, 0xE3, 0x1A, 0xE2, 0xD4, 0xCD, 0xD0,
+  0xD0, 0xCA, 0xD0, 0xCA, 0xD0, 0xCA, 0xC7, 0xC6, 0xCA, 0xCA, 0xC6, 0xCF, 0xC6, 0xC4, 0xCA, 0xC5,
+  0xC7, 0xC6, 0xAE, 0xAD, 0xBF, 0xA7, 0xBF, 0x87, 0xA6, 0x00, 0xC1, 0x81, 0xA6, 0x00, 0xA5, 0x81,
+  0xA6, 0x00, 0xA3, 0x85, 0xA6, 0x16, 0xC1, 0xA6, 0xBF, 0xA7, 0xA6, 0xA7, 0xA6, 0xBF, 0xD7, 0xD1,
+  0xD2, 0xC8, 0xD2, 0xDA, 0xDA, 0xD9, 0xD9, 0xDE, 0xD0, 0xD4, 0xE1, 0xDE, 0xD9, 0x80, 0xDE, 0x01,
+  0xE3, 0xE3, 0x80, 0xDE, 0x20, 0xE3, 0xE3, 0xE6, 0xEB, 0xE6, 0xE8, 0xEF, 0xE9, 0xF6, 0xEE, 0xED,
+  0xFA, 0xF2, 0xEF, 0xF3, 0xF1, 0xF3, 0xF1, 0xF3, 0xF1, 0xF3, 0xF1, 0xF1, 0xF3, 0xF3, 0xF1, 0xF1,
+  0xF0, 0xF2, 0xF3, 0xF0, 0xF3, 0xF1, 0x81, 0xF3, 0x03, 0xEC, 0xF3, 0xF3, 0xFC, 0x81, 0xF3, 0x00,
+  0xF2, 0x81, 0xF3, 0x02, 0xF2, 0xF3, 0xEC, 0x82, 0xF3, 0x00, 0xEC, 0x80, 0xEB, 0x0D, 0xE9, 0xE6,
+  0xE8, 0xE8, 0xE7, 0xE1, 0xE3, 0xE3, 0xDE, 0xE3, 0xDE, 0xE3, 0xE5, 0xD4, 0x80, 0xCD, 0x03, 0xD6,
+  0xD9, 0xD8, 0xD0, 0x80, 0xCA, 0x1C, 0xD0, 0xCA, 0xCA, 0xC9, 0xC6, 0xAE, 0xC7, 0xC7, 0xC6, 0xC5,
+  0xAE, 0xAD, 0xAD, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA5, 0xC1, 0xA6, 0xA6, 0xA5, 0xC1, 0xC1, 0xA6,
+  0xA6, 0xAD, 0xC1, 0x87, 0xA6, 0x16, 0xAD, 0xA6, 0xC1, 0xA7, 0xC1, 0xA6, 0xA7, 0xC1, 0xA6, 0xAC,
+  0xAE, 0xC4, 0xCA, 0xD1, 0xC6, 0xCF, 0xD4, 0xDB, 0xDD, 0xDB, 0xD8, 0xD7, 0xDB, 0x80, 0xDE, 0x02,
+  0xDF, 0xDE, 0xDE, 0x82, 0xE3, 0x0E, 0xE4, 0xE2, 0xE6, 0xEA, 0xE9, 0xEE, 0xF6, 0xEC, 0xEF, 0xEC,
+  0xF2, 0xF3, 0xF3, 0xEE, 0xEE, 0x80, 0xF3, 0x0F, 0xF1, 0xF3, 0xF5, 0xF3, 0xF3, 0xF1, 0xF3, 0xF3,
+  0xF2, 0xF2, 0xF3, 0xF3, 0xFC, 0xF2, 0xF2, 0xF1, 0x23, 0xF2, 0xF3, 0xF2, 0xEF, 0xF2, 0xF2, 0xF3,
+  0xFB, 0xF3, 0xF1, 0xF1, 0xF2, 0xF2, 0xF5, 0xF1, 0xF5, 0xFC, 0xFC, 0xF2, 0xF3, 0xF1, 0xF3, 0xF5,
+  0xEC, 0xEB, 0xEF, 0xE9, 0xE9, 0xEC, 0xF6, 0xEA, 0xEA, 0xE9, 0xE8, 0xE0, 0xE7, 0x81, 0xE3, 0x1C,
+  0xE4, 0xE4, 0xE3, 0xD8, 0xD5, 0xE5, 0xE3, 0xD6, 0xDB, 0xCC, 0xCB, 0xD0, 0xCD, 0xD1, 0xD0, 0xCA,
+  0xCA, 0xD0, 0xCB, 0xCF, 0xC6, 0xCA, 0xCA, 0xC5, 0xC4, 0xAC, 0xAC, 0xC3, 0xA4, 0x83, 0xA6, 0x01,
+  0xC1, 0xC1, 0x85, 0xA6, 0x05, 0xA5, 0xA6, 0xA6, 0xC1, 0xA6, 0xC1, 0x80, 0xA6, 0x00, 0xC1, 0x80,
+  0xA6, 0x0F, 0xBF, 0xAD, 0xBF, 0xAE, 0xC6, 0xC6, 0xC7, 0xC7, 0xCD, 0xD7, 0xD3, 0xD9, 0xDE, 0xDB,
+  0xDB, 0xD9, 0x80, 0xDE, 0x18, 0xE0, 0xE5, 0xE4, 0xE3, 0xE3, 0xE7, 0xE3, 0xE3, 0xE4, 0xDF, 0xE2,
+  0xE6, 0xF6, 0xEF, 0xEF, 0xFA, 0xF3, 0xF1, 0xF1, 0xF2, 0xF3, 0xF2, 0xF1, 0xF1, 0xF3, 0x80, 0xF2,
+  0x0E, 0xFC, 0xF2, 0xFB, 0xF2, 0xF3, 0xF2, 0xF1, 0xFB, 0xEB, 0xF2, 0xF5, 0xFB, 0xF5, 0xFB, 0xFB,
+  0x14, 0xF1, 0xF3, 0xF1, 0xFB, 0xEC, 0xF1, 0xF3, 0xFB, 0xF3, 0xF2, 0xF1, 0xF1, 0xFC, 0xF3, 0xF3,
+  0xFC, 0xF3, 0xF3, 0xF1, 0xFB, 0xF3, 0x81, 0xF1, 0x09, 0xE9, 0xBA, 0xE8, 0xEB, 0xED, 0xEB, 0xEC,
+  0xEB, 0xEB, 0xED, 0x80, 0xE7, 0x21, 0xE3, 0xE3, 0xE7, 0xE4, 0xDE, 0xE7, 0xDE, 0xD6, 0xE3, 0xE3,
+  0xD5, 0xE4, 0xD9, 0xD4, 0xE7, 0xDE, 0xCD, 0xCC, 0xC8, 0xDA, 0xCC, 0xCD, 0xD0, 0xCA, 0xD0, 0xCA,
+  0xCA, 0xC5, 0xC7, 0xC7, 0xC5, 0xC7, 0xAC, 0xA3, 0x82, 0xA6, 0x02, 0xC1, 0xA6, 0xC1, 0x84, 0xA6,
+  0x1A, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6, 0xC1, 0xA6, 0xBF, 0xA6, 0xA6, 0xC1, 0xC1, 0xA6, 0xC3, 0xC5,
+  0xC7, 0xCA, 0xCD, 0xD0, 0xCD, 0xDB, 0xD9, 0xDB, 0xDE, 0xDE, 0xDB, 0xDE, 0x80, 0xE3, 0x0C, 0xE1,
+  0xD4, 0xE4, 0xE0, 0xE7, 0xE7, 0xE3, 0xE7, 0xE3, 0xE3, 0xDB, 0xEB, 0xEF, 0x80, 0xF1, 0x10, 0xF2,
+  0xF1, 0xF1, 0xEF, 0xF3, 0xFB, 0xF1, 0xFB, 0xF3, 0xF1, 0xF1, 0xF3, 0xF3, 0xFB, 0xF1, 0xF3, 0xEC,
+  0x81, 0xF1, 0x05, 0xFB, 0xF3, 0xF3, 0xFC, 0xF1, 0xF3, 0x00, 0xFB, 0x80, 0xF3, 0x09, 0xF5, 0xFC,
+  0xF1, 0xF3, 0xF4, 0xF2, 0xFB, 0xF3, 0xF3, 0xFC, 0x80, 0xF3, 0x00, 0xF1, 0x80, 0xF3, 0x11, 0xEE,
+  0xF3, 0xF1, 0xEB, 0xF6, 0xED, 0xBA, 0xF0, 0xEA, 0xBA, 0xF6, 0xEB, 0xE9, 0xE9, 0xDA, 0xE2, 0xE7,
+  0xE4, 0x82, 0xE7, 0x20, 0xE3, 0xE4, 0xE4, 0xE3, 0xE4, 0xE4, 0xDF, 0xD6, 0xD3, 0xDB, 0xD8, 0xD9,
+  0xD6, 0xCD, 0xD8, 0xDB, 0xDA, 0xCD, 0xC8, 0xD1, 0xCA, 0xC6, 0xC6, 0xCA, 0xC6, 0xCA, 0xC5, 0xAD,
+  0xBF, 0xA6, 0xC1, 0xA6, 0xC1, 0x80, 0xA6, 0x29, 0xAD, 0xC1, 0xA6, 0xA6, 0xBF, 0xA5, 0xA6, 0xA6,
+  0xC1, 0xC1, 0xA6, 0xA6, 0xBF, 0xA6, 0xA6, 0xC1, 0xBF, 0xC1, 0xAC, 0xBF, 0xC6, 0xD4, 0xDA, 0xCD,
+  0xD5, 0xDC, 0xD9, 0xD9, 0xD8, 0xDB, 0xDE, 0xE1, 0xDE, 0xDE, 0xE5, 0xDE, 0xE4, 0xE2, 0xD8, 0xE4,
+  0xE3, 0xE3, 0x81, 0xE7, 0x0F, 0xE3, 0xDC, 0xED, 0xEC, 0xEB, 0xEB, 0xF4, 0xF4, 0xF1, 0xF3, 0xEF,
+  0xF1, 0xFB, 0xF3, 0xF4, 0xF3, 0x80, 0xF1, 0x0E, 0xF3, 0xF3, 0xF1, 0xFC, 0xF1, 0xF1, 0xF2, 0xF1,
+  0xFC, 0xF1, 0xF3, 0xF5, 0xF3, 0xFC, 0xF1, 0x00, 0xF1, 0x81, 0xF3, 0x02, 0xF1, 0xFC, 0xF1, 0x80,
+  0xF3, 0x06, 0xEC, 0xF3, 0xF3, 0xFB, 0xFB, 0xF1, 0xFA, 0x80, 0xF3, 0x35, 0xEE, 0xF3, 0xF1, 0xEC,
+  0xF1, 0xEB, 0xF3, 0xED, 0xF2, 0xEB, 0xED, 0xE9, 0xEB, 0xE9, 0xDC, 0xE4, 0xE7, 0xE7, 0xE3, 0xE3,
+  0xE7, 0xE4, 0xE7, 0xE3, 0xE4, 0xE4, 0xE3, 0xE4, 0xE1, 0xE4, 0xE3, 0xE3, 0xDE, 0xDE, 0xE3, 0xE2,
+  0xD9, 0xD7, 0xDB, 0xDE, 0xDB, 0xCC, 0xD9, 0xCC, 0xCB, 0xCA, 0xD0, 0xC6, 0xC6, 0xCA, 0xCA, 0xAE,
+  0xAC, 0xBF, 0x82, 0xA6, 0x80, 0xC1, 0x0B, 0xAD, 0xA6, 0xA6, 0xBF, 0xA6, 0xC1, 0xA6, 0xC1, 0xA6,
+  0xC1, 0xBF, 0xC1, 0x80, 0xBF, 0x05, 0xAC, 0xA4, 0xD6, 0xD9, 0xDE, 0xD9, 0x80, 0xDE, 0x07, 0xDB,
+  0xDE, 0xDB, 0xD3, 0xD7, 0xD8, 0xD6, 0xD6, 0x80, 0xE3, 0x16, 0xE4, 0xE7, 0xE7, 0xE4, 0xDE, 0xE3,
+  0xE7, 0xE7, 0xE6, 0xED, 0xEA, 0xF3, 0xF3, 0xEB, 0xEB, 0xF1, 0xF1, 0xF3, 0xF2, 0xF3, 0xFC, 0xF1,
+  0xF5, 0x80, 0xF3, 0x0F, 0xFA, 0xF3, 0xF3, 0xF1, 0xF3, 0xF1, 0xF1, 0xF2, 0xF3, 0xF2, 0xF1, 0xF3,
+  0xFB, 0xF3, 0xF3, 0xFB, 0x81, 0xF3, 0x06, 0xFC, 0xF3, 0xFC, 0xF3, 0xEE, 0xF3, 0xF5, 0x81, 0xFC,
+  0x87, 0xF3, 0x81, 0xF1, 0x1B, 0xF3, 0xF3, 0xE9, 0xBA, 0xEB, 0xE9, 0xF7, 0xE6, 0xE7, 0xE4, 0xE7,
+  0xE7, 0xE3, 0xE7, 0xE7, 0xE3, 0xE4, 0xE7, 0xE3, 0xE3, 0xE4, 0xE2, 0xE4, 0xE3, 0xE4, 0xE3, 0xE2,
+  0xE3, 0x80, 0xDE, 0x00, 0xD8, 0x80, 0xDE, 0x0E, 0xD8, 0xDA, 0xCC, 0xD8, 0xDB, 0xD2, 0xC6, 0xCA,
+  0xC7, 0xD1, 0xC4, 0xC4, 0xBF, 0xAD, 0xBF, 0x80, 0xA6, 0x15, 0xBF, 0xA6, 0xA6, 0xA7, 0xC1, 0xBF,
+  0xC1, 0xC1, 0xBF, 0xAC, 0xC3, 0xC5, 0xC5, 0xAC, 0xAC, 0xAD, 0xC5, 0xD4, 0xD8, 0xD9, 0xDB, 0xDB,
+  0x82, 0xDE, 0x18, 0xCC, 0xDB, 0xD5, 0xD9, 0xD6, 0xE3, 0xE2, 0xE5, 0xE5, 0xDA, 0xE8, 0xE4, 0xE5,
+  0xE4, 0xE7, 0xE3, 0xE4, 0xB6, 0xF1, 0xF1, 0xF3, 0xF3, 0xF1, 0xF3, 0xF1, 0x84, 0xF3, 0x04, 0xEC,
+  0xF1, 0xF3, 0xF1, 0xFA, 0x80, 0xF3, 0x05, 0xF2, 0xFB, 0xF3, 0xF4, 0xFB, 0xF1, 0x82, 0xF3, 0x02,
+  0xF3, 0xFC, 0xF5, 0x80, 0xF3, 0x02, 0xEC, 0xF3, 0xEE, 0x81, 0xF3, 0x00, 0xFC, 0x84, 0xF3, 0x00,
+  0xF5, 0x85, 0xF3, 0x1A, 0xE9, 0xEF, 0xE9, 0xEB, 0xEB, 0xF0, 0xE8, 0xE6, 0xE4, 0xDE, 0xE3, 0xE3,
+  0xE7, 0xE4, 0xE3, 0xE4, 0xDE, 0xE4, 0xE4, 0xE3, 0xE4, 0xE3, 0xE3, 0xDF, 0xE4, 0xE3, 0xE4, 0x80,
+  0xDE, 0x00, 0xDD, 0x81, 0xDE, 0x01, 0xE5, 0xD4, 0x80, 0xDB, 0x0B, 0xC8, 0xCA, 0xCA, 0xC6, 0xC7,
+  0xC5, 0xD0, 0xAC, 0xC3, 0xA6, 0xA6, 0xC1, 0x80, 0xA6, 0x0F, 0xBF, 0xC1, 0xA6, 0xBF, 0xBF, 0xA4,
+  0xCC, 0xC4, 0xD1, 0xD1, 0xCC, 0xAE, 0xC3, 0xD9, 0xDB, 0xDC, 0x80, 0xD9, 0x81, 0xDE, 0x0D, 0xD6,
+  0xDB, 0xE4, 0xE4, 0xE7, 0xE7, 0xE4, 0xE4, 0xE5, 0xBA, 0xDC, 0xEE, 0xF8, 0xE3, 0x80, 0xE4, 0x0B,
+  0xDF, 0xBA, 0xEB, 0xF1, 0xEB, 0xF1, 0xED, 0xF3, 0xF1, 0xEB, 0xEF, 0xEC, 0x82, 0xF3, 0x03, 0xF1,
+  0xF3, 0xF3, 0xFC, 0x80, 0xF3, 0x05, 0xFC, 0xFB, 0xFA, 0xF1, 0xF3, 0xFB, 0x80, 0xFC, 0x01, 0xF3,
+  0xF3, 0x05, 0xF3, 0xF2, 0xF3, 0xF3, 0xEC, 0xF3, 0x80, 0xFC, 0x02, 0xF7, 0xF3, 0xFC, 0x80, 0xF3,
+  0x05, 0xFC, 0xF3, 0xFC, 0xF3, 0xF3, 0xEF, 0x84, 0xF3, 0x04, 0xEE, 0xF3, 0xEE, 0xF3, 0xF3, 0x80,
+  0xF1, 0x01, 0xEA, 0xE8, 0x80, 0xE4, 0x04, 0xE3, 0xE4, 0xE4, 0xE3, 0xE4, 0x81, 0xE3, 0x0A, 0xDE,
+  0xE3, 0xE4, 0xE1, 0xE3, 0xDE, 0xE3, 0xE3, 0xDE, 0xDE, 0xD8, 0x81, 0xDE, 0x11, 0xDF, 0xDF, 0xD4,
+  0xDA, 0xDE, 0xC8, 0xD7, 0xD0, 0xCA, 0xCA, 0xD0, 0xCA, 0xCA, 0xD1, 0xA3, 0xA6, 0xA6, 0xC1, 0x80,
+  0xA6, 0x12, 0xAC, 0xA7, 0xAC, 0xD7, 0xD2, 0xCD, 0xCD, 0xD2, 0xD0, 0xCA, 0xCD, 0xDB, 0xE5, 0xDB,
+  0xDE, 0xDB, 0xDB, 0xDE, 0xE3, 0x80, 0xDE, 0x04, 0xE3, 0xE3, 0xDF, 0xE0, 0xE4, 0x80, 0xE6, 0x05,
+  0xED, 0xEB, 0xEC, 0xEB, 0xEB, 0xE8, 0x80, 0xE4, 0x22, 0xE6, 0xEE, 0xEB, 0xF3, 0xF1, 0xF1, 0xF3,
+  0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF1, 0xF1, 0xFC, 0xFC, 0xF3, 0xF1, 0xF3, 0xFA, 0xFC, 0xF3, 0xFC,
+  0xF3, 0xF3, 0xFC, 0xF3, 0xFB, 0xF1, 0xF3, 0xF3, 0xF5, 0xFD, 0xFB, 0xF3, 0x02, 0xF3, 0xFB, 0xFC,
+  0x80, 0xF3, 0x0D, 0xF5, 0xF3, 0xFC, 0xF3, 0xFB, 0xFB, 0xF3, 0xFC, 0xF3, 0xF3, 0xFC, 0xF3, 0xF5,
+  0xFC, 0x85, 0xF3, 0x14, 0xEE, 0xEE, 0xF3, 0xEF, 0xF5, 0xF2, 0xEB, 0xF1, 0xEB, 0xE9, 0xDC, 0xE6,
+  0xE6, 0xE7, 0xE4, 0xE7, 0xE3, 0xE3, 0xE7, 0xE4, 0xE4, 0x83, 0xE3, 0x08, 0xE1, 0xE5, 0xE0, 0xE3,
+  0xDE, 0xDE, 0xE3, 0xDE, 0xE3, 0x80, 0xDE, 0x03, 0xE3, 0xD4, 0xD9, 0xDB, 0x80, 0xD3, 0x1C, 0xCD,
+  0xCD, 0xD2, 0xD2, 0xCC, 0xC8, 0xAE, 0xAE, 0xA6, 0xBF, 0xA6, 0xA7, 0xA7, 0xAE, 0xD7, 0xD6, 0xCC,
+  0xCC, 0xD3, 0xD3, 0xCD, 0xCD, 0xD4, 0xDE, 0xDE, 0xDB, 0xDE, 0xD9, 0xDB, 0x82, 0xDE, 0x27, 0xE3,
+  0xE3, 0xE4, 0xE4, 0xE6, 0xE4, 0xE6, 0xE9, 0xE9, 0xEC, 0xEB, 0xEB, 0xF2, 0xEA, 0xE9, 0xE9, 0xE6,
+  0xB6, 0xEF, 0xF1, 0xFC, 0xF3, 0xEC, 0xEE, 0xF1, 0xF3, 0xEA, 0xEA, 0xF3, 0xF3, 0xFC, 0xF2, 0xFB,
+  0xF3, 0xF1, 0xF3, 0xEF, 0xF3, 0xF3, 0xFC, 0x81, 0xF3, 0x01, 0xF4, 0xFC, 0x80, 0xF3, 0x02, 0xFB,
+  0xFB, 0xFC, 0x80, 0xF3, 0x11, 0xFC, 0xF3, 0xFC, 0xF3, 0xFC, 0xF3, 0xF3, 0xF1, 0xFB, 0xFC, 0xFC,
+  0xFA, 0xFA, 0xFC, 0xF5, 0xEE, 0xFC, 0xFA, 0x84, 0xF3, 0x20, 0xEE, 0xF3, 0xF3, 0xEC, 0xF3, 0xF3,
+  0xF1, 0xEC, 0xF1, 0xEF, 0xE9, 0xEB, 0xED, 0xED, 0xE4, 0xE4, 0xE3, 0xE7, 0xE7, 0xDC, 0xDE, 0xDE,
+  0xE7, 0xE3, 0xE0, 0xE0, 0xE3, 0xDD, 0xE5, 0xB2, 0xDB, 0xD4, 0xD9, 0x80, 0xDE, 0x51, 0xD8, 0xD5,
+  0xE5, 0xDE, 0xE7, 0xDE, 0xDE, 0xD5, 0xD4, 0xCD, 0xD4, 0xB2, 0xCD, 0xCC, 0xCC, 0xCD, 0xCC, 0xC8,
+  0xCF, 0xAC, 0xA7, 0xAC, 0xC8, 0xD5, 0xCD, 0xD3, 0xD7, 0xD4, 0xCD, 0xD3, 0xCD, 0xD9, 0xD8, 0xD8,
+  0xD3, 0xD5, 0xCE, 0xCC, 0xD3, 0xD5, 0xE5, 0xD8, 0xDF, 0xDE, 0xE3, 0xE3, 0xE4, 0xE4, 0xE6, 0xE4,
+  0xE9, 0xEE, 0xEC, 0xF3, 0xF3, 0xF1, 0xF1, 0xEB, 0xF3, 0xF3, 0xEA, 0xEE, 0xEF, 0xF6, 0xF1, 0xF3,
+  0xF3, 0xEE, 0xF3, 0xF5, 0xF3, 0xF1, 0xF3, 0xF1, 0xF1, 0xFA, 0xF1, 0xF3, 0xFC, 0xF3, 0xF1, 0xFB,
+  0x80, 0xFC, 0x0A, 0xF3, 0xF3, 0xF2, 0xF4, 0xF1, 0xFC, 0xF3, 0xFC, 0xF1, 0xFC, 0xF1, 0x01, 0xF3,
+  0xF4, 0x80, 0xF3, 0x12, 0xF4, 0xF3, 0xFB, 0xF2, 0xFA, 0xFB, 0xF3, 0xF8, 0xF8, 0xF3, 0xF3, 0xF8,
+  0xF4, 0xEE, 0xFC, 0xF4, 0xF4, 0xF3, 0xF3, 0x80, 0xEF, 0x01, 0xF3, 0xEE, 0x80, 0xF3, 0x0C, 0xEE,
+  0xEE, 0xEC, 0xF3, 0xF1, 0xE9, 0xEF, 0xEA, 0xF0, 0xE9, 0xDC, 0xE4, 0xE3, 0x80, 0xE4, 0x12, 0xD6,
+  0xD3, 0xD5, 0xD7, 0xD3, 0xD8, 0xDF, 0xDE, 0xD6, 0xD5, 0xDF, 0xCD, 0xD3, 0xD5, 0xCC, 0xD3, 0xD5,
+  0xCD, 0xCC, 0x85, 0xB1, 0x03, 0xAA, 0xB1, 0xB1, 0xAA, 0x80, 0xAB, 0x00, 0xB1, 0x81, 0xAA, 0x06,
+  0xAB, 0xAB, 0xAA, 0xAB, 0xB1, 0xB2, 0xB2, 0x80, 0xB1, 0x1D, 0xAB, 0xB1, 0xB2, 0xB1, 0xB2, 0xCC,
+  0xD3, 0xCC, 0xCC, 0xD5, 0xD3, 0xD5, 0xDB, 0xD5, 0xD6, 0xD6, 0xD9, 0xF5, 0xEE, 0xF3, 0xEE, 0xF8,
+  0xEE, 0xEE, 0xF3, 0xEE, 0xEE, 0xF6, 0xF7, 0xEF, 0x80, 0xF3, 0x10, 0xF7, 0xF7, 0xEE, 0xF8, 0xF1,
+  0xF3, 0xF3, 0xFC, 0xF3, 0xFC, 0xF3, 0xF5, 0xF4, 0xF4, 0xF3, 0xF3, 0xFC, 0x81, 0xF3, 0x08, 0xF2,
+  0xFB, 0xFC, 0xF3, 0xF3, 0xFC, 0xFB, 0xF4, 0xFC, 0x03, 0xF1, 0xFC, 0xF3, 0xFC, 0x80, 0xF3, 0x00,
+  0xF7, 0x80, 0xF3, 0x12, 0xF8, 0xFC, 0xF8, 0xF8, 0xFA, 0xEF, 0xFC, 0xF3, 0xF7, 0xF8, 0xF3, 0xFA,
+  0xFA, 0xEF, 0xF3, 0xEE, 0xF5, 0xFC, 0xFC, 0x82, 0xF3, 0x14, 0xF1, 0xF2, 0xEB, 0xEB, 0xF3, 0xEB,
+  0xEB, 0xE9, 0xB6, 0xDF, 0xE0, 0xE4, 0xE4, 0xE7, 0xE3, 0xD3, 0xD5, 0xD3, 0xD3, 0xD5, 0xD5, 0x83,
+  0xD3, 0x01, 0xB2, 0xB2, 0x80, 0xCE, 0x07, 0xB1, 0xB1, 0xAB, 0xB1, 0xAA, 0xB1, 0xB1, 0xAB, 0x80,
+  0xB2, 0x00, 0xCE, 0x80, 0xAB, 0x13, 0xAA, 0xAB, 0xAA, 0xAA, 0xB1, 0xCE, 0xCE, 0xAB, 0xB1, 0xAB,
+  0xB1, 0xAB, 0xAA, 0xB1, 0xAB, 0xB1, 0xCE, 0xD3, 0xCE, 0xCE, 0x80, 0xD5, 0x04, 0xCE, 0xCE, 0xB2,
+  0xD6, 0xD5, 0x80, 0xD6, 0x03, 0xFA, 0xFC, 0xEF, 0xF3, 0x81, 0xEE, 0x15, 0xF7, 0xEE, 0xF3, 0xF8,
+  0xFC, 0xF8, 0xF3, 0xEE, 0xF8, 0xF8, 0xF3, 0xF7, 0xFC, 0xF8, 0xFC, 0xF3, 0xF3, 0xFC, 0xFC, 0xF3,
+  0xF3, 0xFB, 0x83, 0xF3, 0x0A, 0xFC, 0xFC, 0xFA, 0xFB, 0xF3, 0xF3, 0xFC, 0xFC, 0xF2, 0xF1, 0xFA,
+  0x0C, 0xF4, 0xFB, 0xF3, 0xF3, 0xFC, 0xFC, 0xF3, 0xFA, 0xF3, 0xEE, 0xF8, 0xFC, 0xFC, 0x80, 0xEE,
+  0x0E, 0xFC, 0xF8, 0xF8, 0xFC, 0xF3, 0xFA, 0xFA, 0xEF, 0xEF, 0xFC, 0xF7, 0xF3, 0xFC, 0xF3, 0xF5,
+  0x84, 0xF3, 0x0B, 0xF1, 0xF1, 0xEC, 0xEC, 0xEB, 0xEA, 0xE8, 0xD5, 0xD6, 0xD6, 0xCE, 0xCE, 0x81,
+  0xD3, 0x15, 0xB2, 0xAB, 0xB1, 0xCE, 0xCE, 0xD5, 0xCE, 0xCC, 0xD6, 0xB2, 0xB1, 0xAA, 0xAA, 0xB1,
+  0xD5, 0xCE, 0xB2, 0xAB, 0xAA, 0xB2, 0xAA, 0xAB, 0x82, 0xAA, 0x12, 0xB1, 0xAA, 0xAB, 0xAA, 0xAA,
+  0xAB, 0xAA, 0xAB, 0xAA, 0xAA, 0xB1, 0xAB, 0xAA, 0xD6, 0xD3, 0xCE, 0xCE, 0xB2, 0xB1, 0x80, 0xAA,
+  0x01, 0xB2, 0xB2, 0x80, 0xB1, 0x80, 0xD6, 0x11, 0xD5, 0xD6, 0xEE, 0xEF, 0xEF, 0xEE, 0xF8, 0xF8,
+  0xF3, 0xF3, 0xEF, 0xF6, 0xF8, 0xF3, 0xF9, 0xF8, 0xF9, 0xEF, 0x80, 0xF8, 0x0D, 0xF7, 0xF3, 0xF8,
+  0xF3, 0xF3, 0xFC, 0xFC, 0xF3, 0xFC, 0xF3, 0xF1, 0xF3, 0xFC, 0xF3, 0x80, 0xFC, 0x0A, 0xF3, 0xFC,
+  0xF4, 0xFB, 0xFC, 0xF1, 0xFB, 0xF5, 0xFC, 0xFC, 0xFA, 0x81, 0xF3, 0x03, 0xF5, 0xED, 0xFC, 0xFC,
+  0x80, 0xF3, 0x07, 0xFC, 0xFC, 0xF7, 0xFC, 0xF3, 0xF8, 0xF3, 0xF5, 0x81, 0xFC, 0x06, 0xF8, 0xF3,
+  0xF5, 0xFC, 0xFC, 0xF8, 0xFC, 0x81, 0xF3, 0x00, 0xF4, 0x80, 0xF3, 0x07, 0xEC, 0xF3, 0xF3, 0xF7,
+  0xF3, 0xF3, 0xEC, 0xED, 0x80, 0xD6, 0x0A, 0xD5, 0xCE, 0xB1, 0xCE, 0xB1, 0xB1, 0xCE, 0xB1, 0xB2,
+  0xB1, 0xAA, 0x80, 0xB1, 0x0C, 0xAA, 0xAA, 0xAB, 0xAA, 0xAA, 0xAB, 0xAB, 0xAA, 0xAA, 0xB2, 0xAA,
+  0xA9, 0xB1, 0x83, 0xAA, 0x00, 0xB2, 0x86, 0xAA, 0x00, 0xB1, 0x83, 0xAA, 0x81, 0xB2, 0x80, 0xCE,
+  0x01, 0xB2, 0xCE, 0x81, 0xB1, 0x08, 0xB6, 0xEA, 0xF8, 0xF8, 0xEE, 0xF8, 0xF3, 0xFC, 0xF3, 0x81,
+  0xF8, 0x0F, 0xFA, 0xF8, 0xF8, 0xF3, 0xEE, 0xFC, 0xF8, 0xFC, 0xF7, 0xFC, 0xF8, 0xF3, 0xFC, 0xFC,
+  0xFB, 0xF1, 0x81, 0xF3, 0x82, 0xFC, 0x09, 0xF3, 0xF3, 0xFC, 0xFC, 0xFB, 0xF1, 0xFC, 0xF3, 0xF3,
+  0xFC, 0x02, 0xF5, 0xF3, 0xF3, 0x80, 0xFC, 0x05, 0xF8, 0xFC, 0xF3, 0xF3, 0xF8, 0xFC, 0x80, 0xF3,
+  0x0D, 0xEF, 0xF5, 0xF8, 0xFC, 0xF7, 0xEF, 0xF3, 0xEE, 0xFC, 0xEE, 0xF3, 0xF5, 0xEE, 0xF5, 0x83,
+  0xF3, 0x00, 0xEC, 0x81, 0xF3, 0x06, 0xED, 0xF3, 0xEE, 0xEE, 0xF6, 0xF6, 0xE6, 0x82, 0xD6, 0x80,
+  0xB1, 0x02, 0xAB, 0xA9, 0xB2, 0x81, 0xAA, 0x07, 0xAB, 0xAA, 0xAA, 0xB1, 0xAA, 0xCE, 0xAA, 0xAB,
+  0x82, 0xAA, 0x00, 0xB1, 0x83, 0xAA, 0x11, 0xB1, 0xAA, 0xAA, 0xD5, 0xAB, 0xB2, 0xD5, 0xB1, 0xAA,
+  0xB1, 0xAA, 0xAA, 0xAB, 0xAB, 0xAA, 0xCE, 0xAB, 0xA9, 0x81, 0xAA, 0x01, 0xB1, 0xAA, 0x81, 0xB1,
+  0x0B, 0xAA, 0xED, 0xF8, 0xEE, 0xEE, 0xF7, 0xFC, 0xEE, 0xF3, 0xF8, 0xF8, 0xF3, 0x80, 0xF8, 0x00,
+  0xF7, 0x81, 0xF8, 0x0B, 0xFC, 0xEF, 0xFC, 0xF8, 0xF3, 0xF3, 0xFC, 0xFC, 0xF5, 0xF3, 0xF3, 0xFA,
+  0x85, 0xFC, 0x02, 0xF3, 0xF5, 0xF5, 0x80, 0xFC, 0x03, 0xF3, 0xFC, 0xF3, 0xF5, 0x80, 0xF3, 0x16,
+  0xEF, 0xFC, 0xFC, 0xF3, 0xF8, 0xF8, 0xFC, 0xF3, 0xFC, 0xF3, 0xF3, 0xFC, 0xFA, 0xF7, 0xF8, 0xFA,
+  0xF3, 0xFA, 0xF8, 0xEE, 0xFC, 0xF3, 0xFC, 0x80, 0xF3, 0x01, 0xFC, 0xFC, 0x80, 0xF3, 0x0D, 0xEC,
+  0xF3, 0xF3, 0xF8, 0xF9, 0xEE, 0xF3, 0xF3, 0xEC, 0xEE, 0xF3, 0xF1, 0xEF, 0xD8, 0x80, 0xD6, 0x0A,
+  0xD5, 0xD5, 0xCE, 0xCE, 0xD5, 0xD5, 0xB1, 0xCE, 0xAA, 0xAA, 0xB1, 0x80, 0xAA, 0x04, 0xAB, 0xA9,
+  0xAA, 0xB1, 0xB1, 0x87, 0xAA, 0x05, 0xB2, 0xCE, 0xD3, 0xCE, 0xCC, 0xB2, 0x80, 0xB1, 0x0C, 0xAA,
+  0xAA, 0xC6, 0xCE, 0xCE, 0xD3, 0xCE, 0xCE, 0xCC, 0xCC, 0xCE, 0xB2, 0xD3, 0x80, 0xB1, 0x05, 0xD5,
+  0xD5, 0xD6, 0xD6, 0xE8, 0xE9, 0x80, 0xEE, 0x06, 0xF3, 0xEE, 0xEF, 0xEC, 0xF8, 0xF3, 0xFC, 0x82,
+  0xF8, 0x0A, 0xF3, 0xF8, 0xFC, 0xF8, 0xFC, 0xF3, 0xEE, 0xF3, 0xEC, 0xFC, 0xFA, 0x82, 0xFC, 0x03,
+  0xF3, 0xFC, 0xFC, 0xF3, 0x82, 0xFC, 0x08, 0xF3, 0xF8, 0xF8, 0xFB, 0xFB, 0xFC, 0xFE, 0xFB, 0xFC,
+  0x0A, 0xF1, 0xF1, 0xF3, 0xF8, 0xFC, 0xF3, 0xF3, 0xF8, 0xF7, 0xF3, 0xEE, 0x81, 0xFC, 0x0A, 0xF5,
+  0xFC, 0xF8, 0xF3, 0xFC, 0xEF, 0xF8, 0xFC, 0xEE, 0xF3, 0xF3, 0x80, 0xFC, 0x1A, 0xEC, 0xF3, 0xFC,
+  0xFC, 0xF3, 0xFC, 0xF3, 0xFC, 0xF3, 0xF1, 0xF3, 0xF1, 0xF1, 0xF3, 0xEF, 0xF3, 0xEB, 0xEA, 0xEB,
+  0xE1, 0xD8, 0xD6, 0xD6, 0xB2, 0xD5, 0xB2, 0xD5, 0x81, 0xCE, 0x1D, 0xB2, 0xD5, 0xB2, 0xB1, 0xB2,
+  0xB2, 0xAA, 0xB1, 0xAA, 0xAB, 0xAA, 0xB1, 0xB1, 0xA9, 0xAA, 0xCE, 0xD5, 0xB2, 0xCC, 0xCC, 0xD5,
+  0xD3, 0xCC, 0xD3, 0xCC, 0xCE, 0xCE, 0xB2, 0xB1, 0xAB, 0x80, 0xB1, 0x00, 0xD3, 0x80, 0xCE, 0x00,
+  0xD6, 0x80, 0xB2, 0x09, 0xD5, 0xCE, 0xB2, 0xD6, 0xD5, 0xD6, 0xD6, 0xBA, 0xF6, 0xFF, 0x80, 0xEE,
+  0x04, 0xEF, 0xF7, 0xEA, 0xEE, 0xEF, 0x80, 0xFC, 0x01, 0xF8, 0xFC, 0x80, 0xF8, 0x10, 0xEE, 0xF3,
+  0xF8, 0xFC, 0xEE, 0xF8, 0xFC, 0xFC, 0xF8, 0xF5, 0xEC, 0xFC, 0xF8, 0xF8, 0xFC, 0xEE, 0xF8, 0x80,
+  0xF3, 0x04, 0xFE, 0xF3, 0xF3, 0xFC, 0xF5, 0x82, 0xFC, 0x02, 0xFB, 0xF3, 0xF3, 0x80, 0xF3, 0x80,
+  0xFC, 0x01, 0xF3, 0xF8, 0x80, 0xF3, 0x80, 0xFC, 0x0E, 0xF3, 0xF3, 0xF4, 0xFC, 0xFC, 0xF3, 0xF7,
+  0xEE, 0xF8, 0xFC, 0xF3, 0xF3, 0xEF, 0xFC, 0xFC, 0x80, 0xF3, 0x00, 0xFC, 0x80, 0xF3, 0x02, 0xF4,
+  0xF2, 0xF2, 0x81, 0xF3, 0x0D, 0xEE, 0xEF, 0xEC, 0xF3, 0xF9, 0xEF, 0xB6, 0xDF, 0xD9, 0xD8, 0xD6,
+  0xD6, 0xCE, 0xD5, 0x80, 0xB1, 0x0B, 0xCE, 0xD5, 0xD5, 0xCE, 0xCE, 0xB2, 0xAA, 0xCC, 0xCD, 0xCE,
+  0xD3, 0xCE, 0x80, 0xD3, 0x00, 0xD6, 0x82, 0xB1, 0x02, 0xAA, 0xB2, 0xB1, 0x80, 0xCE, 0x07, 0xCC,
+  0xD5, 0xCE, 0xD5, 0xD3, 0xD3, 0xAB, 0xCE, 0x80, 0xB1, 0x03, 0xCE, 0xCE, 0xB2, 0xB1, 0x80, 0xD5,
+  0x0C, 0xD7, 0xE6, 0xEC, 0xEE, 0xEF, 0xEE, 0xEE, 0xFC, 0xFC, 0xEE, 0xFC, 0xEF, 0xF7, 0x80, 0xF8,
+  0x03, 0xFA, 0xFC, 0xF8, 0xFC, 0x80, 0xF8, 0x01, 0xEE, 0xFA, 0x81, 0xFC, 0x00, 0xF5, 0x80, 0xF3,
+  0x08, 0xFC, 0xF3, 0xFC, 0xF5, 0xF1, 0xFC, 0xF3, 0xFC, 0xF3, 0x81, 0xFC, 0x00, 0xF3, 0x80, 0xFC,
+  0x04, 0xFB, 0xF3, 0xF3, 0xFC, 0xF3
+};
+
+#endif
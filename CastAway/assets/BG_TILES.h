@@ -0,0 +1,2751 @@
+#ifndef BG8_TILES_H_
+#define BG8_TILES_H_
+
+#include <Arduino.h>
+
+// Generated by tools/ca_assetc.cpp (8x8 tiles of BACKGROUND, deduplicated with mirroring; CA_BG_TILES)
+//  ca_assetc -bg -tiles -set BG8_TILES -o CastAway/assets/BG_TILES.h CastAway/assets/BACKGROUND.h
+// Tiles are 64 BG8 palette indices, row-major. Map entries are tile numbers,
+// bit 15 set = mirrored left-right (CA_TileBg::HFLIP). The world is the 160x120 picture followed
+// by its mirror image: a 320x120 panorama that wraps seamlessly, at the flash
+// cost of the picture plus the map
+const uint16_t BG8_TILE_N = 300;   // 19200 B
+const uint8_t  BG8_MAP_W = 40, BG8_MAP_H = 15;
+
+const uint8_t BG8_tiles[BG8_TILE_N * 64] PROGMEM = {
+  // 0
+  0x35, 0x3B, 0x35, 0x41, 0x33, 0x35, 0x41, 0x41,
+  0x35, 0x41, 0x3F, 0x3F, 0x38, 0x35, 0x33, 0x35,
+  0x35, 0x41, 0x3B, 0x41, 0x41, 0x35, 0x35, 0x35,
+  0x41, 0x41, 0x41, 0x41, 0x35, 0x35, 0x35, 0x3F,
+  0x41, 0x43, 0x3B, 0x3B, 0x41, 0x41, 0x35, 0x35,
+  0x41, 0x41, 0xB5, 0x3B, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x40, 0xBD, 0x41, 0x41, 0x41, 0x41, 0x3B,
+  0x3B, 0x43, 0xB5, 0x41, 0x41, 0x3F, 0x35, 0x35,
+  // 1
+  0x35, 0x33, 0x35, 0x35, 0x38, 0x35, 0x35, 0x35,
+  0x35, 0x3F, 0x35, 0x41, 0x3B, 0x35, 0x35, 0x35,
+  0x35, 0x3F, 0x35, 0x35, 0x35, 0x35, 0x35, 0x41,
+  0x35, 0x41, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3F,
+  0x3F, 0x35, 0x35, 0x35, 0x35, 0x3F, 0x35, 0x35,
+  0x41, 0x35, 0x3F, 0x35, 0x38, 0x38, 0x35, 0x35,
+  0x3F, 0x41, 0x41, 0x35, 0x41, 0x35, 0x35, 0x35,
+  0x3B, 0x41, 0x35, 0x35, 0x35, 0x41, 0x35, 0x35,
+  // 2
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x2F, 0x35, 0x33, 0x33, 0x41, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x41,
+  0x35, 0x35, 0x35, 0x35, 0x3F, 0x3F, 0x35, 0x35,
+  0x35, 0x38, 0x38, 0x35, 0x35, 0x38, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x3B, 0x35, 0x38, 0x35, 0x35,
+  0x33, 0x35, 0x35, 0x2F, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x33, 0x35, 0x35,
+  // 3
+  0x35, 0x35, 0x35, 0x38, 0x35, 0x35, 0x33, 0x3A,
+  0x35, 0x35, 0x35, 0x38, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x41, 0x35, 0x35, 0x38, 0x35, 0x35, 0x3A,
+  0x35, 0x35, 0x35, 0x35, 0x38, 0x35, 0x38, 0x38,
+  0x35, 0x35, 0x35, 0x38, 0x35, 0x35, 0x35, 0x35,
+  0x41, 0x35, 0x35, 0x38, 0x35, 0x35, 0x38, 0x38,
+  0x38, 0x35, 0x35, 0x35, 0x35, 0x35, 0x41, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x38, 0x38, 0x38,
+  // 4
+  0x38, 0x38, 0x35, 0x38, 0x41, 0x41, 0x38, 0x3B,
+  0x35, 0x3F, 0x35, 0x35, 0x35, 0x38, 0x38, 0x38,
+  0x3B, 0x35, 0x38, 0x35, 0x38, 0x3B, 0x38, 0x35,
+  0x41, 0x38, 0x38, 0x35, 0x38, 0x38, 0x38, 0x3B,
+  0x35, 0x35, 0x38, 0x35, 0x35, 0x35, 0x3A, 0x38,
+  0x38, 0x38, 0x35, 0x35, 0x35, 0x41, 0x35, 0x38,
+  0x35, 0x35, 0x38, 0x30, 0x35, 0x38, 0x35, 0x35,
+  0x35, 0x33, 0x38, 0x35, 0x38, 0x35, 0x30, 0x35,
+  // 5
+  0x35, 0x38, 0x35, 0x38, 0x35, 0x35, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x30, 0x33, 0x35, 0x35, 0x38,
+  0x35, 0x41, 0x35, 0x35, 0x35, 0x38, 0x38, 0x35,
+  0x35, 0x35, 0x41, 0x35, 0x33, 0x38, 0x35, 0x3B,
+  0x38, 0x38, 0x35, 0x38, 0x35, 0x35, 0x38, 0x35,
+  0x3B, 0x38, 0x35, 0x38, 0x38, 0x38, 0x38, 0x35,
+  0x35, 0x38, 0x38, 0x35, 0x38, 0x35, 0x35, 0x38,
+  0x35, 0x38, 0x35, 0x33, 0x38, 0x35, 0x35, 0x38,
+  // 6
+  0x35, 0x41, 0x41, 0x35, 0x38, 0x38, 0x2F, 0x3F,
+  0x33, 0x35, 0x35, 0x35, 0x38, 0x38, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x3F, 0x35, 0x33, 0x33,
+  0x35, 0x35, 0x38, 0x41, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x33, 0x35, 0x38,
+  0x35, 0x35, 0x3F, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x38, 0x30, 0x35, 0x38, 0x35, 0x35, 0x38,
+  0x2F, 0x3B, 0x3A, 0x38, 0x38, 0x35, 0x38, 0x35,
+  // 7
+  0x38, 0x41, 0x41, 0x3A, 0x38, 0x35, 0x41, 0x38,
+  0x35, 0x35, 0x38, 0x38, 0x30, 0x38, 0x35, 0x35,
+  0x41, 0x35, 0x35, 0x38, 0x41, 0x35, 0x38, 0x41,
+  0x35, 0x35, 0x35, 0x3F, 0x38, 0x35, 0x35, 0x35,
+  0x30, 0x38, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35,
+  0x38, 0x35, 0x35, 0x35, 0x35, 0x38, 0x38, 0x41,
+  0x33, 0x38, 0x38, 0x35, 0x38, 0x38, 0x35, 0x35,
+  0x38, 0x35, 0x2F, 0x30, 0x35, 0x3F, 0x35, 0x35,
+  // 8
+  0x38, 0x38, 0x35, 0x35, 0x38, 0x2F, 0x2F, 0x38,
+  0x38, 0x38, 0x35, 0x35, 0x2F, 0x38, 0x38, 0x38,
+  0x38, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x35, 0x30, 0x38, 0x38, 0x38, 0x38, 0x3B, 0x38,
+  0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3A, 0x38,
+  0x35, 0x35, 0x38, 0x38, 0x38, 0x33, 0x38, 0x38,
+  0x35, 0x38, 0x35, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x35, 0x35, 0x38, 0x38, 0x38, 0x38, 0x38,
+  // 9
+  0x38, 0x38, 0x38, 0x38, 0x3B, 0x38, 0x41, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2F,
+  0x38, 0x38, 0x3B, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x3B, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x3B, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x43, 0x38, 0x36, 0x3E, 0x3C,
+  0x38, 0x38, 0x30, 0x38, 0x41, 0x2D, 0x09, 0x00,
+  // 10
+  0x38, 0x41, 0x3B, 0x38, 0x38, 0x38, 0x3B, 0x38,
+  0x2F, 0x38, 0x38, 0x30, 0x38, 0x38, 0x38, 0x38,
+  0x3B, 0x38, 0x38, 0x38, 0x38, 0x30, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x3B, 0x38, 0x3B, 0x38, 0x38, 0x30, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x37, 0x38, 0x38, 0x38, 0x38, 0x2F, 0x38, 0x38,
+  0x33, 0x38, 0x38, 0x38, 0x38, 0x3B, 0x38, 0x38,
+  // 11
+  0x38, 0x38, 0x30, 0x41, 0x30, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35, 0x2F,
+  0x38, 0x38, 0x30, 0x38, 0x38, 0x38, 0x3B, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3B, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35,
+  0x38, 0x38, 0x2F, 0x38, 0x38, 0x38, 0x38, 0x35,
+  // 12
+  0x38, 0x38, 0x38, 0x35, 0x35, 0x38, 0x35, 0x30,
+  0x3B, 0x38, 0x38, 0x38, 0x38, 0x2F, 0x38, 0x35,
+  0x2F, 0x3B, 0x38, 0x2F, 0x35, 0x30, 0x3A, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2F, 0x35,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x3B, 0x38, 0x38,
+  0x3B, 0x38, 0x38, 0x38, 0x38, 0x3B, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  // 13
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x30, 0x35, 0x38, 0x38, 0x38, 0x38, 0x30,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x30, 0x38, 0x3B,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x30,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  // 14
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x3A, 0x35, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x30, 0x35, 0x38, 0x38,
+  0x3B, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x35, 0x38, 0x38, 0x35, 0x35,
+  0x38, 0x38, 0x35, 0x38, 0x38, 0x35, 0x30, 0x38,
+  0x38, 0x38, 0x35, 0x38, 0x3B, 0x38, 0x41, 0x38,
+  0x38, 0x2F, 0x38, 0x35, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x35, 0x38, 0x35, 0x38, 0x38, 0x41,
+  // 15
+  0x38, 0x38, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x38, 0x38, 0x35, 0x38, 0x38, 0x38, 0x35, 0x38,
+  0x3A, 0x38, 0x35, 0x35, 0x35, 0x35, 0x43, 0x35,
+  0x38, 0x38, 0x35, 0x35, 0x38, 0x38, 0x41, 0x35,
+  0x38, 0x38, 0x38, 0x38, 0x30, 0x35, 0x3A, 0x35,
+  0x38, 0x3B, 0x38, 0x38, 0x35, 0x38, 0x35, 0x35,
+  0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x38, 0x38,
+  0x3F, 0x38, 0x30, 0x38, 0x35, 0x38, 0x38, 0x38,
+  // 16
+  0x35, 0x38, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x3B, 0x38, 0x33, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x33, 0x2F, 0x3F, 0x35, 0x35, 0x35,
+  0x35, 0x38, 0x35, 0x38, 0x35, 0x35, 0x35, 0x35,
+  0x38, 0x35, 0x35, 0x30, 0x35, 0x35, 0x35, 0x35,
+  0x38, 0x38, 0x38, 0x35, 0x2F, 0x38, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x33, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x38, 0x38, 0x33, 0x35, 0x35, 0x35, 0x35,
+  // 17
+  0x35, 0x35, 0x35, 0x38, 0x2E, 0x2F, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x3B, 0x35, 0x35, 0x33, 0x35,
+  0x35, 0x33, 0x33, 0x38, 0x2F, 0x35, 0x35, 0x38,
+  0x35, 0x2F, 0x33, 0x33, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x38, 0x35, 0x35, 0x38, 0x38, 0x35, 0x35,
+  0x35, 0x33, 0x38, 0x35, 0x33, 0x35, 0x35, 0x35,
+  0x35, 0x38, 0x35, 0x38, 0x35, 0x35, 0x35, 0x3F,
+  // 18
+  0x35, 0x35, 0x2F, 0x38, 0x35, 0x35, 0x2F, 0x35,
+  0x35, 0x2F, 0x35, 0x38, 0x35, 0x33, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x2F, 0x35, 0x35, 0x35,
+  0x35, 0x33, 0x35, 0x35, 0x2F, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x33,
+  0x35, 0x35, 0x35, 0x35, 0x33, 0x35, 0x35, 0x35,
+  // 19
+  0x35, 0x35, 0x38, 0x33, 0x2F, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x30, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x33, 0x35, 0x35, 0x35, 0x35, 0x38,
+  0x3F, 0x3F, 0x35, 0x38, 0x3F, 0x35, 0x35, 0x35,
+  0x2F, 0x33, 0x35, 0x35, 0x35, 0x41, 0x35, 0x35,
+  0x30, 0x35, 0x38, 0x38, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x38, 0x38, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  // 20
+  0x41, 0xA8, 0x94, 0x44, 0x3F, 0x41, 0x3B, 0x35,
+  0x3C, 0x8F, 0x94, 0xB7, 0x43, 0x3F, 0x41, 0x41,
+  0x3C, 0x93, 0x94, 0x44, 0x41, 0x41, 0x41, 0x35,
+  0x43, 0x8F, 0x9A, 0x50, 0x41, 0x41, 0x41, 0x41,
+  0x47, 0xB0, 0x94, 0xB3, 0x3E, 0x39, 0x39, 0x3F,
+  0x44, 0xA8, 0x97, 0xE9, 0x2D, 0x43, 0x2D, 0x2E,
+  0x40, 0xB7, 0x97, 0x94, 0x56, 0x21, 0x20, 0x21,
+  0x37, 0xA8, 0x9A, 0x93, 0x2C, 0x21, 0x21, 0x20,
+  // 21
+  0x35, 0x35, 0x41, 0x41, 0x35, 0x35, 0x35, 0x2F,
+  0x3F, 0x3F, 0x35, 0x41, 0x35, 0x35, 0x38, 0x35,
+  0x3F, 0x41, 0x35, 0x35, 0x38, 0x38, 0x35, 0x35,
+  0x38, 0x35, 0x3F, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x41, 0x3F, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x41, 0x3F, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x3E, 0x41, 0x35, 0x35, 0x35, 0x33, 0x41, 0x3F,
+  0x1C, 0x39, 0x41, 0x33, 0x35, 0x3F, 0x35, 0x41,
+  // 22
+  0x35, 0x35, 0x35, 0x2F, 0x35, 0x35, 0x35, 0x38,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x33, 0x35, 0x38,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x38, 0x30,
+  0x35, 0x41, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x33, 0x35, 0x35, 0x2F, 0x3F, 0x35, 0x35, 0x41,
+  0x35, 0x35, 0x35, 0x35, 0x33, 0x2F, 0x35, 0x35,
+  0x3F, 0x3F, 0x32, 0x19, 0x19, 0x2B, 0x35, 0x35,
+  0x2F, 0x2B, 0x19, 0x8F, 0x18, 0x23, 0x36, 0x33,
+  // 23
+  0x35, 0x35, 0x38, 0x35, 0x38, 0x38, 0x35, 0x35,
+  0x38, 0x35, 0x38, 0x38, 0x33, 0x41, 0x35, 0x33,
+  0x35, 0x33, 0x41, 0x35, 0x35, 0x35, 0x38, 0x35,
+  0x2F, 0x35, 0x2F, 0x38, 0x38, 0x35, 0x33, 0x38,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x3F, 0x33, 0x35, 0x3F, 0x33, 0x38, 0x38,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x38,
+  0x35, 0x35, 0x35, 0x38, 0x38, 0x35, 0x2F, 0x38,
+  // 24
+  0x2F, 0x35, 0x38, 0x30, 0x35, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x35, 0x38, 0x38, 0x38, 0x38,
+  0x35, 0x2F, 0x38, 0x38, 0x38, 0x35, 0x35, 0x2F,
+  0x35, 0x38, 0x38, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x38, 0x35, 0x35, 0x2F, 0x38, 0x38, 0x3B, 0x35,
+  0x38, 0x35, 0x35, 0x33, 0x38, 0x38, 0x38, 0x35,
+  0x35, 0x35, 0x35, 0x38, 0x35, 0x38, 0x38, 0x38,
+  0x35, 0x35, 0x38, 0x38, 0x35, 0x38, 0x38, 0x38,
+  // 25
+  0x2F, 0x35, 0x38, 0x2F, 0x38, 0x38, 0x38, 0x38,
+  0x3A, 0x38, 0x38, 0x38, 0x2F, 0x38, 0x38, 0x2F,
+  0x38, 0x35, 0x35, 0x38, 0x38, 0x35, 0x2F, 0x33,
+  0x38, 0x35, 0x35, 0x38, 0x35, 0x33, 0x35, 0x38,
+  0x35, 0x35, 0x38, 0x35, 0x35, 0x35, 0x30, 0x35,
+  0x35, 0x35, 0x35, 0x38, 0x35, 0x35, 0x38, 0x38,
+  0x35, 0x38, 0x38, 0x38, 0x30, 0x35, 0x38, 0x38,
+  0x33, 0x35, 0x35, 0x3A, 0x38, 0x35, 0x38, 0x38,
+  // 26
+  0x38, 0x38, 0x35, 0x35, 0x3F, 0x35, 0x2F, 0x38,
+  0x38, 0x38, 0x3A, 0x38, 0x38, 0x38, 0x38, 0x35,
+  0x2F, 0x35, 0x38, 0x38, 0x38, 0x35, 0x35, 0x38,
+  0x38, 0x38, 0x38, 0x35, 0x30, 0x35, 0x38, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x2F, 0x35, 0x38, 0x35, 0x35, 0x33, 0x35,
+  0x2F, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35,
+  0x38, 0x35, 0x35, 0x38, 0x38, 0x38, 0x3A, 0x38,
+  // 27
+  0x38, 0x35, 0x35, 0x35, 0x38, 0x35, 0x35, 0x38,
+  0x35, 0x38, 0x38, 0x38, 0x33, 0x38, 0x35, 0x38,
+  0x35, 0x35, 0x35, 0x30, 0x35, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x35, 0x38, 0x38, 0x38,
+  0x38, 0x35, 0x35, 0x38, 0x38, 0x38, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x38, 0x35, 0x35, 0x38, 0x38,
+  0x38, 0x35, 0x35, 0x3B, 0x30, 0x38, 0x38, 0x38,
+  0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  // 28
+  0x35, 0x2F, 0x2F, 0x38, 0x2F, 0x35, 0x35, 0x2F,
+  0x2F, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x30, 0x38, 0x38, 0x38, 0x2F, 0x38, 0x38,
+  0x38, 0x30, 0x38, 0x38, 0x30, 0x38, 0x38, 0x38,
+  0x38, 0x35, 0x35, 0x38, 0x30, 0x3B, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x3B, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35, 0x33,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x30, 0x34, 0x44,
+  // 29
+  0x3B, 0x38, 0x38, 0x41, 0x43, 0x0A, 0x02, 0x01,
+  0x38, 0x38, 0x30, 0x30, 0x3E, 0x04, 0x02, 0x02,
+  0x38, 0x38, 0x41, 0x34, 0x0A, 0x03, 0x02, 0x0D,
+  0x38, 0x38, 0x3C, 0x3D, 0x04, 0x08, 0x03, 0x0D,
+  0x3B, 0x38, 0x50, 0x02, 0x02, 0x07, 0x05, 0x0D,
+  0x41, 0x38, 0x06, 0x02, 0x09, 0x0C, 0x06, 0x04,
+  0x46, 0x01, 0x03, 0x07, 0x0D, 0x0F, 0x0C, 0x0C,
+  0x01, 0x06, 0x00, 0x0D, 0x0D, 0x0D, 0x0E, 0x0C,
+  // 30
+  0x00, 0x2F, 0x2F, 0x38, 0x38, 0x2F, 0x38, 0x38,
+  0x02, 0x0A, 0x38, 0x38, 0x38, 0x2F, 0x2F, 0x30,
+  0x0B, 0x08, 0x0A, 0x44, 0x37, 0x38, 0x38, 0x38,
+  0x0D, 0x08, 0x02, 0x08, 0x3D, 0x3A, 0x38, 0x30,
+  0x0C, 0x0D, 0x02, 0x01, 0x04, 0x3C, 0x37, 0x32,
+  0x0C, 0x0F, 0x01, 0x01, 0x01, 0x00, 0x0C, 0x46,
+  0x0D, 0x0D, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x0D, 0x0B, 0x01, 0x03,
+  // 31
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35, 0x3A,
+  0x38, 0x2F, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35,
+  0x38, 0x38, 0x3B, 0x38, 0x2F, 0x38, 0x38, 0x38,
+  0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35,
+  0x3A, 0x38, 0x38, 0x38, 0x30, 0x30, 0x3B, 0x38,
+  0x34, 0x38, 0x30, 0x38, 0x2F, 0x38, 0x38, 0x38,
+  0x3E, 0x38, 0x3B, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x06, 0x43, 0x3B, 0x38, 0x38, 0x38, 0x38, 0x38,
+  // 32
+  0x38, 0x38, 0x38, 0x35, 0x35, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2F, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x3B, 0x38, 0x38,
+  0x38, 0x38, 0x30, 0x35, 0x35, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2F,
+  0x38, 0x3B, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  // 33
+  0x38, 0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x2F, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x30, 0x38, 0x38, 0x38, 0x38, 0x41, 0x38, 0x38,
+  0x38, 0x38, 0x30, 0x38, 0x38, 0x41, 0x38, 0x30,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35,
+  0x41, 0x38, 0x38, 0x35, 0x35, 0x38, 0x38, 0x35,
+  0x38, 0x30, 0x38, 0x35, 0x35, 0x38, 0x38, 0x38,
+  // 34
+  0x38, 0x38, 0x35, 0x33, 0x2F, 0x38, 0x38, 0x30,
+  0x38, 0x38, 0x33, 0x38, 0x2F, 0x30, 0x30, 0x38,
+  0x38, 0x38, 0x38, 0x35, 0x38, 0x38, 0x2F, 0x35,
+  0x38, 0x38, 0x38, 0x35, 0x35, 0x38, 0x30, 0x35,
+  0x2F, 0x35, 0x3B, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x30, 0x38, 0x35, 0x35, 0x38, 0x35, 0x35, 0x38,
+  0x38, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x38, 0x35, 0x38, 0x33, 0x35, 0x38, 0x38, 0x35,
+  // 35
+  0x2F, 0x35, 0x30, 0x38, 0x38, 0x38, 0x38, 0x33,
+  0x38, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x38,
+  0x35, 0x35, 0x38, 0x2F, 0x38, 0x38, 0x35, 0x38,
+  0x35, 0x2F, 0x38, 0x38, 0x35, 0x33, 0x35, 0x38,
+  0x35, 0x35, 0x35, 0x38, 0x33, 0x38, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x38, 0x35, 0x2F, 0x35, 0x35,
+  0x35, 0x38, 0x41, 0x35, 0x35, 0x35, 0x38, 0x3E,
+  0x35, 0x41, 0x35, 0x35, 0x35, 0x33, 0x36, 0x1C,
+  // 36
+  0x38, 0x35, 0x38, 0x35, 0x35, 0x38, 0x35, 0x35,
+  0x35, 0x38, 0x33, 0x35, 0x38, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x38, 0x35, 0x35, 0x3B, 0x3B, 0x35,
+  0x35, 0x38, 0x33, 0x35, 0x35, 0x38, 0x38, 0x41,
+  0x31, 0x34, 0x31, 0x40, 0x2F, 0x31, 0x38, 0x41,
+  0x32, 0x23, 0x1E, 0x22, 0x22, 0x22, 0x2D, 0x34,
+  0x20, 0x25, 0x20, 0x20, 0x20, 0x22, 0x1F, 0x36,
+  0x23, 0x25, 0x20, 0x20, 0x20, 0x22, 0x1E, 0x1C,
+  // 37
+  0x35, 0x38, 0x38, 0x30, 0x35, 0x35, 0x38, 0x35,
+  0x3F, 0x35, 0x41, 0x35, 0x38, 0x35, 0x35, 0x41,
+  0x35, 0x3F, 0x32, 0x2B, 0x31, 0x38, 0x41, 0x41,
+  0x2F, 0x32, 0x2A, 0x21, 0x2D, 0x35, 0x33, 0x2E,
+  0x32, 0x20, 0x20, 0x20, 0x24, 0x3A, 0x30, 0x30,
+  0x32, 0x20, 0x24, 0x2B, 0x25, 0x1F, 0x23, 0x23,
+  0x32, 0x20, 0x1E, 0x20, 0x22, 0x25, 0x2C, 0x24,
+  0x23, 0x20, 0x20, 0x20, 0x22, 0x22, 0x22, 0x20,
+  // 38
+  0x35, 0x33, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x3B, 0x35, 0x3F, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x38, 0x2D, 0x23, 0x2B, 0x36, 0x35, 0x35, 0x35,
+  0x1D, 0x21, 0x22, 0x28, 0x25, 0x3F, 0x35, 0x35,
+  0x1C, 0x1C, 0x20, 0x20, 0x22, 0x23, 0x30, 0x33,
+  0x24, 0x1E, 0x20, 0x24, 0x20, 0x2D, 0x2F, 0x33,
+  0x24, 0x24, 0x24, 0x20, 0x1C, 0x37, 0x21, 0x21,
+  0x24, 0x20, 0x20, 0x20, 0x20, 0x23, 0x1D, 0x24,
+  // 39
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3F,
+  0x41, 0x35, 0x38, 0x35, 0x2D, 0x2B, 0x24, 0x25,
+  0x35, 0x35, 0x35, 0x32, 0x25, 0x20, 0x21, 0x21,
+  0x35, 0x35, 0x1E, 0x28, 0x22, 0x20, 0x20, 0x20,
+  0x38, 0x32, 0x25, 0x25, 0x20, 0x24, 0x20, 0x20,
+  0x33, 0x32, 0x25, 0x20, 0x20, 0x24, 0x20, 0x20,
+  0x24, 0x23, 0x22, 0x20, 0x20, 0x24, 0x20, 0x24,
+  // 40
+  0xBD, 0xB0, 0x99, 0x9B, 0x50, 0x2C, 0x19, 0x20,
+  0xE9, 0x9A, 0x97, 0x97, 0x27, 0x1C, 0x1C, 0x19,
+  0xB0, 0x94, 0x94, 0x99, 0x94, 0x56, 0x19, 0x20,
+  0xBA, 0x9B, 0xB7, 0x92, 0x9A, 0x28, 0x23, 0x20,
+  0xBB, 0x9A, 0xB5, 0x9C, 0x8F, 0x93, 0x10, 0x20,
+  0xE8, 0xB0, 0x92, 0x92, 0x8D, 0x1C, 0x1C, 0x20,
+  0xB4, 0xB4, 0x99, 0x97, 0x94, 0x18, 0x1C, 0x20,
+  0x9B, 0xB3, 0xB4, 0x9B, 0x99, 0x9B, 0x1C, 0x24,
+  // 41
+  0x19, 0x2A, 0x32, 0x38, 0x36, 0x35, 0x32, 0x2B,
+  0x1C, 0x1E, 0x25, 0x2D, 0x2E, 0x24, 0x1F, 0x19,
+  0x19, 0x1C, 0x24, 0x1F, 0x21, 0x1F, 0x19, 0x19,
+  0x19, 0x1C, 0x1B, 0x27, 0x1C, 0x57, 0x57, 0x19,
+  0x20, 0x19, 0x1E, 0x1E, 0x57, 0x58, 0x59, 0x57,
+  0x20, 0x21, 0x1F, 0x1F, 0x7E, 0x7E, 0x7C, 0x57,
+  0x24, 0x3D, 0x23, 0x16, 0x5A, 0x81, 0x59, 0x7E,
+  0x2E, 0x5C, 0x0F, 0x1F, 0x81, 0x81, 0x7E, 0x57,
+  // 42
+  0x20, 0x19, 0x19, 0x8F, 0x16, 0x19, 0x23, 0x35,
+  0x19, 0x19, 0x19, 0x8F, 0x18, 0x1C, 0x24, 0x33,
+  0x19, 0x19, 0x16, 0x9A, 0x97, 0x1E, 0x24, 0x38,
+  0x1E, 0x19, 0x19, 0x94, 0x98, 0x21, 0x2C, 0x33,
+  0x5A, 0x16, 0x16, 0x8F, 0x97, 0x28, 0x19, 0x2B,
+  0x57, 0x15, 0x12, 0x8F, 0x97, 0x1B, 0x19, 0x19,
+  0x58, 0x0F, 0xA8, 0x9A, 0x94, 0x16, 0x19, 0x19,
+  0x59, 0x57, 0x9C, 0xB0, 0x9A, 0x27, 0x19, 0x25,
+  // 43
+  0x35, 0x2F, 0x35, 0x35, 0x38, 0x3F, 0x2F, 0x35,
+  0x2F, 0x35, 0x35, 0x35, 0x38, 0x2F, 0x2F, 0x33,
+  0x33, 0x35, 0x3F, 0x35, 0x35, 0x33, 0x2F, 0x35,
+  0x39, 0x3B, 0x33, 0x35, 0x35, 0x35, 0x38, 0x38,
+  0x2F, 0x3A, 0x34, 0x35, 0x35, 0x3F, 0x41, 0x3B,
+  0x25, 0x23, 0x40, 0x39, 0x35, 0x34, 0x22, 0x2B,
+  0x20, 0x25, 0x25, 0x2B, 0x2E, 0x2B, 0x22, 0x25,
+  0x22, 0x24, 0x20, 0x20, 0x25, 0x25, 0x24, 0x22,
+  // 44
+  0x35, 0x35, 0x35, 0x38, 0x35, 0x33, 0x35, 0x38,
+  0x35, 0x35, 0x2F, 0x38, 0x3F, 0x35, 0x35, 0x38,
+  0x35, 0x33, 0x33, 0x33, 0x30, 0x35, 0x38, 0x2F,
+  0x43, 0x2E, 0x41, 0x35, 0x37, 0x35, 0x35, 0x2F,
+  0x35, 0x28, 0x25, 0x3C, 0x38, 0x35, 0x33, 0x35,
+  0x25, 0x1F, 0x22, 0x1F, 0x25, 0x38, 0x37, 0x35,
+  0x25, 0x23, 0x25, 0x22, 0x25, 0x2D, 0x35, 0x38,
+  0x25, 0x3E, 0x22, 0x22, 0x22, 0x23, 0x32, 0x41,
+  // 45
+  0x35, 0x41, 0x35, 0x35, 0x38, 0x35, 0x38, 0x30,
+  0x35, 0x35, 0x38, 0x38, 0x30, 0x35, 0x38, 0x38,
+  0x38, 0x35, 0x38, 0x35, 0x33, 0x35, 0x38, 0x38,
+  0x35, 0x41, 0x38, 0x30, 0x38, 0x38, 0x30, 0x38,
+  0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35,
+  0x33, 0x38, 0x33, 0x38, 0x38, 0x38, 0x35, 0x3B,
+  0x2F, 0x2F, 0x35, 0x2F, 0x38, 0x35, 0x35, 0x35,
+  0x34, 0x33, 0x35, 0x2F, 0x38, 0x2E, 0x42, 0x50,
+  // 46
+  0x2F, 0x38, 0x30, 0x2F, 0x38, 0x38, 0x2F, 0x30,
+  0x35, 0x38, 0x30, 0x38, 0x38, 0x3B, 0x30, 0x38,
+  0x30, 0x38, 0x30, 0x30, 0x38, 0x38, 0x38, 0x3B,
+  0x38, 0x38, 0x35, 0x38, 0x38, 0x41, 0x38, 0x30,
+  0x35, 0x38, 0x3B, 0x38, 0x38, 0x38, 0x38, 0x3B,
+  0x38, 0x2F, 0x30, 0x38, 0x38, 0x38, 0x38, 0x30,
+  0x35, 0x38, 0x2F, 0x38, 0x30, 0x38, 0x38, 0x38,
+  0x50, 0x3E, 0x2E, 0x33, 0x34, 0x35, 0x38, 0x30,
+  // 47
+  0x38, 0x35, 0x35, 0x38, 0x30, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x3B, 0x38, 0x38, 0x38, 0x3B,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x41,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3B, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x3B, 0x38, 0x34, 0x3E,
+  0x38, 0x38, 0x38, 0x38, 0x3B, 0x38, 0x40, 0x11,
+  0x38, 0x41, 0x41, 0x38, 0x37, 0x3C, 0x3E, 0x07,
+  // 48
+  0x38, 0x35, 0x35, 0x0C, 0x44, 0x33, 0x37, 0x09,
+  0x3B, 0x37, 0x3E, 0x01, 0x01, 0x14, 0x09, 0x03,
+  0x3E, 0x14, 0x04, 0x02, 0x02, 0x02, 0x01, 0x01,
+  0x37, 0x01, 0x06, 0x0D, 0x02, 0x01, 0x04, 0x01,
+  0x26, 0x04, 0x09, 0x0D, 0x05, 0x03, 0x02, 0x01,
+  0x04, 0x08, 0x0E, 0x0C, 0x06, 0x0D, 0x02, 0x02,
+  0x04, 0x0D, 0x0C, 0x0C, 0x0E, 0x03, 0x03, 0x01,
+  0x07, 0x0E, 0x0E, 0x0F, 0x07, 0x05, 0x01, 0x07,
+  // 49
+  0x01, 0x0B, 0x0E, 0x07, 0x0E, 0x0E, 0x0E, 0x14,
+  0x01, 0x01, 0x07, 0x0E, 0x0E, 0x13, 0x11, 0x09,
+  0x01, 0x02, 0x01, 0x0B, 0x14, 0x11, 0x0E, 0x14,
+  0x01, 0x02, 0x00, 0x13, 0x0B, 0x11, 0x14, 0x0C,
+  0x01, 0x0B, 0x14, 0x08, 0x0E, 0x1A, 0x1A, 0x17,
+  0x0D, 0x14, 0x0B, 0x0E, 0x1A, 0x1A, 0x1A, 0x1A,
+  0x00, 0x0D, 0x0E, 0x0E, 0x1A, 0x1A, 0x1A, 0x1A,
+  0x0F, 0x0E, 0x11, 0x1A, 0x15, 0x1A, 0x14, 0x11,
+  // 50
+  0x0B, 0x03, 0x02, 0x01, 0x07, 0x0A, 0x01, 0x02,
+  0x15, 0x06, 0x01, 0x01, 0x02, 0x06, 0x0D, 0x01,
+  0x1A, 0x0F, 0x02, 0x01, 0x0B, 0x0C, 0x0D, 0x0C,
+  0x1A, 0x11, 0x04, 0x04, 0x01, 0x06, 0x0C, 0x0E,
+  0x0E, 0x13, 0x0C, 0x0F, 0x07, 0x01, 0x0D, 0x0E,
+  0x14, 0x26, 0x0C, 0x0D, 0x0B, 0x01, 0x01, 0x0F,
+  0x0E, 0x0E, 0x0E, 0x0B, 0x07, 0x08, 0x05, 0x01,
+  0x11, 0x0E, 0x0E, 0x0B, 0x01, 0x07, 0x05, 0x01,
+  // 51
+  0x02, 0x0A, 0x3C, 0x36, 0x38, 0x38, 0x38, 0x38,
+  0x02, 0x03, 0x06, 0x3E, 0x3A, 0x38, 0x34, 0x35,
+  0x01, 0x02, 0x04, 0x02, 0x0A, 0x16, 0x43, 0x37,
+  0x0E, 0x04, 0x08, 0x09, 0x02, 0x02, 0x0B, 0x33,
+  0x0D, 0x04, 0x05, 0x0C, 0x04, 0x01, 0x07, 0x11,
+  0x0C, 0x0C, 0x09, 0x0D, 0x0D, 0x08, 0x03, 0x01,
+  0x0D, 0x0B, 0x0E, 0x0E, 0x0F, 0x07, 0x0C, 0x03,
+  0x08, 0x0D, 0x14, 0x0E, 0x0F, 0x04, 0x04, 0x02,
+  // 52
+  0x38, 0x38, 0x2F, 0x38, 0x38, 0x38, 0x3B, 0x38,
+  0x38, 0x30, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x30, 0x3B, 0x38, 0x38, 0x38, 0x3B, 0x38,
+  0x3F, 0x38, 0x38, 0x38, 0x3B, 0x38, 0x2F, 0x38,
+  0x37, 0x3B, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x3D, 0x2E, 0x37, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x02, 0x0E, 0x3E, 0x38, 0x38, 0x3B, 0x30, 0x38,
+  0x09, 0x00, 0x14, 0x3E, 0x34, 0x38, 0x38, 0x38,
+  // 53
+  0x38, 0x35, 0x38, 0x38, 0x35, 0x35, 0x38, 0x38,
+  0x38, 0x35, 0x35, 0x3A, 0x38, 0x38, 0x35, 0x38,
+  0x2F, 0x38, 0x30, 0x38, 0x38, 0x38, 0x38, 0x30,
+  0x38, 0x38, 0x38, 0x35, 0x2F, 0x38, 0x35, 0x38,
+  0x38, 0x38, 0x30, 0x30, 0x38, 0x38, 0x3B, 0x38,
+  0x38, 0x35, 0x2F, 0x35, 0x35, 0x35, 0x3B, 0x2E,
+  0x35, 0x3A, 0x38, 0x35, 0x33, 0x35, 0x3B, 0x23,
+  0x35, 0x38, 0x3F, 0x35, 0x38, 0x41, 0x38, 0x20,
+  // 54
+  0x35, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35, 0x2F,
+  0x38, 0x35, 0x35, 0x3B, 0x41, 0x3F, 0x33, 0x37,
+  0x30, 0x38, 0x38, 0x35, 0x35, 0x3A, 0x3B, 0x3F,
+  0x35, 0x35, 0x2F, 0x2F, 0x35, 0x37, 0x3E, 0x25,
+  0x3A, 0x3A, 0x31, 0x30, 0x2D, 0x25, 0x25, 0x25,
+  0x2B, 0x23, 0x32, 0x43, 0x23, 0x25, 0x25, 0x25,
+  0x22, 0x22, 0x21, 0x20, 0x25, 0x22, 0x25, 0x25,
+  0x19, 0x19, 0x1C, 0x1C, 0x1D, 0x1E, 0x23, 0x23,
+  // 55
+  0x35, 0x35, 0x38, 0x2F, 0x30, 0x38, 0x2B, 0x22,
+  0x3A, 0x35, 0x38, 0x35, 0x35, 0x32, 0x24, 0x20,
+  0x3A, 0x35, 0x35, 0x3B, 0x34, 0x32, 0x22, 0x1F,
+  0x3F, 0x38, 0x35, 0x3B, 0x25, 0x22, 0x20, 0x23,
+  0x2B, 0x2D, 0x37, 0x23, 0x2D, 0x1F, 0x20, 0x28,
+  0x2D, 0x1E, 0x25, 0x20, 0x1E, 0x1C, 0x28, 0x18,
+  0x2F, 0x2E, 0x22, 0x25, 0x20, 0x19, 0x15, 0x0D,
+  0x25, 0x23, 0x21, 0x1C, 0x1E, 0x14, 0x08, 0x08,
+  // 56
+  0x22, 0x24, 0x1F, 0x20, 0x2B, 0x21, 0x20, 0x24,
+  0x20, 0x23, 0x30, 0x24, 0x28, 0x22, 0x23, 0x22,
+  0x2B, 0x2A, 0x2D, 0x21, 0x22, 0x20, 0x40, 0x24,
+  0x25, 0x1C, 0x1C, 0x25, 0x1C, 0x2A, 0x23, 0x1F,
+  0x1C, 0x12, 0x0A, 0x1A, 0x08, 0x0B, 0x15, 0x28,
+  0x13, 0x09, 0x03, 0x01, 0x05, 0x01, 0x06, 0x23,
+  0x04, 0x01, 0x04, 0x07, 0x03, 0x01, 0x02, 0x11,
+  0x09, 0x08, 0x01, 0x03, 0x04, 0x05, 0x02, 0x03,
+  // 57
+  0x20, 0x1E, 0x22, 0x20, 0x20, 0x22, 0x24, 0x20,
+  0x20, 0x24, 0x22, 0x22, 0x20, 0x20, 0x20, 0x2A,
+  0x20, 0x20, 0x22, 0x20, 0x20, 0x20, 0x20, 0x24,
+  0x20, 0x29, 0x25, 0x24, 0x22, 0x20, 0x22, 0x20,
+  0x20, 0x2A, 0x1E, 0x23, 0x1F, 0x1C, 0x20, 0x22,
+  0x1F, 0x20, 0x22, 0x20, 0x20, 0x22, 0x25, 0x24,
+  0x24, 0x22, 0x20, 0x20, 0x20, 0x20, 0x25, 0x1E,
+  0x26, 0x23, 0x21, 0x20, 0x24, 0x20, 0x5B, 0x21,
+  // 58
+  0x22, 0x22, 0x20, 0x25, 0x24, 0x22, 0x22, 0x22,
+  0x24, 0x20, 0x20, 0x22, 0x22, 0x24, 0x20, 0x22,
+  0x20, 0x22, 0x20, 0x24, 0x24, 0x22, 0x20, 0x22,
+  0x20, 0x1C, 0x25, 0x25, 0x22, 0x25, 0x25, 0x33,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x36, 0x38, 0x2F,
+  0x20, 0x20, 0x1C, 0x24, 0x20, 0x20, 0x32, 0x25,
+  0x24, 0x20, 0x20, 0x24, 0x20, 0x24, 0x22, 0x15,
+  0x24, 0x20, 0x24, 0x1B, 0x1B, 0x20, 0x20, 0x19,
+  // 59
+  0x22, 0x20, 0x22, 0x25, 0x22, 0x5D, 0x24, 0x20,
+  0x22, 0x24, 0x23, 0x1F, 0x1C, 0x8A, 0x1F, 0x21,
+  0x2B, 0x2E, 0x32, 0x1F, 0x1C, 0x89, 0x15, 0x12,
+  0x3C, 0x19, 0x1C, 0x1B, 0x17, 0x8A, 0x5D, 0x16,
+  0x1E, 0x15, 0x12, 0x16, 0x8A, 0x85, 0x5D, 0x15,
+  0x12, 0x12, 0x12, 0x16, 0x10, 0x85, 0x80, 0x0E,
+  0x16, 0x19, 0x18, 0x1A, 0x5B, 0x7E, 0x5C, 0x5B,
+  0x24, 0x15, 0x12, 0x86, 0x81, 0x80, 0x5C, 0x15,
+  // 60
+  0x9B, 0x9B, 0x9C, 0x92, 0x92, 0x99, 0x32, 0x2D,
+  0xB4, 0xB3, 0x99, 0x9A, 0x99, 0x99, 0x3D, 0x2E,
+  0xB5, 0xB3, 0xB3, 0x9B, 0x9A, 0x2D, 0x2D, 0x33,
+  0xB5, 0x99, 0xB5, 0x9A, 0x92, 0x92, 0x2D, 0x30,
+  0xB3, 0x9A, 0xB3, 0x9B, 0x97, 0x94, 0x15, 0x32,
+  0xB3, 0xB3, 0x9A, 0xB4, 0x9C, 0x92, 0x15, 0x2D,
+  0xB5, 0x99, 0x9A, 0x99, 0x92, 0x94, 0x2D, 0x2C,
+  0xB3, 0xB3, 0x9B, 0x99, 0x9B, 0x97, 0x50, 0x5B,
+  // 61
+  0x2D, 0x59, 0x59, 0x7E, 0x80, 0x57, 0x57, 0x58,
+  0x2D, 0x81, 0x58, 0x58, 0x59, 0x86, 0x7E, 0x58,
+  0x2E, 0x5C, 0x59, 0x57, 0x58, 0x85, 0x7E, 0x58,
+  0x32, 0x7E, 0x59, 0x7E, 0x7E, 0x86, 0x7F, 0x59,
+  0x81, 0x80, 0x7E, 0x85, 0x81, 0x86, 0x7E, 0x59,
+  0x7F, 0x7F, 0x81, 0x86, 0x57, 0x81, 0x7E, 0x59,
+  0x3E, 0x7E, 0x89, 0x86, 0x7E, 0x7F, 0x85, 0x58,
+  0x85, 0x86, 0x7E, 0x7F, 0x82, 0x85, 0x7F, 0x85,
+  // 62
+  0x57, 0x57, 0x59, 0xB0, 0x97, 0x18, 0x19, 0x20,
+  0x58, 0x57, 0x96, 0x9A, 0x94, 0x94, 0xB0, 0x20,
+  0x59, 0x92, 0xAF, 0xB3, 0x97, 0x9A, 0xAF, 0x1F,
+  0x59, 0x57, 0x57, 0xBB, 0xB7, 0x1B, 0x19, 0x20,
+  0x58, 0x57, 0x57, 0x88, 0x9B, 0x9B, 0x26, 0x20,
+  0x59, 0x58, 0x57, 0x59, 0x9A, 0x97, 0x99, 0x21,
+  0x7C, 0x59, 0x58, 0xB3, 0x9A, 0x94, 0x15, 0x20,
+  0x7E, 0x95, 0x99, 0x98, 0xB0, 0x94, 0x18, 0x21,
+  // 63
+  0x24, 0x20, 0x20, 0x22, 0x22, 0x22, 0x22, 0x25,
+  0x24, 0x20, 0x25, 0x22, 0x20, 0x22, 0x24, 0x22,
+  0x20, 0x20, 0x22, 0x22, 0x20, 0x20, 0x25, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x19,
+  0x21, 0x24, 0x20, 0x1F, 0x19, 0x20, 0x19, 0x19,
+  0x21, 0x21, 0x19, 0x1B, 0x12, 0x12, 0x12, 0x16,
+  0x1C, 0x16, 0x15, 0x12, 0x12, 0x12, 0x12, 0x12,
+  // 64
+  0x22, 0x1F, 0x22, 0x25, 0x25, 0x20, 0x24, 0x31,
+  0x20, 0x25, 0x25, 0x22, 0x22, 0x21, 0x23, 0x2B,
+  0x22, 0x24, 0x25, 0x22, 0x25, 0x40, 0x1D, 0x2C,
+  0x24, 0x20, 0x22, 0x20, 0x20, 0x20, 0x22, 0x2B,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x21,
+  0x21, 0x19, 0x1C, 0x15, 0x15, 0x1C, 0x19, 0x1C,
+  0x19, 0x21, 0xB0, 0x12, 0x12, 0x12, 0x19, 0x15,
+  0x12, 0x16, 0xA8, 0x12, 0x12, 0x15, 0x15, 0x12,
+  // 65
+  0x33, 0x35, 0x33, 0x35, 0x33, 0x33, 0x01, 0x04,
+  0x41, 0x35, 0x2F, 0x33, 0x42, 0x26, 0x08, 0x08,
+  0x2B, 0x38, 0x31, 0x40, 0x12, 0x10, 0x13, 0x08,
+  0x2E, 0x35, 0x33, 0x12, 0x12, 0x17, 0x17, 0x03,
+  0x1D, 0x2B, 0x12, 0x12, 0x18, 0x18, 0x26, 0x0F,
+  0x27, 0x3D, 0x12, 0x1B, 0x1B, 0x18, 0x28, 0x11,
+  0x12, 0x12, 0x17, 0x1B, 0x1B, 0x1B, 0x18, 0x1A,
+  0x12, 0x12, 0x17, 0x1B, 0x1B, 0x1B, 0x26, 0x14,
+  // 66
+  0x01, 0x02, 0x00, 0x07, 0x2E, 0x2D, 0x41, 0x38,
+  0x03, 0x05, 0x04, 0x00, 0x03, 0x3D, 0x3D, 0x3D,
+  0x08, 0x0D, 0x0F, 0x0E, 0x0B, 0x07, 0x01, 0x07,
+  0x08, 0x09, 0x0E, 0x0C, 0x0C, 0x03, 0x07, 0x04,
+  0x05, 0x08, 0x0B, 0x0F, 0x0E, 0x04, 0x0F, 0x02,
+  0x0F, 0x06, 0x01, 0x08, 0x0F, 0x00, 0x0D, 0x0C,
+  0x08, 0x09, 0x0D, 0x08, 0x08, 0x0B, 0x0E, 0x0E,
+  0x08, 0x05, 0x0D, 0x0B, 0x08, 0x08, 0x08, 0x0E,
+  // 67
+  0x38, 0x41, 0x41, 0x37, 0x32, 0x2C, 0x06, 0x08,
+  0x3F, 0x41, 0x34, 0x3C, 0x08, 0x02, 0x01, 0x03,
+  0x07, 0x42, 0x36, 0x09, 0x01, 0x06, 0x00, 0x04,
+  0x03, 0x05, 0x05, 0x01, 0x0D, 0x0E, 0x09, 0x01,
+  0x08, 0x0F, 0x0F, 0x0E, 0x14, 0x14, 0x09, 0x01,
+  0x08, 0x0E, 0x0E, 0x0E, 0x1A, 0x06, 0x0C, 0x04,
+  0x0F, 0x0E, 0x0E, 0x1B, 0x1A, 0x26, 0x1B, 0x0B,
+  0x0E, 0x0E, 0x1A, 0x14, 0x0D, 0x17, 0x06, 0x0B,
+  // 68
+  0x08, 0x0E, 0x0F, 0x0D, 0x0D, 0x05, 0x08, 0x0D,
+  0x06, 0x19, 0x04, 0x07, 0x08, 0x03, 0x09, 0x0E,
+  0x0B, 0x0B, 0x05, 0x05, 0x08, 0x07, 0x09, 0x06,
+  0x03, 0x03, 0x07, 0x0B, 0x0D, 0x09, 0x05, 0x04,
+  0x03, 0x08, 0x07, 0x14, 0x06, 0x08, 0x0D, 0x15,
+  0x08, 0x06, 0x14, 0x14, 0x08, 0x14, 0x0F, 0x08,
+  0x0D, 0x0A, 0x28, 0x08, 0x04, 0x1A, 0x1A, 0x0D,
+  0x08, 0x0A, 0x29, 0x0E, 0x0C, 0x1B, 0x13, 0x0B,
+  // 69
+  0x0E, 0x11, 0x14, 0x15, 0x09, 0x1A, 0x14, 0x0E,
+  0x0E, 0x0F, 0x0B, 0x0E, 0x0C, 0x1A, 0x14, 0x11,
+  0x08, 0x08, 0x07, 0x11, 0x0C, 0x26, 0x0E, 0x13,
+  0x03, 0x09, 0x0C, 0x1A, 0x1A, 0x0E, 0x0E, 0x0C,
+  0x01, 0x14, 0x1A, 0x1A, 0x0E, 0x11, 0x14, 0x11,
+  0x00, 0x1A, 0x1A, 0x14, 0x0E, 0x11, 0x27, 0x27,
+  0x17, 0x1A, 0x0E, 0x11, 0x27, 0x1B, 0x24, 0x42,
+  0x1B, 0x13, 0x0E, 0x13, 0x42, 0x32, 0x2A, 0x42,
+  // 70
+  0x0E, 0x14, 0x1A, 0x01, 0x01, 0x01, 0x01, 0x02,
+  0x0E, 0x17, 0x15, 0x08, 0x07, 0x06, 0x04, 0x04,
+  0x26, 0x1A, 0x0D, 0x0D, 0x09, 0x06, 0x00, 0x00,
+  0x1A, 0x1A, 0x01, 0x0D, 0x0C, 0x0C, 0x0C, 0x0D,
+  0x1A, 0x26, 0x07, 0x05, 0x0C, 0x0E, 0x09, 0x0C,
+  0x1B, 0x05, 0x0D, 0x01, 0x08, 0x06, 0x06, 0x0E,
+  0x1B, 0x03, 0x07, 0x0B, 0x04, 0x0C, 0x0C, 0x0C,
+  0x0E, 0x09, 0x08, 0x03, 0x04, 0x0E, 0x0E, 0x0E,
+  // 71
+  0x01, 0x01, 0x10, 0x1A, 0x26, 0x01, 0x07, 0x09,
+  0x01, 0x09, 0x18, 0x13, 0x14, 0x09, 0x0E, 0x0E,
+  0x06, 0x02, 0x0B, 0x1B, 0x11, 0x14, 0x0B, 0x0D,
+  0x0C, 0x01, 0x02, 0x14, 0x1A, 0x1A, 0x09, 0x13,
+  0x0E, 0x01, 0x00, 0x14, 0x1B, 0x26, 0x0B, 0x06,
+  0x07, 0x08, 0x02, 0x14, 0x1B, 0x27, 0x27, 0x08,
+  0x04, 0x02, 0x04, 0x08, 0x0A, 0x27, 0x27, 0x26,
+  0x0B, 0x04, 0x02, 0x02, 0x07, 0x26, 0x27, 0x28,
+  // 72
+  0x13, 0x1A, 0x04, 0x05, 0x34, 0x39, 0x38, 0x38,
+  0x14, 0x1A, 0x0C, 0x01, 0x05, 0x3D, 0x41, 0x38,
+  0x09, 0x14, 0x1D, 0x09, 0x01, 0x07, 0x3E, 0x3F,
+  0x1A, 0x09, 0x14, 0x26, 0x14, 0x01, 0x04, 0x2C,
+  0x1A, 0x26, 0x00, 0x0A, 0x1A, 0x07, 0x00, 0x0A,
+  0x1A, 0x26, 0x1B, 0x00, 0x26, 0x00, 0x01, 0x05,
+  0x18, 0x0A, 0x1B, 0x1A, 0x26, 0x1A, 0x02, 0x01,
+  0x1D, 0x1B, 0x27, 0x27, 0x1B, 0x0C, 0x0B, 0x06,
+  // 73
+  0x3F, 0x38, 0x35, 0x33, 0x41, 0x43, 0x19, 0x24,
+  0x41, 0x3C, 0x2F, 0x32, 0x32, 0x1C, 0x1C, 0x23,
+  0x41, 0x43, 0x15, 0x10, 0x19, 0x18, 0x1B, 0x15,
+  0x40, 0x43, 0x3E, 0x19, 0x15, 0x15, 0x1B, 0x1B,
+  0x50, 0x44, 0x2C, 0x10, 0x0E, 0x09, 0x09, 0x12,
+  0x5B, 0x43, 0x3E, 0x10, 0x27, 0x00, 0x00, 0x02,
+  0x08, 0x0A, 0x38, 0x42, 0x29, 0x13, 0x0C, 0x06,
+  0x0B, 0x09, 0x43, 0x44, 0x32, 0x17, 0x12, 0x1C,
+  // 74
+  0x1D, 0x12, 0x12, 0x1A, 0x1B, 0x1F, 0x18, 0x22,
+  0x25, 0x15, 0x17, 0x10, 0x0F, 0x1A, 0x00, 0x26,
+  0x12, 0x16, 0x1B, 0x10, 0x07, 0x07, 0x03, 0x07,
+  0x17, 0x10, 0x10, 0x0C, 0x0D, 0x05, 0x03, 0x05,
+  0x10, 0x10, 0x09, 0x03, 0x02, 0x01, 0x03, 0x03,
+  0x11, 0x14, 0x08, 0x05, 0x04, 0x04, 0x04, 0x04,
+  0x07, 0x06, 0x05, 0x01, 0x09, 0x0B, 0x0D, 0x05,
+  0x1D, 0x05, 0x03, 0x0B, 0x0D, 0x0C, 0x07, 0x03,
+  // 75
+  0x24, 0x24, 0x1F, 0x17, 0x06, 0x04, 0x08, 0x09,
+  0x1F, 0x22, 0x28, 0x0B, 0x09, 0x05, 0x08, 0x0D,
+  0x02, 0x0E, 0x0B, 0x06, 0x07, 0x02, 0x00, 0x0D,
+  0x0D, 0x05, 0x02, 0x05, 0x07, 0x06, 0x0C, 0x0E,
+  0x05, 0x01, 0x03, 0x05, 0x04, 0x0D, 0x0C, 0x0F,
+  0x06, 0x05, 0x01, 0x05, 0x0B, 0x0F, 0x0E, 0x04,
+  0x07, 0x05, 0x05, 0x0D, 0x08, 0x07, 0x00, 0x0F,
+  0x03, 0x05, 0x01, 0x03, 0x04, 0x04, 0x0A, 0x0D,
+  // 76
+  0x0D, 0x02, 0x01, 0x0B, 0x05, 0xBE, 0x01, 0x02,
+  0x0D, 0x00, 0x0E, 0x06, 0x03, 0xBE, 0x03, 0x02,
+  0x0C, 0x07, 0x0F, 0x01, 0x0C, 0xFF, 0x0B, 0x06,
+  0x0E, 0x0D, 0x05, 0x0B, 0x0E, 0xFF, 0x0E, 0x13,
+  0x0F, 0x05, 0x08, 0x0E, 0x04, 0x99, 0x90, 0x0A,
+  0x05, 0x05, 0x0A, 0x13, 0x13, 0x9A, 0x0D, 0x07,
+  0x07, 0x0F, 0x0E, 0x13, 0x11, 0x97, 0x92, 0x0E,
+  0x0B, 0x11, 0x13, 0x11, 0x8F, 0x9B, 0x92, 0x00,
+  // 77
+  0x01, 0x13, 0x17, 0x19, 0x1C, 0x20, 0x5B, 0x21,
+  0x02, 0x04, 0x04, 0x1B, 0x19, 0x22, 0x5B, 0x24,
+  0x03, 0x04, 0x06, 0x03, 0x3D, 0x12, 0x9A, 0x97,
+  0x0B, 0x03, 0x01, 0x01, 0x03, 0x1E, 0xB0, 0x50,
+  0x14, 0x02, 0x14, 0x04, 0x02, 0xBE, 0x9A, 0x97,
+  0x13, 0x09, 0x13, 0x06, 0x05, 0x00, 0xBE, 0x97,
+  0x0B, 0x06, 0x06, 0x1A, 0x14, 0x0A, 0x99, 0x97,
+  0x13, 0x05, 0x14, 0x00, 0x0D, 0x11, 0xB0, 0x5B,
+  // 78
+  0x24, 0x24, 0x20, 0xB3, 0x16, 0x20, 0x20, 0x19,
+  0x24, 0x20, 0x21, 0x9B, 0x92, 0x19, 0x1D, 0x1B,
+  0x19, 0x1B, 0x17, 0xB4, 0xBD, 0x12, 0x15, 0x12,
+  0x17, 0x16, 0x12, 0xB3, 0x99, 0x12, 0x12, 0x10,
+  0x10, 0x12, 0x11, 0x9A, 0x94, 0x12, 0x12, 0x10,
+  0x10, 0x12, 0x13, 0xB0, 0x94, 0x15, 0x0A, 0x93,
+  0xB3, 0x12, 0x12, 0xB0, 0x97, 0x12, 0x10, 0x3D,
+  0x5B, 0x12, 0x10, 0xB4, 0x9A, 0xA8, 0xA8, 0x26,
+  // 79
+  0x12, 0x12, 0x12, 0x14, 0x8A, 0x57, 0x7E, 0x7E,
+  0x17, 0x12, 0x12, 0x12, 0x85, 0x57, 0x57, 0x57,
+  0x12, 0x12, 0x13, 0x85, 0x85, 0x7E, 0x7C, 0x7E,
+  0x12, 0x12, 0x8B, 0x82, 0x85, 0x81, 0x59, 0x7C,
+  0x12, 0x13, 0x14, 0x86, 0x85, 0x59, 0x59, 0x58,
+  0x12, 0x81, 0x7F, 0x86, 0x7E, 0x7E, 0x58, 0x80,
+  0x0A, 0x85, 0x7E, 0x86, 0x7E, 0x7C, 0x57, 0x57,
+  0x10, 0x82, 0x85, 0x85, 0x80, 0x7E, 0x7F, 0x59,
+  // 80
+  0x9B, 0xB3, 0x9B, 0x99, 0x97, 0x98, 0x7C, 0x85,
+  0xBD, 0x9A, 0xB3, 0x97, 0x94, 0x7C, 0x59, 0x82,
+  0xB4, 0xB4, 0xB4, 0x99, 0x94, 0x97, 0x7E, 0x7E,
+  0xB5, 0xB5, 0xB5, 0x9B, 0x99, 0x91, 0x85, 0x89,
+  0xB5, 0xB5, 0xB7, 0xB5, 0x99, 0x97, 0x85, 0x86,
+  0xB7, 0xBB, 0xBB, 0xB4, 0x9B, 0x89, 0x89, 0x86,
+  0xBC, 0xB4, 0xB4, 0x9A, 0xB3, 0xB3, 0x88, 0x8A,
+  0xB5, 0xB4, 0xB5, 0x9B, 0xB3, 0x9C, 0x98, 0x8B,
+  // 81
+  0x85, 0x85, 0x89, 0x86, 0x86, 0x82, 0x82, 0x85,
+  0x57, 0x86, 0x89, 0x86, 0x81, 0x86, 0x89, 0x7C,
+  0x7C, 0x86, 0x89, 0x87, 0x82, 0x89, 0x8A, 0x89,
+  0x7E, 0x7E, 0x89, 0x86, 0x89, 0x7F, 0x86, 0x85,
+  0x85, 0x89, 0x8A, 0x87, 0x89, 0x8A, 0x8C, 0x89,
+  0x86, 0x87, 0x89, 0x89, 0x8A, 0x89, 0x7E, 0x7D,
+  0x89, 0x8A, 0x89, 0x81, 0x81, 0x86, 0x8C, 0x86,
+  0x8A, 0x8A, 0x89, 0x95, 0x8A, 0x8C, 0x8C, 0x89,
+  // 82
+  0x7E, 0x81, 0x57, 0x58, 0xB3, 0x94, 0x8F, 0x10,
+  0x57, 0x57, 0x57, 0x58, 0x57, 0xB7, 0x0A, 0x10,
+  0x81, 0x59, 0x58, 0x96, 0xB3, 0x9B, 0x93, 0x12,
+  0x81, 0x7C, 0x80, 0x84, 0x88, 0x84, 0x94, 0x1A,
+  0x7C, 0x80, 0x7F, 0x7E, 0x7E, 0x98, 0x99, 0x94,
+  0x87, 0x82, 0x89, 0x87, 0x83, 0xB5, 0x92, 0x0A,
+  0x80, 0x7C, 0x95, 0xB5, 0xB3, 0x99, 0x97, 0x10,
+  0x8B, 0x87, 0x96, 0xB3, 0x9A, 0xB3, 0x8D, 0x92,
+  // 83
+  0x17, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+  0x12, 0x15, 0x12, 0x12, 0x1B, 0x17, 0x12, 0x12,
+  0x12, 0x12, 0x12, 0x15, 0x12, 0x15, 0x12, 0x12,
+  0x1A, 0x15, 0x12, 0x15, 0x12, 0x15, 0x17, 0x15,
+  0x29, 0x16, 0x12, 0x15, 0x16, 0x17, 0x19, 0x20,
+  0x15, 0x16, 0xB0, 0x1A, 0x17, 0x10, 0x1C, 0x28,
+  0x15, 0x16, 0xB0, 0x93, 0x1D, 0x10, 0x2A, 0x19,
+  0x8F, 0x15, 0xB0, 0x29, 0x28, 0x10, 0x15, 0x1F,
+  // 84
+  0x12, 0x12, 0x94, 0x0A, 0x12, 0x12, 0x12, 0x12,
+  0x12, 0x12, 0x94, 0x0A, 0x12, 0x12, 0x12, 0x17,
+  0x12, 0x12, 0x92, 0x11, 0x12, 0x12, 0x15, 0x1B,
+  0x1A, 0xB0, 0x97, 0x0A, 0x12, 0x18, 0x16, 0x15,
+  0x18, 0x9A, 0x92, 0x14, 0x1B, 0x1D, 0x12, 0x12,
+  0x2A, 0xB6, 0x94, 0x99, 0x15, 0x1C, 0x19, 0x19,
+  0xE8, 0xB5, 0x99, 0x10, 0x16, 0x16, 0x2C, 0x2C,
+  0x24, 0x9A, 0x99, 0x5E, 0x2B, 0x2C, 0x32, 0x21,
+  // 85
+  0x17, 0x18, 0x1B, 0x18, 0x1B, 0x1B, 0x26, 0x26,
+  0x12, 0x1A, 0x1B, 0x17, 0x18, 0x18, 0x26, 0x08,
+  0x15, 0x1B, 0x27, 0x18, 0x1B, 0x1B, 0x26, 0x14,
+  0x1B, 0x27, 0x10, 0x1A, 0x10, 0x10, 0x10, 0x1A,
+  0x1B, 0x12, 0x17, 0x10, 0x12, 0x1A, 0x17, 0x1D,
+  0x17, 0x10, 0x18, 0x10, 0x27, 0x18, 0x1A, 0x20,
+  0x13, 0x1A, 0x15, 0x1D, 0x2C, 0x2C, 0x1A, 0x0F,
+  0x12, 0x15, 0x28, 0x2C, 0x42, 0x05, 0x3D, 0x0D,
+  // 86
+  0x0E, 0x07, 0x08, 0x0F, 0x0C, 0x05, 0x0D, 0x0E,
+  0x1A, 0x0F, 0x0B, 0x00, 0x0D, 0x0D, 0x11, 0x13,
+  0x06, 0x05, 0x05, 0x07, 0x09, 0x26, 0x13, 0x16,
+  0x0E, 0x0B, 0x0B, 0x0B, 0x26, 0x13, 0x26, 0x29,
+  0x1B, 0x0C, 0x09, 0x14, 0x1A, 0x13, 0x3D, 0x29,
+  0x07, 0x08, 0x08, 0x3D, 0x13, 0x3D, 0x2C, 0x2C,
+  0x08, 0x0C, 0x3D, 0x1B, 0x29, 0x2C, 0x3E, 0x32,
+  0x0B, 0x2C, 0x32, 0x2A, 0x2C, 0x3E, 0x36, 0x3E,
+  // 87
+  0x0E, 0x13, 0x29, 0x1B, 0x1A, 0x0C, 0x0D, 0x07,
+  0x26, 0x27, 0x27, 0x13, 0x0A, 0x26, 0x00, 0x08,
+  0x13, 0x1B, 0x13, 0x0E, 0x13, 0x2A, 0x0F, 0x17,
+  0x26, 0x26, 0x11, 0x29, 0x36, 0x21, 0x0C, 0x2C,
+  0x29, 0x1A, 0x1A, 0x47, 0x45, 0x3E, 0x12, 0x2D,
+  0x2C, 0x29, 0x13, 0x42, 0x46, 0x46, 0x40, 0x2B,
+  0x32, 0x1D, 0x45, 0x44, 0x24, 0x47, 0x47, 0x2A,
+  0x1B, 0x45, 0x45, 0x46, 0x42, 0x46, 0x47, 0x45,
+  // 88
+  0x0C, 0x1B, 0x3D, 0x08, 0x17, 0x1A, 0x08, 0x26,
+  0x26, 0x46, 0x3D, 0x0B, 0x1A, 0x26, 0x08, 0x1A,
+  0x18, 0x44, 0x50, 0x28, 0x19, 0x28, 0x09, 0x1A,
+  0x28, 0x45, 0x46, 0x13, 0x46, 0x1D, 0x26, 0x27,
+  0x28, 0x44, 0x46, 0x2C, 0x29, 0x27, 0x29, 0x2B,
+  0x2A, 0x2E, 0x49, 0x46, 0x2A, 0x2A, 0x48, 0x2B,
+  0x46, 0x42, 0x48, 0x2B, 0x22, 0x48, 0x47, 0x45,
+  0x48, 0x48, 0x46, 0x2A, 0x2D, 0x47, 0x48, 0x47,
+  // 89
+  0x17, 0x0D, 0x11, 0x1D, 0x44, 0x45, 0x2B, 0x46,
+  0x0A, 0x13, 0x26, 0x46, 0x44, 0x45, 0x2D, 0x25,
+  0x0A, 0x18, 0x47, 0x42, 0x2E, 0x45, 0x20, 0x19,
+  0x29, 0x36, 0x45, 0x29, 0x44, 0x45, 0x42, 0x27,
+  0x2B, 0x47, 0x46, 0x25, 0x45, 0x2B, 0x1A, 0x0D,
+  0x47, 0x47, 0x45, 0x2B, 0x44, 0x2A, 0x1A, 0x1B,
+  0x47, 0x47, 0x47, 0x47, 0x3E, 0x15, 0x1B, 0x18,
+  0x47, 0x47, 0x47, 0x44, 0x29, 0x2C, 0x2C, 0x16,
+  // 90
+  0x14, 0x0F, 0x07, 0x07, 0x09, 0x0C, 0x0E, 0x0E,
+  0x06, 0x06, 0x14, 0x08, 0x0E, 0x0E, 0x14, 0x0E,
+  0x0C, 0x06, 0x27, 0x0C, 0x11, 0x0E, 0x13, 0x11,
+  0x07, 0x14, 0x14, 0x13, 0x13, 0x11, 0x0E, 0x13,
+  0x13, 0x14, 0x0F, 0x07, 0x0F, 0x28, 0x14, 0x1B,
+  0x14, 0x1A, 0x13, 0x07, 0x14, 0x28, 0x14, 0x2A,
+  0x13, 0x3E, 0x1A, 0x29, 0x26, 0x3E, 0x26, 0x28,
+  0x14, 0x45, 0x2C, 0x29, 0x27, 0x2A, 0x28, 0x20,
+  // 91
+  0x0E, 0x02, 0x01, 0x0C, 0x07, 0x09, 0x27, 0x27,
+  0x29, 0x26, 0x03, 0x0C, 0x14, 0x02, 0x00, 0x1F,
+  0x1B, 0x29, 0x06, 0x08, 0x0A, 0x00, 0x08, 0x00,
+  0x26, 0x2C, 0x29, 0x07, 0x08, 0x26, 0x02, 0x02,
+  0x02, 0x3E, 0x1C, 0x0A, 0x3D, 0x27, 0x0F, 0x07,
+  0x2A, 0x0B, 0x3E, 0x29, 0x11, 0x21, 0x1A, 0x05,
+  0x43, 0x46, 0x36, 0x2B, 0x26, 0x1D, 0x1D, 0x09,
+  0x44, 0x45, 0x2D, 0x45, 0x3E, 0x1B, 0x27, 0x27,
+  // 92
+  0x27, 0x1D, 0x27, 0x27, 0x27, 0x26, 0x08, 0x0D,
+  0x1B, 0x1D, 0x28, 0x3D, 0x27, 0x1A, 0x03, 0x03,
+  0x3D, 0x27, 0x1D, 0x28, 0x00, 0x1B, 0x0B, 0x05,
+  0x02, 0x26, 0x27, 0x1D, 0x28, 0x0B, 0x17, 0x09,
+  0x06, 0x04, 0x14, 0x1D, 0x28, 0x26, 0x1D, 0x21,
+  0x04, 0x08, 0x04, 0x1B, 0x26, 0x19, 0x1D, 0x1D,
+  0x06, 0x03, 0x07, 0x00, 0x00, 0x27, 0x27, 0x27,
+  0x13, 0x00, 0x03, 0x0B, 0x04, 0x01, 0x13, 0x27,
+  // 93
+  0x03, 0x03, 0x00, 0x44, 0x45, 0x46, 0x19, 0x3D,
+  0x03, 0x05, 0x01, 0x44, 0x44, 0x44, 0x44, 0x00,
+  0x00, 0x00, 0x03, 0x09, 0x40, 0x43, 0x44, 0x42,
+  0x14, 0x11, 0x03, 0x04, 0x0A, 0x43, 0x3C, 0x44,
+  0x09, 0x11, 0x0D, 0x07, 0x07, 0x09, 0x43, 0x44,
+  0x1B, 0x09, 0x03, 0x09, 0x09, 0x06, 0x02, 0x45,
+  0x24, 0x1B, 0x27, 0x26, 0x26, 0x1B, 0x29, 0x14,
+  0x1D, 0x1D, 0x28, 0x28, 0x2A, 0x32, 0x2A, 0x0C,
+  // 94
+  0x2A, 0x1A, 0x09, 0x01, 0x03, 0x09, 0x0D, 0x0D,
+  0x12, 0x28, 0x1B, 0x06, 0x03, 0x04, 0x00, 0x06,
+  0x1B, 0x1B, 0x2C, 0x2A, 0x0C, 0x03, 0x04, 0x08,
+  0x44, 0x22, 0x1B, 0x2C, 0x1B, 0x26, 0x06, 0x05,
+  0x45, 0x44, 0x21, 0x27, 0x0F, 0x27, 0x27, 0x0D,
+  0x45, 0x44, 0x45, 0x24, 0x0B, 0x26, 0x27, 0x28,
+  0x42, 0x2C, 0x44, 0x44, 0x2C, 0x26, 0x26, 0x1B,
+  0x43, 0x2C, 0x44, 0x45, 0x45, 0x43, 0x2C, 0x29,
+  // 95
+  0x08, 0x05, 0x05, 0x05, 0x0D, 0x01, 0x0E, 0x04,
+  0x01, 0x03, 0x07, 0x00, 0x00, 0x0D, 0x06, 0x08,
+  0x07, 0x07, 0x05, 0x07, 0x0D, 0x0D, 0x05, 0x07,
+  0x0D, 0x0E, 0x0E, 0x0F, 0x0C, 0x0D, 0x0B, 0x0A,
+  0x0B, 0x09, 0x0E, 0x0D, 0x09, 0x09, 0x0F, 0x26,
+  0x0C, 0x08, 0x08, 0x08, 0x09, 0x13, 0x11, 0x27,
+  0x1B, 0x09, 0x08, 0x0B, 0x14, 0x13, 0x27, 0x28,
+  0x27, 0x32, 0x13, 0x28, 0x15, 0x13, 0x28, 0x1D,
+  // 96
+  0x07, 0x0E, 0x14, 0x13, 0x9A, 0x99, 0x97, 0x04,
+  0x0F, 0x13, 0x11, 0x26, 0xFF, 0x9B, 0x92, 0x04,
+  0x13, 0x1A, 0x15, 0x1B, 0xB4, 0x9C, 0x99, 0x0E,
+  0x17, 0x15, 0x10, 0x1A, 0xB4, 0x92, 0x97, 0x09,
+  0x27, 0x10, 0x10, 0x10, 0xB0, 0xB7, 0x97, 0x9B,
+  0x15, 0x1B, 0x1B, 0x93, 0xB0, 0x99, 0x8F, 0x12,
+  0x28, 0x1B, 0x1B, 0x15, 0xB8, 0x97, 0x9B, 0x9C,
+  0x3D, 0x3D, 0x1B, 0x5B, 0xB3, 0x9B, 0x92, 0x1B,
+  // 97
+  0x13, 0x09, 0x07, 0x15, 0x00, 0xB5, 0x99, 0x97,
+  0x08, 0x0C, 0x06, 0x26, 0x15, 0xBC, 0xB0, 0x92,
+  0x02, 0x02, 0x0C, 0x09, 0x17, 0x12, 0xB3, 0x92,
+  0x0B, 0x09, 0x15, 0x17, 0xB5, 0xB7, 0x99, 0x97,
+  0x0C, 0x50, 0x10, 0x1B, 0x11, 0xB5, 0xB7, 0x97,
+  0x10, 0x94, 0x0A, 0x2A, 0x16, 0xB9, 0xB4, 0x99,
+  0x15, 0x99, 0x94, 0x12, 0xEA, 0x10, 0x9B, 0x98,
+  0x16, 0x78, 0x94, 0x50, 0xB0, 0xB5, 0x9B, 0x99,
+  // 98
+  0x99, 0x12, 0x10, 0x9A, 0x92, 0xA8, 0x7E, 0xA8,
+  0xBE, 0x10, 0x8F, 0x99, 0x94, 0x88, 0x93, 0xA8,
+  0x9C, 0x12, 0xB0, 0x9A, 0x97, 0xA8, 0xA8, 0x94,
+  0x57, 0x57, 0x5D, 0xB0, 0x9A, 0x92, 0xB0, 0x9A,
+  0x9A, 0xB0, 0xA8, 0xB0, 0xB0, 0x94, 0x94, 0x9A,
+  0x9C, 0x7F, 0x59, 0x96, 0x92, 0x94, 0xA8, 0x94,
+  0x7C, 0x58, 0x57, 0x96, 0x99, 0x9A, 0x99, 0x9A,
+  0x5C, 0x7C, 0x59, 0x8C, 0x99, 0x99, 0x94, 0x9A,
+  // 99
+  0x7F, 0x7E, 0x82, 0x86, 0x86, 0x57, 0x82, 0x57,
+  0x57, 0x86, 0x86, 0x86, 0x81, 0x59, 0x7E, 0x57,
+  0x98, 0x7E, 0x89, 0x85, 0x7E, 0x7F, 0x7E, 0x59,
+  0x97, 0x96, 0x89, 0x7E, 0x7E, 0x5A, 0x82, 0x80,
+  0x92, 0x86, 0x89, 0x7E, 0x85, 0x5A, 0x82, 0x80,
+  0x86, 0x86, 0x86, 0x81, 0x81, 0x5A, 0x82, 0x7E,
+  0x91, 0x8A, 0x87, 0x8A, 0x8A, 0x5A, 0x86, 0x85,
+  0x94, 0x87, 0x89, 0x86, 0x8A, 0x5A, 0x82, 0x82,
+  // 100
+  0xB6, 0xB6, 0xB8, 0xB3, 0xB3, 0x8A, 0x8B, 0x95,
+  0xB6, 0xB6, 0xB6, 0xB5, 0xB3, 0x9B, 0x8C, 0x8B,
+  0xB9, 0xB5, 0xB7, 0x9B, 0x8B, 0x95, 0x8A, 0x8B,
+  0xB8, 0xB5, 0xB8, 0xB3, 0x9B, 0x8C, 0x8B, 0x8C,
+  0xB6, 0xB4, 0xBB, 0x9B, 0x9B, 0x91, 0x95, 0x8B,
+  0xB6, 0xB9, 0xB5, 0xBB, 0x9B, 0xB9, 0x8B, 0x8B,
+  0xB9, 0xB6, 0xBD, 0xBD, 0x9C, 0x8E, 0x8C, 0x95,
+  0xB9, 0xB9, 0xB8, 0xB8, 0xBD, 0x95, 0x8C, 0x8C,
+  // 101
+  0x8B, 0x87, 0x8A, 0x80, 0x8A, 0x8A, 0x8A, 0x87,
+  0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8A, 0x95, 0x95,
+  0x8A, 0x8A, 0x8C, 0x8C, 0x8C, 0x8B, 0x8A, 0x8C,
+  0x86, 0x8C, 0x95, 0x8C, 0x8C, 0x8B, 0x95, 0x85,
+  0x8B, 0x8B, 0x8C, 0x95, 0x8C, 0x8B, 0x86, 0x82,
+  0x95, 0x95, 0x95, 0x96, 0x95, 0x8C, 0x89, 0x82,
+  0x98, 0x96, 0x96, 0x96, 0x96, 0x87, 0x87, 0x87,
+  0x95, 0x95, 0x95, 0x8B, 0x95, 0x8A, 0x8A, 0x86,
+  // 102
+  0x8B, 0x86, 0x59, 0x8B, 0xB8, 0x9A, 0x9A, 0xB3,
+  0x8A, 0x59, 0x59, 0x59, 0x9C, 0xB5, 0x9B, 0x94,
+  0x81, 0x80, 0x7E, 0x7E, 0x92, 0x97, 0xB3, 0xB3,
+  0x80, 0x80, 0x59, 0x8B, 0xB5, 0x9A, 0x99, 0x9A,
+  0x85, 0x81, 0x7E, 0x85, 0x9C, 0x98, 0x99, 0x97,
+  0x7E, 0x80, 0x59, 0x7E, 0x59, 0xB4, 0xB3, 0x9B,
+  0x7F, 0x58, 0x7C, 0x59, 0xBE, 0xB3, 0xB7, 0x94,
+  0x80, 0x8C, 0x7E, 0x88, 0x9C, 0xBD, 0x99, 0x92,
+  // 103
+  0x93, 0x15, 0xB0, 0x9A, 0x2A, 0xA8, 0xB1, 0x1F,
+  0x1A, 0x10, 0xB0, 0x3D, 0x2C, 0x15, 0xCE, 0x2D,
+  0x8D, 0x5B, 0x9A, 0x94, 0x1F, 0x76, 0xB6, 0x2C,
+  0x94, 0x9C, 0xA9, 0x93, 0x32, 0xA1, 0xA1, 0x42,
+  0x99, 0x83, 0xA9, 0xA8, 0xA9, 0xA1, 0xA1, 0x2B,
+  0x87, 0x5C, 0xA9, 0x94, 0xA1, 0xA1, 0xA1, 0xA1,
+  0x98, 0x81, 0x93, 0x93, 0xA1, 0xA1, 0xA1, 0xA9,
+  0x98, 0x83, 0x94, 0x94, 0xA1, 0xA8, 0xA1, 0xA1,
+  // 104
+  0x6D, 0x9A, 0x94, 0x9A, 0x2C, 0x2B, 0x2C, 0x15,
+  0xB0, 0xB3, 0xB3, 0x99, 0x3D, 0x1B, 0x1D, 0x2C,
+  0x50, 0xB0, 0x92, 0x97, 0x43, 0x24, 0x2A, 0x40,
+  0xB0, 0xB5, 0x92, 0x97, 0xB0, 0x3E, 0x2D, 0x42,
+  0xB5, 0xB4, 0xB3, 0x92, 0x50, 0x60, 0x37, 0x44,
+  0xB8, 0x9A, 0x94, 0x9B, 0xB3, 0x5F, 0x54, 0x54,
+  0xB6, 0xB4, 0x99, 0x97, 0x94, 0x5F, 0x60, 0x68,
+  0xB6, 0xB5, 0x98, 0x92, 0x99, 0xB4, 0x66, 0x60,
+  // 105
+  0x2C, 0x42, 0x41, 0x2B, 0x0A, 0x08, 0x09, 0x15,
+  0x42, 0x44, 0x45, 0x11, 0x0A, 0x0A, 0x42, 0x45,
+  0x45, 0x45, 0x27, 0x2C, 0x15, 0x46, 0x47, 0x4A,
+  0x45, 0x45, 0x45, 0x45, 0x46, 0x32, 0x32, 0x48,
+  0x55, 0x45, 0x42, 0x47, 0x49, 0x47, 0x47, 0x47,
+  0x55, 0x6A, 0x48, 0x48, 0x49, 0x4A, 0x49, 0x49,
+  0x68, 0x5E, 0x60, 0x5F, 0x6A, 0x4E, 0x49, 0x49,
+  0x60, 0x6A, 0x5F, 0x5F, 0x60, 0x47, 0x4D, 0x4C,
+  // 106
+  0x2C, 0x43, 0x1B, 0x29, 0x40, 0x42, 0x45, 0x45,
+  0x44, 0x24, 0x46, 0x40, 0x42, 0x43, 0x44, 0x46,
+  0x32, 0x44, 0x45, 0x46, 0x45, 0x44, 0x32, 0x2A,
+  0x48, 0x44, 0x45, 0x44, 0x47, 0x42, 0x42, 0x23,
+  0x48, 0x47, 0x47, 0x4E, 0x49, 0x32, 0x48, 0x49,
+  0x49, 0x4C, 0x4A, 0x48, 0x47, 0x42, 0x4B, 0x49,
+  0x49, 0x4C, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A,
+  0x4C, 0x4C, 0x4D, 0x4C, 0x4C, 0x4C, 0x4B, 0x4B,
+  // 107
+  0x42, 0x47, 0x47, 0x47, 0x47, 0x47, 0x49, 0x48,
+  0x32, 0x47, 0x47, 0x47, 0x48, 0x47, 0x48, 0x48,
+  0x45, 0x47, 0x47, 0x48, 0x48, 0x48, 0x49, 0x46,
+  0x49, 0x47, 0x48, 0x49, 0x48, 0x4A, 0x49, 0x44,
+  0x49, 0x48, 0x49, 0x46, 0x49, 0x4C, 0x49, 0x4B,
+  0x4A, 0x4A, 0x52, 0x42, 0x32, 0x2D, 0x4D, 0x4C,
+  0x4C, 0x4C, 0x52, 0x43, 0x52, 0x4D, 0x4D, 0x4B,
+  0x51, 0x38, 0x4C, 0x51, 0x4D, 0x4D, 0x4D, 0x4D,
+  // 108
+  0x48, 0x3E, 0x2C, 0x2C, 0x48, 0x48, 0x48, 0x47,
+  0x47, 0x2C, 0x32, 0x48, 0x48, 0x48, 0x48, 0x47,
+  0x2C, 0x47, 0x40, 0x49, 0x49, 0x48, 0x48, 0x48,
+  0x49, 0x4C, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49,
+  0x4A, 0x4C, 0x4C, 0x4A, 0x49, 0x4A, 0x49, 0x4A,
+  0x4C, 0x4C, 0x4C, 0x4A, 0x4A, 0x4A, 0x49, 0x49,
+  0x4D, 0x4D, 0x4D, 0x4C, 0x4B, 0x48, 0x4A, 0x32,
+  0x4D, 0x4D, 0x4D, 0x4D, 0x46, 0x31, 0x2B, 0x4C,
+  // 109
+  0x47, 0x47, 0x46, 0x3D, 0x2C, 0x32, 0x45, 0x3E,
+  0x47, 0x47, 0x3E, 0x3D, 0x42, 0x40, 0x3E, 0x21,
+  0x48, 0x48, 0x1C, 0x1B, 0x47, 0x47, 0x39, 0x46,
+  0x47, 0x49, 0x1E, 0x46, 0x48, 0x48, 0x47, 0x2D,
+  0x49, 0x32, 0x43, 0x49, 0x49, 0x49, 0x44, 0x2E,
+  0x2C, 0x4B, 0x49, 0x49, 0x4A, 0x49, 0x44, 0x48,
+  0x50, 0x4C, 0x4C, 0x4C, 0x4B, 0x3E, 0x50, 0x4C,
+  0x30, 0x47, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4B,
+  // 110
+  0x27, 0x45, 0x45, 0x3E, 0x25, 0x2C, 0x29, 0x28,
+  0x2C, 0x45, 0x42, 0x2C, 0x2C, 0x45, 0x29, 0x29,
+  0x42, 0x42, 0x40, 0x2C, 0x2B, 0x32, 0x2A, 0x2A,
+  0x47, 0x4A, 0x49, 0x2C, 0x2C, 0x2B, 0x2B, 0x2C,
+  0x49, 0x4A, 0x49, 0x2C, 0x2C, 0x2C, 0x46, 0x2B,
+  0x4A, 0x4C, 0x4C, 0x4A, 0x49, 0x2B, 0x2B, 0x46,
+  0x4C, 0x4C, 0x4C, 0x51, 0x4C, 0x4B, 0x4B, 0x4C,
+  0x4C, 0x52, 0x4E, 0x51, 0x4C, 0x4B, 0x51, 0x4A,
+  // 111
+  0x2A, 0x2D, 0x45, 0x45, 0x45, 0x1D, 0x2A, 0x28,
+  0x2A, 0x29, 0x46, 0x45, 0x47, 0x28, 0x42, 0x29,
+  0x2A, 0x2C, 0x2A, 0x48, 0x47, 0x42, 0x27, 0x26,
+  0x2A, 0x2A, 0x2C, 0x46, 0x47, 0x47, 0x29, 0x29,
+  0x2A, 0x2C, 0x47, 0x2C, 0x46, 0x47, 0x45, 0x2C,
+  0x2B, 0x2C, 0x49, 0x2D, 0x2C, 0x45, 0x48, 0x2B,
+  0x50, 0x2C, 0x2B, 0x4B, 0x50, 0x50, 0x32, 0x49,
+  0x4C, 0x2D, 0x2B, 0x4C, 0x4C, 0x49, 0x49, 0x49,
+  // 112
+  0x2A, 0x12, 0x04, 0x09, 0x04, 0x07, 0x07, 0x0F,
+  0x32, 0x27, 0x0C, 0x00, 0x29, 0x06, 0x07, 0x07,
+  0x47, 0x42, 0x2A, 0x1A, 0x28, 0x1B, 0x28, 0x13,
+  0x45, 0x47, 0x32, 0x25, 0x28, 0x29, 0x29, 0x27,
+  0x29, 0x47, 0x40, 0x47, 0x28, 0x21, 0x40, 0x28,
+  0x42, 0x2C, 0x47, 0x47, 0x47, 0x2A, 0x29, 0x45,
+  0x49, 0x46, 0x2B, 0x47, 0x47, 0x46, 0x29, 0x2C,
+  0x49, 0x4A, 0x32, 0x48, 0x49, 0x47, 0x2D, 0x49,
+  // 113
+  0x3D, 0x24, 0x29, 0x2A, 0x28, 0x2A, 0x47, 0x2E,
+  0x00, 0x2C, 0x29, 0x24, 0x2A, 0x28, 0x46, 0x47,
+  0x15, 0x19, 0x29, 0x29, 0x42, 0x2C, 0x1B, 0x3E,
+  0x42, 0x21, 0x2A, 0x29, 0x32, 0x44, 0x46, 0x2C,
+  0x1D, 0x2A, 0x2A, 0x2A, 0x2C, 0x46, 0x49, 0x45,
+  0x19, 0x47, 0x47, 0x46, 0x49, 0x32, 0x4A, 0x49,
+  0x45, 0x48, 0x47, 0x47, 0x48, 0x48, 0x48, 0x49,
+  0x2B, 0x49, 0x47, 0x47, 0x51, 0x49, 0x49, 0x49,
+  // 114
+  0x2B, 0x47, 0x24, 0x46, 0x47, 0x45, 0x47, 0x2A,
+  0x42, 0x45, 0x2C, 0x2E, 0x44, 0x45, 0x47, 0x45,
+  0x47, 0x45, 0x43, 0x2C, 0x2C, 0x42, 0x39, 0x45,
+  0x2D, 0x47, 0x45, 0x48, 0x2C, 0x2B, 0x3A, 0x48,
+  0x2F, 0x49, 0x48, 0x48, 0x47, 0x32, 0x2B, 0x42,
+  0x49, 0x4C, 0x49, 0x49, 0x49, 0x48, 0x48, 0x48,
+  0x49, 0x4A, 0x49, 0x4A, 0x49, 0x49, 0x4A, 0x4A,
+  0x4A, 0x4A, 0x4A, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C,
+  // 115
+  0x2A, 0x3D, 0x32, 0x40, 0x28, 0x1A, 0x27, 0x28,
+  0x29, 0x2A, 0x28, 0x2A, 0x40, 0x32, 0x1D, 0x2A,
+  0x42, 0x45, 0x29, 0x28, 0x2C, 0x2B, 0x32, 0x2A,
+  0x47, 0x2B, 0x47, 0x1E, 0x28, 0x2A, 0x44, 0x46,
+  0x46, 0x48, 0x48, 0x49, 0x2C, 0x2C, 0x2B, 0x2B,
+  0x1F, 0x49, 0x49, 0x49, 0x4C, 0x6A, 0x6F, 0xB0,
+  0x4C, 0x4C, 0x52, 0x52, 0x6D, 0x6B, 0x5F, 0x60,
+  0x4D, 0x5E, 0x4F, 0x4B, 0x6F, 0x6B, 0x6D, 0xE8,
+  // 116
+  0x3E, 0x29, 0x1B, 0x6D, 0x99, 0x9B, 0xB3, 0x5B,
+  0x29, 0x29, 0x1C, 0xB5, 0x94, 0x92, 0x97, 0xB4,
+  0xB0, 0x8F, 0x46, 0x8F, 0xB5, 0x99, 0x94, 0x92,
+  0x8F, 0x9A, 0x1F, 0xB7, 0xB4, 0x97, 0x97, 0x99,
+  0xB5, 0xBB, 0x1F, 0xBE, 0xB4, 0x94, 0x92, 0x92,
+  0xB5, 0xB3, 0x55, 0x99, 0x97, 0x97, 0x97, 0xB7,
+  0xB8, 0xB8, 0x56, 0x9B, 0x97, 0x98, 0x92, 0x92,
+  0xB5, 0x9B, 0x50, 0xB3, 0x99, 0x94, 0x97, 0x92,
+  // 117
+  0x2C, 0xB5, 0x9B, 0x5A, 0x86, 0xB5, 0x9B, 0x81,
+  0x28, 0xBD, 0xBB, 0x5C, 0x5C, 0xB9, 0x98, 0x82,
+  0x90, 0xB4, 0xB5, 0xBA, 0xBB, 0xB8, 0xB7, 0xB4,
+  0x15, 0x9B, 0xBD, 0xBE, 0xBD, 0xB6, 0x95, 0x98,
+  0xB4, 0xB5, 0xBD, 0xBB, 0xB8, 0xBD, 0x81, 0x7E,
+  0x97, 0x9A, 0xBB, 0xB5, 0xBE, 0x7E, 0x85, 0x86,
+  0x99, 0xB3, 0x99, 0xBB, 0xBD, 0x96, 0x80, 0x85,
+  0x92, 0x92, 0xB7, 0xB6, 0xB8, 0xBD, 0x86, 0x82,
+  // 118
+  0x80, 0x58, 0x57, 0x91, 0xB3, 0x99, 0x9A, 0xB7,
+  0x7E, 0x57, 0x58, 0x98, 0x9C, 0x94, 0xB3, 0xB4,
+  0x87, 0x7F, 0x57, 0x7D, 0x94, 0xB4, 0xB5, 0xB5,
+  0x7C, 0x59, 0x7C, 0x57, 0xB7, 0x97, 0xB3, 0x88,
+  0x7C, 0x7C, 0x7E, 0x96, 0x98, 0x94, 0x9A, 0x8B,
+  0x82, 0x7E, 0x7F, 0x57, 0x57, 0xB3, 0x9A, 0x8B,
+  0x89, 0x7E, 0x7C, 0x7D, 0x5C, 0x9B, 0x9C, 0x99,
+  0x8A, 0x7E, 0x7F, 0x96, 0x9C, 0xB3, 0xB7, 0x8C,
+  // 119
+  0x94, 0x98, 0x89, 0x86, 0x85, 0x5A, 0x89, 0x7E,
+  0x98, 0x98, 0x86, 0x89, 0x8C, 0x5A, 0x8A, 0x89,
+  0x8B, 0x89, 0x89, 0x85, 0x89, 0x7E, 0x85, 0x85,
+  0x89, 0x8A, 0x86, 0x8A, 0x86, 0x7E, 0x8A, 0x81,
+  0x8A, 0x8A, 0x89, 0x87, 0x8A, 0x81, 0x8B, 0x87,
+  0x88, 0x89, 0x8A, 0x8A, 0x8C, 0x5C, 0x8C, 0x8C,
+  0x98, 0x8A, 0x8A, 0x8C, 0x86, 0x5C, 0x87, 0x87,
+  0x8A, 0x8A, 0x87, 0x87, 0x95, 0x8C, 0x8A, 0x89,
+  // 120
+  0xB9, 0xB7, 0xB6, 0xB8, 0xBC, 0xBD, 0x8C, 0x8C,
+  0xB6, 0xBB, 0xBC, 0xBB, 0xB5, 0x99, 0x98, 0x95,
+  0xB9, 0xB9, 0xB6, 0xB8, 0xB3, 0x9B, 0xB3, 0x95,
+  0xB9, 0xB6, 0xB9, 0xB7, 0xB3, 0xBD, 0x98, 0x9C,
+  0xB9, 0xB6, 0xB6, 0xB6, 0xB3, 0xB3, 0xB6, 0xB5,
+  0xB9, 0xB9, 0xB3, 0xB3, 0xB9, 0xB9, 0x91, 0x96,
+  0xB9, 0xBC, 0xB9, 0xB4, 0xB3, 0x9B, 0x8C, 0x95,
+  0xBA, 0xB9, 0xB6, 0x99, 0xB8, 0xB8, 0x95, 0x95,
+  // 121
+  0x8B, 0x8C, 0x8C, 0x95, 0x8C, 0x8A, 0x8C, 0x89,
+  0x95, 0x95, 0x95, 0x95, 0x8B, 0x8C, 0x95, 0x86,
+  0x8B, 0x95, 0x95, 0x95, 0x95, 0x8A, 0x91, 0x87,
+  0x91, 0x95, 0x95, 0x95, 0x91, 0x95, 0x95, 0x8B,
+  0x96, 0x91, 0x95, 0x8C, 0x95, 0x8E, 0x91, 0x8B,
+  0x96, 0x95, 0x8B, 0x95, 0x91, 0x9C, 0xBB, 0x95,
+  0x95, 0x95, 0x91, 0x96, 0x91, 0x96, 0x91, 0x8B,
+  0x8C, 0x95, 0x91, 0x96, 0x8C, 0x96, 0x96, 0x8A,
+  // 122
+  0x86, 0x85, 0x7F, 0x7E, 0x9B, 0x99, 0xB4, 0x92,
+  0x86, 0x86, 0x89, 0xB4, 0xB8, 0xB3, 0x99, 0x97,
+  0x8C, 0x8A, 0x8A, 0x8B, 0x9A, 0x9B, 0x99, 0x98,
+  0x86, 0x86, 0x8A, 0x91, 0xB6, 0x9B, 0x9B, 0x9C,
+  0x8A, 0x8A, 0xB3, 0x92, 0xB8, 0x9B, 0x9C, 0x94,
+  0x8C, 0x8B, 0xBD, 0xB5, 0xBB, 0xBB, 0x99, 0x99,
+  0x8A, 0x8B, 0x8A, 0xBD, 0x92, 0xB7, 0x9B, 0x97,
+  0x95, 0x9C, 0x8D, 0x9C, 0xBC, 0xB5, 0x99, 0x97,
+  // 123
+  0x8B, 0x83, 0x9B, 0x97, 0x93, 0xA1, 0x9F, 0xDC,
+  0x96, 0x98, 0x8B, 0x97, 0x94, 0xA1, 0xA1, 0xA1,
+  0x99, 0x8B, 0x88, 0x99, 0x97, 0xA1, 0xA1, 0xB6,
+  0x97, 0x98, 0x8E, 0x97, 0x9A, 0xA9, 0xA4, 0xBA,
+  0x97, 0x99, 0x98, 0x99, 0x9A, 0xA9, 0xA1, 0x9C,
+  0x97, 0x96, 0x92, 0x9B, 0x97, 0xA9, 0xAF, 0x84,
+  0x98, 0x92, 0x9A, 0xB3, 0x94, 0xB0, 0xA9, 0xB9,
+  0x96, 0xB3, 0x9A, 0x94, 0x99, 0xB0, 0xAF, 0xB8,
+  // 124
+  0xB5, 0xB4, 0x9B, 0x9B, 0x88, 0x6D, 0x6C, 0x85,
+  0xAF, 0xB8, 0xB3, 0x92, 0x96, 0x6C, 0x66, 0x86,
+  0xB5, 0xB9, 0x9A, 0x97, 0x99, 0x94, 0x87, 0x85,
+  0xBC, 0xB4, 0x92, 0x9C, 0x8B, 0x94, 0x81, 0x85,
+  0xB4, 0xB5, 0xB4, 0xB7, 0x91, 0x82, 0x82, 0x80,
+  0xB9, 0xB5, 0xB8, 0xB7, 0x97, 0x91, 0x85, 0x82,
+  0xB9, 0xB9, 0xB8, 0x98, 0x92, 0x92, 0x81, 0x86,
+  0xB9, 0xBB, 0x9A, 0xBB, 0x98, 0x96, 0x85, 0x89,
+  // 125
+  0x7C, 0x59, 0x5F, 0x65, 0x5F, 0x6A, 0x60, 0x4F,
+  0x80, 0x80, 0x7E, 0x60, 0x60, 0x5F, 0x65, 0x5F,
+  0x80, 0x59, 0x5C, 0x64, 0x65, 0x61, 0x62, 0x5F,
+  0x80, 0x7F, 0x6A, 0x6A, 0x63, 0x66, 0x62, 0x65,
+  0x7E, 0x7E, 0x5B, 0x6C, 0x65, 0x62, 0x62, 0x62,
+  0x80, 0x7F, 0x59, 0x5F, 0x6B, 0x67, 0x67, 0x67,
+  0x7E, 0x80, 0x6D, 0x64, 0x68, 0x67, 0x67, 0x67,
+  0x86, 0x81, 0x5B, 0x5B, 0x6D, 0x67, 0x6B, 0x65,
+  // 126
+  0x52, 0x4F, 0x4F, 0x4E, 0x4D, 0x4D, 0x4E, 0x52,
+  0x5F, 0x6A, 0x4D, 0x6D, 0x51, 0x4E, 0x4E, 0x4E,
+  0x61, 0x6B, 0x4F, 0x61, 0x54, 0x51, 0x51, 0x4E,
+  0x65, 0x61, 0x5F, 0x60, 0x55, 0x54, 0x5E, 0x56,
+  0x67, 0x60, 0x60, 0x60, 0x5E, 0x62, 0x65, 0x6A,
+  0x66, 0x67, 0x62, 0x62, 0x62, 0x60, 0x65, 0x66,
+  0x67, 0x67, 0x66, 0x67, 0x62, 0x62, 0x62, 0x6B,
+  0x6B, 0x67, 0x69, 0x6B, 0x67, 0x6B, 0x6B, 0x68,
+  // 127
+  0x44, 0x4E, 0x4D, 0x51, 0x4E, 0x4D, 0x4D, 0x4D,
+  0x4E, 0x4E, 0x51, 0x51, 0x4E, 0x4E, 0x4E, 0x4E,
+  0x4E, 0x51, 0x51, 0x51, 0x52, 0x51, 0x4E, 0x4E,
+  0x53, 0x4F, 0x4F, 0x51, 0x51, 0x51, 0x51, 0x4E,
+  0x53, 0x4D, 0x52, 0x51, 0x51, 0x4F, 0x52, 0x51,
+  0x54, 0x54, 0x52, 0x53, 0x53, 0x4F, 0x53, 0x4F,
+  0x61, 0x6F, 0x54, 0x54, 0x6A, 0x54, 0x4F, 0x53,
+  0x66, 0x67, 0x65, 0x60, 0x68, 0x5F, 0x4F, 0x54,
+  // 128
+  0x4D, 0x4C, 0x4C, 0x40, 0x32, 0x4D, 0x4D, 0x4B,
+  0x4D, 0x4C, 0x2D, 0x4C, 0x4D, 0x4C, 0x4C, 0x4D,
+  0x4E, 0x4E, 0x51, 0x4D, 0x4D, 0x4D, 0x4D, 0x4E,
+  0x4E, 0x51, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+  0x51, 0x51, 0x4E, 0x51, 0x51, 0x51, 0x4E, 0x51,
+  0x51, 0x52, 0x53, 0x51, 0x52, 0x52, 0x51, 0x52,
+  0x53, 0x52, 0x53, 0x52, 0x52, 0x52, 0x53, 0x52,
+  0x52, 0x53, 0x53, 0x52, 0x52, 0x53, 0x53, 0x53,
+  // 129
+  0x4D, 0x4D, 0x4D, 0x4D, 0x4E, 0x4D, 0x4D, 0x4D,
+  0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4E, 0x4E,
+  0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+  0x4E, 0x51, 0x51, 0x51, 0x4E, 0x51, 0x4E, 0x4E,
+  0x51, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+  0x4F, 0x53, 0x53, 0x53, 0x51, 0x52, 0x52, 0x52,
+  0x52, 0x53, 0x52, 0x53, 0x53, 0x53, 0x52, 0x51,
+  0x53, 0x52, 0x53, 0x53, 0x53, 0x54, 0x52, 0x53,
+  // 130
+  0x4D, 0x51, 0x4C, 0x51, 0x4D, 0x4E, 0x44, 0x4D,
+  0x4E, 0x4E, 0x4F, 0x4E, 0x4D, 0x4E, 0x4F, 0x4C,
+  0x4E, 0x4E, 0x4D, 0x4D, 0x4D, 0x4E, 0x4E, 0x4D,
+  0x51, 0x51, 0x51, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+  0x51, 0x51, 0x51, 0x51, 0x51, 0x4E, 0x51, 0x4E,
+  0x52, 0x51, 0x51, 0x52, 0x52, 0x51, 0x51, 0x51,
+  0x53, 0x51, 0x52, 0x53, 0x52, 0x52, 0x53, 0x51,
+  0x53, 0x52, 0x52, 0x53, 0x52, 0x53, 0x51, 0x52,
+  // 131
+  0x4B, 0x4C, 0x4C, 0x32, 0x4C, 0x4C, 0x4A, 0x4A,
+  0x4D, 0x4D, 0x4D, 0x4D, 0x4C, 0x2F, 0x4D, 0x4D,
+  0x4D, 0x4E, 0x4D, 0x4D, 0x4D, 0x3E, 0x51, 0x4A,
+  0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x52, 0x3E, 0x45,
+  0x51, 0x51, 0x4E, 0x4E, 0x4E, 0x51, 0x51, 0x4E,
+  0x51, 0x51, 0x51, 0x51, 0x4E, 0x51, 0x51, 0x51,
+  0x52, 0x51, 0x51, 0x4F, 0x51, 0x52, 0x52, 0x52,
+  0x52, 0x53, 0x4F, 0x5E, 0x3C, 0x4F, 0x53, 0x53,
+  // 132
+  0x4C, 0x4C, 0x4B, 0x4C, 0x55, 0x4A, 0x49, 0x49,
+  0x4C, 0x4B, 0x4D, 0x4A, 0x49, 0x4B, 0x49, 0x4A,
+  0x4D, 0x4D, 0x4B, 0x4C, 0x4D, 0x54, 0x55, 0x4B,
+  0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4E, 0x54, 0x51,
+  0x4E, 0x4D, 0x4D, 0x4D, 0x4E, 0x4E, 0x4E, 0x4E,
+  0x51, 0x4E, 0x51, 0x4E, 0x52, 0x4F, 0x52, 0x52,
+  0x51, 0x52, 0x60, 0x47, 0x54, 0x60, 0x6A, 0x53,
+  0x53, 0x4F, 0x61, 0x65, 0x61, 0x6B, 0x60, 0x54,
+  // 133
+  0x49, 0x4A, 0x49, 0x49, 0x3E, 0x4D, 0x4B, 0x4C,
+  0x4A, 0x4A, 0x4B, 0x4D, 0x4C, 0x4D, 0x4B, 0x4D,
+  0x4C, 0x4C, 0x4B, 0x4D, 0x4D, 0x4D, 0x4E, 0x4E,
+  0x4E, 0x4D, 0x51, 0x56, 0x4E, 0x4E, 0x4E, 0x6A,
+  0x4E, 0x4E, 0x53, 0x60, 0x56, 0x51, 0x51, 0x6A,
+  0x51, 0x51, 0x54, 0x61, 0x60, 0x60, 0x60, 0x6A,
+  0x6E, 0x56, 0x5F, 0x65, 0x65, 0x62, 0x67, 0x61,
+  0x6D, 0x5E, 0x60, 0x62, 0x62, 0x62, 0x66, 0x62,
+  // 134
+  0x4C, 0x4C, 0x4C, 0x4C, 0x4E, 0x4F, 0x4E, 0x4B,
+  0x4C, 0x4C, 0x5E, 0x52, 0x52, 0x5E, 0x51, 0x60,
+  0x4E, 0x51, 0x5E, 0x4F, 0x4F, 0x5F, 0x4F, 0x60,
+  0x51, 0x52, 0x5E, 0x61, 0x60, 0x5F, 0x60, 0x66,
+  0x53, 0x4F, 0x5F, 0x67, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x62, 0x65, 0x63, 0x5F, 0x5F, 0x61,
+  0x60, 0x5F, 0x65, 0x62, 0x62, 0x6C, 0x5F, 0x6B,
+  0x65, 0x62, 0x62, 0x64, 0x61, 0x6D, 0x6F, 0x6D,
+  // 135
+  0x52, 0x65, 0x61, 0x6A, 0x6D, 0x6C, 0xB6, 0xB5,
+  0x54, 0x65, 0x66, 0x66, 0x6B, 0x6B, 0xB8, 0xB8,
+  0x53, 0x63, 0x6C, 0x6C, 0x6E, 0x6B, 0x5E, 0xB8,
+  0x6C, 0x6B, 0x6C, 0x6B, 0x6B, 0x72, 0xE8, 0xBB,
+  0x71, 0x67, 0x6C, 0x61, 0x5F, 0x9D, 0xBC, 0xB8,
+  0x71, 0x6C, 0x74, 0x6C, 0x71, 0x70, 0x76, 0xB5,
+  0x71, 0x6E, 0x73, 0x74, 0x75, 0x6F, 0xB5, 0xB9,
+  0x71, 0x66, 0x74, 0x74, 0xDA, 0xE8, 0xE8, 0x9A,
+  // 136
+  0xB4, 0x99, 0x94, 0x9B, 0x9A, 0x98, 0x92, 0xB3,
+  0xB5, 0xB7, 0x9B, 0x94, 0x9A, 0x97, 0x92, 0x92,
+  0xBB, 0xB3, 0xB7, 0x94, 0xB4, 0x97, 0x9C, 0x92,
+  0xB3, 0x97, 0x92, 0xBD, 0x9A, 0x98, 0x97, 0x98,
+  0x99, 0x94, 0x97, 0x9B, 0x9A, 0x94, 0x97, 0x9C,
+  0xB3, 0x97, 0x92, 0x99, 0xB8, 0x94, 0x97, 0x99,
+  0xBD, 0x99, 0x9C, 0xB3, 0xB5, 0x92, 0x9B, 0xB3,
+  0x9B, 0xB3, 0x94, 0xB5, 0x92, 0x98, 0x9C, 0xB3,
+  // 137
+  0x97, 0x9A, 0xB7, 0xBC, 0x57, 0x7E, 0x81, 0x82,
+  0x92, 0x9B, 0xB9, 0xB8, 0x7F, 0x7F, 0x85, 0x7E,
+  0x99, 0x97, 0xB7, 0x5C, 0x89, 0x7E, 0x82, 0x80,
+  0x99, 0x97, 0xBD, 0xBE, 0x95, 0x82, 0x85, 0x86,
+  0x97, 0x9A, 0xB0, 0xBC, 0xBD, 0x83, 0x89, 0x89,
+  0xB4, 0x9B, 0xB4, 0x80, 0xBD, 0x8A, 0x85, 0x80,
+  0xB3, 0x9B, 0xB8, 0xBE, 0x87, 0x5C, 0x82, 0x80,
+  0x9B, 0x98, 0x82, 0xBE, 0x86, 0x89, 0x80, 0x80,
+  // 138
+  0x85, 0x7D, 0x7F, 0x7C, 0x7E, 0x9A, 0xB4, 0x96,
+  0x7F, 0x80, 0x7C, 0x7C, 0x7C, 0xB8, 0xB6, 0xB8,
+  0x85, 0x7C, 0x59, 0x91, 0x9C, 0xB6, 0xB8, 0xB9,
+  0x89, 0x80, 0x7C, 0x7C, 0x7E, 0x83, 0xB8, 0xB8,
+  0x85, 0x86, 0x59, 0x7F, 0x7F, 0x98, 0xB8, 0xB4,
+  0x85, 0x7E, 0x7E, 0x82, 0x8A, 0x8A, 0xB6, 0xB9,
+  0x86, 0x86, 0x7F, 0x85, 0x85, 0xBE, 0xB8, 0xB9,
+  0x80, 0x86, 0x82, 0x85, 0x82, 0x85, 0xB6, 0xB9,
+  // 139
+  0x8C, 0x8B, 0x8B, 0x8C, 0x8C, 0x86, 0x8A, 0x8A,
+  0x96, 0x95, 0x8B, 0x8B, 0x8C, 0x8A, 0x8A, 0x8C,
+  0x91, 0x91, 0x8C, 0x8C, 0x96, 0x84, 0x95, 0x8C,
+  0xBE, 0x95, 0x8C, 0x95, 0x8C, 0x83, 0x96, 0x8C,
+  0xB3, 0xBB, 0x8C, 0x95, 0x8C, 0x5C, 0x8A, 0x95,
+  0xB8, 0xBD, 0xBB, 0x91, 0x8C, 0x5C, 0x95, 0x8C,
+  0xB9, 0x98, 0x91, 0x96, 0x96, 0x5C, 0x8C, 0x95,
+  0xB9, 0x92, 0x99, 0x92, 0x91, 0x83, 0x95, 0x96,
+  // 140
+  0xBC, 0xB6, 0xB9, 0xB9, 0xB8, 0xB7, 0xB7, 0x92,
+  0x95, 0xB8, 0xBA, 0xB6, 0xBC, 0xBD, 0xB5, 0xB7,
+  0x84, 0xBA, 0xB9, 0xBD, 0xBA, 0xBD, 0xBC, 0xB4,
+  0xBB, 0xBA, 0xB9, 0xBC, 0xB9, 0xB8, 0xB6, 0xBA,
+  0x95, 0xBA, 0xBD, 0xBC, 0xBA, 0xB9, 0xB8, 0xB0,
+  0x81, 0x83, 0x5C, 0xB6, 0xB4, 0xBA, 0x9A, 0xB7,
+  0x7F, 0x58, 0x84, 0xBD, 0xB9, 0xBA, 0xBB, 0xBC,
+  0x87, 0x58, 0xB4, 0x9C, 0x94, 0x9B, 0xB6, 0x97,
+  // 141
+  0x95, 0x8B, 0x96, 0x9B, 0x95, 0x8C, 0x96, 0x98,
+  0xB7, 0x95, 0x98, 0xB7, 0x9C, 0xB7, 0x9B, 0xBD,
+  0xBC, 0x8E, 0x94, 0xB5, 0xB7, 0xB4, 0xBB, 0xBA,
+  0xB9, 0xBA, 0x92, 0xB6, 0xB9, 0xB8, 0xB4, 0xBC,
+  0xBC, 0xB8, 0xB7, 0xBA, 0xBC, 0xBB, 0xBC, 0xB3,
+  0xB9, 0xBC, 0xB0, 0xBC, 0x9A, 0xB5, 0xBD, 0xB4,
+  0xBA, 0xBC, 0x92, 0xB9, 0xB8, 0xBC, 0xBD, 0xBA,
+  0x88, 0xBE, 0x92, 0x9C, 0x92, 0xBE, 0xBE, 0xBA,
+  // 142
+  0x8C, 0xBC, 0xB8, 0xB7, 0xB9, 0x9A, 0xB8, 0x92,
+  0xB8, 0xB8, 0xB5, 0xBC, 0xB4, 0xB8, 0xB7, 0x9A,
+  0xBC, 0xB5, 0xB6, 0xB7, 0x9A, 0xB8, 0x9B, 0xB3,
+  0xB9, 0xBC, 0xB3, 0xB7, 0xBC, 0xB8, 0xB4, 0x97,
+  0xBA, 0xB8, 0xB7, 0xB7, 0xB5, 0xB9, 0xB8, 0x99,
+  0xBC, 0xB9, 0xB9, 0xBC, 0xB8, 0xB8, 0xB4, 0xB9,
+  0xBC, 0xBC, 0xBC, 0xBD, 0x9A, 0xB9, 0xB3, 0x9A,
+  0xB7, 0xB8, 0xB6, 0xBC, 0xBD, 0xBA, 0xB5, 0xB8,
+  // 143
+  0x9B, 0x99, 0x97, 0x9B, 0x9A, 0xB0, 0xAF, 0xBC,
+  0x92, 0x91, 0x92, 0xB3, 0xB5, 0xB0, 0xB0, 0xB9,
+  0x97, 0xB3, 0x94, 0xB5, 0x99, 0xB0, 0xA8, 0xBC,
+  0x9B, 0xB3, 0xB5, 0xB4, 0x94, 0xB0, 0xB9, 0xB8,
+  0xB7, 0x94, 0x9A, 0x9B, 0xB4, 0xB5, 0xA8, 0xB9,
+  0x99, 0x97, 0x9B, 0xB3, 0xB5, 0xB0, 0xB6, 0xBC,
+  0x9A, 0x99, 0x99, 0xB4, 0xB4, 0xB5, 0xB9, 0xBC,
+  0x9B, 0x99, 0x9B, 0xB3, 0xB5, 0xB8, 0xB5, 0xBA,
+  // 144
+  0xB3, 0xB7, 0x9B, 0x9B, 0x98, 0x8B, 0x89, 0x89,
+  0xBC, 0xB9, 0xBC, 0xB3, 0x9B, 0x98, 0x8A, 0x87,
+  0xB9, 0xBC, 0xBA, 0xBD, 0x9B, 0x99, 0x98, 0x87,
+  0xB8, 0xBC, 0xB7, 0x9B, 0xB4, 0x98, 0x8B, 0x8A,
+  0xBC, 0xB8, 0xB4, 0xB4, 0x9C, 0x91, 0x8C, 0x8A,
+  0xB5, 0xB4, 0xB4, 0xB8, 0xB4, 0x91, 0x8A, 0x8B,
+  0xBC, 0xBA, 0xB9, 0xB9, 0xB9, 0xBD, 0x98, 0x88,
+  0xBA, 0xB4, 0xBC, 0xBC, 0xB3, 0x9B, 0x96, 0x91,
+  // 145
+  0x7F, 0x7E, 0x59, 0x59, 0x5B, 0x68, 0x66, 0x5E,
+  0x82, 0x8A, 0x7E, 0x7C, 0x7C, 0x5D, 0x6C, 0xA9,
+  0x8A, 0x87, 0x82, 0x7C, 0x7C, 0x75, 0x6C, 0xD7,
+  0x86, 0x8C, 0x86, 0x7E, 0x7E, 0x5D, 0x72, 0xA1,
+  0x8A, 0x8C, 0x86, 0x82, 0x82, 0x8D, 0x74, 0xA1,
+  0x95, 0x8C, 0x89, 0x85, 0x8D, 0x77, 0x77, 0xA1,
+  0x88, 0x95, 0x8C, 0x86, 0x8F, 0x7B, 0x7B, 0xA1,
+  0x86, 0x95, 0x8C, 0x80, 0x7E, 0x7E, 0xA1, 0x9F,
+  // 146
+  0x6B, 0x6B, 0x6B, 0x67, 0x6B, 0x67, 0x6B, 0x67,
+  0xA4, 0x6C, 0x6B, 0x67, 0x67, 0x6B, 0x66, 0x63,
+  0xA1, 0x6C, 0x69, 0x69, 0x6B, 0x67, 0x67, 0x67,
+  0xA1, 0x6C, 0x6A, 0x56, 0x6B, 0x67, 0x6B, 0x6B,
+  0x70, 0x78, 0x6D, 0x56, 0x6C, 0x6B, 0x67, 0x6B,
+  0x9F, 0x9E, 0x6D, 0x52, 0x6B, 0x6B, 0x66, 0x66,
+  0xA1, 0x9F, 0xDC, 0xAF, 0x72, 0x66, 0x67, 0x66,
+  0x9F, 0x78, 0x78, 0xAF, 0x75, 0x65, 0x5F, 0x62,
+  // 147
+  0x67, 0x66, 0x67, 0x62, 0x61, 0x61, 0x60, 0x60,
+  0x66, 0x67, 0x67, 0x67, 0x63, 0x66, 0x62, 0x66,
+  0x67, 0x67, 0x67, 0x62, 0x67, 0x62, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x62, 0x66, 0x62, 0x62,
+  0x67, 0x6B, 0x67, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x6B, 0x62, 0x67, 0x67, 0x61, 0x66, 0x67, 0x66,
+  0x6B, 0x62, 0x67, 0x67, 0x67, 0x67, 0x67, 0x62,
+  0x67, 0x67, 0x67, 0x67, 0x62, 0x67, 0x67, 0x62,
+  // 148
+  0x53, 0x53, 0x53, 0x53, 0x54, 0x54, 0x53, 0x54,
+  0x60, 0x6A, 0x6A, 0x5E, 0x54, 0x54, 0x53, 0x53,
+  0x6B, 0x5F, 0x65, 0x5F, 0x48, 0x6A, 0x4F, 0x54,
+  0x65, 0x64, 0x66, 0x67, 0x6C, 0x66, 0x54, 0x66,
+  0x62, 0x62, 0x62, 0x67, 0x67, 0x6B, 0x61, 0x64,
+  0x62, 0x62, 0x62, 0x66, 0x66, 0x64, 0x65, 0x66,
+  0x67, 0x67, 0x62, 0x62, 0x67, 0x62, 0x62, 0x62,
+  0x62, 0x67, 0x66, 0x62, 0x62, 0x62, 0x62, 0x62,
+  // 149
+  0x53, 0x53, 0x54, 0x53, 0x53, 0x53, 0x52, 0x54,
+  0x54, 0x53, 0x54, 0x53, 0x53, 0x53, 0x53, 0x54,
+  0x53, 0x4D, 0x53, 0x53, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x55, 0x4F, 0x54, 0x53, 0x51, 0x53, 0x53,
+  0x55, 0x61, 0x5E, 0x60, 0x6A, 0x6A, 0x54, 0x54,
+  0x5F, 0x6B, 0x6A, 0x65, 0x6A, 0x6C, 0x62, 0x54,
+  0x62, 0x62, 0x64, 0x60, 0x66, 0x67, 0x67, 0x6C,
+  0x62, 0x62, 0x62, 0x62, 0x61, 0x67, 0x6B, 0x62,
+  // 150
+  0x54, 0x53, 0x53, 0x54, 0x53, 0x53, 0x53, 0x52,
+  0x53, 0x53, 0x54, 0x54, 0x54, 0x53, 0x54, 0x53,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x53, 0x4F,
+  0x53, 0x54, 0x53, 0x54, 0x53, 0x4F, 0x6A, 0x68,
+  0x54, 0x53, 0x53, 0x6D, 0x6A, 0x5E, 0x66, 0x66,
+  0x54, 0x54, 0x6B, 0x65, 0x68, 0x61, 0x66, 0x66,
+  0x6C, 0x6C, 0x6C, 0x67, 0x67, 0x62, 0x62, 0x67,
+  0x6B, 0x67, 0x67, 0x67, 0x66, 0x67, 0x62, 0x67,
+  // 151
+  0x53, 0x53, 0x66, 0x64, 0x61, 0x60, 0x60, 0x5F,
+  0x54, 0x60, 0x5F, 0x64, 0x61, 0x61, 0x61, 0x65,
+  0x5E, 0x5F, 0x60, 0x62, 0x62, 0x62, 0x5F, 0x62,
+  0x60, 0x64, 0x60, 0x62, 0x62, 0x66, 0x67, 0x62,
+  0x6B, 0x66, 0x6A, 0x67, 0x62, 0x62, 0x67, 0x67,
+  0x69, 0x68, 0x69, 0x67, 0x66, 0x67, 0x67, 0x66,
+  0x67, 0x67, 0x67, 0x67, 0x62, 0x67, 0x67, 0x67,
+  0x67, 0x62, 0x67, 0x67, 0x6B, 0x67, 0x67, 0x67,
+  // 152
+  0x66, 0x60, 0x62, 0x62, 0x67, 0x66, 0x61, 0x65,
+  0x61, 0x65, 0x62, 0x67, 0x67, 0x67, 0x69, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x62, 0x67,
+  0x6B, 0x67, 0x67, 0x67, 0x67, 0x66, 0x67, 0x67,
+  0x67, 0x67, 0x67, 0x6B, 0x6B, 0x67, 0x62, 0x67,
+  0x67, 0x67, 0x67, 0x66, 0x66, 0x67, 0x6B, 0x67,
+  0x67, 0x67, 0x67, 0x6B, 0x6B, 0x67, 0x67, 0x67,
+  0x66, 0x66, 0x6B, 0x67, 0x67, 0x6B, 0x67, 0x68,
+  // 153
+  0x6D, 0x62, 0x62, 0x62, 0x62, 0x67, 0x67, 0x62,
+  0x5F, 0x64, 0x67, 0x67, 0x66, 0x62, 0x62, 0x62,
+  0x62, 0x67, 0x62, 0x67, 0x67, 0x62, 0x66, 0x67,
+  0x67, 0x67, 0x67, 0x67, 0x67, 0x61, 0x66, 0x5F,
+  0x67, 0x62, 0x67, 0x6B, 0x67, 0x61, 0x61, 0x62,
+  0x67, 0x6B, 0x67, 0x6B, 0x6B, 0x6C, 0x71, 0x75,
+  0x67, 0x69, 0x69, 0x66, 0x6B, 0x61, 0x71, 0x75,
+  0x67, 0x67, 0x6B, 0x68, 0x6C, 0x72, 0x73, 0x75,
+  // 154
+  0x62, 0x62, 0x62, 0x62, 0x63, 0x71, 0x6E, 0x71,
+  0x62, 0x5F, 0x66, 0x62, 0x6F, 0x74, 0x71, 0x71,
+  0x62, 0x66, 0x61, 0x68, 0x67, 0x72, 0x6F, 0x71,
+  0x61, 0x66, 0x6C, 0x6B, 0x70, 0x72, 0x6F, 0x72,
+  0x70, 0x72, 0x72, 0x74, 0x71, 0x73, 0x72, 0x72,
+  0x72, 0x74, 0x71, 0x75, 0x74, 0x74, 0x72, 0x75,
+  0x73, 0x73, 0x73, 0x75, 0x73, 0x74, 0x72, 0x74,
+  0x73, 0x75, 0x74, 0x74, 0x75, 0x72, 0x72, 0x75,
+  // 155
+  0x71, 0x6E, 0x74, 0x74, 0x6E, 0x78, 0xB8, 0xBB,
+  0x71, 0x73, 0x75, 0x71, 0xD7, 0xB9, 0xB9, 0xB3,
+  0x72, 0x73, 0x72, 0x6D, 0xB6, 0xB8, 0xB9, 0xB9,
+  0x73, 0x74, 0x73, 0x73, 0x71, 0x70, 0xB9, 0xB4,
+  0x74, 0x74, 0x75, 0xA2, 0xCE, 0xDC, 0xBC, 0xB3,
+  0x77, 0x75, 0x74, 0x76, 0xB9, 0xB9, 0xBC, 0xB9,
+  0x7A, 0x73, 0x75, 0x70, 0x9D, 0xBA, 0xB3, 0xB4,
+  0x79, 0x74, 0x76, 0x76, 0x78, 0xB1, 0xBC, 0xB0,
+  // 156
+  0xB3, 0xB7, 0x97, 0xB4, 0xB5, 0x94, 0xB3, 0x99,
+  0x99, 0xB7, 0x94, 0x92, 0xB5, 0x99, 0xB4, 0xB7,
+  0xB7, 0x98, 0x9B, 0x9C, 0xBD, 0xB0, 0xBB, 0xB3,
+  0xB4, 0x94, 0x9B, 0x92, 0xB4, 0xB0, 0x99, 0xB8,
+  0x9A, 0x9B, 0x97, 0xB4, 0xB8, 0xB8, 0xB8, 0xB8,
+  0x99, 0xB3, 0x97, 0x97, 0xBD, 0xB8, 0xB8, 0xB6,
+  0xB7, 0x9C, 0x99, 0x97, 0xB6, 0xB8, 0xB8, 0xB8,
+  0xB8, 0xB4, 0x98, 0x92, 0x97, 0xBD, 0xB9, 0xB9,
+  // 157
+  0xB5, 0xB7, 0x85, 0x86, 0x85, 0x85, 0x85, 0x80,
+  0x9C, 0x88, 0x89, 0x85, 0x85, 0x8A, 0x95, 0x89,
+  0xBD, 0x95, 0x87, 0x89, 0x89, 0x8A, 0x95, 0x8B,
+  0xB6, 0xBD, 0x91, 0x95, 0x8A, 0x82, 0x85, 0x95,
+  0xB9, 0xB8, 0x99, 0x95, 0x95, 0x95, 0x8C, 0x87,
+  0xB9, 0xB9, 0xBC, 0x96, 0x96, 0x96, 0x8C, 0x86,
+  0xBC, 0x91, 0x8B, 0x8B, 0x8C, 0x96, 0x95, 0x96,
+  0xB9, 0x9B, 0x91, 0x96, 0x95, 0x96, 0x96, 0x98,
+  // 158
+  0x80, 0x89, 0x82, 0x82, 0x8B, 0x87, 0xB7, 0xB6,
+  0x8A, 0x80, 0x7F, 0x7F, 0x7E, 0x89, 0xBD, 0xB6,
+  0x8C, 0x7F, 0x7F, 0x89, 0x85, 0x89, 0xBB, 0xB8,
+  0x83, 0x8A, 0x7E, 0x7F, 0x85, 0x86, 0xB7, 0xB8,
+  0x83, 0x95, 0x86, 0x86, 0x86, 0x8B, 0x91, 0x95,
+  0x83, 0x95, 0x8C, 0x81, 0x89, 0x8C, 0x91, 0x95,
+  0x81, 0x86, 0x8A, 0x8A, 0x85, 0x87, 0x96, 0x91,
+  0x5C, 0x89, 0x87, 0x89, 0x86, 0x8A, 0xBB, 0xB8,
+  // 159
+  0xB8, 0xBD, 0x91, 0x95, 0x96, 0x5D, 0x91, 0x95,
+  0xB8, 0x91, 0x96, 0x91, 0x91, 0x5D, 0x96, 0x95,
+  0xB6, 0xBD, 0x95, 0x91, 0x98, 0x83, 0x97, 0x95,
+  0xB4, 0xB9, 0x9C, 0x96, 0x98, 0x5D, 0x9C, 0x98,
+  0xB7, 0xBD, 0xB8, 0x98, 0xBD, 0x5D, 0x99, 0x99,
+  0xBD, 0xB8, 0xB6, 0xB8, 0xBA, 0x5A, 0xB8, 0xB9,
+  0xB9, 0xB3, 0xBD, 0xBC, 0xBB, 0x5A, 0xB8, 0xBD,
+  0xBD, 0xBC, 0xB8, 0xB9, 0xB7, 0x5A, 0xBD, 0x94,
+  // 160
+  0x7F, 0x80, 0x5C, 0x87, 0x92, 0x8B, 0x9C, 0xB3,
+  0x7D, 0x7C, 0x7D, 0x58, 0x86, 0x80, 0x7E, 0x59,
+  0x7D, 0x7D, 0x7D, 0x80, 0x7D, 0x82, 0x81, 0x7D,
+  0x82, 0x85, 0x89, 0x86, 0x80, 0x80, 0x88, 0x80,
+  0x7D, 0x83, 0x7F, 0x82, 0x80, 0x8E, 0x86, 0x7F,
+  0x7D, 0x83, 0x80, 0x8A, 0x7E, 0x58, 0x7D, 0x7D,
+  0x88, 0x88, 0x82, 0x80, 0xAF, 0x7D, 0x59, 0x7D,
+  0x8E, 0x90, 0x88, 0x86, 0xAF, 0x80, 0x8A, 0x80,
+  // 161
+  0x7E, 0x58, 0xBE, 0x8E, 0xBE, 0x81, 0x87, 0xBD,
+  0x59, 0x7E, 0x5C, 0x58, 0x7D, 0x7D, 0x58, 0x82,
+  0x58, 0x58, 0x57, 0x58, 0x89, 0x58, 0x58, 0x80,
+  0x80, 0x7C, 0x7D, 0x80, 0x58, 0x80, 0x7D, 0x59,
+  0x85, 0x80, 0x7D, 0x80, 0x7D, 0x7D, 0x80, 0x7D,
+  0x59, 0x96, 0x7E, 0x85, 0x87, 0x80, 0x80, 0x85,
+  0x7D, 0x7D, 0x96, 0x82, 0x8C, 0x80, 0x85, 0x80,
+  0x7D, 0x8A, 0xB0, 0x92, 0x80, 0x7F, 0x88, 0x7D,
+  // 162
+  0x59, 0xBE, 0xB5, 0xBC, 0xB5, 0xBA, 0xB4, 0xB8,
+  0x58, 0x5C, 0x57, 0x9C, 0xBD, 0x5C, 0x9C, 0xBA,
+  0x80, 0x58, 0x57, 0xBE, 0x7D, 0x82, 0x59, 0x57,
+  0x59, 0x58, 0x7D, 0x59, 0x7D, 0x7F, 0x7D, 0x59,
+  0x7D, 0x59, 0x58, 0x7D, 0x7D, 0x7F, 0x7C, 0x59,
+  0x7F, 0x59, 0x7D, 0x58, 0x58, 0x7D, 0x7D, 0x59,
+  0x81, 0x7D, 0x59, 0x80, 0x7D, 0x7F, 0x80, 0x7D,
+  0x7D, 0x82, 0x7E, 0x87, 0x7F, 0x7F, 0x7D, 0x7F,
+  // 163
+  0x9B, 0xB8, 0xB8, 0xB4, 0x9B, 0xB4, 0xBA, 0xBA,
+  0xBC, 0xB3, 0xB8, 0xB5, 0xB3, 0xB0, 0xBC, 0xBA,
+  0xBD, 0xBE, 0xBB, 0xBC, 0x9A, 0xB0, 0xBA, 0xBA,
+  0x7D, 0x92, 0x92, 0x92, 0x9A, 0xB5, 0xB0, 0xB6,
+  0x58, 0x59, 0x86, 0x81, 0x91, 0x92, 0x8E, 0xB3,
+  0x58, 0x58, 0x7D, 0x7D, 0x82, 0x88, 0x91, 0x8E,
+  0x7D, 0x7D, 0x58, 0x58, 0x58, 0x81, 0x57, 0x7E,
+  0x7D, 0x58, 0x59, 0x58, 0x59, 0x82, 0x7D, 0x80,
+  // 164
+  0xBA, 0xB9, 0xB9, 0xB6, 0x9B, 0x98, 0x8A, 0x8A,
+  0xBC, 0xBC, 0xB9, 0x9B, 0xB4, 0x9B, 0x8B, 0x8B,
+  0xBA, 0xBA, 0xB3, 0x9C, 0x96, 0x98, 0x96, 0x8B,
+  0xB9, 0xBA, 0x9B, 0x98, 0x9C, 0x9C, 0x98, 0x88,
+  0xB9, 0xB8, 0xB8, 0x9C, 0x9B, 0x9C, 0x9B, 0x84,
+  0x9C, 0xBC, 0xB0, 0xB3, 0xB4, 0x9C, 0xB6, 0x84,
+  0x57, 0x91, 0xBD, 0xBD, 0xB4, 0xBD, 0xB6, 0x84,
+  0x80, 0x86, 0x96, 0xBE, 0x91, 0xBD, 0x8E, 0x88,
+  // 165
+  0x89, 0x8B, 0x8A, 0x59, 0x7F, 0x7D, 0x8F, 0xA1,
+  0x95, 0x8A, 0x82, 0x89, 0x7D, 0x80, 0x8F, 0xA1,
+  0x8C, 0x8B, 0x8C, 0x87, 0x80, 0x5D, 0xA1, 0x9F,
+  0x96, 0x88, 0x95, 0x8B, 0x86, 0x87, 0x93, 0xA1,
+  0x96, 0x8C, 0x95, 0x87, 0x8D, 0xA2, 0xA1, 0xA4,
+  0xB3, 0x98, 0x91, 0x8A, 0x8F, 0xA1, 0x9F, 0xA4,
+  0xB7, 0x98, 0x91, 0x8B, 0xA1, 0xA2, 0xA2, 0xA4,
+  0xBC, 0xBC, 0x91, 0x88, 0xA4, 0xA1, 0x8F, 0x5C,
+  // 166
+  0x7B, 0x77, 0xB1, 0xA9, 0x78, 0x6A, 0x71, 0x62,
+  0x9F, 0x7A, 0xAA, 0xAF, 0x77, 0x6F, 0x75, 0x75,
+  0x9F, 0xAB, 0xAF, 0xA9, 0x9F, 0x75, 0x75, 0x71,
+  0xA1, 0xA1, 0xB2, 0xA9, 0x9D, 0x75, 0x75, 0x74,
+  0xA1, 0xA4, 0xB1, 0xA9, 0x9F, 0x75, 0x75, 0x73,
+  0x9D, 0xB1, 0xA9, 0xA4, 0xA1, 0x71, 0x75, 0x75,
+  0x9E, 0xA9, 0xAA, 0xA1, 0xA1, 0x77, 0x75, 0x75,
+  0xA2, 0xA9, 0xA9, 0xA4, 0xA1, 0x9F, 0x76, 0x76,
+  // 167
+  0x67, 0x67, 0x67, 0x66, 0x67, 0x62, 0x66, 0x62,
+  0x70, 0x6D, 0x66, 0x6B, 0x61, 0x62, 0x67, 0x66,
+  0x70, 0x71, 0x5F, 0x67, 0x66, 0x62, 0x67, 0x67,
+  0x73, 0x71, 0x71, 0x68, 0x67, 0x63, 0x62, 0x68,
+  0x73, 0x72, 0x73, 0x6D, 0x6B, 0x5F, 0x6D, 0x67,
+  0x7B, 0x72, 0x73, 0x73, 0x6E, 0x5F, 0x71, 0x67,
+  0x9D, 0x9E, 0x73, 0x74, 0x73, 0x73, 0x72, 0x71,
+  0x9D, 0x7B, 0x75, 0x74, 0x74, 0x73, 0x73, 0x72,
+  // 168
+  0x66, 0x62, 0x67, 0x62, 0x62, 0x62, 0x67, 0x62,
+  0x66, 0x62, 0x62, 0x66, 0x66, 0x66, 0x62, 0x5F,
+  0x62, 0x62, 0x67, 0x62, 0x62, 0x66, 0x62, 0x62,
+  0x67, 0x62, 0x62, 0x66, 0x62, 0x66, 0x62, 0x62,
+  0x67, 0x62, 0x62, 0x62, 0x62, 0x61, 0x67, 0x62,
+  0x61, 0x62, 0x62, 0x65, 0x62, 0x62, 0x5F, 0x5F,
+  0x6B, 0x73, 0x65, 0x65, 0x62, 0x62, 0x62, 0x5F,
+  0x6C, 0x71, 0x5F, 0x5F, 0x62, 0x62, 0x68, 0x62,
+  // 169
+  0x62, 0x62, 0x62, 0x5F, 0x61, 0x62, 0x67, 0x5F,
+  0x62, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x66,
+  0x62, 0x62, 0x5F, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x5F, 0x62, 0x62, 0x5F, 0x66, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x5F, 0x67, 0x62, 0x67, 0x61,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5F, 0x62,
+  0x60, 0x65, 0x62, 0x62, 0x67, 0x62, 0x5F, 0x62,
+  0x62, 0x65, 0x62, 0x66, 0x62, 0x62, 0x62, 0x62,
+  // 170
+  0x67, 0x67, 0x67, 0x67, 0x66, 0x67, 0x67, 0x67,
+  0x62, 0x67, 0x67, 0x67, 0x67, 0x67, 0x66, 0x67,
+  0x62, 0x5F, 0x62, 0x67, 0x67, 0x62, 0x62, 0x6B,
+  0x62, 0x67, 0x62, 0x62, 0x62, 0x66, 0x66, 0x62,
+  0x62, 0x62, 0x67, 0x62, 0x67, 0x62, 0x67, 0x67,
+  0x62, 0x62, 0x5F, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6B, 0x67,
+  0x62, 0x62, 0x67, 0x67, 0x65, 0x65, 0x67, 0x67,
+  // 171
+  0x67, 0x67, 0x62, 0x67, 0x62, 0x67, 0x67, 0x67,
+  0x62, 0x67, 0x66, 0x62, 0x62, 0x62, 0x67, 0x67,
+  0x62, 0x67, 0x62, 0x62, 0x62, 0x62, 0x67, 0x67,
+  0x66, 0x62, 0x5F, 0x62, 0x62, 0x66, 0x62, 0x62,
+  0x67, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6B, 0x66,
+  0x66, 0x62, 0x63, 0x63, 0x5F, 0x71, 0x72, 0x6C,
+  0x62, 0x67, 0x62, 0x6C, 0x75, 0x71, 0x73, 0x75,
+  0x62, 0x67, 0x66, 0x73, 0x73, 0x73, 0x72, 0x73,
+  // 172
+  0x6B, 0x67, 0x67, 0x67, 0x62, 0x67, 0x67, 0x6B,
+  0x67, 0x66, 0x67, 0x68, 0x61, 0x75, 0x67, 0x73,
+  0x67, 0x5F, 0x67, 0x67, 0x71, 0x75, 0x6B, 0x72,
+  0x67, 0x71, 0x6C, 0x6B, 0x6B, 0x75, 0x74, 0x75,
+  0x6B, 0x72, 0x6C, 0x6C, 0x75, 0x73, 0x70, 0x75,
+  0x6B, 0x75, 0x73, 0x74, 0x75, 0x74, 0x6E, 0x73,
+  0x71, 0x74, 0x75, 0x75, 0x75, 0x74, 0x71, 0x74,
+  0x73, 0x74, 0x75, 0x75, 0x75, 0x74, 0x75, 0x73,
+  // 173
+  0x67, 0x62, 0x6C, 0x6B, 0x6F, 0x71, 0x75, 0x72,
+  0x6B, 0x71, 0x74, 0x66, 0x75, 0x75, 0x74, 0x74,
+  0x5F, 0x73, 0x74, 0x74, 0x75, 0x75, 0x74, 0x72,
+  0x71, 0x72, 0x75, 0x74, 0x74, 0x74, 0x75, 0x79,
+  0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x77, 0x79,
+  0x74, 0x74, 0x75, 0x79, 0x75, 0x77, 0x79, 0x79,
+  0x75, 0x74, 0x75, 0x79, 0x75, 0x79, 0x79, 0x79,
+  0x74, 0x77, 0x75, 0x79, 0x75, 0x79, 0x79, 0x79,
+  // 174
+  0x72, 0x6F, 0x73, 0x74, 0x77, 0x79, 0x73, 0x79,
+  0x75, 0x76, 0x79, 0x77, 0x79, 0x79, 0x75, 0x79,
+  0x75, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x79,
+  0x76, 0x79, 0x79, 0x79, 0x7A, 0x79, 0x7A, 0x79,
+  0x79, 0x7A, 0x7A, 0x7A, 0x7B, 0x7A, 0x7A, 0x7A,
+  0x79, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7A,
+  0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B,
+  0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 0x7A, 0x7A, 0x79,
+  // 175
+  0x79, 0x7A, 0x76, 0xB1, 0xB6, 0xB6, 0xB8, 0xBC,
+  0x79, 0x7A, 0x7B, 0x9D, 0xBA, 0xBC, 0xBC, 0xBC,
+  0x7A, 0x9D, 0x77, 0x78, 0xBA, 0xBA, 0xBC, 0xBD,
+  0x7A, 0x7A, 0x7B, 0xB9, 0xBC, 0xB8, 0xB3, 0x9A,
+  0x79, 0x7B, 0x9D, 0x9E, 0xE6, 0xBC, 0xBC, 0xBA,
+  0x79, 0x7B, 0x7B, 0xB6, 0xBA, 0xBC, 0xB4, 0xBC,
+  0x7B, 0x7B, 0x9D, 0xB9, 0xB9, 0xBA, 0xB6, 0xBC,
+  0x78, 0x9D, 0x9E, 0x9D, 0xE8, 0xBE, 0x8F, 0xBE,
+  // 176
+  0xB8, 0xB4, 0x9B, 0x94, 0xB4, 0xBA, 0xB9, 0xB9,
+  0xB5, 0x99, 0xB7, 0xBD, 0x98, 0xBC, 0xB6, 0xB9,
+  0xB3, 0x99, 0x98, 0x9C, 0x92, 0xBE, 0xBE, 0xBE,
+  0xB8, 0xBC, 0x97, 0x98, 0x9B, 0x5D, 0x58, 0x5C,
+  0xB9, 0xB9, 0xB4, 0x97, 0x98, 0x81, 0x7F, 0x59,
+  0xB8, 0x8B, 0x9C, 0xB3, 0x89, 0x89, 0x82, 0x80,
+  0x8D, 0x87, 0x5C, 0x5C, 0x8A, 0x81, 0x80, 0x7D,
+  0x91, 0x86, 0x86, 0x59, 0x89, 0x81, 0x89, 0x7D,
+  // 177
+  0xBC, 0xBC, 0x9C, 0x8B, 0xBE, 0x95, 0x96, 0x96,
+  0xB9, 0xB9, 0xBC, 0xBA, 0xB7, 0x98, 0x91, 0x96,
+  0xB9, 0xB9, 0xB9, 0xBC, 0xB8, 0xBE, 0x91, 0x97,
+  0xBA, 0xBC, 0xBC, 0xB8, 0x9A, 0x9B, 0xBC, 0xB8,
+  0x8E, 0xBD, 0xB4, 0x92, 0x92, 0xB4, 0xB5, 0xBD,
+  0x59, 0x82, 0x8E, 0x8E, 0x88, 0x8E, 0x88, 0x9C,
+  0x7F, 0x87, 0x83, 0x5C, 0x83, 0x81, 0x83, 0x89,
+  0x86, 0x89, 0x86, 0x82, 0x57, 0x82, 0x7D, 0x7D,
+  // 178
+  0x83, 0x87, 0x8A, 0x86, 0x8A, 0x8C, 0xB3, 0xBD,
+  0x5D, 0xBD, 0x88, 0x96, 0x96, 0x96, 0xB7, 0xB6,
+  0x5D, 0xB8, 0x5D, 0x92, 0x98, 0x92, 0xB9, 0xBE,
+  0x5D, 0xBC, 0x84, 0xBC, 0xB3, 0x83, 0x81, 0x92,
+  0x5D, 0xBB, 0x5D, 0x96, 0x8E, 0x80, 0x58, 0x83,
+  0x5D, 0xBD, 0x7E, 0x7E, 0x82, 0x7F, 0x7D, 0x80,
+  0x57, 0x7E, 0x7D, 0x7D, 0x57, 0x80, 0x7D, 0x7D,
+  0x58, 0x59, 0x80, 0x7D, 0x58, 0x57, 0x57, 0x58,
+  // 179
+  0xB7, 0xB9, 0xBA, 0xB3, 0xB7, 0x5A, 0x92, 0x8E,
+  0xB6, 0x8E, 0xBA, 0x9B, 0xBA, 0x5D, 0xB0, 0x8D,
+  0xB3, 0x95, 0x8E, 0xB6, 0xBA, 0x5D, 0x96, 0x91,
+  0x9A, 0x58, 0xB5, 0x7E, 0x91, 0x87, 0x81, 0x7F,
+  0x58, 0x58, 0x58, 0x57, 0x81, 0x81, 0x81, 0x7F,
+  0x58, 0x58, 0x58, 0x7D, 0x59, 0x58, 0x58, 0x80,
+  0x7C, 0x7C, 0x80, 0x7F, 0x7C, 0x58, 0x57, 0x80,
+  0x7D, 0x82, 0x82, 0x82, 0x87, 0x7D, 0x7D, 0x58,
+  // 180
+  0x92, 0x93, 0xB0, 0x81, 0xAF, 0x87, 0x86, 0x87,
+  0x83, 0xAF, 0x90, 0x8E, 0xAF, 0x8C, 0x87, 0x92,
+  0x8E, 0xAF, 0x92, 0x93, 0xAF, 0x92, 0x92, 0x8D,
+  0xB0, 0xA8, 0xAF, 0xAF, 0xAF, 0xB1, 0x90, 0xAF,
+  0xA8, 0x8D, 0x8E, 0x5D, 0xA8, 0x90, 0xB2, 0xAF,
+  0xA8, 0x90, 0x92, 0x84, 0x93, 0xA8, 0xAF, 0x5D,
+  0x90, 0x8D, 0x5D, 0x84, 0x90, 0x93, 0x5D, 0x5A,
+  0x8F, 0x84, 0x5A, 0x5C, 0x5A, 0x5B, 0x8E, 0x5D,
+  // 181
+  0x80, 0x7F, 0x89, 0x93, 0x81, 0x87, 0x92, 0x8B,
+  0x88, 0x86, 0x96, 0x93, 0x88, 0x87, 0x92, 0xA8,
+  0x88, 0x88, 0x98, 0xA8, 0x93, 0x8E, 0xB0, 0xA8,
+  0x8D, 0x90, 0x93, 0xA8, 0xAF, 0x90, 0xA8, 0xAF,
+  0xAF, 0xA8, 0xAF, 0x8F, 0xA8, 0xAF, 0xAF, 0xAF,
+  0xA8, 0x93, 0x90, 0x90, 0x9C, 0x84, 0x84, 0x8D,
+  0x5D, 0xA8, 0xA8, 0x8F, 0xA8, 0xA8, 0x93, 0x5D,
+  0x5C, 0x5C, 0x8D, 0x84, 0x5B, 0x90, 0xA8, 0x84,
+  // 182
+  0x87, 0x86, 0x86, 0x86, 0x91, 0x87, 0x85, 0x7F,
+  0x93, 0x8E, 0x91, 0x91, 0x88, 0x8B, 0x81, 0x82,
+  0x93, 0x8D, 0xA8, 0x8E, 0x8E, 0x93, 0x83, 0x98,
+  0x8F, 0xB0, 0x93, 0x90, 0x91, 0x8E, 0xAF, 0xA8,
+  0x93, 0xAF, 0xAF, 0xA8, 0xAF, 0x8D, 0x8F, 0xA8,
+  0x8E, 0xAF, 0xB0, 0x90, 0x8F, 0x93, 0x84, 0x5C,
+  0x5D, 0x5D, 0x83, 0x8E, 0x5D, 0xAF, 0xAF, 0x5D,
+  0x84, 0x5D, 0x5D, 0x83, 0x5D, 0x84, 0x8D, 0x92,
+  // 183
+  0x7F, 0x7E, 0x89, 0x7D, 0x7D, 0x7D, 0x58, 0x7F,
+  0x89, 0x87, 0x82, 0x7D, 0x7D, 0x80, 0x7D, 0x58,
+  0x83, 0x88, 0x87, 0x89, 0x7E, 0x59, 0x85, 0x89,
+  0x90, 0x93, 0x88, 0x92, 0x88, 0x85, 0x59, 0x59,
+  0x8F, 0x93, 0x8E, 0x93, 0x8B, 0x89, 0x88, 0x96,
+  0x84, 0xA8, 0x8D, 0xAF, 0x90, 0x88, 0x8F, 0x90,
+  0x5A, 0x5A, 0x5A, 0x90, 0x5A, 0x90, 0x93, 0x90,
+  0x84, 0x5D, 0x5A, 0x5A, 0x5A, 0x5B, 0x8D, 0x5D,
+  // 184
+  0x7D, 0x58, 0x7D, 0x86, 0x87, 0x88, 0x82, 0x87,
+  0x7F, 0x59, 0x58, 0x58, 0x58, 0x7E, 0x58, 0x59,
+  0x81, 0x57, 0x80, 0x86, 0x7D, 0x58, 0x58, 0x59,
+  0x88, 0x87, 0x88, 0x7D, 0x87, 0x88, 0x82, 0x7D,
+  0x83, 0x87, 0x87, 0x88, 0x88, 0x88, 0x8A, 0x8A,
+  0x93, 0x87, 0x8E, 0x8E, 0x8F, 0x8E, 0x8E, 0x8E,
+  0xAF, 0x93, 0x90, 0x93, 0x93, 0x93, 0x90, 0x90,
+  0x90, 0x92, 0x8F, 0x8F, 0x8D, 0x84, 0x5D, 0x8F,
+  // 185
+  0x88, 0x93, 0x58, 0x88, 0xA4, 0xA2, 0x92, 0x58,
+  0x59, 0x57, 0x80, 0x92, 0x84, 0x81, 0x7E, 0x7D,
+  0x58, 0x58, 0x82, 0x96, 0x86, 0x7E, 0x59, 0x7F,
+  0x80, 0x58, 0x7D, 0x82, 0x7F, 0x7D, 0x86, 0x87,
+  0x8A, 0x7F, 0x81, 0x81, 0x82, 0x95, 0x82, 0x86,
+  0x8B, 0x88, 0x88, 0x92, 0x83, 0x93, 0x8E, 0x88,
+  0x93, 0x90, 0x8E, 0x8D, 0x84, 0xA8, 0xB0, 0x92,
+  0x8D, 0x93, 0x8E, 0x5D, 0x5D, 0x5D, 0x90, 0x84,
+  // 186
+  0x7D, 0xAA, 0xA9, 0xB1, 0xA1, 0xA1, 0x76, 0x9D,
+  0x7D, 0x93, 0xA9, 0x9C, 0xA1, 0x5D, 0x9D, 0x9E,
+  0x7D, 0x80, 0x7E, 0x85, 0x7D, 0x59, 0x9F, 0xA1,
+  0x87, 0x7F, 0x7D, 0x82, 0x7D, 0x7D, 0x80, 0x58,
+  0x87, 0x88, 0x7C, 0x8A, 0x86, 0x7D, 0x7D, 0x7D,
+  0x8E, 0x88, 0x88, 0x88, 0x8E, 0x7D, 0x81, 0x59,
+  0x8E, 0x5A, 0x5A, 0x5A, 0x84, 0x88, 0x8E, 0x91,
+  0x5C, 0x5A, 0x83, 0x5A, 0x5A, 0x5D, 0x5C, 0x5D,
+  // 187
+  0x9D, 0x9D, 0x75, 0x74, 0x74, 0x74, 0x73, 0x72,
+  0x9D, 0x9D, 0x76, 0x75, 0x75, 0x74, 0x74, 0x73,
+  0x9E, 0x9D, 0x9D, 0x74, 0x75, 0x74, 0x73, 0x73,
+  0x9E, 0x9D, 0x9D, 0x78, 0x7B, 0x75, 0x73, 0x74,
+  0xA1, 0x5D, 0x9D, 0x9D, 0x9D, 0x7B, 0x77, 0x72,
+  0x82, 0x86, 0x58, 0x9E, 0x9E, 0x9D, 0x9D, 0x71,
+  0x8E, 0x8E, 0x88, 0x7E, 0x8F, 0x8F, 0x8D, 0x8F,
+  0x92, 0x83, 0x5D, 0x5A, 0x5B, 0x5C, 0x5A, 0x5D,
+  // 188
+  0x72, 0x72, 0x72, 0x71, 0x6F, 0x67, 0x6C, 0x67,
+  0x71, 0x72, 0x72, 0x72, 0x72, 0x6C, 0x71, 0x61,
+  0x73, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71,
+  0x73, 0x73, 0x72, 0x71, 0x71, 0x73, 0x73, 0x72,
+  0x73, 0x73, 0x71, 0x71, 0x73, 0x73, 0x71, 0x71,
+  0x73, 0x73, 0x73, 0x72, 0x73, 0x73, 0x72, 0x71,
+  0x9D, 0x6D, 0x5F, 0x60, 0x60, 0x60, 0x5E, 0x5E,
+  0x5D, 0x83, 0x8D, 0x55, 0x55, 0x55, 0x55, 0x55,
+  // 189
+  0x5F, 0x65, 0x60, 0x5F, 0x66, 0x65, 0x65, 0x65,
+  0x6E, 0x60, 0x61, 0x61, 0x65, 0x65, 0x65, 0x60,
+  0x6F, 0x61, 0x5F, 0x5E, 0x71, 0x72, 0x6C, 0x72,
+  0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x72, 0x71,
+  0x71, 0x71, 0x71, 0x71, 0x72, 0x71, 0x72, 0x73,
+  0x71, 0x71, 0x71, 0x71, 0x72, 0x71, 0x72, 0x72,
+  0x60, 0x5E, 0x60, 0x5E, 0x60, 0x60, 0x60, 0x60,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  // 190
+  0x65, 0x62, 0x67, 0x67, 0x61, 0x75, 0x6C, 0x67,
+  0x70, 0x67, 0x67, 0x71, 0x6E, 0x71, 0x66, 0x6D,
+  0x71, 0x5F, 0x6C, 0x72, 0x71, 0x71, 0x6E, 0x71,
+  0x71, 0x72, 0x72, 0x71, 0x71, 0x72, 0x71, 0x72,
+  0x71, 0x71, 0x71, 0x72, 0x71, 0x71, 0x71, 0x71,
+  0x72, 0x71, 0x72, 0x71, 0x72, 0x72, 0x72, 0x72,
+  0x60, 0x60, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  // 191
+  0x62, 0x72, 0x70, 0x73, 0x73, 0x73, 0x73, 0x74,
+  0x70, 0x71, 0x72, 0x73, 0x73, 0x73, 0x74, 0x73,
+  0x71, 0x72, 0x71, 0x73, 0x74, 0x74, 0x73, 0x75,
+  0x72, 0x72, 0x72, 0x72, 0x73, 0x74, 0x74, 0x74,
+  0x72, 0x72, 0x72, 0x73, 0x74, 0x76, 0x75, 0x75,
+  0x72, 0x72, 0x73, 0x73, 0x74, 0x79, 0x79, 0x7A,
+  0x60, 0x5E, 0x60, 0x60, 0x6A, 0x6D, 0x6A, 0x6C,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  // 192
+  0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x74, 0x79,
+  0x74, 0x74, 0x75, 0x77, 0x75, 0x75, 0x79, 0x79,
+  0x75, 0x75, 0x75, 0x79, 0x73, 0x79, 0x7A, 0x79,
+  0x75, 0x79, 0x79, 0x7A, 0x79, 0x79, 0x79, 0x79,
+  0x7B, 0x7A, 0x7B, 0x79, 0x79, 0x79, 0x79, 0x79,
+  0x7A, 0x79, 0x79, 0x7A, 0x7A, 0x79, 0x7A, 0x79,
+  0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  // 193
+  0x72, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7A,
+  0x77, 0x7A, 0x79, 0x79, 0x79, 0x7A, 0x7A, 0x79,
+  0x79, 0x7A, 0x7A, 0x7A, 0x7B, 0x79, 0x79, 0x7A,
+  0x7A, 0x79, 0x79, 0x7B, 0x7A, 0x7A, 0x7A, 0x7A,
+  0x7A, 0x79, 0x7A, 0x7A, 0x7B, 0x7A, 0x7B, 0x7B,
+  0x79, 0x79, 0x7A, 0x7A, 0x7B, 0x7A, 0x83, 0x83,
+  0x6D, 0x6D, 0x6E, 0x6E, 0x83, 0x8D, 0x88, 0x88,
+  0x55, 0x55, 0x55, 0x8F, 0x8E, 0x84, 0x8D, 0x8D,
+  // 194
+  0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7A, 0x7B, 0x78,
+  0x7B, 0x7B, 0x7B, 0x7B, 0x8D, 0x8F, 0x7B, 0x88,
+  0x7B, 0x7A, 0x7A, 0x7A, 0x87, 0x87, 0x81, 0x83,
+  0x7B, 0x79, 0x79, 0x8F, 0x87, 0x86, 0x87, 0x8F,
+  0x7B, 0x84, 0x8D, 0x83, 0x83, 0x83, 0x88, 0x8E,
+  0x88, 0x88, 0x8E, 0x88, 0x90, 0x88, 0x88, 0x90,
+  0x8E, 0x8E, 0x90, 0x93, 0x93, 0x93, 0x93, 0x93,
+  0x8D, 0xA8, 0x8D, 0x5D, 0x83, 0x84, 0x8D, 0x8D,
+  // 195
+  0x82, 0x87, 0x83, 0x88, 0x9C, 0x8E, 0x9C, 0x7E,
+  0x86, 0x87, 0x88, 0x88, 0x88, 0x88, 0x8E, 0x87,
+  0x83, 0x8E, 0x88, 0x88, 0x88, 0x83, 0x84, 0x93,
+  0x8E, 0x92, 0x93, 0x8E, 0x92, 0x8E, 0x96, 0x84,
+  0x92, 0x92, 0x8E, 0x93, 0x93, 0x90, 0x8E, 0x92,
+  0xAF, 0xAF, 0x93, 0x8E, 0x93, 0xA8, 0x93, 0xA8,
+  0xAF, 0x8F, 0xAF, 0x8F, 0xAF, 0xB0, 0x8F, 0xA8,
+  0x8D, 0x8F, 0xA8, 0x8D, 0x8D, 0x8E, 0x8D, 0x8D,
+  // 196
+  0x88, 0x82, 0x80, 0x80, 0x58, 0x89, 0x86, 0x88,
+  0x87, 0x7D, 0x7D, 0x7F, 0x87, 0x84, 0x87, 0x88,
+  0x83, 0x83, 0x7E, 0x87, 0x82, 0x83, 0x84, 0x8E,
+  0x88, 0x8E, 0x88, 0x84, 0x93, 0x93, 0xA8, 0x90,
+  0x88, 0x90, 0x92, 0x90, 0xAF, 0xA8, 0xA8, 0x90,
+  0xAF, 0xA8, 0x93, 0xA8, 0xAF, 0x8F, 0xAF, 0x90,
+  0xB0, 0x93, 0xB0, 0x8F, 0x8D, 0xB0, 0xA8, 0xA8,
+  0x8D, 0x84, 0x84, 0x84, 0x8D, 0x84, 0x84, 0x8D,
+  // 197
+  0x87, 0x82, 0x86, 0x7D, 0x57, 0x7D, 0x7D, 0x7D,
+  0x88, 0x87, 0x7E, 0x7D, 0x7E, 0x82, 0x7C, 0x80,
+  0x90, 0x82, 0x81, 0x82, 0x5C, 0x86, 0x7D, 0x80,
+  0x83, 0x93, 0x82, 0x82, 0x92, 0x87, 0x86, 0x87,
+  0x8E, 0x93, 0x88, 0x83, 0xA8, 0x91, 0x82, 0x88,
+  0x93, 0x90, 0xA8, 0x90, 0x90, 0x92, 0x90, 0x90,
+  0x90, 0xAF, 0xA8, 0xB1, 0xA8, 0x8D, 0xA8, 0xA8,
+  0x8D, 0x84, 0x84, 0x5D, 0x8D, 0x83, 0x83, 0x84,
+  // 198
+  0x89, 0x85, 0x80, 0x59, 0x80, 0x81, 0x82, 0x80,
+  0x82, 0x8A, 0x88, 0x80, 0x80, 0x82, 0x82, 0x82,
+  0x82, 0x8B, 0x8E, 0x87, 0x87, 0x87, 0x92, 0x82,
+  0x86, 0x8E, 0x92, 0x88, 0x92, 0x90, 0x92, 0x91,
+  0x82, 0x90, 0xAF, 0x90, 0x8E, 0xA8, 0x93, 0x90,
+  0x93, 0xAF, 0xA8, 0x93, 0xA8, 0xAF, 0x90, 0xAF,
+  0x93, 0x93, 0x8D, 0x8D, 0x8E, 0x90, 0xAF, 0x90,
+  0x84, 0x8D, 0x84, 0x8D, 0x8E, 0x84, 0x8D, 0x8E,
+  // 199
+  0x80, 0x82, 0x7F, 0x58, 0x80, 0x82, 0x85, 0x86,
+  0x86, 0x8A, 0x86, 0x7D, 0x88, 0x8A, 0x7F, 0x87,
+  0x92, 0x88, 0x91, 0x58, 0x95, 0x89, 0x88, 0x91,
+  0x92, 0x9A, 0x88, 0x82, 0x8E, 0x88, 0x84, 0x92,
+  0xAF, 0xB2, 0x88, 0x87, 0xAF, 0x93, 0x93, 0xAF,
+  0xAF, 0xA8, 0xA8, 0x90, 0xB0, 0xB0, 0xAA, 0xAA,
+  0xAF, 0x93, 0x90, 0x92, 0x8E, 0xB0, 0xAA, 0xA8,
+  0x8D, 0x8E, 0x90, 0x90, 0x93, 0x8D, 0x8F, 0x84,
+  // 200
+  0x5D, 0x8D, 0x8D, 0x84, 0x5C, 0x5A, 0x5C, 0x84,
+  0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5A, 0x5A, 0x83,
+  0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x9E, 0x9D,
+  0xA2, 0xA3, 0xA2, 0x9E, 0xA2, 0xA3, 0xA2, 0xA2,
+  0x78, 0x77, 0x77, 0x76, 0x76, 0x76, 0x78, 0x70,
+  0xD9, 0xDE, 0xD9, 0xD6, 0xD6, 0xD7, 0xD9, 0xD9,
+  0xDE, 0xDE, 0xE4, 0xDF, 0xE1, 0xDB, 0xD9, 0xDA,
+  // 201
+  0x5A, 0x5A, 0x5A, 0x84, 0x84, 0x5D, 0x5D, 0x84,
+  0x84, 0x84, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A, 0x5D,
+  0xA0, 0xA0, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+  0x9D, 0xA2, 0xA2, 0x7B, 0xA2, 0xA2, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA0, 0xA2,
+  0x76, 0x74, 0x6E, 0x6D, 0x6E, 0x76, 0x76, 0x76,
+  0xD6, 0xD6, 0xD7, 0xD6, 0xD6, 0xD5, 0xD2, 0xCA,
+  0xDB, 0xD9, 0xD6, 0xD6, 0xDA, 0xD4, 0xCD, 0xD0,
+  // 202
+  0x84, 0x84, 0x5C, 0x5D, 0x83, 0x83, 0x83, 0x5D,
+  0x5A, 0x5A, 0x84, 0x8D, 0x84, 0x5A, 0x5A, 0x5D,
+  0xA2, 0xA2, 0xA0, 0xA0, 0xA0, 0xA2, 0xA0, 0xA0,
+  0xA2, 0x9D, 0xA0, 0xA0, 0xA2, 0xA0, 0xA0, 0x7B,
+  0xA2, 0xA0, 0xA0, 0xA0, 0xA0, 0x9E, 0xA0, 0xA0,
+  0x77, 0x78, 0x6A, 0x6D, 0x74, 0x76, 0x60, 0x6A,
+  0xCA, 0xD2, 0xCA, 0xC5, 0xC6, 0xCA, 0xC6, 0xC6,
+  0xD0, 0xD2, 0xD0, 0xD2, 0xCA, 0xCA, 0xCA, 0xCA,
+  // 203
+  0x5D, 0x8E, 0x5A, 0x5C, 0x5D, 0x5D, 0x8E, 0x5D,
+  0x84, 0x8D, 0x84, 0x5A, 0x5A, 0x5A, 0x5A, 0x5A,
+  0xA2, 0xA2, 0xA0, 0xA0, 0x9F, 0x9F, 0x9F, 0x9F,
+  0x78, 0x7B, 0x9E, 0x78, 0x7B, 0x78, 0x9E, 0x9E,
+  0xA0, 0xA0, 0x7A, 0xA0, 0x9F, 0x9F, 0x9E, 0x9E,
+  0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6D, 0x5E,
+  0xC6, 0xC7, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+  0xC6, 0xC6, 0xCA, 0xCA, 0xCA, 0xC7, 0xC6, 0xC6,
+  // 204
+  0x5D, 0x5C, 0x5D, 0x84, 0x5D, 0x84, 0x5C, 0x5C,
+  0x5C, 0x83, 0x5A, 0x5B, 0x5D, 0x8D, 0x8F, 0x8F,
+  0x9F, 0x9F, 0x9F, 0xA0, 0x9F, 0x9F, 0x9F, 0xA2,
+  0x9E, 0x9E, 0x9D, 0x7B, 0x7A, 0x78, 0x9D, 0x7B,
+  0x9D, 0x7B, 0x7A, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+  0x6D, 0x70, 0x74, 0x70, 0x6E, 0x60, 0x5E, 0x5E,
+  0xC5, 0xC5, 0xC6, 0xC6, 0xC6, 0xC6, 0xC5, 0xC5,
+  0xC6, 0xC6, 0xCA, 0xC6, 0xCA, 0xC5, 0xC6, 0xC5,
+  // 205
+  0x5D, 0x5D, 0x90, 0x5C, 0x5A, 0x5A, 0x5D, 0x8E,
+  0x93, 0x90, 0xA8, 0x8F, 0x90, 0xA8, 0x8F, 0x9D,
+  0xA0, 0x9F, 0x9F, 0xA0, 0x78, 0x9E, 0x9D, 0x7B,
+  0x9D, 0x9E, 0x9F, 0x9E, 0x9D, 0x9D, 0x6F, 0x78,
+  0x9D, 0x9E, 0x9E, 0x9D, 0x7B, 0x76, 0x77, 0x77,
+  0x5E, 0x5E, 0x5E, 0x5E, 0x6A, 0x6A, 0x6A, 0x6D,
+  0xC5, 0xC5, 0xC6, 0xC4, 0xC5, 0xC4, 0xC4, 0xC5,
+  0xC4, 0xC5, 0xC5, 0xC6, 0xC7, 0xC5, 0xC5, 0xC5,
+  // 206
+  0x84, 0x5D, 0x5D, 0x5D, 0x5A, 0x5A, 0x5A, 0x5A,
+  0x9E, 0x9D, 0x9D, 0x9E, 0x77, 0x77, 0x76, 0x76,
+  0x7B, 0x77, 0x77, 0x77, 0x6F, 0x77, 0x78, 0x77,
+  0x78, 0x78, 0x79, 0x79, 0x7A, 0x77, 0x76, 0x77,
+  0x78, 0x77, 0x74, 0x78, 0x78, 0x77, 0x77, 0x70,
+  0x6A, 0x5E, 0x5E, 0x5E, 0x5E, 0x56, 0x56, 0x56,
+  0xC4, 0xC3, 0xC3, 0xAD, 0xAD, 0xAC, 0xAC, 0xAC,
+  0xC5, 0xAE, 0xAD, 0xC3, 0xAD, 0xAC, 0xAD, 0xAC,
+  // 207
+  0x5A, 0x5D, 0x5A, 0x5A, 0x8E, 0x5D, 0x5A, 0x5C,
+  0x70, 0x70, 0x6F, 0x70, 0x72, 0x70, 0x70, 0x6C,
+  0x77, 0x77, 0x79, 0x6D, 0x6D, 0x71, 0x72, 0x6F,
+  0x77, 0x77, 0x77, 0x6F, 0x70, 0x6F, 0x6F, 0x6F,
+  0x70, 0x70, 0x70, 0x6F, 0x70, 0x70, 0x70, 0x6F,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0xC1, 0xC1, 0xA6, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xA6, 0xA6, 0xC1, 0xC1,
+  // 208
+  0x5C, 0x84, 0x84, 0x84, 0x50, 0x3C, 0x3A, 0x55,
+  0x5E, 0x5E, 0x55, 0x56, 0x5E, 0x55, 0x55, 0x56,
+  0x6D, 0x70, 0x71, 0x70, 0x70, 0x6D, 0x70, 0x6E,
+  0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+  0x6F, 0x6E, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6F,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0xA5, 0xA5, 0xC1, 0xC1, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xC1, 0xC1, 0xAD, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6,
+  // 209
+  0x3A, 0x47, 0x44, 0x3C, 0x55, 0x3C, 0x3C, 0x45,
+  0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55,
+  0x6F, 0x6E, 0x6E, 0x6D, 0x6E, 0x70, 0x70, 0x70,
+  0x6F, 0x6E, 0x6F, 0x6E, 0x6E, 0x6F, 0x6E, 0x6E,
+  0x6F, 0x6F, 0x6F, 0x6F, 0x70, 0x70, 0x6F, 0x6E,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0xC1, 0xC1, 0xA6, 0xA6, 0xA6, 0xC1, 0xC1, 0xC1,
+  0xA6, 0xA6, 0xA6, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+  // 210
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x70, 0x70, 0x70, 0x6E, 0x6E, 0x6E, 0x6E, 0x70,
+  0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+  0x6F, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6F,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0xA6, 0xAD, 0xAC, 0xAC, 0xC1, 0xAD, 0xC1, 0xAC,
+  0xAD, 0xAD, 0xA6, 0xC1, 0xC1, 0xA6, 0xC1, 0xAD,
+  // 211
+  0x54, 0x55, 0x55, 0x55, 0x55, 0x47, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x54, 0x6C, 0x6E, 0x6D,
+  0x70, 0x70, 0x70, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E,
+  0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+  0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0xC0, 0xA6, 0xC1, 0xA6, 0xC1, 0xC1, 0xA6, 0xA3,
+  0xBF, 0xA6, 0xA6, 0xC1, 0xA6, 0xC1, 0xA6, 0xA6,
+  // 212
+  0x55, 0x55, 0x47, 0x37, 0x47, 0x44, 0x55, 0x3C,
+  0x5E, 0x6D, 0x56, 0x56, 0x55, 0x55, 0x6C, 0x5E,
+  0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6D, 0x6E, 0x6E,
+  0x6E, 0x6E, 0x6E, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E,
+  0x6E, 0x6F, 0x6E, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0xC1, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA5,
+  0xA6, 0xAD, 0xA6, 0xA6, 0xA6, 0xA6, 0xAD, 0xA6,
+  // 213
+  0x8F, 0x8D, 0x8D, 0x8E, 0x8E, 0x8E, 0x84, 0x84,
+  0x5E, 0x5E, 0x60, 0x6D, 0x78, 0x77, 0x77, 0x78,
+  0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x70, 0x6E, 0x6F,
+  0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x70, 0x77,
+  0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA5, 0xA6, 0xA6, 0xC1, 0xAC, 0xC1, 0xA6,
+  // 214
+  0x84, 0x84, 0x8D, 0x84, 0x83, 0x90, 0x90, 0x92,
+  0x7B, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7B, 0x9D,
+  0x70, 0x72, 0x77, 0x77, 0x77, 0x9D, 0x9D, 0x77,
+  0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x77, 0x77,
+  0x6E, 0x6E, 0x6E, 0x77, 0x77, 0x78, 0x77, 0x77,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0xC1, 0xAC, 0xA6, 0xC1, 0xAC, 0xAC, 0xAC, 0xAC,
+  0xAC, 0xAD, 0xA6, 0xC1, 0xA3, 0xC1, 0xA6, 0xAC,
+  // 215
+  0x8D, 0x8D, 0x8D, 0x8D, 0x84, 0x84, 0x84, 0x8E,
+  0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0xA8, 0x8F,
+  0x7B, 0x9E, 0x9F, 0xA0, 0x9F, 0x9F, 0x9D, 0x9E,
+  0x79, 0x77, 0x7B, 0x9E, 0xA0, 0x9F, 0x9F, 0x9D,
+  0x77, 0x77, 0x77, 0x77, 0x9D, 0x9D, 0x9D, 0x9D,
+  0x56, 0x5E, 0x5E, 0x5E, 0x6D, 0x77, 0x78, 0x76,
+  0xA6, 0xA6, 0xAD, 0xA3, 0xC5, 0xC5, 0xC5, 0xC5,
+  0xAC, 0xA6, 0xBF, 0xA6, 0xC7, 0xCA, 0xC6, 0xC5,
+  // 216
+  0x84, 0x84, 0x8E, 0x8E, 0x5D, 0x5C, 0x5C, 0x5C,
+  0x90, 0xA8, 0x8F, 0x8F, 0x90, 0x90, 0x90, 0x90,
+  0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9F, 0x9E,
+  0xA0, 0x9F, 0x9F, 0xA0, 0x9F, 0x9F, 0xA0, 0xA0,
+  0x9F, 0x9F, 0x9F, 0x9D, 0x9E, 0x9E, 0x9E, 0x9D,
+  0x77, 0x76, 0x76, 0x76, 0x70, 0x70, 0x6D, 0x6D,
+  0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC6, 0xC6,
+  0xC5, 0xC5, 0xC5, 0xC6, 0xCA, 0xCA, 0xCA, 0xCA,
+  // 217
+  0x83, 0x5C, 0x83, 0x83, 0x84, 0x84, 0x83, 0x5C,
+  0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x90,
+  0x9F, 0x9E, 0x7B, 0x9D, 0x9D, 0x7B, 0xA2, 0xA0,
+  0xA0, 0xA2, 0xA0, 0xA2, 0xA0, 0xA0, 0x7B, 0x9D,
+  0x9F, 0xA2, 0xA2, 0x9F, 0x9E, 0x9E, 0x9F, 0x9F,
+  0x76, 0x78, 0x76, 0x76, 0x76, 0x77, 0x78, 0x78,
+  0xC6, 0xC6, 0xC6, 0xC6, 0xCA, 0xD0, 0xC9, 0xCA,
+  0xCA, 0xCA, 0xCA, 0xD0, 0xCA, 0xD2, 0xD0, 0xD2,
+  // 218
+  0x83, 0x84, 0x5C, 0x5D, 0x84, 0x84, 0x84, 0x8E,
+  0x90, 0x8F, 0x90, 0x90, 0x8F, 0x90, 0x90, 0x90,
+  0x7B, 0x9D, 0x7B, 0x7B, 0xA0, 0xA0, 0x9F, 0x9F,
+  0x9F, 0xA0, 0xA0, 0x9E, 0xA0, 0x9E, 0x9E, 0xA0,
+  0x9D, 0x9E, 0xA0, 0xA0, 0xA2, 0xA2, 0x9D, 0x9E,
+  0x77, 0x77, 0x77, 0x76, 0x76, 0x6D, 0x70, 0x6D,
+  0xCA, 0xD0, 0xCD, 0xD4, 0xD7, 0xD6, 0xD6, 0xD5,
+  0xCD, 0xCD, 0xCD, 0xD4, 0xD3, 0xD6, 0xD6, 0xD7,
+  // 219
+  0x8E, 0x8E, 0x8E, 0x8E, 0x84, 0x8D, 0x83, 0x83,
+  0x8F, 0x8F, 0x90, 0x8F, 0x93, 0x93, 0x90, 0x90,
+  0xA0, 0x9F, 0x9F, 0x9F, 0xA2, 0xA2, 0xA0, 0xA0,
+  0xA2, 0x9E, 0x9E, 0x9E, 0x9E, 0x9D, 0xA0, 0xA0,
+  0x9D, 0x9E, 0x9E, 0x9D, 0x78, 0xA0, 0x9E, 0x9F,
+  0x6D, 0x6D, 0x6A, 0x6D, 0x6D, 0x6A, 0x6D, 0x6D,
+  0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD4, 0xD7, 0xD7,
+  0xD8, 0xD6, 0xD7, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+  // 220
+  0xDE, 0xDB, 0xDC, 0xDC, 0xDC, 0xDE, 0xDE, 0xD9,
+  0xDC, 0xED, 0xF0, 0xEB, 0xEB, 0xE4, 0xDB, 0xDB,
+  0xED, 0xF0, 0xEB, 0xE9, 0xEC, 0xE9, 0xE4, 0xDE,
+  0xF6, 0xF6, 0xEB, 0xEC, 0xEB, 0xF6, 0xEC, 0xDC,
+  0xEB, 0xEB, 0xEB, 0xF1, 0xEB, 0xEB, 0xEB, 0xEB,
+  0xF1, 0xF1, 0xEB, 0xF4, 0xF3, 0xEB, 0xEB, 0xE9,
+  0xF1, 0xF1, 0xEB, 0xF1, 0xEC, 0xEC, 0xF1, 0xF1,
+  0xF3, 0xEC, 0xF1, 0xF1, 0xF3, 0xF3, 0xF3, 0xF1,
+  // 221
+  0xD9, 0xD9, 0xD6, 0xD9, 0xD9, 0xD6, 0xD0, 0xD0,
+  0xDB, 0xD9, 0xD9, 0xD6, 0xD4, 0xD4, 0xD2, 0xD2,
+  0xDF, 0xDB, 0xD9, 0xD9, 0xD9, 0xD3, 0xD4, 0xCD,
+  0xDD, 0xDB, 0xDB, 0xDB, 0xDB, 0xE5, 0xD3, 0xB2,
+  0xE6, 0xDC, 0xE5, 0xE3, 0xE3, 0xE2, 0xE7, 0xE3,
+  0xE9, 0xE9, 0xE8, 0xE7, 0xE7, 0xE7, 0xE3, 0xE4,
+  0xEC, 0xE9, 0xE8, 0xE7, 0xE7, 0xE3, 0xE3, 0xE3,
+  0xEC, 0xEC, 0xFA, 0xE6, 0xE7, 0xE7, 0xE7, 0xE7,
+  // 222
+  0xD0, 0xD2, 0xCA, 0xCA, 0xD0, 0xD0, 0xCA, 0xCA,
+  0xD0, 0xCD, 0xCD, 0xD0, 0xD0, 0xD0, 0xD0, 0xCA,
+  0xD2, 0xD2, 0xD2, 0xCA, 0xCD, 0xD0, 0xCA, 0xCA,
+  0xCC, 0xD3, 0xCD, 0xD4, 0xD0, 0xD0, 0xD2, 0xD2,
+  0xE3, 0xDE, 0xCD, 0xDA, 0xCD, 0xD0, 0xD0, 0xD0,
+  0xE4, 0xE3, 0xD7, 0xD9, 0xDB, 0xCD, 0xCD, 0xCD,
+  0xE7, 0xDE, 0xE3, 0xE3, 0xE7, 0xCC, 0xDB, 0xB2,
+  0xE7, 0xE7, 0xE7, 0xE3, 0xE7, 0xE0, 0xE3, 0xE3,
+  // 223
+  0xC6, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCC, 0xCC,
+  0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xC9, 0xDB,
+  0xD0, 0xCA, 0xD2, 0xD0, 0xD1, 0xC6, 0xC8, 0xD4,
+  0xCA, 0xD0, 0xD4, 0xCD, 0xD0, 0xD0, 0xCD, 0xCA,
+  0xCB, 0xCC, 0xD7, 0xDB, 0xCD, 0xD2, 0xCC, 0xCB,
+  0xCD, 0xD0, 0xCD, 0xD8, 0xD6, 0xD7, 0xCD, 0xCC,
+  0xD4, 0xCD, 0xCD, 0xD4, 0xDB, 0xDB, 0xD3, 0xCC,
+  0xE5, 0xD4, 0xD4, 0xD2, 0xD4, 0xD6, 0xDE, 0xD9,
+  // 224
+  0xCA, 0xCA, 0xCA, 0xC7, 0xCA, 0xC6, 0xCA, 0xCA,
+  0xC6, 0xCA, 0xCA, 0xD9, 0xD4, 0xCA, 0xCA, 0xCA,
+  0xD3, 0xCD, 0xC6, 0xD2, 0xD5, 0xD7, 0xCA, 0xC6,
+  0xD2, 0xD3, 0xC8, 0xC7, 0xD5, 0xDA, 0xD2, 0xCA,
+  0xCD, 0xDE, 0xCB, 0xCB, 0xD7, 0xCD, 0xC8, 0xC6,
+  0xD7, 0xDA, 0xD6, 0xCC, 0xD6, 0xDB, 0xD9, 0xC6,
+  0xDB, 0xE5, 0xD8, 0xD9, 0xDB, 0xD8, 0xD8, 0xCD,
+  0xE5, 0xD5, 0xD7, 0xDE, 0xDE, 0xE3, 0xDE, 0xDB,
+  // 225
+  0xC4, 0xC6, 0xC5, 0xC6, 0xC5, 0xC7, 0xC5, 0xC5,
+  0xC6, 0xAE, 0xC5, 0xC6, 0xC6, 0xC7, 0xC5, 0xC5,
+  0xC8, 0xC7, 0xC4, 0xC4, 0xCA, 0xCF, 0xC6, 0xC6,
+  0xD0, 0xCA, 0xC4, 0xCF, 0xC7, 0xC8, 0xCA, 0xC6,
+  0xCA, 0xCA, 0xCA, 0xD0, 0xC5, 0xC4, 0xCA, 0xCA,
+  0xD0, 0xD0, 0xCA, 0xC6, 0xC6, 0xC9, 0xCA, 0xCA,
+  0xD0, 0xD0, 0xD2, 0xD1, 0xC4, 0xC4, 0xCA, 0xC7,
+  0xD0, 0xD0, 0xCD, 0xC4, 0xC4, 0xAE, 0xAE, 0xAE,
+  // 226
+  0xC5, 0xC4, 0xAD, 0xAD, 0xAC, 0xC1, 0xAC, 0xA6,
+  0xC5, 0xAE, 0xC3, 0xAC, 0xAC, 0xBF, 0xAC, 0xC1,
+  0xC5, 0xAE, 0xC3, 0xC3, 0xAC, 0xBF, 0xC1, 0xC3,
+  0xC5, 0xC7, 0xAE, 0xAC, 0xAC, 0xBF, 0xC1, 0xA7,
+  0xC5, 0xC5, 0xC5, 0xA4, 0xA6, 0xAC, 0xAD, 0xAD,
+  0xC5, 0xC5, 0xC5, 0xC6, 0xAE, 0xAC, 0xC3, 0xAE,
+  0xC5, 0xC5, 0xC7, 0xC6, 0xC7, 0xAE, 0xC6, 0xC6,
+  0xC4, 0xAE, 0xAE, 0xC5, 0xC7, 0xC5, 0xC5, 0xC5,
+  // 227
+  0xAC, 0xC1, 0xC1, 0xC1, 0xC1, 0xA6, 0xC1, 0xC1,
+  0xAC, 0xC1, 0xC1, 0xC1, 0xA6, 0xA6, 0xC1, 0xC1,
+  0xC1, 0xBF, 0xC1, 0xA6, 0xA7, 0xC3, 0xA6, 0xC1,
+  0xA6, 0xBF, 0xA7, 0xA6, 0xA7, 0xA7, 0xC1, 0xAD,
+  0xAC, 0xBF, 0xA6, 0xC1, 0xC1, 0xA6, 0xC1, 0xC1,
+  0xAE, 0xAC, 0xAC, 0xA6, 0xA6, 0xC1, 0xC1, 0xAD,
+  0xC6, 0xC4, 0xC2, 0xC1, 0xC2, 0xC1, 0xC1, 0xC1,
+  0xC5, 0xC5, 0xAE, 0xAC, 0xAD, 0xAD, 0xC1, 0xC1,
+  // 228
+  0xBF, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xBF, 0xC1, 0xC1, 0xAD, 0xA6, 0xA6, 0xC1, 0xA6,
+  0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xC1, 0xAD, 0xA6,
+  0xA6, 0xC1, 0xA6, 0xC1, 0xAD, 0xC1, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xC1, 0xC1, 0xC1, 0xA6, 0xA6,
+  0xA6, 0xC1, 0xAD, 0xA6, 0xC1, 0xA5, 0xA6, 0xC1,
+  0xC1, 0xA6, 0xC1, 0xA6, 0xAD, 0xC1, 0xC1, 0xC1,
+  0xC1, 0xC1, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6,
+  // 229
+  0xC1, 0xAD, 0xA6, 0xA6, 0xA6, 0xC1, 0xC1, 0xA6,
+  0xA6, 0xC1, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xC1,
+  0xC1, 0xC1, 0xA6, 0xAD, 0xA6, 0xA6, 0xC1, 0xA6,
+  0xA6, 0xC1, 0xA6, 0xA6, 0xA6, 0xC1, 0xC1, 0xA6,
+  0xC1, 0xA6, 0xC1, 0xA6, 0xC1, 0xA6, 0xC1, 0xA6,
+  0xC1, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xC1,
+  0xC1, 0xA6, 0xA6, 0xAD, 0xA6, 0xC1, 0xA6, 0xC1,
+  0xC1, 0xC1, 0xC1, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6,
+  // 230
+  0xC1, 0xA6, 0xAD, 0xC1, 0xA5, 0xA6, 0xC1, 0xAD,
+  0xC1, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xC1, 0xA5, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6,
+  0xAD, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xAD, 0xA6, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6, 0xC1, 0xC1,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xAD, 0xA6, 0xC1,
+  0xA5, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xC1, 0xC1,
+  // 231
+  0xC1, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xC1, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xC1,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6,
+  0xC1, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xC1, 0xC1, 0xA6, 0xC1, 0xA6,
+  // 232
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xC1, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xC1, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xC1, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xC1, 0xA6, 0xA6, 0xC1, 0xA6, 0xA5, 0xA6, 0xA6,
+  // 233
+  0xA6, 0xA6, 0xA6, 0xA6, 0xC1, 0xAD, 0xC1, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xC1, 0xC1,
+  0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xAD,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xAD,
+  0xA6, 0xA6, 0xA6, 0xC0, 0xC1, 0xA6, 0xC1, 0xAC,
+  0xA6, 0xA6, 0xA6, 0xC1, 0xBF, 0xAC, 0xAC, 0xAC,
+  // 234
+  0xC1, 0xC1, 0xC1, 0xC1, 0xA6, 0xA7, 0xC1, 0xAC,
+  0xA6, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xBF, 0xAC,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xAD, 0xBF, 0xAC, 0xAC,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xAC, 0xAD, 0xAE, 0xAE,
+  0xAC, 0xAC, 0xC1, 0xC1, 0xAE, 0xAE, 0xC6, 0xCA,
+  0xAC, 0xAC, 0xC3, 0xAC, 0xC4, 0xC6, 0xC9, 0xCA,
+  0xAC, 0xAC, 0xAC, 0xA4, 0xCF, 0xCA, 0xCA, 0xCA,
+  0xC3, 0xAC, 0xAC, 0xCD, 0xCA, 0xCA, 0xD0, 0xCA,
+  // 235
+  0xA6, 0xC1, 0xAC, 0xAE, 0xC6, 0xCA, 0xC6, 0xC6,
+  0xA6, 0xAD, 0xC3, 0xCF, 0xC6, 0xC6, 0xC6, 0xC5,
+  0xAC, 0xAC, 0xC4, 0xC6, 0xCA, 0xCA, 0xC5, 0xC5,
+  0xC6, 0xAE, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xD0,
+  0xCA, 0xCA, 0xCA, 0xCA, 0xD0, 0xCA, 0xC6, 0xD7,
+  0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xD0, 0xD9, 0xD4,
+  0xCA, 0xCA, 0xCA, 0xCA, 0xD0, 0xD9, 0xCD, 0xD0,
+  0xCA, 0xDB, 0xD4, 0xDB, 0xE7, 0xDF, 0xD7, 0xCD,
+  // 236
+  0xC5, 0xC5, 0xC5, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+  0xCA, 0xCA, 0xC6, 0xCA, 0xCA, 0xD0, 0xCA, 0xCA,
+  0xC5, 0xC6, 0xCA, 0xC6, 0xCA, 0xD0, 0xD0, 0xCA,
+  0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xD0, 0xCA,
+  0xCA, 0xCA, 0xCA, 0xD0, 0xCA, 0xD0, 0xD0, 0xC9,
+  0xD0, 0xD0, 0xD0, 0xCD, 0xD7, 0xD7, 0xCD, 0xCD,
+  0xD0, 0xCD, 0xD0, 0xCD, 0xD8, 0xD3, 0xD4, 0xD4,
+  0xCD, 0xDB, 0xD4, 0xD8, 0xD6, 0xD4, 0xD4, 0xD9,
+  // 237
+  0xC6, 0xCA, 0xCA, 0xD0, 0xCA, 0xD4, 0xD4, 0xCD,
+  0xCA, 0xD0, 0xD0, 0xD0, 0xD0, 0xDB, 0xDA, 0xD4,
+  0xCA, 0xD0, 0xD2, 0xD2, 0xD2, 0xDE, 0xDE, 0xD9,
+  0xD2, 0xCD, 0xCD, 0xC8, 0xCC, 0xDA, 0xDB, 0xDB,
+  0xCD, 0xCB, 0xCB, 0xDB, 0xD8, 0xDE, 0xDE, 0xE3,
+  0xD4, 0xD4, 0xD4, 0xD4, 0xD7, 0xE3, 0xE4, 0xE4,
+  0xD3, 0xD7, 0xD5, 0xE3, 0xE3, 0xE2, 0xE6, 0xE1,
+  0xD6, 0xDB, 0xE7, 0xE4, 0xE6, 0xDC, 0xEB, 0xF0,
+  // 238
+  0xD4, 0xCD, 0xD7, 0xD7, 0xD7, 0xD9, 0xD9, 0xD9,
+  0xD3, 0xDB, 0xE5, 0xDA, 0xD5, 0xDE, 0xD8, 0xD9,
+  0xDB, 0xDB, 0xDE, 0xD6, 0xDB, 0xDE, 0xDE, 0xDE,
+  0xDE, 0xDE, 0xE2, 0xE3, 0xE3, 0xE5, 0xDB, 0xD8,
+  0xE3, 0xDE, 0xE3, 0xE4, 0xE4, 0xE3, 0xE4, 0xE6,
+  0xE7, 0xE3, 0xE4, 0xDE, 0xE3, 0xE3, 0xE4, 0xED,
+  0xBA, 0xEB, 0xE6, 0xDC, 0xE3, 0xE0, 0xE8, 0xEE,
+  0xE9, 0xE9, 0xEA, 0xF5, 0xE9, 0xE6, 0xED, 0xEB,
+  // 239
+  0xDA, 0xD9, 0xD7, 0xDC, 0xDA, 0xDC, 0xD7, 0xDC,
+  0xDC, 0xDA, 0xED, 0xEB, 0xED, 0xD3, 0xFE, 0xEB,
+  0xDA, 0xE8, 0xEB, 0xEC, 0xEB, 0xEB, 0xEB, 0xEB,
+  0xE9, 0xEA, 0xEB, 0xE9, 0xEB, 0xF1, 0xEB, 0xEB,
+  0xEC, 0xEC, 0xE9, 0xE9, 0xF1, 0xEB, 0xEB, 0xF1,
+  0xEA, 0xEE, 0xEB, 0xF1, 0xF1, 0xEB, 0xF3, 0xF1,
+  0xEB, 0xF1, 0xEB, 0xF3, 0xF1, 0xF1, 0xEB, 0xF2,
+  0xF1, 0xEB, 0xF2, 0xEB, 0xF1, 0xF1, 0xF1, 0xF2,
+  // 240
+  0xEC, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF1, 0xF3,
+  0xEC, 0xF3, 0xF3, 0xEC, 0xF3, 0xF3, 0xF1, 0xF3,
+  0xF1, 0xF3, 0xF1, 0xF3, 0xF3, 0xF1, 0xF3, 0xF3,
+  0xF3, 0xF5, 0xEB, 0xF3, 0xF3, 0xF1, 0xF3, 0xF3,
+  0xEC, 0xF3, 0xF3, 0xF3, 0xEF, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xEF, 0xFE, 0xEC, 0xFC, 0xF3, 0xF1,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xEC, 0xF3, 0xF3, 0xFC,
+  0xF2, 0xF3, 0xF2, 0xEF, 0xF2, 0xF2, 0xF3, 0xFB,
+  // 241
+  0xF3, 0xF3, 0xEE, 0xEA, 0xE8, 0xE6, 0xE4, 0xE7,
+  0xEC, 0xEC, 0xEF, 0xEC, 0xEF, 0xEA, 0xE9, 0xEB,
+  0xF3, 0xF3, 0xEC, 0xEB, 0xF3, 0xEC, 0xEB, 0xEF,
+  0xF3, 0xF3, 0xF3, 0xF1, 0xF1, 0xF4, 0xEC, 0xF1,
+  0xF3, 0xF3, 0xF1, 0xF3, 0xF1, 0xF3, 0xF3, 0xF1,
+  0xF1, 0xF3, 0xF2, 0xF3, 0xF1, 0xF3, 0xFC, 0xF2,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF2, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF1, 0xF1, 0xF2, 0xF2, 0xF5, 0xF1, 0xF5,
+  // 242
+  0xE4, 0xE7, 0xE4, 0xE3, 0xE3, 0xE4, 0xE6, 0xE1,
+  0xF6, 0xE6, 0xE4, 0xE4, 0xE3, 0xE4, 0xE8, 0xE6,
+  0xEA, 0xED, 0xE7, 0xE4, 0xE6, 0xE6, 0xEF, 0xEA,
+  0xF3, 0xEF, 0xE6, 0xE7, 0xE4, 0xEB, 0xEE, 0xEA,
+  0xEE, 0xEF, 0xF6, 0xE6, 0xE6, 0xEB, 0xEB, 0xF1,
+  0xFA, 0xF4, 0xED, 0xF1, 0xED, 0xEF, 0xF1, 0xEB,
+  0xF3, 0xF2, 0xF3, 0xEC, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xFC, 0xFC, 0xF2, 0xF3, 0xF1, 0xF3, 0xF5, 0xEC,
+  // 243
+  0xD8, 0xD6, 0xD4, 0xD4, 0xD4, 0xD4, 0xE0, 0xD9,
+  0xE8, 0xE5, 0xD6, 0xDB, 0xD6, 0xD5, 0xDE, 0xD3,
+  0xED, 0xEB, 0xD9, 0xE4, 0xE3, 0xDB, 0xD5, 0xD6,
+  0xEA, 0xF8, 0xF6, 0xF0, 0xE6, 0xE3, 0xDA, 0xD6,
+  0xEC, 0xF3, 0xEC, 0xEA, 0xDC, 0xDB, 0xDB, 0xD9,
+  0xEC, 0xF3, 0xF3, 0xE9, 0xE9, 0xE8, 0xE5, 0xD9,
+  0xF3, 0xEC, 0xEB, 0xEB, 0xEB, 0xE9, 0xE6, 0xE8,
+  0xEB, 0xEF, 0xE9, 0xE9, 0xEC, 0xF6, 0xEA, 0xEA,
+  // 244
+  0xDE, 0xD7, 0xD3, 0xDE, 0xDE, 0xD9, 0xD8, 0xD6,
+  0xDB, 0xDE, 0xD4, 0xD6, 0xDB, 0xDE, 0xD4, 0xCD,
+  0xDE, 0xDE, 0xE3, 0xD9, 0xDB, 0xDE, 0xDB, 0xD7,
+  0xE5, 0xD5, 0xDE, 0xE3, 0xD7, 0xDE, 0xDB, 0xD8,
+  0xD8, 0xE3, 0xD5, 0xE3, 0xE7, 0xDB, 0xDB, 0xDE,
+  0xE5, 0xDB, 0xDE, 0xDE, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xE8, 0xE7, 0xE1, 0xE3, 0xE3, 0xDE, 0xE3, 0xDE,
+  0xE9, 0xE8, 0xE0, 0xE7, 0xE3, 0xE3, 0xE3, 0xE3,
+  // 245
+  0xDA, 0xCD, 0xD2, 0xCD, 0xC8, 0xC7, 0xC4, 0xAE,
+  0xD9, 0xDA, 0xCC, 0xD0, 0xC8, 0xCB, 0xC7, 0xAE,
+  0xD7, 0xCD, 0xCD, 0xD0, 0xD0, 0xD0, 0xCA, 0xC7,
+  0xD2, 0xCD, 0xD0, 0xD1, 0xCA, 0xD0, 0xCA, 0xC8,
+  0xD4, 0xD0, 0xD0, 0xCD, 0xD0, 0xD0, 0xD0, 0xC6,
+  0xE2, 0xD4, 0xCD, 0xD0, 0xD0, 0xCA, 0xD0, 0xCA,
+  0xE3, 0xE5, 0xD4, 0xCD, 0xCD, 0xCD, 0xD6, 0xD9,
+  0xE4, 0xE4, 0xE3, 0xD8, 0xD5, 0xE5, 0xE3, 0xD6,
+  // 246
+  0xAE, 0xAE, 0xAE, 0xD1, 0xC5, 0xC5, 0xC6, 0xC6,
+  0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xC9, 0xC6, 0xC6,
+  0xAE, 0xAE, 0xC8, 0xC4, 0xC7, 0xC7, 0xC6, 0xCA,
+  0xC6, 0xC4, 0xC6, 0xC7, 0xC6, 0xCA, 0xCA, 0xCA,
+  0xD0, 0xC6, 0xC7, 0xC6, 0xCA, 0xCA, 0xC6, 0xC8,
+  0xD0, 0xCA, 0xC7, 0xC6, 0xCA, 0xCA, 0xC6, 0xCF,
+  0xD8, 0xD0, 0xCA, 0xCA, 0xCA, 0xD0, 0xCA, 0xCA,
+  0xDB, 0xCC, 0xCB, 0xD0, 0xCD, 0xD1, 0xD0, 0xCA,
+  // 247
+  0xC5, 0xC5, 0xC5, 0xC3, 0xAD, 0xAD, 0xC1, 0xAD,
+  0xC5, 0xC7, 0xC6, 0xAC, 0xAD, 0xAC, 0xAC, 0xBF,
+  0xC6, 0xC5, 0xC6, 0xC7, 0xAC, 0xBF, 0xC1, 0xC1,
+  0xC6, 0xC5, 0xC6, 0xC8, 0xC6, 0xAE, 0xAC, 0xAC,
+  0xAE, 0xD1, 0xC6, 0xC6, 0xC6, 0xC6, 0xA4, 0xAC,
+  0xC6, 0xC4, 0xCA, 0xC5, 0xC7, 0xC6, 0xAE, 0xAD,
+  0xC9, 0xC6, 0xAE, 0xC7, 0xC7, 0xC6, 0xC5, 0xAE,
+  0xCA, 0xD0, 0xCB, 0xCF, 0xC6, 0xCA, 0xCA, 0xC5,
+  // 248
+  0xA6, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xC1, 0xA6,
+  0xAD, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xA6, 0xC1,
+  0xA6, 0xA5, 0xA7, 0xBF, 0xA6, 0xC1, 0xA6, 0xC1,
+  0xA6, 0xBF, 0xBF, 0xBF, 0xC1, 0xC1, 0xA5, 0xA6,
+  0xA6, 0xA6, 0xC1, 0xC1, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xBF, 0xA7, 0xBF, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xAD, 0xAD, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA5,
+  0xC4, 0xAC, 0xAC, 0xC3, 0xA4, 0xA6, 0xA6, 0xA6,
+  // 249
+  0xA6, 0xA6, 0xC1, 0xC1, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xC1, 0xC1, 0xA6, 0xA6, 0xC1, 0xC1, 0xC1, 0xA6,
+  0xA6, 0xC1, 0xC1, 0xA6, 0xC1, 0xC1, 0xC1, 0xA6,
+  0xC1, 0xAD, 0xC1, 0xA6, 0xA5, 0xA6, 0xC1, 0xA6,
+  0xA6, 0xC1, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6,
+  0xC1, 0xA6, 0xA6, 0xA5, 0xC1, 0xC1, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xC1, 0xC1, 0xA6, 0xA6, 0xA6,
+  // 250
+  0xA6, 0xC1, 0xC1, 0xC1, 0xA6, 0xC1, 0xA6, 0xA5,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xC1, 0xC1, 0xA6, 0xA6, 0xAD,
+  0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xC1, 0xC1, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xA6, 0xA6, 0xA3,
+  0xAD, 0xC1, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6,
+  // 251
+  0xC1, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xC1, 0xC1, 0xA6,
+  0xA6, 0xC1, 0xA6, 0xA6, 0xAD, 0xC1, 0xC1, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA5, 0xA6, 0xA6, 0xC1, 0xA6,
+  0xA6, 0xA6, 0xA5, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xAD, 0xA6, 0xC1, 0xA7,
+  0xC1, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6,
+  // 252
+  0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xC1, 0xC1, 0xA6, 0xA6, 0xC1, 0xA6,
+  0xC1, 0xC1, 0xA6, 0xA6, 0xA6, 0xA7, 0xC0, 0xA6,
+  0xA5, 0xC1, 0xBF, 0xA6, 0xA5, 0xA7, 0xA6, 0xA6,
+  0xC1, 0xA6, 0xBF, 0xA7, 0xA6, 0xA7, 0xA6, 0xBF,
+  0xC1, 0xA6, 0xA7, 0xC1, 0xA6, 0xAC, 0xAE, 0xC4,
+  0xA6, 0xA6, 0xBF, 0xAD, 0xBF, 0xAE, 0xC6, 0xC6,
+  // 253
+  0xA6, 0xA5, 0xA5, 0xA7, 0xAD, 0xAE, 0xAE, 0xAE,
+  0xA6, 0xA6, 0xC1, 0xAC, 0xAC, 0xC6, 0xC6, 0xC6,
+  0xA5, 0xA6, 0xC1, 0xA7, 0xC7, 0xC8, 0xCA, 0xCA,
+  0xA6, 0xA6, 0xAC, 0xA7, 0xCA, 0xCA, 0xCA, 0xCD,
+  0xAC, 0xAC, 0xAC, 0xC4, 0xC6, 0xDA, 0xD8, 0xD8,
+  0xD7, 0xD1, 0xD2, 0xC8, 0xD2, 0xDA, 0xDA, 0xD9,
+  0xCA, 0xD1, 0xC6, 0xCF, 0xD4, 0xDB, 0xDD, 0xDB,
+  0xC7, 0xC7, 0xCD, 0xD7, 0xD3, 0xD9, 0xDE, 0xDB,
+  // 254
+  0xC6, 0xC8, 0xC8, 0xC8, 0xCA, 0xCA, 0xD0, 0xCA,
+  0xC8, 0xC8, 0xC8, 0xCF, 0xCA, 0xCA, 0xD0, 0xD7,
+  0xD0, 0xD0, 0xD0, 0xCA, 0xCA, 0xCD, 0xDD, 0xE5,
+  0xCA, 0xCA, 0xCA, 0xC6, 0xD3, 0xD9, 0xDE, 0xDB,
+  0xDA, 0xD0, 0xCA, 0xDB, 0xDB, 0xDE, 0xDE, 0xDE,
+  0xD9, 0xDE, 0xD0, 0xD4, 0xE1, 0xDE, 0xD9, 0xDE,
+  0xD8, 0xD7, 0xDB, 0xDE, 0xDE, 0xDE, 0xDF, 0xDE,
+  0xDB, 0xD9, 0xDE, 0xDE, 0xDE, 0xE0, 0xE5, 0xE4,
+  // 255
+  0xD0, 0xD8, 0xDE, 0xD7, 0xDB, 0xDE, 0xDE, 0xDB,
+  0xD8, 0xD8, 0xCD, 0xDB, 0xE5, 0xDE, 0xDB, 0xDA,
+  0xE0, 0xDE, 0xD8, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE,
+  0xDE, 0xDE, 0xDB, 0xE3, 0xDE, 0xDE, 0xDE, 0xDE,
+  0xE3, 0xE3, 0xDE, 0xE3, 0xDE, 0xE3, 0xE3, 0xDE,
+  0xDE, 0xDE, 0xE3, 0xE3, 0xDE, 0xDE, 0xDE, 0xE3,
+  0xDE, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE4, 0xE2,
+  0xE3, 0xE3, 0xE7, 0xE3, 0xE3, 0xE4, 0xDF, 0xE2,
+  // 256
+  0xD3, 0xE1, 0xE1, 0xD7, 0xD4, 0xE5, 0xD9, 0xE0,
+  0xE3, 0xE5, 0xD5, 0xD7, 0xD4, 0xD5, 0xD7, 0xE3,
+  0xDE, 0xDE, 0xD3, 0xD5, 0xDE, 0xDE, 0xDC, 0xE6,
+  0xDE, 0xDE, 0xD9, 0xDB, 0xE4, 0xE7, 0xDC, 0xE6,
+  0xE3, 0xE5, 0xDC, 0xE0, 0xDB, 0xED, 0xEB, 0xF1,
+  0xE3, 0xE6, 0xEB, 0xE6, 0xE8, 0xEF, 0xE9, 0xF6,
+  0xE6, 0xEA, 0xE9, 0xEE, 0xF6, 0xEC, 0xEF, 0xEC,
+  0xE6, 0xF6, 0xEF, 0xEF, 0xFA, 0xF3, 0xF1, 0xF1,
+  // 257
+  0xE3, 0xE3, 0xE4, 0xDE, 0xE4, 0xEA, 0xF3, 0xEE,
+  0xE4, 0xE3, 0xE4, 0xE7, 0xDC, 0xEA, 0xEE, 0xF6,
+  0xE3, 0xE3, 0xE7, 0xE7, 0xE8, 0xEC, 0xEE, 0xEE,
+  0xE4, 0xE3, 0xE7, 0xE6, 0xF6, 0xEC, 0xF6, 0xEF,
+  0xDC, 0xE6, 0xE6, 0xE9, 0xF4, 0xEC, 0xF1, 0xF3,
+  0xEE, 0xED, 0xFA, 0xF2, 0xEF, 0xF3, 0xF1, 0xF3,
+  0xF2, 0xF3, 0xF3, 0xEE, 0xEE, 0xF3, 0xF3, 0xF3,
+  0xF2, 0xF3, 0xF2, 0xF1, 0xF1, 0xF3, 0xF2, 0xF2,
+  // 258
+  0xEE, 0xF3, 0xEC, 0xF6, 0xEE, 0xF6, 0xEC, 0xEA,
+  0xF7, 0xEF, 0xF3, 0xEF, 0xEA, 0xEE, 0xED, 0xF3,
+  0xF3, 0xF6, 0xF8, 0xF3, 0xFC, 0xF3, 0xF3, 0xF3,
+  0xEF, 0xED, 0xEC, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF1, 0xFC, 0xF1, 0xF3, 0xF1, 0xF1, 0xF3, 0xF3,
+  0xF1, 0xF3, 0xF1, 0xF3, 0xF1, 0xF1, 0xF3, 0xF3,
+  0xF1, 0xF3, 0xF5, 0xF3, 0xF3, 0xF1, 0xF3, 0xF3,
+  0xF2, 0xFC, 0xF2, 0xFB, 0xF2, 0xF3, 0xF2, 0xF1,
+  // 259
+  0xF3, 0xF3, 0xF3, 0xEB, 0xEC, 0xEB, 0xF1, 0xF1,
+  0xEE, 0xEE, 0xEB, 0xF1, 0xF6, 0xF1, 0xEB, 0xF2,
+  0xF3, 0xF3, 0xF2, 0xF3, 0xF3, 0xF1, 0xEC, 0xF3,
+  0xF3, 0xF3, 0xF2, 0xF1, 0xF1, 0xF0, 0xF1, 0xF1,
+  0xF3, 0xF1, 0xF1, 0xF1, 0xF1, 0xEB, 0xF3, 0xF1,
+  0xF1, 0xF1, 0xF0, 0xF2, 0xF3, 0xF0, 0xF3, 0xF1,
+  0xF2, 0xF2, 0xF3, 0xF3, 0xFC, 0xF2, 0xF2, 0xF1,
+  0xFB, 0xEB, 0xF2, 0xF5, 0xFB, 0xF5, 0xFB, 0xFB,
+  // 260
+  0xF1, 0xF3, 0xF1, 0xFB, 0xEC, 0xF1, 0xF3, 0xFB,
+  0xFB, 0xF3, 0xF3, 0xF3, 0xF5, 0xFC, 0xF1, 0xF3,
+  0xF1, 0xF3, 0xF3, 0xF3, 0xF3, 0xF1, 0xFC, 0xF1,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xFC, 0xF3, 0xFC, 0xF3,
+  0xF3, 0xFC, 0xF5, 0xF3, 0xF3, 0xF3, 0xEC, 0xF3,
+  0xF3, 0xF2, 0xF3, 0xF3, 0xEC, 0xF3, 0xFC, 0xFC,
+  0xF3, 0xFB, 0xFC, 0xF3, 0xF3, 0xF3, 0xF5, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xFC, 0xF3, 0xFC, 0xF3, 0xFC,
+  // 261
+  0xF3, 0xF2, 0xF1, 0xF1, 0xFC, 0xF3, 0xF3, 0xFC,
+  0xF4, 0xF2, 0xFB, 0xF3, 0xF3, 0xFC, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xEC, 0xF3, 0xF3, 0xFB, 0xFB,
+  0xEE, 0xF3, 0xF5, 0xFC, 0xFC, 0xFC, 0xFC, 0xF3,
+  0xEE, 0xF3, 0xF3, 0xF3, 0xF3, 0xFC, 0xF3, 0xF3,
+  0xFC, 0xF7, 0xF3, 0xFC, 0xF3, 0xF3, 0xF3, 0xFC,
+  0xFC, 0xF3, 0xFB, 0xFB, 0xF3, 0xFC, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF1, 0xFB, 0xFC, 0xFC, 0xFA, 0xFA,
+  // 262
+  0xF3, 0xF3, 0xF1, 0xFB, 0xF3, 0xF1, 0xF1, 0xF1,
+  0xF3, 0xF1, 0xF3, 0xF3, 0xF3, 0xEE, 0xF3, 0xF1,
+  0xF1, 0xFA, 0xF3, 0xF3, 0xF3, 0xEE, 0xF3, 0xF1,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF5, 0xF3, 0xF3,
+  0xF3, 0xFC, 0xF3, 0xF3, 0xEF, 0xF3, 0xF3, 0xF3,
+  0xFC, 0xF3, 0xF5, 0xFC, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xFC, 0xF5, 0xEE, 0xFC, 0xFA, 0xF3, 0xF3, 0xF3,
+  // 263
+  0xF1, 0xE9, 0xBA, 0xE8, 0xEB, 0xED, 0xEB, 0xEC,
+  0xEB, 0xF6, 0xED, 0xBA, 0xF0, 0xEA, 0xBA, 0xF6,
+  0xEC, 0xF1, 0xEB, 0xF3, 0xED, 0xF2, 0xEB, 0xED,
+  0xF3, 0xF1, 0xF1, 0xF1, 0xF1, 0xF3, 0xF3, 0xE9,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xE9, 0xEF,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xEE, 0xF3, 0xEE, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xEE, 0xEE, 0xF3, 0xEF,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xEE, 0xF3, 0xF3, 0xEC,
+  // 264
+  0xEB, 0xEB, 0xED, 0xE7, 0xE7, 0xE7, 0xE3, 0xE3,
+  0xEB, 0xE9, 0xE9, 0xDA, 0xE2, 0xE7, 0xE4, 0xE7,
+  0xE9, 0xEB, 0xE9, 0xDC, 0xE4, 0xE7, 0xE7, 0xE3,
+  0xBA, 0xEB, 0xE9, 0xF7, 0xE6, 0xE7, 0xE4, 0xE7,
+  0xE9, 0xEB, 0xEB, 0xF0, 0xE8, 0xE6, 0xE4, 0xDE,
+  0xF3, 0xF1, 0xF1, 0xF1, 0xEA, 0xE8, 0xE4, 0xE4,
+  0xF5, 0xF2, 0xEB, 0xF1, 0xEB, 0xE9, 0xDC, 0xE6,
+  0xF3, 0xF3, 0xF1, 0xEC, 0xF1, 0xEF, 0xE9, 0xEB,
+  // 265
+  0xE7, 0xE4, 0xDE, 0xE7, 0xDE, 0xD6, 0xE3, 0xE3,
+  0xE7, 0xE7, 0xE7, 0xE7, 0xE3, 0xE4, 0xE4, 0xE3,
+  0xE3, 0xE7, 0xE4, 0xE7, 0xE3, 0xE4, 0xE4, 0xE3,
+  0xE7, 0xE3, 0xE7, 0xE7, 0xE3, 0xE4, 0xE7, 0xE3,
+  0xE3, 0xE3, 0xE7, 0xE4, 0xE3, 0xE4, 0xDE, 0xE4,
+  0xE4, 0xE3, 0xE4, 0xE4, 0xE3, 0xE4, 0xE3, 0xE3,
+  0xE6, 0xE7, 0xE4, 0xE7, 0xE3, 0xE3, 0xE7, 0xE4,
+  0xED, 0xED, 0xE4, 0xE4, 0xE3, 0xE7, 0xE7, 0xDC,
+  // 266
+  0xD5, 0xE4, 0xD9, 0xD4, 0xE7, 0xDE, 0xCD, 0xCC,
+  0xE4, 0xE4, 0xDF, 0xD6, 0xD3, 0xDB, 0xD8, 0xD9,
+  0xE4, 0xE1, 0xE4, 0xE3, 0xE3, 0xDE, 0xDE, 0xE3,
+  0xE3, 0xE4, 0xE2, 0xE4, 0xE3, 0xE4, 0xE3, 0xE2,
+  0xE4, 0xE3, 0xE4, 0xE3, 0xE3, 0xDF, 0xE4, 0xE3,
+  0xE3, 0xE3, 0xDE, 0xE3, 0xE4, 0xE1, 0xE3, 0xDE,
+  0xE4, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE1,
+  0xDE, 0xDE, 0xE7, 0xE3, 0xE0, 0xE0, 0xE3, 0xDD,
+  // 267
+  0xC8, 0xDA, 0xCC, 0xCD, 0xD0, 0xCA, 0xD0, 0xCA,
+  0xD6, 0xCD, 0xD8, 0xDB, 0xDA, 0xCD, 0xC8, 0xD1,
+  0xE2, 0xD9, 0xD7, 0xDB, 0xDE, 0xDB, 0xCC, 0xD9,
+  0xE3, 0xDE, 0xDE, 0xDE, 0xD8, 0xDE, 0xDE, 0xDE,
+  0xE4, 0xDE, 0xDE, 0xDE, 0xDD, 0xDE, 0xDE, 0xDE,
+  0xE3, 0xE3, 0xDE, 0xDE, 0xD8, 0xDE, 0xDE, 0xDE,
+  0xE5, 0xE0, 0xE3, 0xDE, 0xDE, 0xE3, 0xDE, 0xE3,
+  0xE5, 0xB2, 0xDB, 0xD4, 0xD9, 0xDE, 0xDE, 0xDE,
+  // 268
+  0xCA, 0xC5, 0xC7, 0xC7, 0xC5, 0xC7, 0xAC, 0xA3,
+  0xCA, 0xC6, 0xC6, 0xCA, 0xC6, 0xCA, 0xC5, 0xAD,
+  0xCC, 0xCB, 0xCA, 0xD0, 0xC6, 0xC6, 0xCA, 0xCA,
+  0xD8, 0xDA, 0xCC, 0xD8, 0xDB, 0xD2, 0xC6, 0xCA,
+  0xDE, 0xE5, 0xD4, 0xDB, 0xDB, 0xDB, 0xC8, 0xCA,
+  0xDE, 0xDF, 0xDF, 0xD4, 0xDA, 0xDE, 0xC8, 0xD7,
+  0xDE, 0xDE, 0xDE, 0xE3, 0xD4, 0xD9, 0xDB, 0xD3,
+  0xD8, 0xD5, 0xE5, 0xDE, 0xE7, 0xDE, 0xDE, 0xD5,
+  // 269
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xC1, 0xA6, 0xC1,
+  0xBF, 0xA6, 0xC1, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6,
+  0xAE, 0xAC, 0xBF, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xC7, 0xD1, 0xC4, 0xC4, 0xBF, 0xAD, 0xBF, 0xA6,
+  0xCA, 0xC6, 0xC7, 0xC5, 0xD0, 0xAC, 0xC3, 0xA6,
+  0xD0, 0xCA, 0xCA, 0xD0, 0xCA, 0xCA, 0xD1, 0xA3,
+  0xD3, 0xD3, 0xCD, 0xCD, 0xD2, 0xD2, 0xCC, 0xC8,
+  0xD4, 0xCD, 0xD4, 0xB2, 0xCD, 0xCC, 0xCC, 0xCD,
+  // 270
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xC1,
+  0xAD, 0xC1, 0xA6, 0xA6, 0xBF, 0xA5, 0xA6, 0xA6,
+  0xC1, 0xC1, 0xC1, 0xAD, 0xA6, 0xA6, 0xBF, 0xA6,
+  0xA6, 0xA6, 0xBF, 0xA6, 0xA6, 0xA7, 0xC1, 0xBF,
+  0xA6, 0xC1, 0xA6, 0xA6, 0xA6, 0xBF, 0xC1, 0xA6,
+  0xA6, 0xA6, 0xC1, 0xA6, 0xA6, 0xA6, 0xAC, 0xA7,
+  0xAE, 0xAE, 0xA6, 0xBF, 0xA6, 0xA7, 0xA7, 0xAE,
+  0xCC, 0xC8, 0xCF, 0xAC, 0xA7, 0xAC, 0xC8, 0xD5,
+  // 271
+  0xA6, 0xA6, 0xC1, 0xA6, 0xC1, 0xA6, 0xBF, 0xA6,
+  0xC1, 0xC1, 0xA6, 0xA6, 0xBF, 0xA6, 0xA6, 0xC1,
+  0xC1, 0xA6, 0xC1, 0xA6, 0xC1, 0xBF, 0xC1, 0xBF,
+  0xC1, 0xC1, 0xBF, 0xAC, 0xC3, 0xC5, 0xC5, 0xAC,
+  0xBF, 0xBF, 0xA4, 0xCC, 0xC4, 0xD1, 0xD1, 0xCC,
+  0xAC, 0xD7, 0xD2, 0xCD, 0xCD, 0xD2, 0xD0, 0xCA,
+  0xD7, 0xD6, 0xCC, 0xCC, 0xD3, 0xD3, 0xCD, 0xCD,
+  0xCD, 0xD3, 0xD7, 0xD4, 0xCD, 0xD3, 0xCD, 0xD9,
+  // 272
+  0xA6, 0xC1, 0xC1, 0xA6, 0xC3, 0xC5, 0xC7, 0xCA,
+  0xBF, 0xC1, 0xAC, 0xBF, 0xC6, 0xD4, 0xDA, 0xCD,
+  0xBF, 0xBF, 0xAC, 0xA4, 0xD6, 0xD9, 0xDE, 0xD9,
+  0xAC, 0xAD, 0xC5, 0xD4, 0xD8, 0xD9, 0xDB, 0xDB,
+  0xAE, 0xC3, 0xD9, 0xDB, 0xDC, 0xD9, 0xD9, 0xD9,
+  0xCD, 0xDB, 0xE5, 0xDB, 0xDE, 0xDB, 0xDB, 0xDE,
+  0xD4, 0xDE, 0xDE, 0xDB, 0xDE, 0xD9, 0xDB, 0xDE,
+  0xD8, 0xD8, 0xD3, 0xD5, 0xCE, 0xCC, 0xD3, 0xD5,
+  // 273
+  0xCD, 0xD0, 0xCD, 0xDB, 0xD9, 0xDB, 0xDE, 0xDE,
+  0xD5, 0xDC, 0xD9, 0xD9, 0xD8, 0xDB, 0xDE, 0xE1,
+  0xDE, 0xDE, 0xDE, 0xDB, 0xDE, 0xDB, 0xD3, 0xD7,
+  0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xCC, 0xDB, 0xD5,
+  0xDE, 0xDE, 0xDE, 0xDE, 0xD6, 0xDB, 0xE4, 0xE4,
+  0xE3, 0xDE, 0xDE, 0xDE, 0xE3, 0xE3, 0xDF, 0xE0,
+  0xDE, 0xDE, 0xDE, 0xDE, 0xE3, 0xE3, 0xE4, 0xE4,
+  0xE5, 0xD8, 0xDF, 0xDE, 0xE3, 0xE3, 0xE4, 0xE4,
+  // 274
+  0xDB, 0xDE, 0xE3, 0xE3, 0xE3, 0xE1, 0xD4, 0xE4,
+  0xDE, 0xDE, 0xE5, 0xDE, 0xE4, 0xE2, 0xD8, 0xE4,
+  0xD8, 0xD6, 0xD6, 0xE3, 0xE3, 0xE3, 0xE4, 0xE7,
+  0xD9, 0xD6, 0xE3, 0xE2, 0xE5, 0xE5, 0xDA, 0xE8,
+  0xE7, 0xE7, 0xE4, 0xE4, 0xE5, 0xBA, 0xDC, 0xEE,
+  0xE4, 0xE6, 0xE6, 0xE6, 0xED, 0xEB, 0xEC, 0xEB,
+  0xE6, 0xE4, 0xE6, 0xE9, 0xE9, 0xEC, 0xEB, 0xEB,
+  0xE6, 0xE4, 0xE9, 0xEE, 0xEC, 0xF3, 0xF3, 0xF1,
+  // 275
+  0xE0, 0xE7, 0xE7, 0xE3, 0xE7, 0xE3, 0xE3, 0xDB,
+  0xE3, 0xE3, 0xE7, 0xE7, 0xE7, 0xE7, 0xE3, 0xDC,
+  0xE7, 0xE4, 0xDE, 0xE3, 0xE7, 0xE7, 0xE6, 0xED,
+  0xE4, 0xE5, 0xE4, 0xE7, 0xE3, 0xE4, 0xB6, 0xF1,
+  0xF8, 0xE3, 0xE4, 0xE4, 0xE4, 0xDF, 0xBA, 0xEB,
+  0xEB, 0xE8, 0xE4, 0xE4, 0xE4, 0xE6, 0xEE, 0xEB,
+  0xF2, 0xEA, 0xE9, 0xE9, 0xE6, 0xB6, 0xEF, 0xF1,
+  0xF1, 0xEB, 0xF3, 0xF3, 0xEA, 0xEE, 0xEF, 0xF6,
+  // 276
+  0xEB, 0xEF, 0xF1, 0xF1, 0xF1, 0xF2, 0xF1, 0xF1,
+  0xED, 0xEC, 0xEB, 0xEB, 0xF4, 0xF4, 0xF1, 0xF3,
+  0xEA, 0xF3, 0xF3, 0xEB, 0xEB, 0xF1, 0xF1, 0xF3,
+  0xF1, 0xF3, 0xF3, 0xF1, 0xF3, 0xF1, 0xF3, 0xF3,
+  0xF1, 0xEB, 0xF1, 0xED, 0xF3, 0xF1, 0xEB, 0xEF,
+  0xF3, 0xF1, 0xF1, 0xF3, 0xF3, 0xF4, 0xF3, 0xF4,
+  0xFC, 0xF3, 0xEC, 0xEE, 0xF1, 0xF3, 0xEA, 0xEA,
+  0xF1, 0xF3, 0xF3, 0xEE, 0xF3, 0xF5, 0xF3, 0xF1,
+  // 277
+  0xEF, 0xF3, 0xFB, 0xF1, 0xFB, 0xF3, 0xF1, 0xF1,
+  0xEF, 0xF1, 0xFB, 0xF3, 0xF4, 0xF3, 0xF1, 0xF1,
+  0xF2, 0xF3, 0xFC, 0xF1, 0xF5, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xEC, 0xF1, 0xF3,
+  0xEC, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF1, 0xF3,
+  0xF3, 0xF1, 0xF1, 0xFC, 0xFC, 0xF3, 0xF1, 0xF3,
+  0xF3, 0xF3, 0xFC, 0xF2, 0xFB, 0xF3, 0xF1, 0xF3,
+  0xF3, 0xF1, 0xF1, 0xFA, 0xF1, 0xF3, 0xFC, 0xF3,
+  // 278
+  0xF3, 0xF3, 0xFB, 0xF1, 0xF3, 0xEC, 0xF1, 0xF1,
+  0xF1, 0xF3, 0xF3, 0xF1, 0xFC, 0xF1, 0xF1, 0xF2,
+  0xFA, 0xF3, 0xF3, 0xF1, 0xF3, 0xF1, 0xF1, 0xF2,
+  0xF1, 0xFA, 0xF3, 0xF3, 0xF3, 0xF2, 0xFB, 0xF3,
+  0xF3, 0xFC, 0xF3, 0xF3, 0xF3, 0xFC, 0xFB, 0xFA,
+  0xFA, 0xFC, 0xF3, 0xFC, 0xF3, 0xF3, 0xFC, 0xF3,
+  0xEF, 0xF3, 0xF3, 0xFC, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF1, 0xFB, 0xFC, 0xFC, 0xFC, 0xF3, 0xF3, 0xF2,
+  // 279
+  0xF1, 0xF1, 0xFB, 0xF3, 0xF3, 0xFC, 0xF1, 0xF3,
+  0xF1, 0xFC, 0xF1, 0xF3, 0xF5, 0xF3, 0xFC, 0xF1,
+  0xF3, 0xF2, 0xF1, 0xF3, 0xFB, 0xF3, 0xF3, 0xFB,
+  0xF4, 0xFB, 0xF1, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF1, 0xF3, 0xFB, 0xFC, 0xFC, 0xFC, 0xF3, 0xF3,
+  0xFB, 0xF1, 0xF3, 0xF3, 0xF5, 0xFD, 0xFB, 0xF3,
+  0xF4, 0xFC, 0xF3, 0xF3, 0xF3, 0xFB, 0xFB, 0xFC,
+  0xF4, 0xF1, 0xFC, 0xF3, 0xFC, 0xF1, 0xFC, 0xF1,
+  // 280
+  0xF3, 0xF4, 0xF3, 0xF3, 0xF3, 0xF4, 0xF3, 0xFB,
+  0xF1, 0xFC, 0xF3, 0xFC, 0xF3, 0xF3, 0xF3, 0xF7,
+  0xF4, 0xFB, 0xF3, 0xF3, 0xFC, 0xFC, 0xF3, 0xFA,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF5, 0xED, 0xFC, 0xFC,
+  0xF5, 0xF3, 0xF3, 0xFC, 0xFC, 0xFC, 0xF8, 0xFC,
+  0xF3, 0xF3, 0xF3, 0xEF, 0xFC, 0xFC, 0xF3, 0xF8,
+  0xF1, 0xF1, 0xF3, 0xF8, 0xFC, 0xF3, 0xF3, 0xF8,
+  0xF3, 0xF3, 0xF3, 0xFC, 0xFC, 0xFC, 0xF3, 0xF8,
+  // 281
+  0xF2, 0xFA, 0xFB, 0xF3, 0xF8, 0xF8, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF8, 0xFC, 0xF8, 0xF8, 0xFA,
+  0xF3, 0xEE, 0xF8, 0xFC, 0xFC, 0xEE, 0xEE, 0xEE,
+  0xF3, 0xF3, 0xF3, 0xFC, 0xFC, 0xF7, 0xFC, 0xF3,
+  0xF3, 0xF3, 0xF8, 0xFC, 0xF3, 0xF3, 0xF3, 0xEF,
+  0xF8, 0xFC, 0xF3, 0xFC, 0xF3, 0xF3, 0xFC, 0xFA,
+  0xF7, 0xF3, 0xEE, 0xFC, 0xFC, 0xFC, 0xFC, 0xF5,
+  0xF3, 0xF3, 0xF3, 0xFC, 0xFC, 0xFC, 0xF3, 0xF3,
+  // 282
+  0xF8, 0xF4, 0xEE, 0xFC, 0xF4, 0xF4, 0xF3, 0xF3,
+  0xEF, 0xFC, 0xF3, 0xF7, 0xF8, 0xF3, 0xFA, 0xFA,
+  0xFC, 0xF8, 0xF8, 0xFC, 0xF3, 0xFA, 0xFA, 0xEF,
+  0xF8, 0xF3, 0xF5, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8,
+  0xF5, 0xF8, 0xFC, 0xF7, 0xEF, 0xF3, 0xEE, 0xFC,
+  0xF7, 0xF8, 0xFA, 0xF3, 0xFA, 0xF8, 0xEE, 0xFC,
+  0xFC, 0xF8, 0xF3, 0xFC, 0xEF, 0xF8, 0xFC, 0xEE,
+  0xF4, 0xFC, 0xFC, 0xF3, 0xF7, 0xEE, 0xF8, 0xFC,
+  // 283
+  0xEF, 0xEF, 0xEF, 0xF3, 0xEE, 0xF3, 0xF3, 0xF3,
+  0xEF, 0xF3, 0xEE, 0xF5, 0xFC, 0xFC, 0xF3, 0xF3,
+  0xEF, 0xFC, 0xF7, 0xF3, 0xFC, 0xF3, 0xF5, 0xF3,
+  0xF3, 0xF5, 0xFC, 0xFC, 0xF8, 0xFC, 0xF3, 0xF3,
+  0xEE, 0xF3, 0xF5, 0xEE, 0xF5, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xFC, 0xF3, 0xF3, 0xF3, 0xFC, 0xFC, 0xF3,
+  0xF3, 0xF3, 0xFC, 0xFC, 0xFC, 0xEC, 0xF3, 0xFC,
+  0xF3, 0xF3, 0xEF, 0xFC, 0xFC, 0xF3, 0xF3, 0xF3,
+  // 284
+  0xEE, 0xEE, 0xEC, 0xF3, 0xF1, 0xE9, 0xEF, 0xEA,
+  0xF3, 0xF3, 0xF3, 0xF1, 0xF2, 0xEB, 0xEB, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF1, 0xF1,
+  0xF3, 0xF3, 0xF4, 0xF3, 0xF3, 0xF3, 0xEC, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xEC, 0xF3, 0xF3, 0xF3, 0xF3,
+  0xF3, 0xF3, 0xEC, 0xF3, 0xF3, 0xF8, 0xF9, 0xEE,
+  0xFC, 0xF3, 0xFC, 0xF3, 0xFC, 0xF3, 0xF1, 0xF3,
+  0xFC, 0xF3, 0xF3, 0xF3, 0xF4, 0xF2, 0xF2, 0xF3,
+  // 285
+  0xF0, 0xE9, 0xDC, 0xE4, 0xE3, 0xE4, 0xE4, 0xE4,
+  0xEB, 0xEB, 0xE9, 0xB6, 0xDF, 0xE0, 0xE4, 0xE4,
+  0xEC, 0xEC, 0xEB, 0xEA, 0xE8, 0xD5, 0xD6, 0xD6,
+  0xF3, 0xF7, 0xF3, 0xF3, 0xEC, 0xED, 0xD6, 0xD6,
+  0xED, 0xF3, 0xEE, 0xEE, 0xF6, 0xF6, 0xE6, 0xD6,
+  0xF3, 0xF3, 0xEC, 0xEE, 0xF3, 0xF1, 0xEF, 0xD8,
+  0xF1, 0xF1, 0xF3, 0xEF, 0xF3, 0xEB, 0xEA, 0xEB,
+  0xF3, 0xF3, 0xF3, 0xEE, 0xEF, 0xEC, 0xF3, 0xF9,
+  // 286
+  0xD6, 0xD3, 0xD5, 0xD7, 0xD3, 0xD8, 0xDF, 0xDE,
+  0xE7, 0xE3, 0xD3, 0xD5, 0xD3, 0xD3, 0xD5, 0xD5,
+  0xCE, 0xCE, 0xD3, 0xD3, 0xD3, 0xD3, 0xB2, 0xAB,
+  0xD6, 0xD5, 0xCE, 0xB1, 0xCE, 0xB1, 0xB1, 0xCE,
+  0xD6, 0xD6, 0xD6, 0xD6, 0xB1, 0xB1, 0xB1, 0xAB,
+  0xD6, 0xD6, 0xD6, 0xD5, 0xD5, 0xCE, 0xCE, 0xD5,
+  0xE1, 0xD8, 0xD6, 0xD6, 0xB2, 0xD5, 0xB2, 0xD5,
+  0xEF, 0xB6, 0xDF, 0xD9, 0xD8, 0xD6, 0xD6, 0xCE,
+  // 287
+  0xD6, 0xD5, 0xDF, 0xCD, 0xD3, 0xD5, 0xCC, 0xD3,
+  0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xB2, 0xB2,
+  0xB1, 0xCE, 0xCE, 0xD5, 0xCE, 0xCC, 0xD6, 0xB2,
+  0xB1, 0xB2, 0xB1, 0xAA, 0xB1, 0xB1, 0xB1, 0xAA,
+  0xA9, 0xB2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAA,
+  0xD5, 0xB1, 0xCE, 0xAA, 0xAA, 0xB1, 0xAA, 0xAA,
+  0xCE, 0xCE, 0xCE, 0xCE, 0xB2, 0xD5, 0xB2, 0xB1,
+  0xD5, 0xB1, 0xB1, 0xB1, 0xCE, 0xD5, 0xD5, 0xCE,
+  // 288
+  0xD5, 0xCD, 0xCC, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+  0xCE, 0xCE, 0xCE, 0xB1, 0xB1, 0xAB, 0xB1, 0xAA,
+  0xB1, 0xAA, 0xAA, 0xB1, 0xD5, 0xCE, 0xB2, 0xAB,
+  0xAA, 0xAB, 0xAA, 0xAA, 0xAB, 0xAB, 0xAA, 0xAA,
+  0xAA, 0xB1, 0xAA, 0xCE, 0xAA, 0xAB, 0xAA, 0xAA,
+  0xAA, 0xAB, 0xA9, 0xAA, 0xB1, 0xB1, 0xAA, 0xAA,
+  0xB2, 0xB2, 0xAA, 0xB1, 0xAA, 0xAB, 0xAA, 0xB1,
+  0xCE, 0xB2, 0xAA, 0xCC, 0xCD, 0xCE, 0xD3, 0xCE,
+  // 289
+  0xB1, 0xB1, 0xB1, 0xAA, 0xB1, 0xB1, 0xAA, 0xAB,
+  0xB1, 0xB1, 0xAB, 0xB2, 0xB2, 0xB2, 0xCE, 0xAB,
+  0xAA, 0xB2, 0xAA, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xB2, 0xAA, 0xA9, 0xB1, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xAA, 0xB1, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xB1, 0xA9, 0xAA, 0xCE, 0xD5, 0xB2, 0xCC, 0xCC,
+  0xD3, 0xD3, 0xD3, 0xD6, 0xB1, 0xB1, 0xB1, 0xB1,
+  // 290
+  0xAB, 0xAB, 0xB1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB,
+  0xAB, 0xAB, 0xAA, 0xAB, 0xAA, 0xAA, 0xB1, 0xCE,
+  0xAA, 0xB1, 0xAA, 0xAB, 0xAA, 0xAA, 0xAB, 0xAA,
+  0xAA, 0xAA, 0xB2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xAA, 0xAA, 0xB1, 0xAA, 0xAA, 0xD5, 0xAB, 0xB2,
+  0xB2, 0xCE, 0xD3, 0xCE, 0xCC, 0xB2, 0xB1, 0xB1,
+  0xD5, 0xD3, 0xCC, 0xD3, 0xCC, 0xCE, 0xCE, 0xB2,
+  0xB1, 0xAA, 0xB2, 0xB1, 0xCE, 0xCE, 0xCE, 0xCC,
+  // 291
+  0xAB, 0xAA, 0xAB, 0xB1, 0xB2, 0xB2, 0xB1, 0xB1,
+  0xCE, 0xAB, 0xB1, 0xAB, 0xB1, 0xAB, 0xAA, 0xB1,
+  0xAB, 0xAA, 0xAA, 0xB1, 0xAB, 0xAA, 0xD6, 0xD3,
+  0xAA, 0xAA, 0xAA, 0xAA, 0xB1, 0xAA, 0xAA, 0xAA,
+  0xD5, 0xB1, 0xAA, 0xB1, 0xAA, 0xAA, 0xAB, 0xAB,
+  0xB1, 0xAA, 0xAA, 0xC6, 0xCE, 0xCE, 0xD3, 0xCE,
+  0xB1, 0xAB, 0xB1, 0xB1, 0xB1, 0xD3, 0xCE, 0xCE,
+  0xD5, 0xCE, 0xD5, 0xD3, 0xD3, 0xAB, 0xCE, 0xB1,
+  // 292
+  0xB1, 0xAB, 0xB1, 0xB2, 0xB1, 0xB2, 0xCC, 0xD3,
+  0xAB, 0xB1, 0xCE, 0xD3, 0xCE, 0xCE, 0xD5, 0xD5,
+  0xCE, 0xCE, 0xB2, 0xB1, 0xAA, 0xAA, 0xAA, 0xB2,
+  0xAA, 0xAA, 0xAA, 0xB2, 0xB2, 0xB2, 0xB2, 0xCE,
+  0xAA, 0xCE, 0xAB, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA,
+  0xCE, 0xCC, 0xCC, 0xCE, 0xB2, 0xD3, 0xB1, 0xB1,
+  0xCE, 0xD6, 0xB2, 0xB2, 0xB2, 0xD5, 0xCE, 0xB2,
+  0xB1, 0xB1, 0xCE, 0xCE, 0xB2, 0xB1, 0xD5, 0xD5,
+  // 293
+  0xCC, 0xCC, 0xD5, 0xD3, 0xD5, 0xDB, 0xD5, 0xD6,
+  0xD5, 0xCE, 0xCE, 0xB2, 0xD6, 0xD5, 0xD6, 0xD6,
+  0xB2, 0xB1, 0xB1, 0xB1, 0xD6, 0xD6, 0xD6, 0xD5,
+  0xCE, 0xCE, 0xB2, 0xCE, 0xB1, 0xB1, 0xB1, 0xB1,
+  0xB1, 0xAA, 0xB1, 0xB1, 0xB1, 0xB1, 0xAA, 0xED,
+  0xB1, 0xD5, 0xD5, 0xD6, 0xD6, 0xE8, 0xE9, 0xEE,
+  0xD6, 0xD5, 0xD6, 0xD6, 0xBA, 0xF6, 0xFF, 0xEE,
+  0xD5, 0xD7, 0xE6, 0xEC, 0xEE, 0xEF, 0xEE, 0xEE,
+  // 294
+  0xD6, 0xD9, 0xF5, 0xEE, 0xF3, 0xEE, 0xF8, 0xEE,
+  0xD6, 0xFA, 0xFC, 0xEF, 0xF3, 0xEE, 0xEE, 0xEE,
+  0xD6, 0xEE, 0xEF, 0xEF, 0xEE, 0xF8, 0xF8, 0xF3,
+  0xB6, 0xEA, 0xF8, 0xF8, 0xEE, 0xF8, 0xF3, 0xFC,
+  0xF8, 0xEE, 0xEE, 0xF7, 0xFC, 0xEE, 0xF3, 0xF8,
+  0xEE, 0xEE, 0xF3, 0xEE, 0xEF, 0xEC, 0xF8, 0xF3,
+  0xEE, 0xEE, 0xEF, 0xF7, 0xEA, 0xEE, 0xEF, 0xFC,
+  0xFC, 0xFC, 0xEE, 0xFC, 0xEF, 0xF7, 0xF8, 0xF8,
+  // 295
+  0xEE, 0xF3, 0xEE, 0xEE, 0xF6, 0xF7, 0xEF, 0xF3,
+  0xEE, 0xF7, 0xEE, 0xF3, 0xF8, 0xFC, 0xF8, 0xF3,
+  0xF3, 0xEF, 0xF6, 0xF8, 0xF3, 0xF9, 0xF8, 0xF9,
+  0xF3, 0xF8, 0xF8, 0xF8, 0xF8, 0xFA, 0xF8, 0xF8,
+  0xF8, 0xF3, 0xF8, 0xF8, 0xF8, 0xF7, 0xF8, 0xF8,
+  0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF3, 0xF8,
+  0xFC, 0xFC, 0xF8, 0xFC, 0xF8, 0xF8, 0xF8, 0xEE,
+  0xF8, 0xFA, 0xFC, 0xF8, 0xFC, 0xF8, 0xF8, 0xF8,
+  // 296
+  0xF3, 0xF3, 0xF7, 0xF7, 0xEE, 0xF8, 0xF1, 0xF3,
+  0xEE, 0xF8, 0xF8, 0xF3, 0xF7, 0xFC, 0xF8, 0xFC,
+  0xEF, 0xF8, 0xF8, 0xF8, 0xF7, 0xF3, 0xF8, 0xF3,
+  0xF3, 0xEE, 0xFC, 0xF8, 0xFC, 0xF7, 0xFC, 0xF8,
+  0xF8, 0xF8, 0xFC, 0xEF, 0xFC, 0xF8, 0xF3, 0xF3,
+  0xFC, 0xF8, 0xFC, 0xF3, 0xEE, 0xF3, 0xEC, 0xFC,
+  0xF3, 0xF8, 0xFC, 0xEE, 0xF8, 0xFC, 0xFC, 0xF8,
+  0xEE, 0xFA, 0xFC, 0xFC, 0xFC, 0xFC, 0xF5, 0xF3,
+  // 297
+  0xF3, 0xFC, 0xF3, 0xFC, 0xF3, 0xF5, 0xF4, 0xF4,
+  0xF3, 0xF3, 0xFC, 0xFC, 0xF3, 0xF3, 0xFB, 0xF3,
+  0xF3, 0xFC, 0xFC, 0xF3, 0xFC, 0xF3, 0xF1, 0xF3,
+  0xF3, 0xFC, 0xFC, 0xFB, 0xF1, 0xF3, 0xF3, 0xF3,
+  0xFC, 0xFC, 0xF5, 0xF3, 0xF3, 0xFA, 0xFC, 0xFC,
+  0xFA, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF3, 0xFC,
+  0xF5, 0xEC, 0xFC, 0xF8, 0xF8, 0xFC, 0xEE, 0xF8,
+  0xF3, 0xF3, 0xFC, 0xF3, 0xFC, 0xF5, 0xF1, 0xFC,
+  // 298
+  0xF3, 0xF3, 0xFC, 0xF3, 0xF3, 0xF3, 0xF3, 0xF2,
+  0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xFC, 0xFC, 0xFA,
+  0xFC, 0xF3, 0xFC, 0xFC, 0xFC, 0xF3, 0xFC, 0xF4,
+  0xF3, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF3, 0xF3,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF3, 0xF5,
+  0xFC, 0xF3, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF3,
+  0xF3, 0xF3, 0xF3, 0xFE, 0xF3, 0xF3, 0xFC, 0xF5,
+  0xF3, 0xFC, 0xF3, 0xFC, 0xFC, 0xFC, 0xFC, 0xF3,
+  // 299
+  0xFB, 0xFC, 0xF3, 0xF3, 0xFC, 0xFB, 0xF4, 0xFC,
+  0xFB, 0xF3, 0xF3, 0xFC, 0xFC, 0xF2, 0xF1, 0xFA,
+  0xFB, 0xFC, 0xF1, 0xFB, 0xF5, 0xFC, 0xFC, 0xFA,
+  0xFC, 0xFC, 0xFB, 0xF1, 0xFC, 0xF3, 0xF3, 0xFC,
+  0xF5, 0xFC, 0xFC, 0xFC, 0xF3, 0xFC, 0xF3, 0xF5,
+  0xF8, 0xF8, 0xFB, 0xFB, 0xFC, 0xFE, 0xFB, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0xF3, 0xF3,
+  0xFC, 0xFC, 0xFC, 0xFB, 0xF3, 0xF3, 0xFC, 0xF3
+};
+
+const uint16_t BG8_map[BG8_MAP_W * BG8_MAP_H] PROGMEM = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013,
+  0x8013, 0x8012, 0x8011, 0x8010, 0x800F, 0x800E, 0x800D, 0x800C, 0x800B, 0x800A, 0x8009, 0x8008, 0x8007, 0x8006, 0x8005, 0x8004, 0x8003, 0x8002, 0x8001, 0x8000,
+  0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+  0x8027, 0x8026, 0x8025, 0x8024, 0x8023, 0x8022, 0x8021, 0x8020, 0x801F, 0x801E, 0x801D, 0x801C, 0x801B, 0x801A, 0x8019, 0x8018, 0x8017, 0x8016, 0x8015, 0x8014,
+  0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B,
+  0x803B, 0x803A, 0x8039, 0x8038, 0x8037, 0x8036, 0x8035, 0x8034, 0x8033, 0x8032, 0x8031, 0x8030, 0x802F, 0x802E, 0x802D, 0x802C, 0x802B, 0x802A, 0x8029, 0x8028,
+  0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+  0x804F, 0x804E, 0x804D, 0x804C, 0x804B, 0x804A, 0x8049, 0x8048, 0x8047, 0x8046, 0x8045, 0x8044, 0x8043, 0x8042, 0x8041, 0x8040, 0x803F, 0x803E, 0x803D, 0x803C,
+  0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063,
+  0x8063, 0x8062, 0x8061, 0x8060, 0x805F, 0x805E, 0x805D, 0x805C, 0x805B, 0x805A, 0x8059, 0x8058, 0x8057, 0x8056, 0x8055, 0x8054, 0x8053, 0x8052, 0x8051, 0x8050,
+  0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x8077, 0x8076, 0x8075, 0x8074, 0x8073, 0x8072, 0x8071, 0x8070, 0x806F, 0x806E, 0x806D, 0x806C, 0x806B, 0x806A, 0x8069, 0x8068, 0x8067, 0x8066, 0x8065, 0x8064,
+  0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B,
+  0x808B, 0x808A, 0x8089, 0x8088, 0x8087, 0x8086, 0x8085, 0x8084, 0x8083, 0x8082, 0x8081, 0x8080, 0x807F, 0x807E, 0x807D, 0x807C, 0x807B, 0x807A, 0x8079, 0x8078,
+  0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+  0x809F, 0x809E, 0x809D, 0x809C, 0x809B, 0x809A, 0x8099, 0x8098, 0x8097, 0x8096, 0x8095, 0x8094, 0x8093, 0x8092, 0x8091, 0x8090, 0x808F, 0x808E, 0x808D, 0x808C,
+  0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+  0x80B3, 0x80B2, 0x80B1, 0x80B0, 0x80AF, 0x80AE, 0x80AD, 0x80AC, 0x80AB, 0x80AA, 0x80A9, 0x80A8, 0x80A7, 0x80A6, 0x80A5, 0x80A4, 0x80A3, 0x80A2, 0x80A1, 0x80A0,
+  0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+  0x80C7, 0x80C6, 0x80C5, 0x80C4, 0x80C3, 0x80C2, 0x80C1, 0x80C0, 0x80BF, 0x80BE, 0x80BD, 0x80BC, 0x80BB, 0x80BA, 0x80B9, 0x80B8, 0x80B7, 0x80B6, 0x80B5, 0x80B4,
+  0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB,
+  0x80DB, 0x80DA, 0x80D9, 0x80D8, 0x80D7, 0x80D6, 0x80D5, 0x80D4, 0x80D3, 0x80D2, 0x80D1, 0x80D0, 0x80CF, 0x80CE, 0x80CD, 0x80CC, 0x80CB, 0x80CA, 0x80C9, 0x80C8,
+  0x00DC, 0x00DD, 0x00DE, 0x00DF, 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+  0x80EF, 0x80EE, 0x80ED, 0x80EC, 0x80EB, 0x80EA, 0x80E9, 0x80E8, 0x80E7, 0x80E6, 0x80E5, 0x80E4, 0x80E3, 0x80E2, 0x80E1, 0x80E0, 0x80DF, 0x80DE, 0x80DD, 0x80DC,
+  0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100, 0x0101, 0x0102, 0x0103,
+  0x8103, 0x8102, 0x8101, 0x8100, 0x80FF, 0x80FE, 0x80FD, 0x80FC, 0x80FB, 0x80FA, 0x80F9, 0x80F8, 0x80F7, 0x80F6, 0x80F5, 0x80F4, 0x80F3, 0x80F2, 0x80F1, 0x80F0,
+  0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010A, 0x010B, 0x010C, 0x010D, 0x010E, 0x010F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117,
+  0x8117, 0x8116, 0x8115, 0x8114, 0x8113, 0x8112, 0x8111, 0x8110, 0x810F, 0x810E, 0x810D, 0x810C, 0x810B, 0x810A, 0x8109, 0x8108, 0x8107, 0x8106, 0x8105, 0x8104,
+  0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x0120, 0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0x0126, 0x0127, 0x0128, 0x0129, 0x012A, 0x012B,
+  0x812B, 0x812A, 0x8129, 0x8128, 0x8127, 0x8126, 0x8125, 0x8124, 0x8123, 0x8122, 0x8121, 0x8120, 0x811F, 0x811E, 0x811D, 0x811C, 0x811B, 0x811A, 0x8119, 0x8118
+};
+
+#endif
@@ -1,29 +0,0 @@
-#ifndef MAN2_H_
-#define MAN2_H_
-
-#include <Arduino.h>
-
-// Generated by png_converter_gui.py (4bpp, idx0 transparent)
-const uint16_t MAN2_W = 16;
-const uint16_t MAN2_H = 23;
-
-const uint16_t MAN2_pal565[16] PROGMEM = {
-  0x0000, 0xDD0C, 0xDB84, 0xDAAC, 0x8AA7, 0x31E7, 0xA986, 0x61C6, 0x4147, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const uint8_t MAN2_data[184] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x09, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x92, 0x22, 0x22, 0x24, 0x90, 0x00,
-  0x00, 0x00, 0x94, 0x22, 0x22, 0x44, 0x90, 0x00, 0x00, 0x09, 0x44, 0x44, 0x44, 0x76, 0x90, 0x00,
-  0x00, 0x92, 0x22, 0x22, 0x22, 0x44, 0x49, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x22, 0x22, 0x29,
-  0x00, 0x09, 0x39, 0x32, 0x37, 0x99, 0x99, 0x90, 0x00, 0x92, 0x12, 0x22, 0x27, 0x92, 0x90, 0x00,
-  0x00, 0x99, 0x77, 0x27, 0x77, 0x89, 0x99, 0x00, 0x00, 0x09, 0x77, 0x77, 0x78, 0x96, 0x68, 0x90,
-  0x00, 0x09, 0x88, 0x88, 0x89, 0x66, 0x68, 0x90, 0x00, 0x09, 0x88, 0x88, 0x89, 0x66, 0x68, 0x90,
-  0x00, 0x00, 0x99, 0x99, 0x99, 0x66, 0x68, 0x90, 0x00, 0x08, 0x66, 0x66, 0x96, 0x66, 0x68, 0x90,
-  0x09, 0x22, 0x26, 0x79, 0x22, 0x49, 0x68, 0x90, 0x09, 0x22, 0x74, 0x42, 0x24, 0x96, 0x68, 0x90,
-  0x09, 0x95, 0x59, 0x99, 0x99, 0x99, 0x99, 0x00, 0x09, 0x95, 0x55, 0x55, 0x55, 0x59, 0x90, 0x00,
-  0x09, 0x95, 0x59, 0x99, 0x99, 0x99, 0x90, 0x00, 0x98, 0x97, 0x89, 0x90, 0x00, 0x09, 0x90, 0x00,
-  0x99, 0x77, 0x89, 0x90, 0x00, 0x09, 0x90, 0x00
-};
-
-#endif
@@ -1,29 +0,0 @@
-#ifndef MAN5_H_
-#define MAN5_H_
-
-#include <Arduino.h>
-
-// Generated by png_converter_gui.py (4bpp, idx0 transparent)
-const uint16_t MAN5_W = 16;
-const uint16_t MAN5_H = 23;
-
-const uint16_t MAN5_pal565[16] PROGMEM = {
-  0x0000, 0xDD0C, 0xDB84, 0xDAAC, 0x8AA7, 0x61C6, 0x31E7, 0xA986, 0x4147, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const uint8_t MAN5_data[184] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x90, 0x00, 0x00,
-  0x00, 0x09, 0x22, 0x22, 0x22, 0x49, 0x00, 0x00, 0x00, 0x09, 0x42, 0x22, 0x24, 0x49, 0x00, 0x00,
-  0x00, 0x94, 0x44, 0x44, 0x45, 0x79, 0x00, 0x00, 0x09, 0x22, 0x22, 0x22, 0x24, 0x44, 0x99, 0x00,
-  0x09, 0x99, 0x99, 0x99, 0x92, 0x22, 0x22, 0x90, 0x00, 0x93, 0x93, 0x23, 0x59, 0x99, 0x99, 0x90,
-  0x09, 0x21, 0x22, 0x22, 0x59, 0x29, 0x00, 0x00, 0x09, 0x95, 0x52, 0x55, 0x58, 0x99, 0x00, 0x00,
-  0x00, 0x95, 0x55, 0x55, 0x89, 0x77, 0x99, 0x00, 0x00, 0x98, 0x88, 0x88, 0x97, 0x77, 0x78, 0x90,
-  0x00, 0x98, 0x88, 0x88, 0x97, 0x77, 0x78, 0x90, 0x00, 0x09, 0x99, 0x99, 0x77, 0x77, 0x78, 0x90,
-  0x00, 0x09, 0x77, 0x77, 0x79, 0x77, 0x78, 0x90, 0x00, 0x28, 0x77, 0x77, 0x97, 0x77, 0x78, 0x90,
-  0x09, 0x22, 0x27, 0x59, 0x22, 0x49, 0x78, 0x90, 0x09, 0x22, 0x54, 0x42, 0x24, 0x97, 0x78, 0x90,
-  0x09, 0x96, 0x69, 0x99, 0x99, 0x99, 0x99, 0x00, 0x09, 0x96, 0x66, 0x66, 0x66, 0x69, 0x90, 0x00,
-  0x09, 0x96, 0x69, 0x99, 0x99, 0x99, 0x90, 0x00, 0x98, 0x95, 0x89, 0x90, 0x00, 0x09, 0x90, 0x00,
-  0x99, 0x55, 0x89, 0x90, 0x00, 0x09, 0x90, 0x00
-};
-
-#endif
@@ -1,29 +0,0 @@
-#ifndef MAN6_H_
-#define MAN6_H_
-
-#include <Arduino.h>
-
-// Generated by png_converter_gui.py (4bpp, idx0 transparent)
-const uint16_t MAN6_W = 16;
-const uint16_t MAN6_H = 23;
-
-const uint16_t MAN6_pal565[16] PROGMEM = {
-  0x0000, 0xDD0C, 0xDB84, 0xDAAC, 0x8AA7, 0x31E7, 0xA986, 0x61C6, 0x4147, 0x2106, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const uint8_t MAN6_data[184] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x90, 0x00, 0x00,
-  0x00, 0x09, 0x22, 0x22, 0x22, 0x49, 0x00, 0x00, 0x00, 0x09, 0x42, 0x22, 0x24, 0x49, 0x00, 0x00,
-  0x00, 0x94, 0x44, 0x44, 0x47, 0x69, 0x00, 0x00, 0x09, 0x22, 0x22, 0x22, 0x24, 0x44, 0x99, 0x00,
-  0x09, 0x99, 0x99, 0x99, 0x92, 0x22, 0x22, 0x90, 0x00, 0x93, 0x22, 0x23, 0x79, 0x99, 0x99, 0x90,
-  0x09, 0x21, 0x22, 0x22, 0x79, 0x29, 0x00, 0x00, 0x09, 0x97, 0x79, 0x77, 0x78, 0x99, 0x00, 0x00,
-  0x00, 0x99, 0x99, 0x97, 0x89, 0x66, 0x99, 0x00, 0x00, 0x99, 0x99, 0x98, 0x96, 0x66, 0x68, 0x90,
-  0x00, 0x98, 0x88, 0x88, 0x96, 0x66, 0x68, 0x90, 0x00, 0x09, 0x99, 0x99, 0x66, 0x66, 0x68, 0x90,
-  0x00, 0x09, 0x66, 0x66, 0x69, 0x66, 0x68, 0x90, 0x00, 0x28, 0x66, 0x66, 0x96, 0x66, 0x68, 0x90,
-  0x09, 0x22, 0x26, 0x79, 0x22, 0x49, 0x68, 0x90, 0x09, 0x22, 0x74, 0x42, 0x24, 0x96, 0x68, 0x90,
-  0x09, 0x95, 0x59, 0x99, 0x99, 0x99, 0x99, 0x00, 0x09, 0x95, 0x55, 0x55, 0x55, 0x59, 0x90, 0x00,
-  0x09, 0x95, 0x59, 0x99, 0x99, 0x99, 0x90, 0x00, 0x98, 0x97, 0x89, 0x90, 0x00, 0x09, 0x90, 0x00,
-  0x99, 0x77, 0x89, 0x90, 0x00, 0x09, 0x90, 0x00
-};
-
-#endif
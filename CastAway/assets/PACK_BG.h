@@ -0,0 +1,12 @@
+#ifndef PACK_BG_H_
+#define PACK_BG_H_
+
+#include <Arduino.h>
+
+// Generated by tools/ca_assetc.cpp (8bpp rows of BACKGROUND in CASTAWAY.PAK; CA_ASSET_PACK)
+//  ca_assetc -bg -pack CASTAWAY.PAK -o CastAway/assets/PACK_BG.h CastAway/assets/BACKGROUND.h
+// BG8_W x BG8_H and BG8_pal565 are in the source header
+
+const uint32_t BG8_pack = 0;   // 160 x 120 indices, row-major
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef PACK_FISH_H_
+#define PACK_FISH_H_
+
+#include <Arduino.h>
+
+// Generated by tools/ca_assetc.cpp (4bpp, idx0 transparent, rows in CASTAWAY.PAK)
+//  ca_assetc -nocrop -pack CASTAWAY.PAK -o CastAway/assets/PACK_FISH.h CastAway/assets/FISH1.h CastAway/assets/FISH2.h
+
+const uint16_t FISH1_W = 26;
+const uint16_t FISH1_H = 10;
+const uint8_t FISH1_KEY = 0;
+
+const uint16_t FISH1_pal565[16] PROGMEM = {
+  0x0000, 0xC42A, 0xABC9, 0x9B69, 0xB204, 0x9A45, 0xA1C3, 0x9183, 0x7963, 0x4123, 0x3104, 0x3103, 0x38E2, 0x3103, 0x3103, 0x0000
+};
+const uint32_t FISH1_pack = 19200;   // 10 rows of 13 B
+
+const uint16_t FISH2_W = 24;
+const uint16_t FISH2_H = 10;
+const uint8_t FISH2_KEY = 0;
+
+const uint16_t FISH2_pal565[16] PROGMEM = {
+  0x0000, 0xC42A, 0xABC9, 0x9368, 0xB204, 0xA225, 0x99A3, 0x7963, 0x5943, 0x3904, 0x3103, 0x3103, 0x30E3, 0x80E1, 0x38C2, 0x0000
+};
+const uint32_t FISH2_pack = 19330;   // 10 rows of 12 B
+
+#endif
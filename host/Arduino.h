@@ -0,0 +1,55 @@
+#ifndef CA_HOST_ARDUINO_H
+#define CA_HOST_ARDUINO_H
+
+// -----------------------------------------------------------------------------
+// Host stand-in for the Arduino core: just what CastAway uses, so the sketch
+// sources build and run on Linux (see castaway_host.cpp). Time is a virtual
+// clock the host program advances; nothing here sleeps
+// -----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+
+#define A0 14
+#define A2 16
+#define A3 17
+#define OUTPUT 1
+#define INPUT  0
+
+namespace CA_Host {
+  extern uint32_t nowMs;               // virtual millis()
+  extern uint32_t nowUs;               // virtual micros()
+}
+
+inline unsigned long millis() { return CA_Host::nowMs; }
+inline unsigned long micros() { return CA_Host::nowUs; }
+inline void delay(unsigned long ms) { CA_Host::nowMs += ms; CA_Host::nowUs += ms * 1000ul; }
+inline int  analogRead(int) { return 0; }
+inline void randomSeed(unsigned long) {}
+inline long random(long hi) { return hi > 0 ? rand() % hi : 0; }
+inline long random(long lo, long hi) { return hi > lo ? lo + rand() % (hi - lo) : lo; }
+inline void pinMode(int, int) {}
+inline long map(long x, long a, long b, long c, long d) { return (x - a) * (d - c) / (b - a) + c; }
+template<class T> T constrain(T v, T a, T b) { return v < a ? a : (v > b ? b : v); }
+
+// Byte sink, as in the core (Serial is one); host programs derive file sinks
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t b) = 0;
+  virtual size_t write(const uint8_t* p, size_t n) {
+    size_t k = 0;
+    while (n--) k += write(*p++);
+    return k;
+  }
+};
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef CA_HOST_MCUFRIEND_KBV_H
+#define CA_HOST_MCUFRIEND_KBV_H
+
+// -----------------------------------------------------------------------------
+// Host mock of the MCUFRIEND_kbv parallel TFT (landscape 320x240, rotation 1;
+// build with -DCA_HOST_TFT_W=480 -DCA_HOST_TFT_H=320 for an ILI9486 panel)
+//
+// Keeps the controller's GRAM as a framebuffer and models what the renderer
+// relies on: address windows with auto-increment, pushColors() streaming and
+// the vertical scrolling area. As on the ILI93xx, scrolling runs along the
+// panel's native rows, which are screen columns in landscape: vertScroll()
+// changes what is shown, never what is stored. shown() gives the picture on
+// the glass, gram() the memory. Counters let a host program measure traffic
+// -----------------------------------------------------------------------------
+#include "Arduino.h"
+
+#ifndef CA_HOST_TFT_W
+#define CA_HOST_TFT_W 320
+#endif
+#ifndef CA_HOST_TFT_H
+#define CA_HOST_TFT_H 240
+#endif
+
+class MCUFRIEND_kbv {
+public:
+  static const int16_t W = CA_HOST_TFT_W, H = CA_HOST_TFT_H;
+
+  // Traffic counters
+  uint32_t pixelsPushed = 0;
+  uint32_t windowsSet   = 0;
+  uint32_t scrollCalls  = 0;
+  // Called on every setAddrWindow() when set (e.g. to compare against a log)
+  void (*onWindow)(int16_t x0, int16_t y0, int16_t x1, int16_t y1) = nullptr;
+
+  void     reset() {}
+  uint16_t readID() { return W == 480 ? 0xD3D3 : 0x9341; }
+  void     begin(uint16_t) {}
+  void     setRotation(uint8_t) {}
+  int16_t  width()  const { return W; }
+  int16_t  height() const { return H; }
+
+  void startWrite() {}
+  void endWrite() {}
+
+  void setAddrWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    wx0 = x0; wy0 = y0; wx1 = x1; wy1 = y1; cx = x0; cy = y0;
+    ++windowsSet;
+    if (onWindow) onWindow(x0, y0, x1, y1);
+  }
+  void pushColors(uint16_t* p, int16_t n, bool /*first*/) {
+    for (int16_t i = 0; i < n; ++i) {
+      put(cx, cy, p[i]);
+      ++pixelsPushed;
+      if (++cx > wx1) { cx = wx0; if (++cy > wy1) cy = wy0; }
+    }
+  }
+
+  void fillScreen(uint16_t c) { fillRect(0, 0, W, H, c); }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+    for (int16_t j = y; j < y + h; ++j) for (int16_t i = x; i < x + w; ++i) put(i, j, c);
+  }
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+    fillRect(x, y, w, 1, c); fillRect(x, (int16_t)(y + h - 1), w, 1, c);
+    fillRect(x, y, 1, h, c); fillRect((int16_t)(x + w - 1), y, 1, h, c);
+  }
+
+  // Text is not rasterized on the host; calls are accepted and ignored
+  void setTextColor(uint16_t) {}
+  void setTextSize(uint8_t) {}
+  void setCursor(int16_t, int16_t) {}
+  void print(const __FlashStringHelper*) {}
+  void print(const char*) {}
+
+  // Vertical scrolling area along the native rows (= screen x here):
+  // screen column top+i shows GRAM column top + ((i + offset) mod lines)
+  void vertScroll(int16_t top, int16_t lines, int16_t offset) {
+    scTop = top; scLines = lines;
+    scOff = lines > 0 ? (int16_t)(((offset % lines) + lines) % lines) : 0;
+    ++scrollCalls;
+  }
+
+  uint16_t gram(int16_t x, int16_t y) const { return fb[y][x]; }
+  uint16_t shown(int16_t x, int16_t y) const {
+    if (scLines > 0 && x >= scTop && x < scTop + scLines)
+      x = (int16_t)(scTop + (x - scTop + scOff) % scLines);
+    return fb[y][x];
+  }
+
+private:
+  uint16_t fb[H][W] = {};
+  int16_t  wx0 = 0, wy0 = 0, wx1 = W - 1, wy1 = H - 1, cx = 0, cy = 0;
+  int16_t  scTop = 0, scLines = 0, scOff = 0;
+
+  void put(int16_t x, int16_t y, uint16_t c) {
+    if ((uint16_t)x < (uint16_t)W && (uint16_t)y < (uint16_t)H) fb[y][x] = c;
+  }
+};
+
+#endif
@@ -0,0 +1,4 @@
+#ifndef CA_HOST_SPI_H
+#define CA_HOST_SPI_H
+// Host stand-in: the parallel TFT shield needs nothing from SPI
+#endif
@@ -0,0 +1,18 @@
+#ifndef CA_HOST_TOUCHSCREEN_H
+#define CA_HOST_TOUCHSCREEN_H
+
+// Host stand-in for the resistive touch panel. The host program sets the raw
+// reading (same units the real panel returns; z < 150 means "not touched")
+struct TSPoint { int x, y, z; };
+
+namespace CA_Host {
+  extern TSPoint touch;
+}
+
+class TouchScreen {
+public:
+  TouchScreen(int, int, int, int, int) {}
+  TSPoint getPoint() { return CA_Host::touch; }
+};
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef CA_HOST_PGMSPACE_H
+#define CA_HOST_PGMSPACE_H
+
+// Host stand-in: flash and RAM share one address space
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char*
+#define pgm_read_byte(p)  (*(const uint8_t*)(p))
+#define pgm_read_word(p)  (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define pgm_read_ptr(p)   (*(void* const*)(p))
+#define memcpy_P  memcpy
+#define strncpy_P strncpy
+
+#endif
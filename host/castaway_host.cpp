@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------
+// castaway_host.cpp
+// Runs the CastAway sketch sources on Linux against the mocks in this folder
+// (virtual clock, scripted touch, framebuffer TFT) and writes what the panel
+// would show as a PPM. Build from the repository root:
+//
+//   g++ -std=gnu++11 -O2 -Ihost -ICastAway host/castaway_host.cpp CastAway/*.cpp -o castaway_host
+//
+// Usage: castaway_host [frames] [out.ppm] [options]
+//   -ms N              frame time in ms (default 33)
+//   -scroll A0 LEN PX  hardware-scroll the band [A0, A0+LEN) by PX each tick
+//   -reel              hold the stylus down in bursts (reels when a fish bites)
+//   -caught N          start with N fish caught (10 empties the lake)
+//   -tap F X Y         tap screen point (X,Y) for frames F..F+2 (repeatable)
+//   -hash              print a hash of the shown picture after every frame
+//   -rec FILE          record the render command log (see castaway_replay.cpp)
+// Built with -DCA_ASSET_PACK=1 it streams the background and fish from
+// CASTAWAY.PAK in the working directory (tools/ca_assetc -pack)
+// -----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <TouchScreen.h>
+#include "CastAway.h"
+
+namespace CA_Host {
+  uint32_t nowMs = 1000;
+  uint32_t nowUs = 1000000ul;
+  TSPoint  touch = { 0, 0, 0 };
+}
+
+static MCUFRIEND_kbv s_tft;
+static CastAwayGame  s_game;
+
+// Render log sink: a plain file
+class FilePrint : public Print {
+public:
+  FILE* f = nullptr;
+  size_t write(uint8_t b) { return fputc(b, f) == EOF ? 0 : 1; }
+};
+static FilePrint        s_recOut;
+static CA_FrameRegistry s_frames;
+static CA_RenderLog     s_log;
+
+static uint64_t hashShown() {
+  uint64_t h = 1469598103934665603ull;
+  for (int16_t y = 0; y < MCUFRIEND_kbv::H; ++y)
+    for (int16_t x = 0; x < MCUFRIEND_kbv::W; ++x) { h ^= s_tft.shown(x, y); h *= 1099511628211ull; }
+  return h;
+}
+
+static bool writePPM(const char* path) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P6 %d %d 255\n", MCUFRIEND_kbv::W, MCUFRIEND_kbv::H);
+  for (int16_t y = 0; y < MCUFRIEND_kbv::H; ++y)
+    for (int16_t x = 0; x < MCUFRIEND_kbv::W; ++x) {
+      const uint16_t c = s_tft.shown(x, y);
+      const unsigned char rgb[3] = { (unsigned char)((c >> 11) << 3),
+                                     (unsigned char)(((c >> 5) & 63) << 2),
+                                     (unsigned char)((c & 31) << 3) };
+      fwrite(rgb, 1, 3, f);
+    }
+  fclose(f);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  int frames = 600;
+  const char* out = "castaway.ppm";
+  int ms = 33;
+  int scA0 = 0, scLen = 0, scPx = 0;
+  bool reel = false, hash = false;
+  int caught = -1;
+  int tapF[8], tapX[8], tapY[8], taps = 0;
+  const char* rec = nullptr;
+
+  int pos = 0;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-ms") && i + 1 < argc) ms = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-scroll") && i + 3 < argc) {
+      scA0 = atoi(argv[++i]); scLen = atoi(argv[++i]); scPx = atoi(argv[++i]);
+    }
+    else if (!strcmp(argv[i], "-reel")) reel = true;
+    else if (!strcmp(argv[i], "-caught") && i + 1 < argc) caught = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-tap") && i + 3 < argc && taps < 8) {
+      tapF[taps] = atoi(argv[++i]); tapX[taps] = atoi(argv[++i]); tapY[taps] = atoi(argv[++i]); ++taps;
+    }
+    else if (!strcmp(argv[i], "-hash")) hash = true;
+    else if (!strcmp(argv[i], "-rec") && i + 1 < argc) rec = argv[++i];
+    else if (pos == 0) { frames = atoi(argv[i]); ++pos; }
+    else if (pos == 1) { out = argv[i]; ++pos; }
+  }
+
+  if (rec) {
+    s_recOut.f = fopen(rec, "wb");
+    if (!s_recOut.f) { fprintf(stderr, "cannot write %s\n", rec); return 1; }
+    CastAwayGame::registerFrames(s_frames);
+    s_log.begin(s_recOut, &s_frames);
+    s_game.setRenderLog(&s_log);
+  }
+
+  if (caught >= 0) s_game.setCaughtCount((uint16_t)caught);
+  s_game.begin(&s_tft);
+  if (scLen) s_game.setScrollBand((int16_t)scA0, (int16_t)scLen, (int8_t)scPx);
+
+  int f = 1;
+  for (; f <= frames && s_game.isActive(); ++f) {
+    CA_Host::nowMs += (uint32_t)ms;
+    CA_Host::nowUs = CA_Host::nowMs * 1000ul;
+    // Raw panel reading at the screen center while "held"
+    CA_Host::touch.z = (reel && (f / 7) % 3 == 0) ? 500 : 0;
+    CA_Host::touch.x = 512; CA_Host::touch.y = 489;
+    for (int t = 0; t < taps; ++t) {
+      if (f < tapF[t] || f > tapF[t] + 2) continue;
+      // Inverse of CA_Draw::getTouchScreen()'s calibration (raw y -> screen x)
+      CA_Host::touch.z = 500;
+      CA_Host::touch.y = (int16_t)(71 + (tapX[t] * 836 + 319) / 320);
+      CA_Host::touch.x = (int16_t)(94 + (tapY[t] * 837 + 239) / 240);
+    }
+    s_game.tick();
+    if (hash) printf("f%d %016llx\n", f, (unsigned long long)hashShown());
+  }
+
+  printf("frames %d  pixels %lu (%lu/frame)  windows %lu  scrolls %lu\n",
+         f - 1, (unsigned long)s_tft.pixelsPushed,
+         (unsigned long)(s_tft.pixelsPushed / (uint32_t)(f > 1 ? f - 1 : 1)),
+         (unsigned long)s_tft.windowsSet, (unsigned long)s_tft.scrollCalls);
+  if (CA_Draw::paletteOverflows())
+    printf("palette overflows: %u (raise CA_PAL_SLOTS)\n", (unsigned)CA_Draw::paletteOverflows());
+#if CA_ASSET_PACK
+  const CA_Asset::Stats& as = CA_Asset::stats();
+  printf("pack rows: %lu hits  %lu misses  %lu reads (%lu bytes)\n", (unsigned long)as.hits,
+         (unsigned long)as.misses, (unsigned long)as.reads, (unsigned long)as.bytes);
+#endif
+  if (rec) {
+    fclose(s_recOut.f);
+    printf("log %s: %lu bytes\n", rec, (unsigned long)s_log.bytes());
+  }
+  if (!writePPM(out)) { fprintf(stderr, "cannot write %s\n", out); return 1; }
+  return 0;
+}
@@ -0,0 +1,366 @@
+// -----------------------------------------------------------------------------
+// castaway_replay.cpp
+// Feeds a render command log (CA_RenderLog: `castaway_host -rec`, or a board's
+// Serial capture) back through CA_Render against the framebuffer mock, so the
+// same frame sequence can be re-rendered after a kernel or dirty-tracking
+// change. Every frame's address windows are checked against the recorded
+// ones; the time spent in renderFrame() is measured on the host clock.
+// Build from the repository root:
+//
+//   g++ -std=gnu++11 -O2 -Ihost -ICastAway host/castaway_replay.cpp CastAway/*.cpp -o castaway_replay
+//
+// Usage: castaway_replay log.cal [out.ppm] [options]
+//   -hash              print a hash of the shown picture after every frame
+//   -repeat N          replay N times and report the fastest pass
+//
+// The replay starts from drawBackground() with the stock palette, as begin()
+// does on the board. Queue capacities come from the log header
+// -----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include <TouchScreen.h>
+#include "CastAway.h"
+
+namespace CA_Host {
+  uint32_t nowMs = 1000;
+  uint32_t nowUs = 1000000ul;
+  TSPoint  touch = { 0, 0, 0 };
+}
+
+// A renderer with the recording's capacities, allocated at run time.
+// `lcap` holds the sprite layer caps (world, FG, extra layers), `cap` the
+// rect, bar, text, world box, UI box and line caps
+class ReplayRender : public CA_Render {
+public:
+  ReplayRender(uint8_t nl, const uint8_t lcap[], const uint8_t cap[6], uint16_t fgcPx)
+    : spr(lcap[0] + 1u), sprOrd(lcap[0] + 1u), sprVis(lcap[0] + 1u),
+      fg(lcap[1] + 1u), fgOrd(lcap[1] + 1u), fgVis(lcap[1] + 1u),
+      x((nl - 2u) * xc(nl, lcap) + 1u), xOrd(x.size()), xVis(x.size()), layers(nl + 1u),
+      rec(cap[0]), recOrd(cap[0]), bar(cap[1]), barOrd(cap[1]), txt(cap[2]), txtOrd(cap[2]),
+      lin(cap[5]), linOrd(cap[5]), wbox(cap[3]), ui(cap[4]), fgc(fgcPx + 1u), fgcMask((fgcPx + 7u) / 8u + 1u) {
+    Pools p;
+    p.spr = spr.data(); p.sprOrd = sprOrd.data(); p.sprVis = sprVis.data(); p.sprCap = lcap[0];
+    p.fg  = fg.data();  p.fgOrd  = fgOrd.data();  p.fgVis  = fgVis.data();  p.fgCap  = lcap[1];
+    p.x   = x.data();   p.xOrd   = xOrd.data();   p.xVis   = xVis.data();   p.xCap   = xc(nl, lcap);
+    p.xl  = (uint8_t)(nl - 2); p.layers = layers.data();
+    p.rec = rec.data(); p.recOrd = recOrd.data(); p.recCap = cap[0];
+    p.bar = bar.data(); p.barOrd = barOrd.data(); p.barCap = cap[1];
+    p.txt = txt.data(); p.txtOrd = txtOrd.data(); p.txtCap = cap[2];
+    p.lin = lin.data(); p.linOrd = linOrd.data(); p.linCap = cap[5];
+    p.wbox = wbox.data(); p.wbCap = cap[3];
+    p.ui   = ui.data();   p.uibCap = cap[4];
+    p.fgc = fgc.data(); p.fgcMask = fgcMask.data(); p.fgcCap = fgcPx;
+    attachPools(p);
+  }
+
+private:
+  // Extra layers share one cap (CA_RenderCaps::XSPR)
+  static uint8_t xc(uint8_t nl, const uint8_t lcap[]) { return nl > 2 ? lcap[2] : 0; }
+
+  std::vector<Sprite> spr; std::vector<uint8_t> sprOrd, sprVis;
+  std::vector<Sprite> fg;  std::vector<uint8_t> fgOrd, fgVis;
+  std::vector<Sprite> x;   std::vector<uint8_t> xOrd, xVis;
+  std::vector<Layer>  layers;
+  std::vector<Rect>   rec; std::vector<uint8_t> recOrd;
+  std::vector<HBar>   bar; std::vector<uint8_t> barOrd;
+  std::vector<Text>   txt; std::vector<uint8_t> txtOrd;
+  std::vector<Line>   lin; std::vector<uint8_t> linOrd;
+  std::vector<Box>    wbox, ui;
+  std::vector<uint16_t> fgc; std::vector<uint8_t> fgcMask;
+};
+
+struct Win { int16_t x0, y0, x1, y1; };
+static std::vector<Win> s_expected, s_actual;
+
+static void onWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  const Win w = { x0, y0, x1, y1 };
+  s_actual.push_back(w);
+}
+
+// Little-endian reader over the whole log
+struct Reader {
+  const uint8_t* p; size_t n, pos;
+  bool ok;
+  bool need(size_t k) { if (pos + k > n) ok = false; return ok; }
+  uint8_t  u8()  { if (!need(1)) return 0; return p[pos++]; }
+  uint16_t u16() { const uint16_t lo = u8(); return (uint16_t)(lo | (u8() << 8)); }
+  int16_t  i16() { return (int16_t)u16(); }
+  uint32_t u32() { const uint32_t lo = u16(); return lo | ((uint32_t)u16() << 16); }
+};
+
+static uint64_t hashShown(const MCUFRIEND_kbv& tft) {
+  uint64_t h = 1469598103934665603ull;
+  for (int16_t y = 0; y < MCUFRIEND_kbv::H; ++y)
+    for (int16_t x = 0; x < MCUFRIEND_kbv::W; ++x) { h ^= tft.shown(x, y); h *= 1099511628211ull; }
+  return h;
+}
+
+static bool writePPM(const MCUFRIEND_kbv& tft, const char* path) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P6 %d %d 255\n", MCUFRIEND_kbv::W, MCUFRIEND_kbv::H);
+  for (int16_t y = 0; y < MCUFRIEND_kbv::H; ++y)
+    for (int16_t x = 0; x < MCUFRIEND_kbv::W; ++x) {
+      const uint16_t c = tft.shown(x, y);
+      const unsigned char rgb[3] = { (unsigned char)((c >> 11) << 3),
+                                     (unsigned char)(((c >> 5) & 63) << 2),
+                                     (unsigned char)((c & 31) << 3) };
+      fwrite(rgb, 1, 3, f);
+    }
+  fclose(f);
+  return true;
+}
+
+static double nowSec() {
+  timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+}
+
+struct PassResult {
+  uint32_t frames, pixels, windows, mismatches, unknown;
+  double   renderSec;
+};
+
+// One pass over the log; false on a malformed log
+static bool replay(const std::vector<uint8_t>& log, const CA_FrameRegistry& frames,
+                   MCUFRIEND_kbv& tft, bool hash, PassResult& res) {
+  typedef CA_RenderLog L;
+  Reader rd = { log.data(), log.size(), 0, true };
+  if (rd.u8() != 'C' || rd.u8() != 'A' || rd.u8() != 'L' || rd.u8() != L::VERSION) {
+    fprintf(stderr, "not a version %u render log\n", (unsigned)L::VERSION);
+    return false;
+  }
+  const int16_t W = rd.i16(), H = rd.i16();
+  const uint8_t nl = rd.u8();
+  uint8_t lcap[256], cap[6];
+  for (uint16_t i = 0; i < nl; ++i) lcap[i] = rd.u8();
+  for (uint8_t i = 0; i < 6; ++i) cap[i] = rd.u8();
+  const uint16_t fgcPx = rd.u16();
+  if (!rd.ok || nl < 2) {
+    fprintf(stderr, "bad log header\n");
+    return false;
+  }
+  if (W != MCUFRIEND_kbv::W || H != MCUFRIEND_kbv::H) {
+    fprintf(stderr, "log is for a %dx%d screen\n", W, H);
+    return false;
+  }
+
+  // Same starting point as begin(): stock palette, full background
+  uint16_t* pal = CA_Draw::getBgPaletteRAM();
+  for (uint16_t i = 0; i < 256; ++i) pal[i] = pgm_read_word(&BG8_pal565[i]);
+  CA_BlitConfig cfg;
+  CA_Draw::init(cfg, &tft, 1);
+  CA_Draw::drawBackground(cfg);
+
+  ReplayRender r(nl, lcap, cap, fgcPx);
+  r.begin(&cfg);
+  r.setBgPalette(pal);
+  CA_WaterFx fx;
+  fx.begin(cfg, pal);
+  fx.loadState(nullptr, 0);
+  r.setWaterFx(&fx);
+  CA_Particles parts;
+  parts.begin(cfg, pal, 0);
+  r.setParticles(&parts);
+
+  memset(&res, 0, sizeof(res));
+  const uint32_t px0 = tft.pixelsPushed, win0 = tft.windowsSet;
+  bool open = false;   // windows of the last rendered frame still being read
+  auto closeFrame = [&]() {
+    if (!open) return;
+    bool same = s_expected.size() == s_actual.size();
+    for (size_t i = 0; same && i < s_actual.size(); ++i)
+      same = !memcmp(&s_expected[i], &s_actual[i], sizeof(Win));
+    if (!same) ++res.mismatches;
+    if (hash) printf("f%lu %016llx%s\n", (unsigned long)res.frames,
+                     (unsigned long long)hashShown(tft), same ? "" : " windows differ");
+    open = false;
+  };
+
+  tft.onWindow = onWindow;
+  while (rd.ok && rd.pos < rd.n) {
+    const uint8_t op = rd.u8();
+    switch (op) {
+      case L::OP_DIRTY_UI: {
+        const int16_t x = rd.i16(), y = rd.i16(), w = rd.i16(), h = rd.i16();
+        r.addDirtyRect(x, y, w, h);
+      } break;
+      case L::OP_DIRTY_WORLD: {
+        const int16_t x = rd.i16(), y = rd.i16(), w = rd.i16(), h = rd.i16();
+        r.addDirtyWorldRect(x, y, w, h, rd.u8());
+      } break;
+      case L::OP_BG_SPANS: {
+        // The renderer keeps the list until it is drawn: point into the log
+        const uint16_t n = rd.u16();
+        if (!rd.need((size_t)n * 3)) break;
+        r.addDirtyBgSpans_P(reinterpret_cast<const uint8_t (*)[3]>(rd.p + rd.pos), n);
+        rd.pos += (size_t)n * 3;
+      } break;
+      case L::OP_LAYER_DIRTY: r.markLayerDirty(rd.u8()); break;
+      case L::OP_LAYER: {
+        CA_Render::LayerDesc d;
+        const uint8_t l = rd.u8();
+        d.kind = CA_Render::LK_SPRITES;   // kept by setLayer()
+        d.dirty = rd.u8(); d.prio = rd.u8(); d.cached = rd.u8() != 0;
+        d.zMin = rd.i16(); d.zMax = rd.i16();
+        r.setLayer(l, d);
+      } break;
+      case L::OP_SCROLL_BAND: {
+        const int16_t a0 = rd.i16(), len = rd.i16();
+        r.setScrollBand(a0, len, rd.u8() != 0);
+      } break;
+      case L::OP_SCROLL_BY: r.scrollBy(rd.i16()); break;
+      case L::OP_BG_BAND: {
+        const uint8_t i = rd.u8(), row0 = rd.u8(), rows = rd.u8();
+        r.setBgBand(i, row0, rows);
+        r.setBgBandOffset(i, rd.i16());
+      } break;
+      case L::OP_BG_ORIGIN: {
+        const int16_t ox = rd.i16();
+        r.setBgOrigin(ox, rd.i16());
+      } break;
+      case L::OP_BG_ROWS: {
+        const int16_t row0 = rd.i16();
+        r.addDirtyBgRows(row0, rd.i16());
+      } break;
+      case L::OP_CONFIG: {
+        const uint32_t px = rd.u32(), us = rd.u32(), il = rd.u32();
+        r.setPixelBudget(px); r.setTimeBudgetUs(us); r.setInterlaceArea(il);
+        r.setFrameSkip(rd.u8() != 0);
+      } break;
+      case L::OP_BG_PAL: {
+        const uint8_t b = rd.u8();
+        for (uint8_t k = 0; k < 16; ++k) pal[((b & 15) << 4) + k] = rd.u16();
+      } break;
+      case L::OP_SPR_PAL: {
+        const CA_Frame4* f = frames.frame(rd.u8());
+        uint16_t* p = f ? CA_Draw::ensurePaletteRAM(f->pal565) : nullptr;
+        for (uint8_t k = 0; k < 16; ++k) { const uint16_t c = rd.u16(); if (p) p[k] = c; }
+      } break;
+      case L::OP_SHIMMER: {
+        const uint8_t n = rd.u8();
+        if (!rd.need(n)) break;
+        fx.loadState(rd.p + rd.pos, n);
+        rd.pos += n;
+      } break;
+      case L::OP_PARTICLES: {
+        const uint8_t n = rd.u8();
+        if (!rd.need(n)) break;
+        parts.loadState(rd.p + rd.pos, n);
+        rd.pos += n;
+      } break;
+      case L::OP_SPR: {
+        const uint8_t l = rd.u8(), id = rd.u8();
+        const int16_t vx = rd.i16(), vy = rd.i16();
+        const bool flip = rd.u8() != 0;
+        const int16_t z = rd.i16();
+        const CA_Frame4* f = frames.frame(id);
+        if (!f) { ++res.unknown; break; }
+        uint16_t* fp = CA_Draw::ensurePaletteRAM(f->pal565);
+        r.addSpriteTo(l, *f, vx, vy, flip, fp, z);
+      } break;
+      case L::OP_SOLID:
+      case L::OP_OUTLINE: {
+        const int16_t x = rd.i16(), y = rd.i16(), w = rd.i16(), h = rd.i16();
+        const uint16_t c = rd.u16();
+        const int16_t z = rd.i16();
+        if (op == L::OP_SOLID) r.addSolid(x, y, w, h, c, z);
+        else                   r.addOutline(x, y, w, h, c, z);
+      } break;
+      case L::OP_BAR: {
+        const int16_t x = rd.i16(), y = rd.i16(), w = rd.i16(), h = rd.i16(), fill = rd.i16();
+        const uint16_t c = rd.u16();
+        r.addHBar(x, y, w, h, fill, c, rd.i16());
+      } break;
+      case L::OP_TEXT: {
+        const int16_t x = rd.i16(), y = rd.i16();
+        const uint16_t c = rd.u16();
+        const int16_t z = rd.i16();
+        const uint8_t n = rd.u8();
+        char s[256];
+        for (uint8_t k = 0; k < n; ++k) s[k] = (char)rd.u8();
+        s[n] = 0;
+        r.addText(s, x, y, c, z);
+      } break;
+      case L::OP_LINE: {
+        const int16_t xa = rd.i16(), ya = rd.i16(), xb = rd.i16(), yb = rd.i16();
+        const uint16_t c = rd.u16();
+        r.addLine(xa, ya, xb, yb, c, rd.i16());
+      } break;
+      case L::OP_RENDER: {
+        closeFrame();
+        s_expected.clear(); s_actual.clear();
+        const double t0 = nowSec();
+        r.renderFrame();
+        res.renderSec += nowSec() - t0;
+        ++res.frames;
+        open = true;
+      } break;
+      case L::OP_WINDOW: {
+        Win w;
+        w.x0 = rd.i16(); w.y0 = rd.i16(); w.x1 = rd.i16(); w.y1 = rd.i16();
+        s_expected.push_back(w);
+      } break;
+      default:
+        fprintf(stderr, "bad record %u at byte %lu\n", (unsigned)op, (unsigned long)(rd.pos - 1));
+        return false;
+    }
+  }
+  closeFrame();
+  tft.onWindow = nullptr;
+  if (!rd.ok) fprintf(stderr, "log ends inside a record (frame %lu)\n", (unsigned long)res.frames);
+  res.pixels  = tft.pixelsPushed - px0;
+  res.windows = tft.windowsSet - win0;
+  return true;
+}
+
+int main(int argc, char** argv) {
+  const char* in = nullptr;
+  const char* out = nullptr;
+  bool hash = false;
+  int repeat = 1;
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-hash")) hash = true;
+    else if (!strcmp(argv[i], "-repeat") && i + 1 < argc) repeat = atoi(argv[++i]);
+    else if (!in) in = argv[i];
+    else if (!out) out = argv[i];
+  }
+  if (!in) { fprintf(stderr, "usage: castaway_replay log.cal [out.ppm] [-hash] [-repeat N]\n"); return 2; }
+  if (repeat < 1) repeat = 1;
+
+  std::vector<uint8_t> log;
+  FILE* f = fopen(in, "rb");
+  if (!f) { fprintf(stderr, "cannot read %s\n", in); return 1; }
+  uint8_t buf[4096];
+  size_t k;
+  while ((k = fread(buf, 1, sizeof(buf), f)) > 0) log.insert(log.end(), buf, buf + k);
+  fclose(f);
+
+  CA_FrameRegistry frames;
+  CastAwayGame::registerFrames(frames);
+
+  static MCUFRIEND_kbv tft;
+  PassResult best = {};
+  for (int pass = 0; pass < repeat; ++pass) {
+    PassResult res;
+    tft = MCUFRIEND_kbv();
+    if (!replay(log, frames, tft, hash && pass == 0, res)) return 1;
+    if (pass == 0 || res.renderSec < best.renderSec) best = res;
+  }
+
+  printf("frames %lu  pixels %lu (%lu/frame)  windows %lu  window mismatches %lu\n",
+         (unsigned long)best.frames, (unsigned long)best.pixels,
+         (unsigned long)(best.pixels / (best.frames ? best.frames : 1)),
+         (unsigned long)best.windows, (unsigned long)best.mismatches);
+  printf("renderFrame %.3f ms total, %.1f us/frame%s\n", best.renderSec * 1e3,
+         best.frames ? best.renderSec * 1e6 / best.frames : 0.0,
+         repeat > 1 ? " (fastest pass)" : "");
+  if (best.unknown) printf("%lu sprites with unregistered frames skipped\n", (unsigned long)best.unknown);
+  if (out && !writePPM(tft, out)) { fprintf(stderr, "cannot write %s\n", out); return 1; }
+  return best.mismatches ? 3 : 0;
+}
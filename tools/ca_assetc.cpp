@@ -0,0 +1,1056 @@
+// ca_assetc: offline asset compiler for CastAway
+//
+//   g++ -std=gnu++11 -O2 tools/ca_assetc.cpp -o ca_assetc
+//
+// Reads 4bpp sprite frames and writes one engine header for the set, in the
+// layout png_converter_gui.py uses (NAME_W, NAME_H, NAME_pal565, NAME_data;
+// rows padded to whole bytes, high nibble first), so the output drops in for
+// hand-converted files. Inputs, one frame each:
+//   *.png  indexed (1/2/4/8-bit), RGB or RGBA, non-interlaced; at most 16
+//          colors including the transparent one (tRNS/alpha < 128, or the
+//          top-left pixel's color when the image has no transparency)
+//   *.h    a png_converter_gui.py 4bpp header (transparent = top-left index),
+//          or a frame of one this tool wrote: FILE.h:FRAME
+// Append =NAME to an input to pick its asset name (default: FRAME or the file
+// stem). A set can so be rebuilt from its own header; the command line that
+// made it is in the header's second comment line.
+//
+// On the way through, frames are:
+//   - renumbered so the transparent index is 0 (NAME_KEY, always 0)
+//   - cropped to their opaque pixels; NAME_OX/NAME_OY place the crop in the
+//     original frame (-nocrop keeps the full size)
+//   - matched against the palettes already emitted for the set: a frame whose
+//     colors all appear in one of them is renumbered onto it. With -merge a
+//     frame that does not fit also tries the entries no frame uses yet, so a
+//     whole animation (or several) can end up on one palette. A palette used
+//     by more than one frame is emitted once as SET_pal565 (SET_pal565_2, ...)
+//     and each frame's NAME_pal565 becomes a #define of it
+// Options:
+//   -o FILE   output header (required); -set NAME   guard/prefix (FILE's stem)
+//   -nocrop   keep frame sizes
+//   -merge    fill unused palette entries with the colors of later frames
+//   -rows     NAME_rows[H][2]: opaque [x0, x1) per row, {0, 0} when empty
+//   -delta    store a frame as the rows it changes against an earlier frame of
+//             the same size and palette (its keyframe) when that takes under
+//             3/4 of the frame's bytes: NAME_data is a #define of the
+//             keyframe's and NAME_delta holds
+//               y0, n, x0, x1   rows [y0, y0+n) differ, within pixels [x0, x1)
+//               n x { b0, b1, off (u16) }   per row: bytes [b0, b1) of the
+//                               keyframe's row are replaced by the b1-b0 bytes
+//                               at off (from the end of this table)
+//               the replacement bytes
+//             Keyframes get NAME_delta = nullptr (CA_Frame4::delta)
+//   -rle      NAME_rle + NAME_rle_row[H+1] instead of NAME_data. Per row:
+//             c < 0x80 skips c+1 transparent pixels, c >= 0x80 is followed
+//             by (c & 0x7F)+1 pixels packed like NAME_data. A row ends at the
+//             next row's offset; trailing transparent pixels are not stored
+//   -bg       background instead of sprites: the one input is an 8bpp
+//             png_converter_gui.py QUADRANTS header (PREFIX_q0..q3), written
+//             as PREFIX_rle + PREFIX_rle_row[H+1] (CA_RleBg). Per row,
+//             c < 0x80 is followed by c+1 indices, c >= 0x80 repeats the next
+//             index (c & 0x7F)+3 times. Size and palette stay in the input
+//   -cycle I,I,...  with -bg: the palette-cycle span map for CA_PalCycle
+//             instead, PREFIX_cyc_idx (the ring, in order) and PREFIX_cyc_span:
+//             { row, x0, len } over every source pixel using a ring index,
+//             runs less than 3 px apart merged into one span
+//   -tiles    with -bg: PREFIX_tiles (8x8 tiles of indices, each stored once;
+//             a repeat or left-right mirror of an earlier one reuses it) and
+//             PREFIX_map, the picture followed by its mirror image, for
+//             CA_TileBg (CA_BG_TILES). Map entries: tile | 0x8000 if mirrored
+//   -pack FILE  the pixels go to the end of FILE (created if missing) instead
+//             of the header, which gets their offset in it: NAME_pack for a
+//             frame (its rows as in NAME_data; no -rle or -delta), PREFIX_pack
+//             for a -bg bitmap (w x h indices, row-major). Palettes stay in
+//             the header. The game reads the file from SD (CA_ASSET_PACK);
+//             build its sets into it in the order their headers list
+// A flash report (input vs output bytes per asset) goes to stderr.
+
+#include <cctype>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// Errors: print and leave; this is a build step, not a library
+// -----------------------------------------------------------------------------
+[[noreturn]] void fail(const std::string& where, const char* what) {
+  fprintf(stderr, "ca_assetc: %s: %s\n", where.c_str(), what);
+  exit(1);
+}
+
+bool readFile(const std::string& path, std::vector<uint8_t>& out) {
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+  fclose(f);
+  return true;
+}
+
+// The header is built in memory and written with CRLF, like the rest of assets/
+std::string text;
+
+void emit(const char* fmt, ...) {
+  char buf[512];
+  va_list ap;
+  va_start(ap, fmt);
+  vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  for (const char* c = buf; *c; ++c) {
+    if (*c == '\n') text += '\r';
+    text += *c;
+  }
+}
+
+inline uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
+  return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+// -----------------------------------------------------------------------------
+// Inflate (RFC 1951): stored, fixed and dynamic Huffman blocks, canonical
+// decoding one bit at a time. Enough for PNG IDAT streams
+// -----------------------------------------------------------------------------
+struct Inflate {
+  const uint8_t* in; size_t n, pos = 0;
+  uint32_t bitBuf = 0; int bitCnt = 0;
+  std::vector<uint8_t>& out;
+  std::string where;
+
+  struct Huff { uint16_t count[16]; uint16_t symbol[288]; };
+
+  Inflate(const uint8_t* p, size_t len, std::vector<uint8_t>& o, const std::string& w)
+    : in(p), n(len), out(o), where(w) {}
+
+  int bits(int need) {
+    uint32_t v = bitBuf;
+    while (bitCnt < need) {
+      if (pos >= n) fail(where, "truncated deflate stream");
+      v |= (uint32_t)in[pos++] << bitCnt;
+      bitCnt += 8;
+    }
+    bitBuf = v >> need;
+    bitCnt -= need;
+    return (int)(v & ((1u << need) - 1));
+  }
+
+  static void build(Huff& h, const uint8_t* len, int n) {
+    uint16_t offs[16];
+    memset(h.count, 0, sizeof(h.count));
+    for (int s=0;s<n;++s) h.count[len[s]]++;
+    h.count[0] = 0;
+    offs[1] = 0;
+    for (int l=1;l<15;++l) offs[l + 1] = (uint16_t)(offs[l] + h.count[l]);
+    for (int s=0;s<n;++s) if (len[s]) h.symbol[offs[len[s]]++] = (uint16_t)s;
+  }
+
+  int decode(const Huff& h) {
+    int code = 0, first = 0, index = 0;
+    for (int l=1;l<16;++l){
+      code |= bits(1);
+      const int count = h.count[l];
+      if (code - count < first) return h.symbol[index + (code - first)];
+      index += count; first += count;
+      first <<= 1; code <<= 1;
+    }
+    fail(where, "bad Huffman code");
+  }
+
+  void codes(const Huff& lit, const Huff& dist) {
+    static const uint16_t LBASE[29] = { 3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,
+                                        35,43,51,59,67,83,99,115,131,163,195,227,258 };
+    static const uint8_t  LEXT[29]  = { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0 };
+    static const uint16_t DBASE[30] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,
+                                        1025,1537,2049,3073,4097,6145,8193,12289,16385,24577 };
+    static const uint8_t  DEXT[30]  = { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
+    for (;;){
+      int s = decode(lit);
+      if (s < 256) { out.push_back((uint8_t)s); continue; }
+      if (s == 256) return;
+      s -= 257;
+      if (s >= 29) fail(where, "bad length code");
+      const int len = LBASE[s] + bits(LEXT[s]);
+      const int d = decode(dist);
+      if (d >= 30) fail(where, "bad distance code");
+      const size_t back = (size_t)(DBASE[d] + bits(DEXT[d]));
+      if (back > out.size()) fail(where, "distance before start");
+      for (int i=0;i<len;++i) out.push_back(out[out.size() - back]);
+    }
+  }
+
+  void run() {
+    int last;
+    do {
+      last = bits(1);
+      const int type = bits(2);
+      if (type == 0) {
+        bitBuf = 0; bitCnt = 0;
+        if (pos + 4 > n) fail(where, "truncated stored block");
+        const size_t len = in[pos] | (in[pos + 1] << 8);
+        pos += 4;
+        if (pos + len > n) fail(where, "truncated stored block");
+        out.insert(out.end(), in + pos, in + pos + len);
+        pos += len;
+      } else if (type == 1) {
+        static Huff lit, dist;
+        static bool built = false;
+        if (!built) {
+          uint8_t l[288];
+          int s = 0;
+          for (; s<144; ++s) l[s] = 8;
+          for (; s<256; ++s) l[s] = 9;
+          for (; s<280; ++s) l[s] = 7;
+          for (; s<288; ++s) l[s] = 8;
+          build(lit, l, 288);
+          for (s=0; s<30; ++s) l[s] = 5;
+          build(dist, l, 30);
+          built = true;
+        }
+        codes(lit, dist);
+      } else if (type == 2) {
+        static const uint8_t ORDER[19] = { 16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15 };
+        const int nlen = bits(5) + 257, ndist = bits(5) + 1, ncode = bits(4) + 4;
+        uint8_t l[320] = {};
+        for (int i=0;i<ncode;++i) l[ORDER[i]] = (uint8_t)bits(3);
+        Huff lencode, lit, dist;
+        build(lencode, l, 19);
+        memset(l, 0, sizeof(l));
+        for (int i=0;i<nlen + ndist;){
+          const int s = decode(lencode);
+          if (s < 16) { l[i++] = (uint8_t)s; continue; }
+          uint8_t v = 0;
+          int rep;
+          if (s == 16) { if (!i) fail(where, "repeat with no length"); v = l[i - 1]; rep = 3 + bits(2); }
+          else if (s == 17) rep = 3 + bits(3);
+          else rep = 11 + bits(7);
+          if (i + rep > nlen + ndist) fail(where, "too many lengths");
+          while (rep--) l[i++] = v;
+        }
+        build(lit, l, nlen);
+        build(dist, l + nlen, ndist);
+        codes(lit, dist);
+      } else {
+        fail(where, "bad block type");
+      }
+    } while (!last);
+  }
+};
+
+// -----------------------------------------------------------------------------
+// Frames: one palette index per pixel, 16-entry RGB565 palette
+// -----------------------------------------------------------------------------
+struct Frame {
+  std::string name, src, part;   // part: frame prefix inside src (headers)
+  int w = 0, h = 0;
+  std::vector<uint8_t> px;
+  uint16_t pal[16] = {};
+  uint8_t key = 0;
+  int ox = 0, oy = 0, srcW = 0, srcH = 0;
+  int palId = -1;
+  int keyOf = -1;                // -delta: keyframe index, -1 = stored in full
+  std::vector<uint8_t> delta;
+};
+
+uint32_t be32(const uint8_t* p) { return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]; }
+
+void loadPng(Frame& f, const std::vector<uint8_t>& file) {
+  static const uint8_t SIG[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+  if (file.size() < 8 || memcmp(file.data(), SIG, 8)) fail(f.src, "not a PNG");
+
+  int depth = 0, ctype = 0;
+  std::vector<uint8_t> z, plte, trns;
+  for (size_t p = 8; p + 12 <= file.size();){
+    const uint32_t len = be32(&file[p]);
+    const char* type = (const char*)&file[p + 4];
+    const uint8_t* d = &file[p + 8];
+    if (p + 12 + len > file.size()) fail(f.src, "truncated chunk");
+    if (!memcmp(type, "IHDR", 4)) {
+      f.w = (int)be32(d); f.h = (int)be32(d + 4);
+      depth = d[8]; ctype = d[9];
+      if (d[12]) fail(f.src, "interlaced PNGs are not supported");
+    }
+    else if (!memcmp(type, "PLTE", 4)) plte.assign(d, d + len);
+    else if (!memcmp(type, "tRNS", 4)) trns.assign(d, d + len);
+    else if (!memcmp(type, "IDAT", 4)) z.insert(z.end(), d, d + len);
+    else if (!memcmp(type, "IEND", 4)) break;
+    p += 12 + len;
+  }
+  if (f.w <= 0 || f.h <= 0 || f.w > 4096 || f.h > 4096) fail(f.src, "bad size");
+  int chans;
+  if (ctype == 3 && (depth == 1 || depth == 2 || depth == 4 || depth == 8)) chans = 1;
+  else if (ctype == 2 && depth == 8) chans = 3;
+  else if (ctype == 6 && depth == 8) chans = 4;
+  else fail(f.src, "only indexed, 8-bit RGB and 8-bit RGBA PNGs are supported");
+  if (z.size() < 2) fail(f.src, "no image data");
+
+  std::vector<uint8_t> raw;
+  Inflate(z.data() + 2, z.size() - 2, raw, f.src).run();   // past the zlib header
+
+  // Undo the row filters
+  const size_t bpp = (size_t)((chans * depth + 7) / 8);
+  const size_t stride = (size_t)((f.w * chans * depth + 7) / 8);
+  if (raw.size() < (stride + 1) * (size_t)f.h) fail(f.src, "short image data");
+  std::vector<uint8_t> img(stride * (size_t)f.h);
+  for (int y=0;y<f.h;++y){
+    const uint8_t ft = raw[(stride + 1) * y];
+    const uint8_t* s = &raw[(stride + 1) * y + 1];
+    uint8_t* d = &img[stride * y];
+    const uint8_t* up = y ? d - stride : nullptr;
+    for (size_t x=0;x<stride;++x){
+      const int a = x >= bpp ? d[x - bpp] : 0, b = up ? up[x] : 0, c = (up && x >= bpp) ? up[x - bpp] : 0;
+      int v = s[x];
+      switch (ft){
+        case 0: break;
+        case 1: v += a; break;
+        case 2: v += b; break;
+        case 3: v += (a + b) >> 1; break;
+        case 4: {
+          const int pp = a + b - c, pa = abs(pp - a), pb = abs(pp - b), pc = abs(pp - c);
+          v += (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+          break;
+        }
+        default: fail(f.src, "bad row filter");
+      }
+      d[x] = (uint8_t)v;
+    }
+  }
+
+  // Pixels to RGBA, then to a palette with the transparent color first
+  std::vector<uint32_t> rgba((size_t)f.w * f.h);
+  for (int y=0;y<f.h;++y)
+    for (int x=0;x<f.w;++x){
+      const uint8_t* row = &img[stride * y];
+      uint32_t c;
+      if (chans == 1) {
+        const int bit = x * depth;
+        const int i = (row[bit >> 3] >> (8 - depth - (bit & 7))) & ((1 << depth) - 1);
+        if ((size_t)i * 3 + 2 >= plte.size()) fail(f.src, "index outside PLTE");
+        const uint8_t al = (size_t)i < trns.size() ? trns[i] : 255;
+        c = ((uint32_t)plte[i * 3] << 24) | (plte[i * 3 + 1] << 16) | (plte[i * 3 + 2] << 8) | al;
+      } else {
+        const uint8_t* p = row + x * chans;
+        c = ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | (chans == 4 ? p[3] : 255);
+      }
+      rgba[(size_t)y * f.w + x] = c;
+    }
+  bool anyClear = false;
+  for (uint32_t c : rgba) if ((c & 0xFF) < 128) { anyClear = true; break; }
+  const uint32_t keyRgb = rgba[0] & 0xFFFFFF00u;
+
+  std::vector<uint32_t> cols;   // opaque colors, first seen first
+  f.px.assign(rgba.size(), 0);
+  for (size_t i=0;i<rgba.size();++i){
+    const uint32_t c = rgba[i];
+    if (anyClear ? (c & 0xFF) < 128 : (c & 0xFFFFFF00u) == keyRgb) continue;
+    const uint32_t rgb = c & 0xFFFFFF00u;
+    size_t j = 0;
+    while (j < cols.size() && cols[j] != rgb) ++j;
+    if (j == cols.size()) {
+      if (cols.size() == 15) fail(f.src, "more than 15 opaque colors");
+      cols.push_back(rgb);
+    }
+    f.px[i] = (uint8_t)(j + 1);
+  }
+  f.pal[0] = anyClear ? 0x0000 : rgb565((uint8_t)(keyRgb >> 24), (uint8_t)(keyRgb >> 16), (uint8_t)(keyRgb >> 8));
+  for (size_t j=0;j<cols.size();++j)
+    f.pal[j + 1] = rgb565((uint8_t)(cols[j] >> 24), (uint8_t)(cols[j] >> 16), (uint8_t)(cols[j] >> 8));
+  f.key = 0;
+}
+
+// name as a whole identifier (not the tail of a longer one)
+size_t findName(const std::string& s, const std::string& name) {
+  for (size_t p = s.find(name); p != std::string::npos; p = s.find(name, p + 1))
+    if (!p || !(isalnum((unsigned char)s[p - 1]) || s[p - 1] == '_')) return p;
+  return std::string::npos;
+}
+
+// Numbers following "<name>" up to the closing brace, or the one after '='
+bool scanArray(const std::string& s, const std::string& name, std::vector<long>& out) {
+  size_t p = findName(s, name);
+  if (p == std::string::npos) return false;
+  p = s.find('{', p);
+  const size_t e = s.find('}', p);
+  if (p == std::string::npos || e == std::string::npos) return false;
+  for (const char* c = s.c_str() + p + 1; c < s.c_str() + e;){
+    if (c[0] == '/' && c[1] == '/') { while (c < s.c_str() + e && *c != '\n') ++c; continue; }
+    if (isalpha((unsigned char)*c) || *c == '_') { while (isalnum((unsigned char)*c) || *c == '_') ++c; continue; }
+    char* end;
+    const long v = strtol(c, &end, 0);
+    if (end == c) { ++c; continue; }
+    out.push_back(v);
+    c = end;
+  }
+  return true;
+}
+
+// What "#define name X" names, or name itself
+std::string defined(const std::string& s, const std::string& name) {
+  const size_t def = findName(s, "#define " + name + " ");
+  if (def == std::string::npos) return name;
+  const size_t b = def + 9 + name.size();
+  const size_t e = s.find_first_of(" \t\r\n", b);
+  return s.substr(b, e - b);
+}
+
+// Patch keyframe bytes with a -delta record (layout in the header comment)
+void applyDelta(const Frame& f, std::vector<long>& data, const std::vector<long>& d) {
+  if (d.size() < 4) fail(f.src, "short NAME_delta");
+  const int bpr = (f.w + 1) >> 1, y0 = (int)d[0], n = (int)d[1];
+  const size_t base = 4 + (size_t)n * 4;
+  if (d.size() < base || y0 + n > f.h) fail(f.src, "bad NAME_delta");
+  for (int i=0;i<n;++i){
+    const long* e = &d[4 + (size_t)i * 4];
+    const int b0 = (int)e[0], b1 = (int)e[1];
+    const size_t off = base + (size_t)(e[2] | (e[3] << 8));
+    if (b1 > bpr || b0 > b1 || off + (size_t)(b1 - b0) > d.size()) fail(f.src, "bad NAME_delta row");
+    for (int b=b0;b<b1;++b) data[(size_t)(y0 + i) * bpr + b] = d[off + (size_t)(b - b0)];
+  }
+}
+
+long scanConst(const std::string& s, const std::string& name) {
+  size_t p = findName(s, name + " =");
+  if (p == std::string::npos) return -1;
+  return strtol(s.c_str() + p + name.size() + 2, nullptr, 0);
+}
+
+void loadHeader(Frame& f, const std::vector<uint8_t>& file) {
+  const std::string s(file.begin(), file.end());
+  // The asset prefix is whatever precedes the first "_W =" (png_converter_gui.py
+  // names), unless the input picked a frame
+  std::string pre = f.part;
+  if (pre.empty()) {
+    const size_t p = s.find("_W =");
+    if (p == std::string::npos) fail(f.src, "no NAME_W");
+    size_t b = p;
+    while (b && (isalnum((unsigned char)s[b - 1]) || s[b - 1] == '_')) --b;
+    pre = s.substr(b, p - b);
+  }
+  f.w = (int)scanConst(s, pre + "_W");
+  f.h = (int)scanConst(s, pre + "_H");
+  // Shared palettes and keyframe data are #defines of other arrays
+  std::vector<long> pal, data, delta;
+  if (!scanArray(s, defined(s, pre + "_pal565") + "[", pal) || pal.size() != 16) fail(f.src, "no 16-entry NAME_pal565");
+  if (!scanArray(s, defined(s, pre + "_data") + "[", data)) fail(f.src, "no NAME_data");
+  if (scanArray(s, pre + "_delta[", delta)) applyDelta(f, data, delta);
+  if (f.w <= 0 || f.h <= 0) fail(f.src, "bad size");
+  const int bpr = (f.w + 1) >> 1;
+  if ((int)data.size() != bpr * f.h) fail(f.src, "NAME_data is not 4bpp W x H");
+  for (int i=0;i<16;++i) f.pal[i] = (uint16_t)pal[i];
+  f.px.resize((size_t)f.w * f.h);
+  for (int y=0;y<f.h;++y)
+    for (int x=0;x<f.w;++x){
+      const long v = data[(size_t)y * bpr + (x >> 1)];
+      f.px[(size_t)y * f.w + x] = (uint8_t)((x & 1) ? (v & 15) : ((v >> 4) & 15));
+    }
+  // What CA_Draw::topLeftKeyIndex() picks, unless the header says
+  const long key = scanConst(s, pre + "_KEY");
+  f.key = key >= 0 ? (uint8_t)key : f.px[0];
+  const long ox = scanConst(s, pre + "_OX"), oy = scanConst(s, pre + "_OY");
+  if (ox >= 0 && oy >= 0) { f.ox = (int)ox; f.oy = (int)oy; }
+}
+
+// Transparent index to 0, so cropped frames need no top-left pixel
+void keyToZero(Frame& f) {
+  if (!f.key) return;
+  for (uint8_t& v : f.px) v = v == f.key ? 0 : (v == 0 ? f.key : v);
+  const uint16_t t = f.pal[0]; f.pal[0] = f.pal[f.key]; f.pal[f.key] = t;
+  f.key = 0;
+}
+
+void crop(Frame& f) {
+  int x0 = f.w, y0 = f.h, x1 = -1, y1 = -1;
+  for (int y=0;y<f.h;++y)
+    for (int x=0;x<f.w;++x)
+      if (f.px[(size_t)y * f.w + x]) {
+        if (x < x0) x0 = x;
+        if (x > x1) x1 = x;
+        if (y < y0) y0 = y;
+        if (y > y1) y1 = y;
+      }
+  if (x1 < 0) { x0 = y0 = 0; x1 = y1 = 0; }   // all clear: keep one pixel
+  std::vector<uint8_t> out;
+  for (int y=y0;y<=y1;++y)
+    out.insert(out.end(), f.px.begin() + (size_t)y * f.w + x0, f.px.begin() + (size_t)y * f.w + x1 + 1);
+  f.px.swap(out);
+  f.ox += x0; f.oy += y0;
+  f.w = x1 - x0 + 1; f.h = y1 - y0 + 1;
+}
+
+// -----------------------------------------------------------------------------
+// Palettes shared across the set
+// -----------------------------------------------------------------------------
+struct Palette {
+  uint16_t c[16];
+  uint16_t used = 1;       // entries some frame draws with (bit 0: transparent)
+  std::string owner;       // first frame on it
+  int users = 0;
+  std::string name;        // as emitted
+};
+
+// Map f's drawn indices onto palette p; with grow, unused entries of p take
+// the colors it lacks. False (p unchanged) when they do not fit
+bool mapOnto(const Frame& f, const bool used[16], Palette& p, bool grow, uint8_t map[16]) {
+  uint16_t taken = p.used;
+  uint16_t fill[16];
+  uint16_t fillMask = 0;
+  for (int i=1;i<16;++i){
+    if (!used[i]) continue;
+    int j = 1;
+    while (j < 16 && !(p.c[j] == f.pal[i] && ((taken | fillMask) >> j & 1))) ++j;
+    if (j == 16) {   // not drawn yet: an entry holding the color already, or a free one
+      j = 1;
+      while (j < 16 && ((taken | fillMask) >> j & 1 || p.c[j] != f.pal[i])) ++j;
+      if (j == 16) {
+        if (!grow) return false;
+        j = 1;
+        while (j < 16 && (taken | fillMask) >> j & 1) ++j;
+        if (j == 16) return false;
+      }
+      fill[j] = f.pal[i];
+      fillMask |= (uint16_t)(1u << j);
+    }
+    map[i] = (uint8_t)j;
+  }
+  for (int j=1;j<16;++j) if (fillMask >> j & 1) p.c[j] = fill[j];
+  p.used |= fillMask;
+  return true;
+}
+
+// Renumber f onto a palette of the set, or start a new one with its colors
+void sharePalette(Frame& f, std::vector<Palette>& pals, bool merge) {
+  bool used[16] = {};
+  for (uint8_t v : f.px) used[v] = true;
+  for (int pass = 0; pass < (merge ? 2 : 1); ++pass)
+    for (size_t p=0;p<pals.size();++p){
+      uint8_t map[16] = {};
+      if (!mapOnto(f, used, pals[p], pass == 1, map)) continue;
+      for (uint8_t& v : f.px) v = map[v];
+      memcpy(f.pal, pals[p].c, sizeof(f.pal));
+      f.palId = (int)p;
+      pals[p].users++;
+      return;
+    }
+  Palette np;
+  memcpy(np.c, f.pal, sizeof(np.c));
+  for (int i=1;i<16;++i) if (used[i]) np.used |= (uint16_t)(1u << i);
+  np.owner = f.name;
+  np.users = 1;
+  pals.push_back(np);
+  f.palId = (int)pals.size() - 1;
+}
+
+void putPalette(const Palette& p) {
+  emit("\nconst uint16_t %s[16] PROGMEM = {\n  ", p.name.c_str());
+  for (int i=0;i<16;++i) emit("0x%04X%s", p.c[i], i < 15 ? ", " : "\n};\n");
+}
+
+// -----------------------------------------------------------------------------
+// Encoders
+// -----------------------------------------------------------------------------
+std::vector<uint8_t> pack4(const Frame& f) {
+  const int bpr = (f.w + 1) >> 1;
+  std::vector<uint8_t> out((size_t)bpr * f.h, 0);
+  for (int y=0;y<f.h;++y)
+    for (int x=0;x<f.w;++x)
+      out[(size_t)y * bpr + (x >> 1)] |= (uint8_t)(f.px[(size_t)y * f.w + x] << ((x & 1) ? 0 : 4));
+  return out;
+}
+
+void rle(const Frame& f, std::vector<uint8_t>& out, std::vector<uint16_t>& rowOff) {
+  for (int y=0;y<f.h;++y){
+    rowOff.push_back((uint16_t)out.size());
+    const uint8_t* r = &f.px[(size_t)y * f.w];
+    int end = f.w;
+    while (end && !r[end - 1]) --end;
+    for (int x=0;x<end;){
+      int n = 0;
+      if (!r[x]) {
+        while (x + n < end && !r[x + n] && n < 128) ++n;
+        out.push_back((uint8_t)(n - 1));
+      } else {
+        while (x + n < end && r[x + n] && n < 128) ++n;
+        out.push_back((uint8_t)(0x80 | (n - 1)));
+        for (int i=0;i<n;i+=2)
+          out.push_back((uint8_t)((r[x + i] << 4) | (i + 1 < n ? r[x + i + 1] : 0)));
+      }
+      x += n;
+    }
+  }
+  rowOff.push_back((uint16_t)out.size());
+  if (out.size() > 0xFFFF) fail(f.name, "RLE data over 64 KB");
+}
+
+// f against keyframe k (same size): the -delta record
+std::vector<uint8_t> encodeDelta(const Frame& f, const Frame& k) {
+  const std::vector<uint8_t> pf = pack4(f);
+  const int bpr = (f.w + 1) >> 1;
+  int y0 = -1, y1 = -1, x0 = f.w, x1 = 0;
+  std::vector<int> r0(f.h, 0), r1(f.h, 0);   // differing pixels per row
+  for (int y=0;y<f.h;++y){
+    int a = f.w, b = -1;
+    for (int x=0;x<f.w;++x)
+      if (f.px[(size_t)y * f.w + x] != k.px[(size_t)y * f.w + x]) { if (a == f.w) a = x; b = x; }
+    if (b < 0) continue;
+    r0[y] = a; r1[y] = b + 1;
+    if (y0 < 0) y0 = y;
+    y1 = y;
+    if (a < x0) x0 = a;
+    if (b + 1 > x1) x1 = b + 1;
+  }
+  std::vector<uint8_t> head, bytes;
+  if (y0 < 0) { head = { 0, 0, 0, 0 }; return head; }
+  head = { (uint8_t)y0, (uint8_t)(y1 - y0 + 1), (uint8_t)x0, (uint8_t)x1 };
+  for (int y=y0;y<=y1;++y){
+    const int b0 = r1[y] ? r0[y] >> 1 : 0, b1 = r1[y] ? (r1[y] + 1) >> 1 : 0;
+    const uint16_t off = (uint16_t)bytes.size();
+    head.push_back((uint8_t)b0); head.push_back((uint8_t)b1);
+    head.push_back((uint8_t)off); head.push_back((uint8_t)(off >> 8));
+    bytes.insert(bytes.end(), pf.begin() + (size_t)y * bpr + b0, pf.begin() + (size_t)y * bpr + b1);
+  }
+  head.insert(head.end(), bytes.begin(), bytes.end());
+  return head;
+}
+
+// 8bpp rows for -bg: literals, and runs of 3 or more as one index
+void rleBg(const std::vector<uint8_t>& px, int w, int h, std::vector<uint8_t>& out, std::vector<uint16_t>& rowOff) {
+  for (int y=0;y<h;++y){
+    rowOff.push_back((uint16_t)out.size());
+    const uint8_t* r = &px[(size_t)y * w];
+    int lit = 0;                       // pending literals end at x
+    auto flush = [&](int x){
+      for (int b = x - lit; b < x;){
+        const int n = x - b < 128 ? x - b : 128;
+        out.push_back((uint8_t)(n - 1));
+        out.insert(out.end(), r + b, r + b + n);
+        b += n;
+      }
+      lit = 0;
+    };
+    for (int x=0;x<w;){
+      int n = 1;
+      while (x + n < w && r[x + n] == r[x] && n < 130) ++n;
+      if (n >= 3) { flush(x); out.push_back((uint8_t)(0x80 | (n - 3))); out.push_back(r[x]); x += n; }
+      else { ++lit; ++x; }
+    }
+    flush(w);
+  }
+  rowOff.push_back((uint16_t)out.size());
+  if (out.size() > 0xFFFF) fail("-bg", "RLE data over 64 KB");
+}
+
+void putBytes(const std::vector<uint8_t>& v) {
+  for (size_t i=0;i<v.size();++i)
+    emit( "%s0x%02X%s", (i % 16) ? " " : "  ", v[i], i + 1 < v.size() ? ((i % 16) == 15 ? ",\n" : ",") : "\n");
+}
+
+// -pack: append bytes to the pack, return where they start
+uint32_t appendPack(const std::string& path, const std::vector<uint8_t>& v) {
+  FILE* f = fopen(path.c_str(), "ab");
+  if (!f || fseek(f, 0, SEEK_END) != 0) fail(path, "cannot open pack");
+  const long at = ftell(f);
+  if (at < 0 || fwrite(v.data(), 1, v.size(), f) != v.size()) fail(path, "cannot write pack");
+  fclose(f);
+  return (uint32_t)at;
+}
+
+std::string stem(const std::string& path) {
+  size_t b = path.find_last_of("/\\");
+  b = b == std::string::npos ? 0 : b + 1;
+  const size_t e = path.find('.', b);
+  return path.substr(b, e == std::string::npos ? std::string::npos : e - b);
+}
+
+// -bg input: a QUADRANTS header as one w x h bitmap of indices; returns PREFIX
+std::string loadBg(const std::string& src, int& w, int& h, std::vector<uint8_t>& px) {
+  std::vector<uint8_t> file;
+  if (!readFile(src, file)) fail(src, "cannot read");
+  const std::string s(file.begin(), file.end());
+  const size_t p = s.find("_q0[");
+  if (p == std::string::npos) fail(src, "no PREFIX_q0 (8bpp QUADRANTS header)");
+  size_t b = p;
+  while (b && (isalnum((unsigned char)s[b - 1]) || s[b - 1] == '_')) --b;
+  const std::string pre = s.substr(b, p - b);
+  w = (int)scanConst(s, pre + "_W"); h = (int)scanConst(s, pre + "_H");
+  const int cw = (int)scanConst(s, pre + "_cw"), ch = (int)scanConst(s, pre + "_ch");
+  if (w <= 0 || h <= 0 || cw <= 0 || ch <= 0 || cw >= w || ch >= h) fail(src, "bad PREFIX_W/H/cw/ch");
+  std::vector<long> q[4];
+  for (int i=0;i<4;++i)
+    if (!scanArray(s, pre + "_q" + std::to_string(i) + "[", q[i])) fail(src, "missing quadrant");
+  const size_t qn[4] = { (size_t)cw * ch, (size_t)(w - cw) * ch, (size_t)cw * (h - ch), (size_t)(w - cw) * (h - ch) };
+  for (int i=0;i<4;++i) if (q[i].size() != qn[i]) fail(src, "quadrant size does not match PREFIX_W/H/cw/ch");
+
+  px.assign((size_t)w * h, 0);
+  for (int y=0;y<h;++y)
+    for (int x=0;x<w;++x){
+      const int qi = (y >= ch ? 2 : 0) + (x >= cw ? 1 : 0);
+      const int qx = x >= cw ? x - cw : x, qy = y >= ch ? y - ch : y, qw = x >= cw ? w - cw : cw;
+      px[(size_t)y * w + x] = (uint8_t)q[qi][(size_t)qy * qw + qx];
+    }
+  return pre;
+}
+
+void openGuard(const std::string& set) {
+  std::string guard = set;
+  for (char& c : guard) c = (char)toupper((unsigned char)c);
+  emit("#ifndef %s_H_\n#define %s_H_\n\n#include <Arduino.h>\n\n", guard.c_str(), guard.c_str());
+}
+
+void writeText(const std::string& outPath) {
+  FILE* o = fopen(outPath.c_str(), "wb");
+  if (!o || fwrite(text.data(), 1, text.size(), o) != text.size()) fail(outPath, "cannot write");
+  fclose(o);
+}
+
+// -bg: one quadrant header in, one row-RLE header out
+void compileBg(const std::string& src, const std::string& outPath, const std::string& set, const std::string& cmd,
+               const std::string& packPath) {
+  int w, h;
+  std::vector<uint8_t> px;
+  const std::string pre = loadBg(src, w, h, px);
+  openGuard(set);
+  if (!packPath.empty()) {
+    const uint32_t at = appendPack(packPath, px);
+    emit("// Generated by tools/ca_assetc.cpp (8bpp rows of %s in %s; CA_ASSET_PACK)\n", stem(src).c_str(),
+         packPath.substr(packPath.find_last_of("/\\") + 1).c_str());
+    emit("%s\n", cmd.c_str());
+    emit("// %s_W x %s_H and %s_pal565 are in the source header\n", pre.c_str(), pre.c_str(), pre.c_str());
+    emit("\nconst uint32_t %s_pack = %lu;   // %d x %d indices, row-major\n", pre.c_str(), (unsigned long)at, w, h);
+    emit("\n#endif\n");
+    writeText(outPath);
+    fprintf(stderr, "%-16s %9u B to %s at %lu; flash: 0 B (source %u B)\n", pre.c_str(), (unsigned)px.size(),
+            packPath.c_str(), (unsigned long)at, (unsigned)px.size());
+    return;
+  }
+
+  std::vector<uint8_t> enc;
+  std::vector<uint16_t> off;
+  rleBg(px, w, h, enc, off);
+  emit("// Generated by tools/ca_assetc.cpp (8bpp row RLE of %s; CA_BG_RLE)\n", stem(src).c_str());
+  emit("%s\n", cmd.c_str());
+  emit("// %s_W x %s_H and %s_pal565 are in the source header\n", pre.c_str(), pre.c_str(), pre.c_str());
+  emit("\nconst uint16_t %s_rle_row[%d] PROGMEM = {\n", pre.c_str(), h + 1);
+  for (size_t i=0;i<off.size();++i)
+    emit("%s%u%s", (i % 16) ? " " : "  ", off[i], i + 1 < off.size() ? ((i % 16) == 15 ? ",\n" : ",") : "\n");
+  emit("};\n\nconst uint8_t %s_rle[%u] PROGMEM = {\n", pre.c_str(), (unsigned)enc.size());
+  putBytes(enc);
+  emit("};\n\n#endif\n");
+  writeText(outPath);
+
+  const size_t inBytes = (size_t)w * h, outBytes = enc.size() + off.size() * 2;
+  fprintf(stderr, "%-16s %9s %9s %6s\n", "asset", "source", "output", "rows");
+  fprintf(stderr, "%-16s %9u %9u %6u\n", pre.c_str(), (unsigned)inBytes, (unsigned)enc.size(), (unsigned)off.size() * 2);
+  fprintf(stderr, "flash: %u B (source %u B, %+ld B)\n", (unsigned)outBytes, (unsigned)inBytes,
+          (long)outBytes - (long)inBytes);
+}
+
+// -bg -cycle: every run of source pixels that uses one of the cycled indices,
+// as { row, x0, len }. Runs less than CYCLE_GAP px apart share a span
+const int CYCLE_GAP = 3;
+
+void compileCycle(const std::string& src, const std::string& outPath, const std::string& set, const std::string& cmd,
+                  const std::vector<int>& ring) {
+  int w, h;
+  std::vector<uint8_t> px;
+  const std::string pre = loadBg(src, w, h, px);
+  if (w > 255 || h > 255) fail(src, "-cycle spans are 8-bit");
+  bool cyc[256] = {};
+  for (int i : ring) {
+    if (i < 0 || i > 255 || cyc[i]) fail("-cycle", "indices must be distinct, 0..255");
+    cyc[i] = true;
+  }
+  std::vector<uint8_t> spans;
+  size_t n = 0;                         // source px the spans cover
+  for (int y=0;y<h;++y){
+    int x0 = -1, x1 = 0;                // open span [x0, x1)
+    auto close = [&](){
+      if (x0 < 0) return;
+      spans.push_back((uint8_t)y); spans.push_back((uint8_t)x0); spans.push_back((uint8_t)(x1 - x0));
+      n += (size_t)(x1 - x0);
+    };
+    for (int x=0;x<w;++x){
+      if (!cyc[px[(size_t)y * w + x]]) continue;
+      if (x0 >= 0 && x - x1 < CYCLE_GAP) { x1 = x + 1; continue; }
+      close();
+      x0 = x; x1 = x + 1;
+    }
+    close();
+  }
+  const size_t sn = spans.size() / 3;
+  if (!sn) fail(src, "no pixel uses the -cycle indices");
+
+  openGuard(set);
+  emit("// Generated by tools/ca_assetc.cpp (palette-cycle span map of %s; CA_PalCycle)\n", stem(src).c_str());
+  emit("%s\n", cmd.c_str());
+  emit("// Cycled %s indices, in ring order: each step every entry takes the color\n", pre.c_str());
+  emit("// of the next one. Spans list the %dx%d source pixels that use any of them,\n", w, h);
+  emit("// as { row, x0, len }, sorted by row then x. Runs closer than %d px are merged\n", CYCLE_GAP);
+  emit("const uint8_t %s_CYC_N = %u;\n", pre.c_str(), (unsigned)ring.size());
+  emit("const uint8_t %s_cyc_idx[%s_CYC_N] PROGMEM = {", pre.c_str(), pre.c_str());
+  for (size_t i=0;i<ring.size();++i) emit("%s %d", i ? "," : "", ring[i]);
+  emit(" };\n\nconst uint16_t %s_CYC_SPANS = %u;   // %u source px\n", pre.c_str(), (unsigned)sn, (unsigned)n);
+  emit("const uint8_t %s_cyc_span[%s_CYC_SPANS][3] PROGMEM = {\n", pre.c_str(), pre.c_str());
+  for (size_t i=0;i<sn;++i)
+    emit("%s{%3u,%3u,%2u},%s", (i % 6) ? " " : "  ", spans[i * 3], spans[i * 3 + 1], spans[i * 3 + 2],
+         (i % 6 == 5 || i + 1 == sn) ? "\n" : "");
+  emit("};\n\n#endif\n");
+  writeText(outPath);
+  fprintf(stderr, "%-16s %u spans, %u source px; flash: %u B\n", pre.c_str(), (unsigned)sn, (unsigned)n,
+          (unsigned)(ring.size() + spans.size()));
+}
+
+// -bg -tiles: 8x8 tiles, each stored once (a repeat or a left-right mirror of
+// an earlier tile reuses it), and a map of the picture followed by its mirror
+// image. Map entries are tile numbers, bit 15 = mirrored (CA_TileBg::HFLIP)
+void compileTiles(const std::string& src, const std::string& outPath, const std::string& set, const std::string& cmd) {
+  int w, h;
+  std::vector<uint8_t> px;
+  const std::string pre = loadBg(src, w, h, px);
+  if (w % 8 || h % 8) fail(src, "-tiles needs a size in whole 8x8 tiles");
+  const int tw = w / 8, th = h / 8;
+  std::vector<uint8_t> tiles;           // 64 indices per tile
+  std::vector<uint16_t> map((size_t)tw * 2 * th);
+  for (int ty=0;ty<th;++ty)
+    for (int tx=0;tx<tw;++tx){
+      uint8_t t[64], m[64];
+      for (int y=0;y<8;++y)
+        for (int x=0;x<8;++x){
+          t[y * 8 + x] = px[(size_t)(ty * 8 + y) * w + tx * 8 + x];
+          m[y * 8 + 7 - x] = t[y * 8 + x];
+        }
+      uint16_t e = 0xFFFF;
+      for (size_t i=0; i<tiles.size() / 64 && e == 0xFFFF; ++i){
+        if (!memcmp(&tiles[i * 64], t, 64)) e = (uint16_t)i;
+        else if (!memcmp(&tiles[i * 64], m, 64)) e = (uint16_t)(i | 0x8000);
+      }
+      if (e == 0xFFFF) {
+        e = (uint16_t)(tiles.size() / 64);
+        if (e >= 0x8000) fail(src, "over 32767 tiles");
+        tiles.insert(tiles.end(), t, t + 64);
+      }
+      map[(size_t)ty * tw * 2 + tx] = e;
+      map[(size_t)ty * tw * 2 + tw * 2 - 1 - tx] = (uint16_t)(e ^ 0x8000);
+    }
+  const size_t tn = tiles.size() / 64;
+
+  openGuard(set);
+  emit("// Generated by tools/ca_assetc.cpp (8x8 tiles of %s, deduplicated with mirroring; CA_BG_TILES)\n",
+       stem(src).c_str());
+  emit("%s\n", cmd.c_str());
+  emit("// Tiles are 64 %s palette indices, row-major. Map entries are tile numbers,\n", pre.c_str());
+  emit("// bit 15 set = mirrored left-right (CA_TileBg::HFLIP). The world is the %dx%d picture followed\n", w, h);
+  emit("// by its mirror image: a %dx%d panorama that wraps seamlessly, at the flash\n", w * 2, h);
+  emit("// cost of the picture plus the map\n");
+  emit("const uint16_t %s_TILE_N = %u;   // %u B\n", pre.c_str(), (unsigned)tn, (unsigned)tiles.size());
+  emit("const uint8_t  %s_MAP_W = %d, %s_MAP_H = %d;\n", pre.c_str(), tw * 2, pre.c_str(), th);
+  emit("\nconst uint8_t %s_tiles[%s_TILE_N * 64] PROGMEM = {\n", pre.c_str(), pre.c_str());
+  for (size_t i=0;i<tiles.size();++i){
+    if (!(i % 64)) emit("  // %u\n", (unsigned)(i / 64));
+    emit("%s0x%02X%s", (i % 8) ? " " : "  ", tiles[i], i + 1 < tiles.size() ? ((i % 8) == 7 ? ",\n" : ",") : "\n");
+  }
+  emit("};\n\nconst uint16_t %s_map[%s_MAP_W * %s_MAP_H] PROGMEM = {\n", pre.c_str(), pre.c_str(), pre.c_str());
+  for (size_t i=0;i<map.size();++i)
+    emit("%s0x%04X%s", (i % tw) ? " " : "  ", map[i], i + 1 < map.size() ? ((i % tw) == (size_t)tw - 1 ? ",\n" : ",") : "\n");
+  emit("};\n\n#endif\n");
+  writeText(outPath);
+  fprintf(stderr, "%-16s %u tiles of %u (%u B), map %dx%d (%u B); flash: %u B (source %u B)\n", pre.c_str(),
+          (unsigned)tn, (unsigned)(tw * th), (unsigned)tiles.size(), tw * 2, th, (unsigned)map.size() * 2,
+          (unsigned)(tiles.size() + map.size() * 2), (unsigned)px.size());
+}
+
+void usage() {
+  fprintf(stderr, "usage: ca_assetc -o OUT.h [-set NAME] [-nocrop] [-merge] [-delta] [-rows] [-rle] [-pack FILE]\n"
+                  "                INPUT[=NAME]...\n"
+                  "       ca_assetc -bg -o OUT.h [-set NAME] [-pack FILE] QUADRANTS.h\n"
+                  "       ca_assetc -bg -cycle I,I,... -o OUT.h [-set NAME] QUADRANTS.h\n"
+                  "       ca_assetc -bg -tiles -o OUT.h [-set NAME] QUADRANTS.h\n");
+  exit(2);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  std::string outPath, set, packPath;
+  bool doCrop = true, doRows = false, doRle = false, doMerge = false, doDelta = false, doBg = false, doTiles = false;
+  std::vector<Frame> frames;
+  std::vector<int> ring;
+  for (int i=1;i<argc;++i){
+    const std::string a = argv[i];
+    if (a == "-o" && i + 1 < argc) outPath = argv[++i];
+    else if (a == "-set" && i + 1 < argc) set = argv[++i];
+    else if (a == "-pack" && i + 1 < argc) packPath = argv[++i];
+    else if (a == "-nocrop") doCrop = false;
+    else if (a == "-rows") doRows = true;
+    else if (a == "-rle") doRle = true;
+    else if (a == "-merge") doMerge = true;
+    else if (a == "-delta") doDelta = true;
+    else if (a == "-bg") doBg = true;
+    else if (a == "-tiles") doTiles = true;
+    else if (a == "-cycle" && i + 1 < argc) {
+      for (const char* c = argv[++i]; *c;){
+        char* end;
+        ring.push_back((int)strtol(c, &end, 10));
+        if (end == c || (*end && *end != ',')) usage();
+        c = *end ? end + 1 : end;
+      }
+    }
+    else if (a[0] == '-') usage();
+    else {
+      Frame f;
+      const size_t eq = a.find('=');
+      f.src = a.substr(0, eq);
+      const size_t colon = f.src.find(':', f.src.find_last_of("/\\") + 1);
+      if (colon != std::string::npos) { f.part = f.src.substr(colon + 1); f.src.resize(colon); }
+      f.name = eq != std::string::npos ? a.substr(eq + 1) : (f.part.empty() ? stem(f.src) : f.part);
+      frames.push_back(f);
+    }
+  }
+  if (outPath.empty() || frames.empty() || (doDelta && doRle)) usage();
+  if (!packPath.empty() && !doBg && (doDelta || doRle)) usage();
+  if (set.empty()) set = stem(outPath);
+  std::string cmd = "//  ca_assetc";
+  for (int i=1;i<argc;++i) cmd += std::string(" ") + argv[i];
+  if ((!ring.empty() || doTiles) && (!doBg || !packPath.empty())) usage();
+  if (!ring.empty() && doTiles) usage();
+  if (doBg) {
+    if (frames.size() != 1) usage();
+    if (!ring.empty()) compileCycle(frames[0].src, outPath, set, cmd, ring);
+    else if (doTiles) compileTiles(frames[0].src, outPath, set, cmd);
+    else compileBg(frames[0].src, outPath, set, cmd, packPath);
+    return 0;
+  }
+
+  // Load and normalise
+  std::vector<Palette> pals;
+  size_t inBytes = 0;
+  for (Frame& f : frames){
+    std::vector<uint8_t> file;
+    if (!readFile(f.src, file)) fail(f.src, "cannot read");
+    const size_t dot = f.src.rfind('.');
+    const std::string ext = dot == std::string::npos ? "" : f.src.substr(dot);
+    if (ext == ".png" || ext == ".PNG") loadPng(f, file);
+    else loadHeader(f, file);
+    f.srcW = f.w; f.srcH = f.h;
+    inBytes += (size_t)((f.w + 1) >> 1) * f.h + 32;   // full frame + its own palette
+    keyToZero(f);
+    if (doCrop) crop(f);
+    sharePalette(f, pals, doMerge);
+  }
+
+  // Keyframes: the earlier full frame the delta is smallest against, if small enough
+  for (size_t i=0; doDelta && i<frames.size(); ++i){
+    Frame& f = frames[i];
+    const size_t full = (size_t)((f.w + 1) >> 1) * f.h;
+    for (size_t j=0;j<i;++j){
+      const Frame& k = frames[j];
+      if (k.keyOf >= 0 || k.w != f.w || k.h != f.h || k.palId != f.palId) continue;
+      std::vector<uint8_t> d = encodeDelta(f, k);
+      if (d.size() * 4 >= full * 3 || (f.keyOf >= 0 && d.size() >= f.delta.size())) continue;
+      f.keyOf = (int)j;
+      f.delta.swap(d);
+    }
+  }
+
+  std::string guard = set;
+  for (char& c : guard) c = (char)toupper((unsigned char)c);
+  emit("#ifndef %s_H_\n#define %s_H_\n\n#include <Arduino.h>\n\n", guard.c_str(), guard.c_str());
+  emit("// Generated by tools/ca_assetc.cpp (4bpp, idx0 transparent%s%s%s%s%s)\n",
+          doCrop ? ", cropped" : "", doRows ? ", row bounds" : "", doRle ? ", RLE" : "",
+          packPath.empty() ? "" : ", rows in ", packPath.substr(packPath.find_last_of("/\\") + 1).c_str());
+  emit("%s\n", cmd.c_str());
+
+  // Shared palettes first, named after the set
+  int shared = 0;
+  for (Palette& p : pals){
+    if (p.users > 1) {
+      p.name = set + "_pal565";
+      if (shared++) p.name += "_" + std::to_string(shared);
+      putPalette(p);
+    } else {
+      p.name = p.owner + "_pal565";
+    }
+  }
+
+  size_t outBytes = pals.size() * 32, packBytes = 0;
+  fprintf(stderr, "%-16s %9s %9s %6s %6s %6s\n", "asset", "source", "output", "data", "rows", "pal");
+  for (const Frame& f : frames){
+    const std::string& n = f.name;
+    emit("\nconst uint16_t %s_W = %d;\nconst uint16_t %s_H = %d;\n", n.c_str(), f.w, n.c_str(), f.h);
+    if (doCrop || f.ox || f.oy) emit("const int16_t %s_OX = %d, %s_OY = %d;   // crop origin in the source frame\n",
+                        n.c_str(), f.ox, n.c_str(), f.oy);
+    emit("const uint8_t %s_KEY = 0;\n", n.c_str());
+
+    const Palette& p = pals[f.palId];
+    if (p.users > 1) emit("#define %s_pal565 %s\n", n.c_str(), p.name.c_str());
+    else putPalette(p);
+
+    size_t dataBytes, rowBytes = 0;
+    if (doRle) {
+      std::vector<uint8_t> enc;
+      std::vector<uint16_t> off;
+      rle(f, enc, off);
+      emit("\nconst uint8_t %s_rle[%u] PROGMEM = {\n", n.c_str(), (unsigned)enc.size());
+      putBytes(enc);
+      emit("};\n\nconst uint16_t %s_rle_row[%d] PROGMEM = {\n", n.c_str(), f.h + 1);
+      for (size_t i=0;i<off.size();++i)
+        emit("%s%u%s", (i % 16) ? " " : "  ", off[i], i + 1 < off.size() ? ((i % 16) == 15 ? ",\n" : ",") : "\n");
+      emit("};\n");
+      dataBytes = enc.size() + off.size() * 2;
+    } else if (f.keyOf >= 0) {
+      const std::string& k = frames[f.keyOf].name;
+      emit("#define %s_data %s_data\n", n.c_str(), k.c_str());
+      emit("\nconst uint8_t %s_delta[%u] PROGMEM = {   // against %s\n", n.c_str(), (unsigned)f.delta.size(), k.c_str());
+      putBytes(f.delta);
+      emit("};\n");
+      dataBytes = f.delta.size();
+    } else if (!packPath.empty()) {
+      const std::vector<uint8_t> d = pack4(f);
+      emit("const uint32_t %s_pack = %lu;   // %d rows of %d B\n", n.c_str(),
+           (unsigned long)appendPack(packPath, d), f.h, (f.w + 1) >> 1);
+      packBytes += d.size();
+      dataBytes = 0;
+    } else {
+      if (doDelta) emit("#define %s_delta nullptr   // keyframe\n", n.c_str());
+      const std::vector<uint8_t> d = pack4(f);
+      emit("\nconst uint8_t %s_data[%u] PROGMEM = {\n", n.c_str(), (unsigned)d.size());
+      putBytes(d);
+      emit("};\n");
+      dataBytes = d.size();
+    }
+
+    if (doRows) {
+      emit("\nconst uint8_t %s_rows[%d][2] PROGMEM = {\n", n.c_str(), f.h);
+      for (int y=0;y<f.h;++y){
+        int x0 = 0, x1 = f.w;
+        while (x0 < f.w && !f.px[(size_t)y * f.w + x0]) ++x0;
+        while (x1 > x0 && !f.px[(size_t)y * f.w + x1 - 1]) --x1;
+        if (x0 == f.w) x0 = x1 = 0;
+        emit("%s{%3d,%3d}%s", (y % 8) ? " " : "  ", x0, x1, y + 1 < f.h ? ((y % 8) == 7 ? ",\n" : ",") : "\n");
+      }
+      emit("};\n");
+      rowBytes = (size_t)f.h * 2;
+    }
+    outBytes += dataBytes + rowBytes;
+
+    char src[24], dst[24];
+    snprintf(src, sizeof(src), "%dx%d", f.srcW, f.srcH);
+    snprintf(dst, sizeof(dst), "%dx%d", f.w, f.h);
+    fprintf(stderr, "%-16s %9s %9s %6u %6u %6s%s%s\n", n.c_str(), src, dst, (unsigned)dataBytes, (unsigned)rowBytes,
+            p.users > 1 ? p.name.c_str() : "own", f.keyOf >= 0 ? "  delta of " : "",
+            f.keyOf >= 0 ? frames[f.keyOf].name.c_str() : "");
+  }
+  emit("\n#endif\n");
+  writeText(outPath);
+
+  fprintf(stderr, "palettes: %u in, %u out (%u B)\n", (unsigned)frames.size(), (unsigned)pals.size(),
+          (unsigned)pals.size() * 32);
+  fprintf(stderr, "flash: %u B (sources %u B, %+ld B)\n", (unsigned)outBytes, (unsigned)inBytes,
+          (long)outBytes - (long)inBytes);
+  if (packBytes) fprintf(stderr, "pack: %u B appended to %s\n", (unsigned)packBytes, packPath.c_str());
+  return 0;
+}